@@ -23,6 +23,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 
 #ifdef USE_MPIR
@@ -65,6 +66,42 @@ double timer_stop()
 
 #endif
 
+/* elapsed (wall clock) time for benchmarks that use several threads,
+   where the process time above would add up the time on all cores */
+
+static double _wst;
+
+#if defined( _MSC_VER )
+
+double wall_time()
+{
+  LARGE_INTEGER ll, fr;
+  QueryPerformanceCounter(&ll);
+  QueryPerformanceFrequency(&fr);
+  return (double)ll.QuadPart / (double)fr.QuadPart;
+}
+
+#else
+
+double wall_time()
+{
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + tv.tv_usec * 1.0e-6;
+}
+
+#endif
+
+void wall_timer_start()
+{
+  _wst = wall_time();
+}
+
+double wall_timer_stop()
+{
+  return wall_time() - _wst;
+}
+
 #define period  1000
 
 #define CALIBRATE(res, fun) do {    \
@@ -82,6 +119,23 @@ double timer_stop()
     res = 1000.0 * t / (double)rep; \
   } while (0)
 
+/* the same by the wall clock, for tests that are timed by it */
+
+#define WALL_CALIBRATE(res, fun) do { \
+    unsigned long i, rep = 1;	    \
+    double t;                       \
+    { fun; }				        \
+    do  {				    		\
+	    rep <<= 1;					\
+	    wall_timer_start();    	    \
+	    for(i = 0 ; i < rep ; ++i)  \
+	        { fun; }			  	\
+        t = wall_timer_stop();	    \
+      }							    \
+    while(t < 0.25);			    \
+    res = 1000.0 * t / (double)rep; \
+  } while (0)
+
 double run_multiply(unsigned long long m,  unsigned long long n)
 {
     unsigned long long i, rep;
@@ -396,6 +450,10 @@ double run_pi(unsigned long long m, unsigned long long n)
 
 #include "trn.h"
 
+/* iStrong selects the Lucas test: 0 for the Lucas-Selfridge test, 1 for
+   the strong Lucas-Selfridge test and 2 for the strong test computed by
+   the V-only ladder in trn.c (iLucasV), which gives the same results */
+
 int iBPSW(mpz_t mpz_n, int iStrong)
 {
     int iComp2;
@@ -430,11 +488,57 @@ int iBPSW(mpz_t mpz_n, int iStrong)
      * test.
      */
 
+    if(iStrong == 2)
+        return(iLucasV(mpz_n, 1));
     if(iStrong)
         return(iStrongLucasSelfridge(mpz_n));
     return(iLucasSelfridge(mpz_n));
 }
 
+
+/* the tests run by the bpsw_cand benchmark on a candidate prepared once
+   by iPrPCandInit in trn.c, which finds N - 1 = d * 2^s, the Selfridge
+   parameters and the trial division result that they share; its Lucas
+   tests use the V-only ladder */
+
+#define BPSW_TESTS  7
+
+char *bpsw_names[BPSW_TESTS] =
+    { "prep", "gmp", "fermat", "mr2", "ls", "sls", "xsl" };
+
+double bpsw_ms[BPSW_TESTS];
+
+/* the results of the tests are added up here, so that the compiler
+   cannot discard calls to functions that are declared pure, such as
+   mpz_probab_prime_p */
+
+unsigned long test_sink;
+
+int bpsw_test(PRPCAND *pc, mpz_t mpz_rem, int k)
+{
+    switch(k)
+    {
+    case 1:
+        return mpz_probab_prime_p(pc->mpzN, 13) > 0;
+    case 2:
+        mpz_set_ui(mpz_rem, 2);
+        mpz_powm(mpz_rem, mpz_rem, pc->mpzN, pc->mpzN);
+        return mpz_cmp_ui(mpz_rem, 2) == 0;
+    case 3:
+        return iMillerRabinCand(pc, 2);
+    case 4:
+        return iLucasCand(pc, 0);
+    case 5:
+        return iLucasCand(pc, 1);
+    case 6:
+        return iExtraStrongLucas(pc->mpzN, 3);
+    }
+    return 0;
+}
+
+/* the tests of the bpsw benchmark, each run on its own by the mpz code
+   in trn.c, as in earlier versions */
+
 void bpsw(mpz_t mpz_n)
 {
     int prime, prime_bpsw, prime_sbpsw, prime_mr2, prime_ls, prime_sls, prime_xsl, prime_fermat2;
@@ -451,13 +555,17 @@ void bpsw(mpz_t mpz_n)
     prime_ls = iLucasSelfridge(mpz_n);
     prime_sls = iStrongLucasSelfridge(mpz_n);
     prime_xsl = iExtraStrongLucas(mpz_n, 3);
+    test_sink += prime + prime_bpsw + prime_sbpsw + prime_fermat2
+                    + prime_mr2 + prime_ls + prime_sls + prime_xsl;
+    mpz_clear(mpz_two);
+    mpz_clear(mpz_rem);
 }
 
 double run_bpsw(unsigned long long m)
 {
     gmp_randstate_t rs;
     mpz_t mpz_n;
-    unsigned long long i, t, rep;
+    unsigned long long i, rep;
     double f;
 
     gmp_randinit_default(rs);
@@ -473,10 +581,125 @@ double run_bpsw(unsigned long long m)
         bpsw(mpz_n);
     }
     f = timer_stop();
+
+    mpz_clear(mpz_n);
+    gmp_randclear(rs);
+    return rep / f;
+}
+
+/* the same tests on a prepared candidate, each run once, with the two
+   Baillie-PSW results derived from their outcomes */
+
+void bpsw_cand(mpz_t mpz_n)
+{
+    int k, status, prime[BPSW_TESTS], prime_bpsw, prime_sbpsw;
+    PRPCAND pc;
+    mpz_t mpz_rem;
+
+    mpz_init(mpz_rem);
+    status = iPrPCandInit(&pc, mpz_n, 1000);
+    for( k = 1 ; k < BPSW_TESTS ; ++k )
+        prime[k] = bpsw_test(&pc, mpz_rem, k);
+
+    /* the Baillie-PSW tests with the standard and strong Lucas-Selfridge
+       tests, as iBPSW(mpz_n, 0) and iBPSW(mpz_n, 1) */
+    prime_bpsw = status >= 0 ? status : prime[3] && prime[4];
+    prime_sbpsw = status >= 0 ? status : prime[3] && prime[5];
+    test_sink += prime[1] + prime_bpsw + prime_sbpsw;
+    vPrPCandClear(&pc);
+    mpz_clear(mpz_rem);
+}
+
+double run_bpsw_cand(unsigned long long m)
+{
+    gmp_randstate_t rs;
+    PRPCAND pc;
+    mpz_t mpz_n, mpz_rem;
+    unsigned long long i, rep;
+    double f;
+    int k;
+
+    gmp_randinit_default(rs);
+    mpz_init(mpz_n);
+    mpz_init(mpz_rem);
+    mpz_urandomb(mpz_n, rs, m);
+
+    CALIBRATE(f, bpsw_cand(mpz_n));
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        bpsw_cand(mpz_n);
+    }
+    f = timer_stop();
+
+    /* the time for each test in milliseconds, for bpsw_detail */
+    CALIBRATE(bpsw_ms[0], (iPrPCandInit(&pc, mpz_n, 1000), vPrPCandClear(&pc)));
+    iPrPCandInit(&pc, mpz_n, 1000);
+    for( k = 1 ; k < BPSW_TESTS ; ++k )
+        CALIBRATE(bpsw_ms[k], test_sink += bpsw_test(&pc, mpz_rem, k));
+    vPrPCandClear(&pc);
+
+    mpz_clear(mpz_rem);
+    mpz_clear(mpz_n);
+    gmp_randclear(rs);
+    return rep / f;
+}
+
+void bpsw_detail(void)
+{
+    int k;
+
+    printf("\n%16s", "(ms)");
+    for( k = 0 ; k < BPSW_TESTS ; ++k )
+        printf(" %s %.3g", bpsw_names[k], bpsw_ms[k]);
+}
+
+/* the next prime above a random m-bit number, by mpz_nextprime (n = 1)
+   or by the sieved search vNextPrime in trn.c on all cores (n = 2) */
+
+double run_nextprime(unsigned long long m, unsigned long long n)
+{
+    gmp_randstate_t rs;
+    mpz_t mpz_n, mpz_p;
+    unsigned long long i, rep;
+    double f;
+
+    gmp_randinit_default(rs);
+    mpz_init(mpz_n);
+    mpz_init(mpz_p);
+    mpz_urandomb(mpz_n, rs, m);
+    mpz_setbit(mpz_n, m - 1);
+
+    if(n == 1)
+    {
+        WALL_CALIBRATE(f, mpz_nextprime(mpz_p, mpz_n));
+    }
+    else
+    {
+        WALL_CALIBRATE(f, vNextPrime(mpz_p, mpz_n, 0));
+    }
+    rep = 1 + period / f;
+
+    wall_timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        if(n == 1)
+            mpz_nextprime(mpz_p, mpz_n);
+        else
+            vNextPrime(mpz_p, mpz_n, 0);
+    }
+    f = wall_timer_stop();
+
+    mpz_clear(mpz_p);
+    mpz_clear(mpz_n);
+    gmp_randclear(rs);
     return rep / f;
 }
 
 void wagstaff(int q);
+int wagstaff_mpn(int q);
 
 double run_wagstaff(unsigned long long q)
 {
@@ -505,6 +728,33 @@ double run_wagstaff(unsigned long long q)
     return rep / f;
 }
 
+/* the same test by the mpn-level squaring loop in wagstaff_bench.c */
+
+double run_wagstaff_mpn(unsigned long long q, unsigned long long n)
+{
+    mpz_t mpz_q;
+    unsigned long long i, rep;
+    double f;
+
+    mpz_init_set_ui(mpz_q, q);
+    if (mpz_probab_prime_p(mpz_q, 10) == 0)
+        mpz_nextprime(mpz_q, mpz_q);
+    q = mpz_get_ui(mpz_q);
+
+    CALIBRATE(f, wagstaff_mpn(q));
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        wagstaff_mpn(q);
+    }
+    f = timer_stop();
+
+    mpz_clear(mpz_q);
+    return rep / f;
+}
+
 double run_mersenne(unsigned long long m, unsigned long long n)
 {
     int ret;
@@ -541,123 +791,1287 @@ double run_fermat(unsigned long long m, unsigned long long n)
     return rep / f;
 }
 
+/* the Lucas-Lehmer and Pepin tests with the squaring kernels mod 2^k - 1
+   and 2^k + 1 in mersenne_prime_p.c and fermat_prime_p.c */
 
-void version()
+int mersenne_prime_sqr_p(unsigned long k);
+int fermat_prime_sqr_p(unsigned long k);
+
+double run_mersenne_sqr(unsigned long long m, unsigned long long n)
 {
-  printf("gmp version: %s\n", gmp_version);
-}
+    unsigned long long i, rep;
+    double f;
 
-typedef struct 
-{   unsigned long long a1, a2;
-} pair;
+    CALIBRATE(f, mersenne_prime_sqr_p(m));
+    rep = 1 + period / f;
 
-pair mul_args[] = 
-{
-    { 128, 0 }, { 512, 0 }, { 8192, 0 }, { 131072, 0 }, { 2097152, 0 }, 
-    { 128, 128 }, { 512, 512 }, { 8192, 8192 }, { 131072, 131072 },
-    { 2097152, 2097152 }, { 15000, 10000 }, { 20000, 10000 },
-    { 30000, 10000 }, { 16777216, 512 }, { 16777216, 262144 }, { 0, 0 }
-};
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        mersenne_prime_sqr_p(m);
+    }
+    f = timer_stop();
+    return rep / f;
+}
 
-pair div_args[] = 
+double run_fermat_sqr(unsigned long long m, unsigned long long n)
 {
-    { 8192, 32 }, { 8192, 64 }, { 8192, 128 }, { 8192, 4096 }, { 131072, 65536 },
-    { 8388608, 4194304 }, { 8192, 8064 }, { 16777216, 262144 }, { 0, 0 }
-};
+    unsigned long long i, rep;
+    double f;
 
-pair gcd_args[] =
-{
-    { 128, 128 }, { 512, 512 }, { 8192, 8192 }, { 131072, 131072 }, { 1048576, 1048576 }, { 0, 0 }
-};
+    CALIBRATE(f, fermat_prime_sqr_p(m));
+    rep = 1 + period / f;
 
-pair gcdext_args[] =
-{
-    { 128, 128 }, { 512, 512 }, { 8192, 8192 }, { 131072, 131072 }, { 1048576, 1048576 }, { 0, 0 }
-};
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        fermat_prime_sqr_p(m);
+    }
+    f = timer_stop();
+    return rep / f;
+}
 
-pair root_args[] =
-{
-    { 128, 5 }, { 512, 3 }, { 8192, 11 }, { 131072, 3 }, { 1048576, 3 }, { 0, 0 }
-};
+/* Pepin's test of F_m followed by Suyama's test of the cofactor of its
+   known factors, which reuses the Pepin residue; suyama_detail gives
+   the low 64 bits of the residue, to compare MPIR and GMP builds */
 
-pair fac_ui_args[] =
-{
-    { 128, 0 }, { 1512, 0 }, { 15000, 0 }, { 1000010, 0 }, { 2123456, 0 }, { 0, 0 }
-};
+int fermat_cofactor_prp(unsigned long k, unsigned long long *res);
 
-pair rsa_args[] = 
-{
-    { 512, 0 }, { 1024, 0 }, { 2048, 0 }, { 0, 0 }
-};
+unsigned long long suyama_res64;
+int suyama_prp;
 
-pair pi_args[] = 
+double run_fermat_suyama(unsigned long long m, unsigned long long n)
 {
-    { 10000, 0 }, { 100000, 0 }, { 1000000, 0 }, { 0, 0 }
-};
+    unsigned long long i, rep;
+    double f;
 
-pair bpsw_args[] = 
-{
-    { 1024, 0 }, { 4096, 0 }, { 16384, 0 }, { 0, 0 }
-};
+    CALIBRATE(f, suyama_prp = fermat_cofactor_prp(m, &suyama_res64));
+    rep = 1 + period / f;
 
-pair wagstaff_args[] = 
-{
-    { 1024, 0 }, { 4096, 0 }, { 16384, 0 }, { 0, 0 }
-};
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        suyama_prp = fermat_cofactor_prp(m, &suyama_res64);
+    }
+    f = timer_stop();
+    return rep / f;
+}
 
-pair mersenne_args[] =
+void suyama_detail(void)
 {
-     { 3217, 0 }, { 4253, 0 }, { 4423, 0 } , { 9689, 0 }, { 11213, 0 }, { 0, 0 }
-};
+    printf("\n%16s %016llx %s", "(res64)", suyama_res64,
+                        suyama_prp ? "prp" : "composite");
+}
 
-pair fermat_args[] =
+/* Squarings per second modulo k 2^m + 1 (n = 1), k 2^m - 1 (n = 2), for
+   k = K2N_K, and the Wagstaff number (2^m + 1) / 3 (n = 3), as in the
+   Proth and base 3 probable prime tests in proth_prime_p.c, timed over
+   K2N_ITERS squarings */
+
+#define K2N_K       1095
+#define K2N_ITERS   256
+
+void k2n_squarings(unsigned long k, unsigned long n, int s, unsigned long i);
+
+double run_proth(unsigned long long m, unsigned long long n)
 {
-    { 8, 0 }, { 10, 0 }, { 12, 0 }, { 0, 0 }
-};
+    unsigned long long i, rep;
+    unsigned long k = n == 3 ? 0 : K2N_K;
+    int s = n == 2 ? -1 : 1;
+    double f;
 
+    CALIBRATE(f, k2n_squarings(k, (unsigned long)m, s, K2N_ITERS));
+    rep = 1 + period / f;
 
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        k2n_squarings(k, (unsigned long)m, s, K2N_ITERS);
+    }
+    f = timer_stop();
+    return K2N_ITERS * (rep / f);
+}
 
-typedef double (*fptr)(unsigned long long, unsigned long long);
+#include "ibdwt.h"
 
-typedef struct
-{   char *name;
-    fptr fp;
-    int  npar;
-    pair *a_ptr;
-    double  wght;
-} scat_str;
+/* the Lucas-Lehmer test of 2^m - 1 with the IBDWT squaring in ibdwt.c */
 
-typedef struct 
+double run_mersenne_fft(unsigned long long m, unsigned long long n)
 {
-    char    *name;
-    scat_str  sc_arr[7];
-} cat_str;
+    unsigned long long i, rep;
+    double f;
 
-cat_str cc_str[] = 
-{ 
-    { "base",
-        { 
-            { "multiply", run_multiply, 2, mul_args, 1.0  },
-            { "divide", run_divide, 2, div_args, 1.0 },
-            { "gcd", run_gcd, 2, gcd_args, 0.5 },
-            { "gcdext", run_gcdext, 2, gcdext_args, 0.5 },
-            { "root", run_root, 2, root_args, 0.3 }, 
-            { "fac_ui", run_fac_ui, 2, fac_ui_args, 0.2 }, 
-            { 0 }
-        }
-    },
-    {   "app",
-        {
-            { "rsa", run_rsa, 1, rsa_args, 1.0 },
-            { "pi", run_pi, 1, pi_args, 1.0 },
-            { "bpsw", run_bpsw, 1, bpsw_args, 1.0 },
-            { "wagstaff", run_wagstaff, 1, wagstaff_args, 1.0 },
-            { "mersenne", run_mersenne, 1, mersenne_args, 1.0 },
-            { "fermat", run_fermat, 1, fermat_args, 1.0 },
-            
+    CALIBRATE(f, dwt_mersenne_prime_p(m));
+    rep = 1 + period / f;
 
-            { 0 }
-        }
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        dwt_mersenne_prime_p(m);
+    }
+    f = timer_stop();
+    return rep / f;
+}
+
+/* Lucas-Lehmer iterations per second with the IBDWT squaring, for 2^m - 1
+   with exponents too large for the whole test to be run here */
+
+double run_ll_fft(unsigned long long m, unsigned long long n)
+{
+    dwt_ctx c;
+    unsigned long long i, rep;
+    double f;
+
+    if(!dwt_init(&c, m, -1, 0))
+        return 0.0;
+    dwt_set_ui(&c, 4);
+
+    /* the residue has its full size after log2(m) iterations */
+    for( i = m ; i > 1 ; i >>= 1 )
+        dwt_square(&c, 2);
+    CALIBRATE(f, dwt_square(&c, 2));
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        dwt_square(&c, 2);
+    }
+    f = timer_stop();
+
+    dwt_clear(&c);
+    return rep / f;
+}
+
+/* Count the primes in (m - n, m] with the segmented sieve in trn.c;
+   the result is in primes per second rather than calls per second. */
+
+double run_sieve(unsigned long long m, unsigned long long n)
+{
+    unsigned long long i, rep, cnt;
+    double f;
+
+    CALIBRATE(f, cnt = ullPrimeCount(m - n + 1, m));
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        cnt = ullPrimeCount(m - n + 1, m);
+    }
+    f = timer_stop();
+    return cnt * (rep / f);
+}
+
+/* the m-bit prime used by the tests below, which is kept since finding a
+   large prime takes much longer than testing it */
+
+#define MAX_BENCH_PRIMES    8
+
+void bench_prime(mpz_t mpz_n, unsigned long long m)
+{
+    static mpz_t mpz_p[MAX_BENCH_PRIMES];
+    static unsigned long long m_p[MAX_BENCH_PRIMES];
+    gmp_randstate_t rs;
+    int i;
+
+    for( i = 0 ; i < MAX_BENCH_PRIMES && m_p[i] ; ++i )
+        if(m_p[i] == m)
+        {
+            mpz_set(mpz_n, mpz_p[i]);
+            return;
+        }
+
+    gmp_randinit_default(rs);
+    mpz_urandomb(mpz_n, rs, m);
+    mpz_setbit(mpz_n, m - 1);
+    mpz_nextprime(mpz_n, mpz_n);
+    gmp_randclear(rs);
+    if(i < MAX_BENCH_PRIMES)
+    {
+        mpz_init_set(mpz_p[i], mpz_n);
+        m_p[i] = m;
+    }
+}
+
+/* Strong Lucas-Selfridge test of an m-bit prime, by the mpz routine
+   (n = 1), the Montgomery engine (n = 2) or the V-only ladder (n = 3)
+   in trn.c; the result is in bits of N per second */
+
+double run_lucas(unsigned long long m, unsigned long long n)
+{
+    mpz_t mpz_n;
+    unsigned long long i, rep;
+    double f;
+
+    mpz_init(mpz_n);
+    bench_prime(mpz_n, m);
+
+    if(n == 1)
+    {
+        CALIBRATE(f, iStrongLucasSelfridge(mpz_n));
+    }
+    else if(n == 2)
+    {
+        CALIBRATE(f, iLucasMont(mpz_n, 1));
+    }
+    else
+    {
+        CALIBRATE(f, iLucasV(mpz_n, 1));
+    }
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        if(n == 1)
+            iStrongLucasSelfridge(mpz_n);
+        else if(n == 2)
+            iLucasMont(mpz_n, 1);
+        else
+            iLucasV(mpz_n, 1);
+    }
+    f = timer_stop();
+
+    mpz_clear(mpz_n);
+    return m * (rep / f);
+}
+
+/* The primality primitives in trn.c (and GMP) on their own, on an m-bit
+   prime, so that all of them run to completion. The result is in bits
+   of N per second; ptest_detail prints it as nanoseconds per bit. */
+
+double ptest_ns;
+
+double run_ptest(unsigned long long m, int k)
+{
+    mpz_t mpz_n;
+    unsigned long long i, rep;
+    double f;
+
+    mpz_init(mpz_n);
+    bench_prime(mpz_n, m);
+
+    switch(k)
+    {
+    case 0: CALIBRATE(f, test_sink += iMillerRabin(mpz_n, 2)); break;
+    case 1: CALIBRATE(f, test_sink += iLucasSelfridge(mpz_n)); break;
+    case 2: CALIBRATE(f, test_sink += iStrongLucasSelfridge(mpz_n)); break;
+    case 3: CALIBRATE(f, test_sink += iExtraStrongLucas(mpz_n, 3)); break;
+    case 4: CALIBRATE(f, test_sink += ulPrmDiv(mpz_n, 65536)); break;
+    default: CALIBRATE(f, test_sink += mpz_probab_prime_p(mpz_n, 13));
+    }
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        switch(k)
+        {
+        case 0: test_sink += iMillerRabin(mpz_n, 2); break;
+        case 1: test_sink += iLucasSelfridge(mpz_n); break;
+        case 2: test_sink += iStrongLucasSelfridge(mpz_n); break;
+        case 3: test_sink += iExtraStrongLucas(mpz_n, 3); break;
+        case 4: test_sink += ulPrmDiv(mpz_n, 65536); break;
+        default: test_sink += mpz_probab_prime_p(mpz_n, 13);
+        }
+    }
+    f = timer_stop();
+
+    mpz_clear(mpz_n);
+    ptest_ns = 1.0e9 * f / (rep * (double)m);
+    return m * (rep / f);
+}
+
+double run_mr(unsigned long long m, unsigned long long n)
+{
+    return run_ptest(m, 0);
+}
+
+double run_ls(unsigned long long m, unsigned long long n)
+{
+    return run_ptest(m, 1);
+}
+
+double run_sls(unsigned long long m, unsigned long long n)
+{
+    return run_ptest(m, 2);
+}
+
+double run_xsl(unsigned long long m, unsigned long long n)
+{
+    return run_ptest(m, 3);
+}
+
+double run_prmdiv(unsigned long long m, unsigned long long n)
+{
+    return run_ptest(m, 4);
+}
+
+double run_probab_prime(unsigned long long m, unsigned long long n)
+{
+    return run_ptest(m, 5);
+}
+
+void ptest_detail(void)
+{
+    printf("\n%16s %.3g", "(ns/bit)", ptest_ns);
+}
+
+/* iIsPrime64 on random m-bit numbers, by the mpz path that it used to
+   take beyond trial division (n = 1), or as it is now (n = 2), with
+   single-word arithmetic where the compiler has unsigned __int128 */
+
+#define PRIME64_INPUTS  1024
+
+int is_prime64_mpz(uint64_t ull)
+{
+    mpz_t mpz_n;
+    int r;
+
+    mpz_init2(mpz_n, 2 * mp_bits_per_limb);
+    __mpz_set_ull(mpz_n, ull);
+    r = iPrP(mpz_n, 1, 1000);
+    mpz_clear(mpz_n);
+    return r;
+}
+
+unsigned long prime64_all(uint64_t *ull, unsigned long long n)
+{
+    unsigned long i, c = 0;
+
+    for( i = 0 ; i < PRIME64_INPUTS ; ++i )
+        c += n == 1 ? is_prime64_mpz(ull[i]) : iIsPrime64(ull[i], 1000);
+    return c;
+}
+
+double run_prime64(unsigned long long m, unsigned long long n)
+{
+    gmp_randstate_t rs;
+    mpz_t mpz_n;
+    uint64_t ull[PRIME64_INPUTS];
+    unsigned long long i, rep;
+    double f;
+
+    gmp_randinit_default(rs);
+    mpz_init(mpz_n);
+    for( i = 0 ; i < PRIME64_INPUTS ; ++i )
+    {
+        mpz_urandomb(mpz_n, rs, m);
+        mpz_setbit(mpz_n, m - 1);
+        ull[i] = __mpz_get_ull(mpz_n);
+    }
+
+    CALIBRATE(f, test_sink += prime64_all(ull, n));
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        test_sink += prime64_all(ull, n);
+    }
+    f = timer_stop();
+
+    mpz_clear(mpz_n);
+    gmp_randclear(rs);
+    return PRIME64_INPUTS * (rep / f);
+}
+
+#include "threads.h"
+
+#define SIEVE_MT_SPAN   1000000000ull
+
+/* Count the primes in (m - SIEVE_MT_SPAN, m] on n threads, timed by
+   the wall clock; run for n = 1, 2, 4, .. cores to show the scaling */
+
+double run_sieve_mt(unsigned long long m, unsigned long long n)
+{
+    unsigned long long i, rep, cnt;
+    double f;
+
+    wall_timer_start();
+    cnt = ullPrimeCountMT(m - SIEVE_MT_SPAN + 1, m, (unsigned int)n);
+    f = wall_timer_stop();
+    rep = 1 + period / (1000.0 * f);
+
+    wall_timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        cnt = ullPrimeCountMT(m - SIEVE_MT_SPAN + 1, m, (unsigned int)n);
+    }
+    f = wall_timer_stop();
+    return cnt * (rep / f);
+}
+
+/* Expressions of the kinds given on the command line of the trn programs
+   evaluated by iEvalExprMPZCtx, m passes over the list split between n
+   threads, each with a context of its own (expressions/second, wall
+   clock). No expression in the list repeats a large result of another,
+   so each pass has a new context for the rate without the result cache,
+   and the rate with one context kept over all the passes of a thread,
+   which then come from the cache, is given apart */
+
+char *expr_list[] =
+{
+    "1693182318746371", "587*43#/2310-1234", "1009*1009#/30030-2908",
+    "2^127-1", "10^50+151", "3*2^200+1", "fib(300)", "(7^40+1)/2",
+    "gcd(2^60-1,3^40-1)", "M(89)", "F(7)", "100!+1", "2^64%1000003", 0
+};
+
+typedef struct
+{
+    unsigned long long  passes;
+    unsigned int        n_threads;
+    int                 cached;         /* one context for all passes */
+    unsigned long      *count;          /* the results of each thread */
+} expr_job;
+
+void expr_thread(void *arg, unsigned int index)
+{
+    expr_job *ej = (expr_job*)arg;
+    EXPRCTX ec;
+    mpz_t r;
+    unsigned long long i;
+    char **s;
+
+    vExprCtxInit(&ec, 1 + index);
+    mpz_init(r);
+    ej->count[index] = 0;
+    for( i = index ; i < ej->passes ; i += ej->n_threads )
+    {
+        if(!ej->cached && i != index)
+        {
+            vExprCtxClear(&ec);
+            vExprCtxInit(&ec, 1 + index);
+        }
+        for( s = expr_list ; *s ; ++s )
+            if(iEvalExprMPZCtx(&ec, r, *s) == 0)
+                ej->count[index] += mpz_size(r) != 0;
+    }
+    mpz_clear(r);
+    vExprCtxClear(&ec);
+}
+
+unsigned long expr_run(unsigned long long m, unsigned int n, int cached)
+{
+    expr_job ej;
+    unsigned long c = 0;
+    unsigned int i;
+
+    ej.passes = m;
+    ej.n_threads = n;
+    ej.cached = cached;
+    ej.count = (unsigned long*)malloc(n * sizeof(unsigned long));
+    run_threads(expr_thread, &ej, n);
+    for( i = 0 ; i < n ; ++i )
+        c += ej.count[i];
+    free(ej.count);
+    return c;
+}
+
+double expr_rate(unsigned long long m, unsigned long long n, int cached)
+{
+    unsigned long long i, rep;
+    double f;
+
+    wall_timer_start();
+    test_sink += expr_run(m, (unsigned int)n, cached);
+    f = wall_timer_stop();
+    rep = 1 + period / (1000.0 * f);
+
+    wall_timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        test_sink += expr_run(m, (unsigned int)n, cached);
+    }
+    f = wall_timer_stop();
+    return m * (sizeof(expr_list) / sizeof(expr_list[0]) - 1) * (rep / f);
+}
+
+double run_expr(unsigned long long m, unsigned long long n)
+{
+    return expr_rate(m, n, 0);
+}
+
+double run_expr_cached(unsigned long long m, unsigned long long n)
+{
+    return expr_rate(m, n, 1);
+}
+
+/* Evaluations per second of the form m over EXPR_PROG_VALUES values of
+   its parameter k, by iEvalExprMPZCtx on the form printed with each
+   value (n = 1) or by a program compiled once by iExprProgCompile
+   (n = 2) */
+
+#define EXPR_PROG_VALUES    1000
+
+typedef struct
+{
+    char   *form;       /* for iExprProgCompile, with variable k */
+    char   *fmt;        /* the same for sprintf */
+} expr_form;
+
+expr_form expr_forms[] =
+{
+    { "k*2^1024-1", "%lu*2^1024-1" },
+    { "k*1009#/30030-2908", "%lu*1009#/30030-2908" },
+    { "(k^41+1)/(k+1)", "(%lu^41+1)/(%lu+1)" },
+    { "(3*2^k+1)%1000003", "(3*2^%lu+1)%%1000003" }
+};
+
+unsigned long expr_prog_all(EXPRCTX *pec, EXPRPROG *pep, mpz_t r,
+                                unsigned long long m, unsigned long long n)
+{
+    char buf[64];
+    unsigned long k, c = 0;
+
+    for( k = 1 ; k <= EXPR_PROG_VALUES ; ++k )
+        if(n == 1)
+        {
+            sprintf(buf, expr_forms[m - 1].fmt, k, k);
+            c += iEvalExprMPZCtx(pec, r, buf) == 0;
+        }
+        else
+        {
+            mpz_set_ui(pep->mpzVar[0], k);
+            c += iExprProgEvalMPZ(pec, pep, r) == 0;
+        }
+    return c;
+}
+
+double run_expr_prog(unsigned long long m, unsigned long long n)
+{
+    EXPRCTX ec;
+    EXPRPROG ep;
+    mpz_t r;
+    unsigned long long i, rep;
+    double f;
+
+    vExprCtxInit(&ec, 1);
+    if(iExprProgCompile(&ec, &ep, expr_forms[m - 1].form, "k"))
+    {
+        vExprCtxClear(&ec);
+        return 0.0;
+    }
+    mpz_init(r);
+
+    CALIBRATE(f, test_sink += expr_prog_all(&ec, &ep, r, m, n));
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        test_sink += expr_prog_all(&ec, &ep, r, m, n);
+    }
+    f = timer_stop();
+
+    mpz_clear(r);
+    vExprProgClear(&ep);
+    vExprCtxClear(&ec);
+    return EXPR_PROG_VALUES * (rep / f);
+}
+
+/* Base 3 probable prime test iterations per second for 2^m - 1 with the
+   IBDWT squaring, with Gerbicz checks on blocks of n iterations (n = 0
+   for none), timed over n^2 iterations, which include one check;
+   prp_detail gives the overhead of the checks on the rate without them,
+   which is timed at the same exponent */
+
+double prp_overhead;
+
+double prp_fft_rate(dwt_ctx *c, unsigned long long n, unsigned long long it)
+{
+    dwt_gerbicz g;
+    unsigned long long i, rep;
+    double f;
+
+    dwt_set_ui(c, 3);
+    if(!dwt_gerbicz_init(&g, c, n, 0))
+        return 0.0;
+    dwt_gerbicz_run(&g, 64);
+
+    CALIBRATE(f, dwt_gerbicz_run(&g, g.i + it));
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        dwt_gerbicz_run(&g, g.i + it);
+    }
+    f = timer_stop();
+
+    dwt_gerbicz_clear(&g);
+    return it * (rep / f);
+}
+
+double run_prp_fft(unsigned long long m, unsigned long long n)
+{
+    dwt_ctx c;
+    unsigned long long it = n ? n * n : 100;
+    double f, f0;
+
+    if(!dwt_init(&c, m, -1, 0))
+        return 0.0;
+    f = prp_fft_rate(&c, n, it);
+    f0 = n ? prp_fft_rate(&c, 0, it) : f;
+    dwt_clear(&c);
+    prp_overhead = f > 0.0 && f0 > 0.0 ? 100.0 * (f0 / f - 1.0) : 0.0;
+    return f;
+}
+
+void prp_detail(void)
+{
+    printf("\n%16s %.1f%%", "(checks)", prp_overhead);
+}
+
+/* Lucas-Lehmer (s = -1) or Pepin (s = 1) iterations per second of wall
+   clock time with the IBDWT squaring modulo 2^m + s on n threads (or
+   the largest power of 2 below n) */
+
+double run_dwt_mt(unsigned long long m, unsigned long long n, int s)
+{
+    dwt_ctx c;
+    unsigned long long i, rep;
+    double f;
+
+    if(!dwt_init(&c, m, s, 0))
+        return 0.0;
+    dwt_set_threads(&c, (unsigned int)n);
+    dwt_set_ui(&c, s < 0 ? 4 : 3);
+    for( i = m ; i > 1 ; i >>= 1 )
+        dwt_square(&c, s < 0 ? 2 : 0);
+
+    wall_timer_start();
+    dwt_square(&c, s < 0 ? 2 : 0);
+    f = wall_timer_stop();
+    rep = 1 + period / (1000.0 * f);
+
+    wall_timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        dwt_square(&c, s < 0 ? 2 : 0);
+    }
+    f = wall_timer_stop();
+
+    dwt_clear(&c);
+    return rep / f;
+}
+
+/* A search for Mersenne primes with exponents in (m / 2, m], by trial
+   factoring to 2^MSEARCH_TF_BITS and the Lucas-Lehmer test of the
+   exponents that survive it, on n threads (exponents per second of wall
+   clock time) */
+
+#define MSEARCH_TF_BITS 24
+
+unsigned long mersenne_search(unsigned long p0, unsigned long p1,
+    unsigned int tf_bits, unsigned int nthreads, unsigned long *tried,
+                                                   unsigned long *ll);
+
+double run_mersenne_search(unsigned long long m, unsigned long long n)
+{
+    unsigned long long i, rep;
+    unsigned long cnt;
+    double f;
+
+    wall_timer_start();
+    mersenne_search((unsigned long)(m / 2 + 1), (unsigned long)m,
+                        MSEARCH_TF_BITS, (unsigned int)n, &cnt, 0);
+    f = wall_timer_stop();
+    rep = 1 + period / (1000.0 * f);
+
+    wall_timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        test_sink += mersenne_search((unsigned long)(m / 2 + 1),
+               (unsigned long)m, MSEARCH_TF_BITS, (unsigned int)n, &cnt, 0);
+    }
+    f = wall_timer_stop();
+    return cnt * (rep / f);
+}
+
+double run_ll_fft_mt(unsigned long long m, unsigned long long n)
+{
+    return run_dwt_mt(m, n, -1);
+}
+
+double run_pepin_fft_mt(unsigned long long m, unsigned long long n)
+{
+    return run_dwt_mt(m, n, 1);
+}
+
+/* The scaling mode ('bench_two scaling'): the time of one multiplication
+   by each of the special form kernels for 2^SCALING_MIN to 2^SCALING_MAX
+   bits, and the fit of these times to t = a n^b log(n)^c by least squares
+   on their logarithms. The Lucas-Lehmer and Pepin tests take n of these
+   for n bits, so with an FFT multiplication (b = c = 1) their time grows
+   by a little over 4 for each doubling of n, as noted in fermat_prime_p.c.
+   Sizes whose time is more than SCALING_DEV percent away from the fitted
+   curve are marked, as they show where a kernel leaves its expected
+   scaling. */
+
+#define SCALING_MIN  10
+#define SCALING_MAX  22
+#define SCALING_DEV  20.0
+
+#if !defined( __MPIR_VERSION ) || __MPIR_VERSION < 1 || ( __MPIR_VERSION == 1 && __MPIR_VERSION_MINOR < 3 )
+void mpn_mulmod_2expm1(mp_ptr xp, mp_ptr yp, mp_ptr zp, mp_size_t k2, mp_ptr tp);
+int mpn_mulmod_2expp1(mp_ptr xp, mp_ptr yp, mp_ptr zp, int c, mp_size_t k2, mp_ptr tp);
+#endif
+
+/* milliseconds for one multiplication modulo 2^m - 1 (s = -1) or 2^m + 1
+   (s = 1) by the mpn kernels (dwt = 0) or the IBDWT (dwt = 1) */
+
+double scaling_time(unsigned long m, int s, int dwt)
+{
+    mp_size_t n = (m + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+    mp_ptr xp, yp, zp, tp;
+    dwt_ctx c;
+    double f;
+
+    if(dwt)
+    {
+        if(!dwt_init(&c, s < 0 ? m - 1 : m, s, 0))
+            return 0.0;
+        dwt_set_ui(&c, 3);
+        CALIBRATE(f, dwt_square(&c, 0));
+        dwt_clear(&c);
+        return f;
+    }
+    xp = (mp_ptr)malloc((8 * n + 5 * 64) * sizeof(mp_limb_t));
+    yp = xp + n;
+    zp = yp + n;
+    tp = zp + n;
+    mpn_random(yp, n);
+    mpn_random(zp, n);
+    if(m % GMP_NUMB_BITS)
+    {
+        yp[n - 1] &= ((mp_limb_t)1 << (m % GMP_NUMB_BITS)) - 1;
+        zp[n - 1] &= ((mp_limb_t)1 << (m % GMP_NUMB_BITS)) - 1;
+    }
+    if(s < 0)
+        CALIBRATE(f, mpn_mulmod_2expm1(xp, yp, zp, m, tp));
+    else
+        CALIBRATE(f, mpn_mulmod_2expp1(xp, yp, zp, 0, m, tp));
+    free(xp);
+    return f;
+}
+
+/* fit log(t) = log(a) + b log(n) + c log(log(n)) to the np points by
+   solving the normal equations */
+
+void scaling_fit(double *n, double *t, int np, double *a, double *b, double *c)
+{
+    double m[3][4] = { { 0.0 } }, x[3], r;
+    int i, j, k;
+
+    for( i = 0 ; i < np ; ++i )
+    {
+        x[0] = 1.0;
+        x[1] = log(n[i]);
+        x[2] = log(log(n[i]));
+        for( j = 0 ; j < 3 ; ++j )
+        {
+            for( k = 0 ; k < 3 ; ++k )
+                m[j][k] += x[j] * x[k];
+            m[j][3] += x[j] * log(t[i]);
+        }
+    }
+    for( j = 0 ; j < 3 ; ++j )
+        for( k = j + 1 ; k < 3 ; ++k )
+        {
+            r = m[k][j] / m[j][j];
+            for( i = j ; i < 4 ; ++i )
+                m[k][i] -= r * m[j][i];
+        }
+    for( j = 2 ; j >= 0 ; --j )
+    {
+        for( k = j + 1 ; k < 3 ; ++k )
+            m[j][3] -= m[j][k] * x[k];
+        x[j] = m[j][3] / m[j][j];
+    }
+    *a = exp(x[0]);
+    *b = x[1];
+    *c = x[2];
+}
+
+void run_scaling(void)
+{
+    static const struct
+    {   char *name;
+        int s, dwt;
+    } ks[] =
+    {
+        { "mulmod_2expm1", -1, 0 },
+        { "mulmod_2expp1",  1, 0 },
+        { "dwt_mersenne",  -1, 1 },
+        { "dwt_fermat",     1, 1 },
+        { 0 }
+    };
+    double n[SCALING_MAX - SCALING_MIN + 1], t[SCALING_MAX - SCALING_MIN + 1];
+    double a, b, c, d;
+    int i, j, np;
+
+    printf("\n Scaling (milliseconds per multiplication)");
+    for( i = 0 ; ks[i].name ; ++i )
+    {
+        printf("\n  Kernel %s", ks[i].name);
+        for( j = SCALING_MIN, np = 0 ; j <= SCALING_MAX ; ++j )
+        {
+            n[np] = ldexp(1.0, j);
+            t[np] = scaling_time(1ul << j, ks[i].s, ks[i].dwt);
+            if(t[np] > 0.0)
+                ++np;
+        }
+        scaling_fit(n, t, np, &a, &b, &c);
+        for( j = 0 ; j < np ; ++j )
+        {
+            d = 100.0 * (t[j] / (a * pow(n[j], b) * pow(log(n[j]), c)) - 1.0);
+            printf("\n   %9.0f %12.4g", n[j], t[j]);
+            if(j)
+                printf("  x%.2f", t[j] / t[j - 1]);
+            else
+                printf("       ");
+            printf(" %+7.1f%%%s", d, fabs(d) > SCALING_DEV ? " *" : "");
+        }
+        /* b and c are close to collinear over a range of sizes, so give
+           the exponent of the fitted curve between its ends as well */
+        d = b + c * log(log(n[np - 1]) / log(n[0])) / log(n[np - 1] / n[0]);
+        printf("\n   t = %.3g n^%.3f log(n)^%.3f, exponent %.3f (tests x%.2f"
+                        " per doubling)", a, b, c, d, 2.0 * pow(2.0, d));
+    }
+    printf("\n\n");
+}
+
+#define BPSW_BATCH  1024
+
+/* Test BPSW_BATCH consecutive odd m-bit numbers, as in a prime gap
+   search, with the batch BPSW test on all cores; the result is in
+   candidates per second of wall clock time */
+
+double run_bpsw_batch(unsigned long long m, unsigned long long n)
+{
+    gmp_randstate_t rs;
+    mpz_t x[BPSW_BATCH];
+    int res[BPSW_BATCH];
+    unsigned long long i, rep;
+    double f;
+
+    gmp_randinit_default(rs);
+    mpz_init(x[0]);
+    mpz_urandomb(x[0], rs, m);
+    mpz_setbit(x[0], m - 1);
+    mpz_setbit(x[0], 0);
+    for( i = 1 ; i < BPSW_BATCH ; ++i )
+    {
+        mpz_init(x[i]);
+        mpz_add_ui(x[i], x[i - 1], 2);
+    }
+
+    wall_timer_start();
+    vPrPBatch(x, res, BPSW_BATCH, 0, 0);
+    f = wall_timer_stop();
+    rep = 1 + period / (1000.0 * f);
+
+    wall_timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        vPrPBatch(x, res, BPSW_BATCH, 0, 0);
+    }
+    f = wall_timer_stop();
+
+    for( i = 0 ; i < BPSW_BATCH ; ++i )
+        mpz_clear(x[i]);
+    gmp_randclear(rs);
+    return BPSW_BATCH * (rep / f);
+}
+
+/* The workload for bpsw_class, BPSW_POOL numbers of one class: m-bit
+   primes (n = 1), the composite Mersenne numbers 2^p - 1 for the
+   largest primes p <= m that give one (n = 2), or products of two
+   m/2-bit primes (n = 3). The Mersenne numbers are thus only about m
+   bits (509, 503, 499 and 487 bits for m = 512), and bpsw_class_detail
+   prints the sizes of each pool. None of them has a factor below 1000,
+   and the first two classes also pass the Miller-Rabin test, so the
+   Lucas test runs on them as well. A random odd number rarely gets past
+   trial division. */
+
+#define BPSW_POOL   4
+
+void bpsw_pool(mpz_t *x, unsigned long long m, unsigned long long n)
+{
+    gmp_randstate_t rs;
+    mpz_t mpz_q;
+    unsigned long p = (unsigned long)m + 1;
+    int i;
+
+    gmp_randinit_default(rs);
+    mpz_init(mpz_q);
+    for( i = 0 ; i < BPSW_POOL ; ++i )
+    {
+        if(n == 1)
+            do
+            {
+                mpz_urandomb(x[i], rs, m);
+                mpz_setbit(x[i], m - 1);
+                mpz_nextprime(x[i], x[i]);
+            }
+            while(mpz_sizeinbase(x[i], 2) != m);
+        else if(n == 2)
+            /* the composite 2^p - 1 is a strong pseudoprime to base 2,
+               since 2^p = 1 modulo it and p divides the odd part
+               2^(p - 1) - 1 of 2^p - 2 */
+            do
+            {
+                while(!iIsPrime32(--p))
+                    ;
+                mpz_set_ui(x[i], 0);
+                mpz_setbit(x[i], p);
+                mpz_sub_ui(x[i], x[i], 1);
+            }
+            while(ulPrmDiv(x[i], 1000) != 0 || mpz_probab_prime_p(x[i], 25));
+        else
+            do
+            {
+                mpz_urandomb(x[i], rs, m / 2);
+                mpz_setbit(x[i], m / 2 - 1);
+                mpz_setbit(x[i], m / 2 - 2);
+                mpz_nextprime(x[i], x[i]);
+                mpz_urandomb(mpz_q, rs, m - m / 2);
+                mpz_setbit(mpz_q, m - m / 2 - 1);
+                mpz_setbit(mpz_q, m - m / 2 - 2);
+                mpz_nextprime(mpz_q, mpz_q);
+                mpz_mul(x[i], x[i], mpz_q);
+            }
+            while(mpz_sizeinbase(x[i], 2) != m);
+    }
+    mpz_clear(mpz_q);
+    gmp_randclear(rs);
+}
+
+void bpsw_pool_test(mpz_t *x)
+{
+    int i;
+
+    for( i = 0 ; i < BPSW_POOL ; ++i )
+        test_sink += iBPSW(x[i], 1);
+}
+
+/* The strong BPSW test (iBPSW) on the numbers of one class from
+   bpsw_pool; the result is in candidates per second */
+
+size_t bpsw_class_bits[BPSW_POOL];
+
+double run_bpsw_class(unsigned long long m, unsigned long long n)
+{
+    mpz_t x[BPSW_POOL];
+    unsigned long long i, rep;
+    double f;
+
+    for( i = 0 ; i < BPSW_POOL ; ++i )
+        mpz_init(x[i]);
+    bpsw_pool(x, m, n);
+
+    CALIBRATE(f, bpsw_pool_test(x));
+    rep = 1 + period / f;
+
+    timer_start();
+    for( i = rep ; i > 0 ; --i )
+    {
+        bpsw_pool_test(x);
+    }
+    f = timer_stop();
+
+    for( i = 0 ; i < BPSW_POOL ; ++i )
+    {
+        bpsw_class_bits[i] = mpz_sizeinbase(x[i], 2);
+        mpz_clear(x[i]);
+    }
+    return BPSW_POOL * (rep / f);
+}
+
+void bpsw_class_detail(void)
+{
+    int i;
+
+    printf("\n%16s", "(bits)");
+    for( i = 0 ; i < BPSW_POOL ; ++i )
+        printf(" %u", (unsigned int)bpsw_class_bits[i]);
+}
+
+void version()
+{
+  printf("gmp version: %s\n", gmp_version);
+}
+
+typedef struct 
+{   unsigned long long a1, a2;
+} pair;
+
+pair mul_args[] = 
+{
+    { 128, 0 }, { 512, 0 }, { 8192, 0 }, { 131072, 0 }, { 2097152, 0 }, 
+    { 128, 128 }, { 512, 512 }, { 8192, 8192 }, { 131072, 131072 },
+    { 2097152, 2097152 }, { 15000, 10000 }, { 20000, 10000 },
+    { 30000, 10000 }, { 16777216, 512 }, { 16777216, 262144 }, { 0, 0 }
+};
+
+pair div_args[] = 
+{
+    { 8192, 32 }, { 8192, 64 }, { 8192, 128 }, { 8192, 4096 }, { 131072, 65536 },
+    { 8388608, 4194304 }, { 8192, 8064 }, { 16777216, 262144 }, { 0, 0 }
+};
+
+pair gcd_args[] =
+{
+    { 128, 128 }, { 512, 512 }, { 8192, 8192 }, { 131072, 131072 }, { 1048576, 1048576 }, { 0, 0 }
+};
+
+pair gcdext_args[] =
+{
+    { 128, 128 }, { 512, 512 }, { 8192, 8192 }, { 131072, 131072 }, { 1048576, 1048576 }, { 0, 0 }
+};
+
+pair root_args[] =
+{
+    { 128, 5 }, { 512, 3 }, { 8192, 11 }, { 131072, 3 }, { 1048576, 3 }, { 0, 0 }
+};
+
+pair fac_ui_args[] =
+{
+    { 128, 0 }, { 1512, 0 }, { 15000, 0 }, { 1000010, 0 }, { 2123456, 0 }, { 0, 0 }
+};
+
+pair rsa_args[] = 
+{
+    { 512, 0 }, { 1024, 0 }, { 2048, 0 }, { 0, 0 }
+};
+
+pair pi_args[] = 
+{
+    { 10000, 0 }, { 100000, 0 }, { 1000000, 0 }, { 0, 0 }
+};
+
+pair bpsw_args[] = 
+{
+    { 1024, 0 }, { 4096, 0 }, { 16384, 0 }, { 0, 0 }
+};
+
+pair nextprime_args[] =
+{
+    { 512, 1 }, { 512, 2 }, { 1024, 1 }, { 1024, 2 },
+    { 2048, 1 }, { 2048, 2 }, { 4096, 1 }, { 4096, 2 }, { 0, 0 }
+};
+
+pair wagstaff_args[] = 
+{
+    { 1024, 0 }, { 4096, 0 }, { 16384, 0 }, { 0, 0 }
+};
+
+pair mersenne_args[] =
+{
+     { 3217, 0 }, { 4253, 0 }, { 4423, 0 } , { 9689, 0 }, { 11213, 0 }, { 0, 0 }
+};
+
+pair ll_fft_args[] =
+{
+    { 110503, 0 }, { 1257787, 0 }, { 3021377, 0 }, { 6972593, 0 }, { 0, 0 }
+};
+
+pair prp_fft_args[] =
+{
+    { 110503, 0 }, { 110503, 10 }, { 110503, 20 },
+    { 1257787, 0 }, { 1257787, 10 }, { 1257787, 20 }, { 0, 0 }
+};
+
+pair fermat_args[] =
+{
+    { 8, 0 }, { 10, 0 }, { 12, 0 }, { 0, 0 }
+};
+
+pair proth_args[] =
+{
+    { 10000, 1 }, { 100000, 1 }, { 1000000, 1 },
+    { 10000, 2 }, { 100000, 2 }, { 1000000, 2 },
+    { 10007, 3 }, { 100003, 3 }, { 1000003, 3 }, { 0, 0 }
+};
+
+pair fermat_suyama_args[] =
+{
+    { 12, 0 }, { 13, 0 }, { 14, 0 }, { 15, 0 }, { 16, 0 }, { 0, 0 }
+};
+
+pair expr_prog_args[] =
+{
+    { 1, 1 }, { 1, 2 }, { 2, 1 }, { 2, 2 }, { 3, 1 }, { 3, 2 },
+    { 4, 1 }, { 4, 2 }, { 0, 0 }
+};
+
+pair prime64_args[] =
+{
+    { 32, 1 }, { 32, 2 }, { 64, 1 }, { 64, 2 }, { 0, 0 }
+};
+
+pair bpsw_batch_args[] =
+{
+    { 512, 0 }, { 1024, 0 }, { 2048, 0 }, { 0, 0 }
+};
+
+pair bpsw_class_args[] =
+{
+    { 512, 1 }, { 512, 2 }, { 512, 3 }, { 1024, 1 }, { 1024, 2 },
+    { 1024, 3 }, { 2048, 1 }, { 2048, 2 }, { 2048, 3 }, { 0, 0 }
+};
+
+pair lucas_args[] =
+{
+    { 1024, 1 }, { 1024, 2 }, { 1024, 3 }, { 4096, 1 }, { 4096, 2 },
+    { 4096, 3 }, { 16384, 1 }, { 16384, 2 }, { 16384, 3 }, { 0, 0 }
+};
+
+pair sieve_args[] =
+{
+    { 10000000, 10000000 }, { 1000000000, 100000000 },
+    { 1000000000000, 100000000 }, { 0, 0 }
+};
+
+#define MAX_THREAD_ARGS 10
+
+/* set by thread_args() to { m, 1 }, { m, 2 }, { m, 4 }, .., { m, cores },
+   which returns the number of pairs */
+pair sieve_mt_args[MAX_THREAD_ARGS];
+pair expr_args[MAX_THREAD_ARGS];
+
+int thread_args(pair *p, unsigned long long m)
+{   unsigned int i, j = 0, nc = num_cores();
+
+    for( i = 1 ; i < nc && j < MAX_THREAD_ARGS - 2 ; i <<= 1 )
+    {
+        p[j].a1 = m;
+        p[j++].a2 = i;
+    }
+    p[j].a1 = m;
+    p[j++].a2 = nc;
+    p[j].a1 = p[j].a2 = 0;
+    return j;
+}
+
+/* thread_args() for each of the exponents e[0], e[1], .. up to a 0 */
+
+pair ll_fft_mt_args[4 * MAX_THREAD_ARGS];
+pair pepin_fft_mt_args[4 * MAX_THREAD_ARGS];
+pair mersenne_search_args[2 * MAX_THREAD_ARGS];
+
+unsigned long long ll_fft_mt_exp[] = { 11213, 132049, 1257787, 6972593, 0 };
+unsigned long long pepin_fft_mt_exp[] = { 16384, 131072, 1048576, 8388608, 0 };
+unsigned long long mersenne_search_exp[] = { 2000, 4000, 0 };
+
+void thread_args_list(pair *p, unsigned long long *e)
+{
+    for( ; *e ; ++e )
+        p += thread_args(p, *e);
+}
+
+typedef double (*fptr)(unsigned long long, unsigned long long);
+
+typedef void (*dptr)(void);
+
+typedef struct
+{   char *name;
+    fptr fp;
+    int  npar;
+    pair *a_ptr;
+    double  wght;
+    dptr detail;    /* if set, prints more results after each run */
+} scat_str;
+
+/* only the scored categories enter the overall figure, which is thus
+   comparable with that of earlier versions; the rest are printed with
+   their own figures */
+
+typedef struct 
+{
+    char    *name;
+    int     scored;
+    scat_str  sc_arr[24];
+} cat_str;
+
+cat_str cc_str[] = 
+{ 
+    { "base", 1,
+        { 
+            { "multiply", run_multiply, 2, mul_args, 1.0  },
+            { "divide", run_divide, 2, div_args, 1.0 },
+            { "gcd", run_gcd, 2, gcd_args, 0.5 },
+            { "gcdext", run_gcdext, 2, gcdext_args, 0.5 },
+            { "root", run_root, 2, root_args, 0.3 }, 
+            { "fac_ui", run_fac_ui, 2, fac_ui_args, 0.2 }, 
+            { 0 }
+        }
+    },
+    {   "app", 1,
+        {
+            { "rsa", run_rsa, 1, rsa_args, 1.0 },
+            { "pi", run_pi, 1, pi_args, 1.0 },
+            { "bpsw", run_bpsw, 1, bpsw_args, 1.0 },
+            { "wagstaff", run_wagstaff, 1, wagstaff_args, 1.0 },
+            { "mersenne", run_mersenne, 1, mersenne_args, 1.0 },
+            { "fermat", run_fermat, 1, fermat_args, 1.0 },
+            { 0 }
+        }
+    },
+    {   "extra", 0,
+        {
+            { "wagstaff_mpn", run_wagstaff_mpn, 1, wagstaff_args, 1.0 },
+            { "mersenne_sqr", run_mersenne_sqr, 1, mersenne_args, 1.0 },
+            { "fermat_sqr", run_fermat_sqr, 1, fermat_args, 1.0 },
+            { "fermat_suyama", run_fermat_suyama, 1, fermat_suyama_args, 1.0, suyama_detail },
+            { "proth", run_proth, 2, proth_args, 1.0 },
+            { 0 }
+        }
+    },
+    {   "fft", 0,
+        {
+            { "mersenne_fft", run_mersenne_fft, 1, mersenne_args, 1.0 },
+            { "ll_fft", run_ll_fft, 1, ll_fft_args, 1.0 },
+            { "prp_fft", run_prp_fft, 2, prp_fft_args, 1.0, prp_detail },
+            { "ll_fft_mt", run_ll_fft_mt, 2, ll_fft_mt_args, 1.0 },
+            { "pepin_fft_mt", run_pepin_fft_mt, 2, pepin_fft_mt_args, 1.0 },
+            { 0 }
+        }
+    },
+    {   "threaded", 0,
+        {
+            { "nextprime", run_nextprime, 2, nextprime_args, 1.0 },
+            { "mersenne_search", run_mersenne_search, 2, mersenne_search_args, 1.0 },
+            { 0 }
+        }
+    },
+    {   "prime", 0,
+        {
+            { "sieve", run_sieve, 2, sieve_args, 1.0 },
+            { "sieve_mt", run_sieve_mt, 2, sieve_mt_args, 1.0 },
+            { "bpsw_batch", run_bpsw_batch, 1, bpsw_batch_args, 1.0 },
+            { "bpsw_class", run_bpsw_class, 2, bpsw_class_args, 1.0, bpsw_class_detail },
+            { "bpsw_cand", run_bpsw_cand, 1, bpsw_args, 1.0, bpsw_detail },
+            { "lucas_engine", run_lucas, 2, lucas_args, 1.0 },
+            { "prime64", run_prime64, 2, prime64_args, 1.0 },
+            { "expr", run_expr, 2, expr_args, 1.0 },
+            { "expr_cached", run_expr_cached, 2, expr_args, 1.0 },
+            { "expr_prog", run_expr_prog, 2, expr_prog_args, 1.0 },
+            { 0 }
+        }
+    },
+    {   "test", 0,
+        {
+            { "miller_rabin", run_mr, 1, bpsw_args, 1.0, ptest_detail },
+            { "lucas", run_ls, 1, bpsw_args, 1.0, ptest_detail },
+            { "strong_lucas", run_sls, 1, bpsw_args, 1.0, ptest_detail },
+            { "xstrong_lucas", run_xsl, 1, bpsw_args, 1.0, ptest_detail },
+            { "prmdiv", run_prmdiv, 1, bpsw_args, 1.0, ptest_detail },
+            { "probab_prime", run_probab_prime, 1, bpsw_args, 1.0, ptest_detail },
+            { 0 }
+        }
     },
     { 0 }
 };
@@ -747,7 +2161,7 @@ int get_processor_info(char *cpu_id, char *cpu_name, double  *cycles_per_second)
 #define _MAX_PATH	1024
 #endif
 
-int main(void)
+int main(int argc, char *argv[])
 {   double r, v, acc, acc1, acc2, n, n1, n2, cps, mcps;
     pair   *pars;
     cat_str  *cp;
@@ -769,11 +2183,23 @@ int main(void)
 #else
     printf("\nSpeed: %.2f GHz (reported)", 1.0e-9 * cps);
 #endif
+    printf("\nCores: %u", num_cores());
+    if(argc > 1 && strcmp(argv[1], "scaling") == 0)
+    {
+        run_scaling();
+        return EXIT_SUCCESS;
+    }
+    thread_args(sieve_mt_args, 1000000000000ull);
+    thread_args(expr_args, 1000);
+    thread_args_list(ll_fft_mt_args, ll_fft_mt_exp);
+    thread_args_list(pepin_fft_mt_args, pepin_fft_mt_exp);
+    thread_args_list(mersenne_search_args, mersenne_search_exp);
+
     acc2 = 1.0;
     n2   = 0.0;
     for( cp = cc_str ; cp->name ; ++cp )
     {
-        printf("\n Category %s", cp->name);
+        printf("\n Category %s%s", cp->name, cp->scored ? "" : " (not scored)");
         acc1 = 1.0;
         n1   = 0.0;
         for( scp = cp->sc_arr; scp->name ; ++scp )
@@ -799,19 +2225,27 @@ int main(void)
                     printf("\n   %9llu %9llu", pars->a1, pars->a2);
                 }
                 out_res(r, 8, 0.0);
+                if(scp->detail)
+                    (scp->detail)();
                 acc *= r;
                 n += 1.0;
             }
             v = pow(acc, 1.0 / n);
+            if(scp->detail)
+                printf("\n%34s", "");
             out_res(v, 5, cps);
             acc1 *= pow(v, scp->wght);
             n1 += scp->wght;
         }
         v = pow(acc1, 1.0 / n1);
         out_res(v, 5, cps);
-        acc2 *= v;
-        n2 += 1.0;
+        if(cp->scored)
+        {
+            acc2 *= v;
+            n2 += 1.0;
+        }
     }
+    printf("\n Overall");
     out_res(pow(acc2, (1.0 / n2)), 5, cps);
     printf("\n\n");
 }
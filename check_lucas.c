@@ -0,0 +1,100 @@
+/*  Consistency check of the Lucas tests in trn.c for the MPIR benchmark
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of version 2.1 of the GNU General Public License
+    as published by the Free Software Foundation; it is not distributable
+    under version 3 (or any later version) of the GNU General Public License.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    Built and run by 'make check' (or 'make check_gmp'), rather than by
+    the benchmark itself, which times iLucasMont and iLucasV as
+    equivalents of iLucasSelfridge and iStrongLucasSelfridge.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#ifdef USE_MPIR
+#include "mpir.h"
+#else
+#include "gmp.h"
+#endif
+
+#include "trn.h"
+
+/* Lucas-Selfridge pseudoprimes, flagged if also strong Lucas-Selfridge
+   pseudoprimes */
+
+static const struct
+{   unsigned long n;
+    int strong;
+} lucas_psp[] =
+{
+    { 323, 0 }, { 377, 0 }, { 1159, 0 }, { 1829, 0 }, { 3827, 0 },
+    { 5459, 1 }, { 5777, 1 }, { 9071, 0 }, { 9179, 0 }, { 10877, 1 },
+    { 11419, 0 }, { 11663, 0 }, { 13919, 0 }, { 14839, 0 }, { 16109, 1 },
+    { 16211, 0 }, { 18407, 0 }, { 18971, 1 }, { 19043, 0 }, { 22499, 1 },
+    { 24569, 1 }, { 25199, 1 }, { 40309, 1 }, { 58519, 1 }, { 75077, 1 },
+    { 97439, 1 }, { 100127, 1 }, { 113573, 1 }, { 115639, 1 },
+    { 130139, 1 }, { 0, 0 }
+};
+
+/* check that the Lucas tests in trn.c (mpz, Montgomery and V-only) agree
+   with each other on small numbers, known pseudoprimes and random
+   numbers, and give the known results on the pseudoprimes */
+
+static int lucas_agree(mpz_t mpz_n, int *ls, int *sls)
+{
+    *ls = iLucasSelfridge(mpz_n);
+    *sls = iStrongLucasSelfridge(mpz_n);
+    return iLucasMont(mpz_n, 0) == *ls && iLucasV(mpz_n, 0) == *ls
+        && iLucasMont(mpz_n, 1) == *sls && iLucasV(mpz_n, 1) == *sls;
+}
+
+static int check_lucas(void)
+{
+    gmp_randstate_t rs;
+    mpz_t mpz_n;
+    int i, ls, sls, ok = 1;
+
+    gmp_randinit_default(rs);
+    mpz_init(mpz_n);
+    for( i = 0 ; ok && i < 5000 ; ++i )
+    {
+        mpz_set_ui(mpz_n, i);
+        ok = lucas_agree(mpz_n, &ls, &sls);
+    }
+    for( i = 0 ; ok && lucas_psp[i].n ; ++i )
+    {
+        mpz_set_ui(mpz_n, lucas_psp[i].n);
+        ok = lucas_agree(mpz_n, &ls, &sls)
+                    && ls == 1 && sls == lucas_psp[i].strong;
+    }
+    for( i = 0 ; ok && i < 200 ; ++i )
+    {
+        mpz_urandomb(mpz_n, rs, 64 + 5 * i);
+        if(i & 1)
+            mpz_nextprime(mpz_n, mpz_n);
+        ok = lucas_agree(mpz_n, &ls, &sls);
+    }
+    if(!ok)
+        gmp_printf("\nLucas test mismatch for %Zd", mpz_n);
+    mpz_clear(mpz_n);
+    gmp_randclear(rs);
+    return ok;
+}
+
+int main(void)
+{
+    if(!check_lucas())
+    {
+        printf("\n");
+        return EXIT_FAILURE;
+    }
+    printf("Lucas tests agree\n");
+    return EXIT_SUCCESS;
+}
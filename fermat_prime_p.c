@@ -47,31 +47,127 @@ Boston, MA 02110-1301, USA.
 #define NEED_MULMOD
 #endif
 
+/* Reduction mod 2^k2 + 1 at the mpn level: if the 2 * n limbs at tp are
+   T = H * 2^k2 + L with L < 2^k2, then T = L - H mod 2^k2 + 1. Returns
+   the carry of the result in the representation used with
+   mpn_mulmod_2expp1, where the n limbs at xp hold x < 2^k2, or a carry
+   of 1 means x = 2^k2 = -1. T < 2^(2 * k2), so H < 2^k2. xp may be tp,
+   which is overwritten. */
+static int
+fold_2expp1 (mp_ptr xp, mp_ptr tp, unsigned long k2)
+{
+  mp_size_t n, q;
+  unsigned long b;
+  mp_limb_t l, h, mask;
+
+  n = BITS_TO_LIMBS (k2);
+  q = k2 / GMP_NUMB_BITS;
+  b = k2 % GMP_NUMB_BITS;
+  mask = ((mp_limb_t) 1 << b) - 1;
+  if (2 * k2 <= GMP_NUMB_BITS)
+    {
+      // T is in tp[0] , as for the Fermat numbers below F_6
+      l = tp[0] & mask;
+      h = tp[0] >> k2;
+      l = l >= h ? l - h : l + ((mp_limb_t) 1 << k2) + 1 - h;
+      xp[0] = l & mask;
+      return l >> k2 != 0;
+    }
+  if (b == 0)
+    {
+      if (mpn_sub_n (xp, tp, tp + n, n) == 0)
+	return 0;
+      // L - H < 0 wrapped mod 2^k2 , so add the 1 of 2^k2 + 1 , which can
+      // carry out only for L - H == -1 , leaving 0 and the carry for 2^k2
+      return mpn_add_1 (xp, xp, n, 1) != 0;
+    }
+  // H is shifted down in place to tp[q..q+n-1] , q = n - 1 , and the top
+  // limb of L is put back over its low limb , which is subtracted alone
+  l = tp[q] & mask;
+  mpn_rshift (tp + q, tp + q, 2 * n - q, b);
+  h = tp[q];
+  tp[q] = l;
+  h = mpn_sub_1 (xp, tp, n, h);
+  if (n > 1)
+    h += mpn_sub_n (xp + 1, xp + 1, tp + n, n - 1);
+  if (h == 0)
+    return 0;
+  // L - H + 2^(n * GMP_NUMB_BITS) has ones above bit k2 , so the low k2
+  // bits are L - H + 2^k2 , and adding 1 reaches 2^k2 only for L - H == -1
+  xp[n - 1] &= mask;
+  mpn_add_1 (xp, xp, n, 1);
+  if (xp[n - 1] >> b == 0)
+    return 0;
+  xp[n - 1] &= mask;
+  return 1;
+}
+
 #ifdef NEED_MULMOD
-#define MPN_NORMALIZE(pp,pn)	do{while(pn>0 && pp[pn-1]==0)pn--;}while(0)
-#include <string.h>
-#define MPN_COPY(ap,bp,pn)	memcpy(ap,bp,pn*sizeof(ap[0]))
-
-int	mpn_mulmod_2expp1 (mp_ptr xp,mp_ptr yp,mp_ptr zp,int c,mp_size_t k2,mp_ptr tp)
-{mpz_t x,y,z,m;mp_size_t n,tn;int ret;
-
-n=BITS_TO_LIMBS(k2);
-mpz_init2(y,k2+1);mpz_init2(z,k2+1);
-mpz_init2(m,k2+1);mpz_init2(x,2*k2+2);
-mpz_set_ui(m,1);mpz_mul_2exp(m,m,k2);mpz_add_ui(m,m,1);
-MPN_COPY(y->_mp_d,yp,n);tn=n;MPN_NORMALIZE(y->_mp_d,tn);y->_mp_size=tn;
-if((c&2)!=0){mpz_add(y,y,m);mpz_sub_ui(y,y,1);}
-MPN_COPY(z->_mp_d,zp,n);tn=n;MPN_NORMALIZE(z->_mp_d,tn);z->_mp_size=tn;
-if((c&1)!=0){mpz_add(z,z,m);mpz_sub_ui(z,z,1);}
-mpz_mul(x,y,z);
-mpz_mod(x,x,m);tn=x->_mp_size;if(tn>n)tn=n;
-MPN_COPY(xp,x->_mp_d,tn);if(tn<n)MPN_ZERO(xp+tn,n-tn);
-ret=0;mpz_sub_ui(m,m,1);
-if(mpz_cmp(x,m)>=0)ret=1;
-mpz_clear(x);mpz_clear(y);mpz_clear(z);mpz_clear(m);
-return ret;}
+/* xp = yp * zp mod 2^k2 + 1 where bit 1 of c set means y = 2^k2 and bit
+   0 that z = 2^k2; the product is formed
+   in the 2 * n limbs at tp, which may be xp, and reduced by fold_2expp1
+   rather than by mpz_mod. Returns the carry of the result. */
+int
+mpn_mulmod_2expp1 (mp_ptr xp, mp_ptr yp, mp_ptr zp, int c, mp_size_t k2, mp_ptr tp)
+{
+  mp_size_t i, n;
+
+  n = BITS_TO_LIMBS (k2);
+  if ((c & 2) != 0 && (c & 1) != 0)
+    {
+      // (-1) * (-1)
+      MPN_ZERO (xp, n);
+      xp[0] = 1;
+      return 0;
+    }
+  if ((c & 2) != 0 || (c & 1) != 0)
+    {
+      // -z = 2^k2 + 1 - z = ~(z - 2) below bit k2 for z >= 2 , and 2^k2
+      // for z = 1 and 0 for z = 0
+      if ((c & 2) != 0)
+	yp = zp;
+      for (i = 1; i < n && yp[i] == 0; i++)
+	;
+      if (i == n && yp[0] < 2)
+	{
+	  MPN_ZERO (xp, n);
+	  return yp[0] != 0;
+	}
+      mpn_sub_1 (xp, yp, n, 2);
+      for (i = 0; i < n; i++)
+	xp[i] = ~xp[i] & GMP_NUMB_MASK;
+      if (k2 % GMP_NUMB_BITS != 0)
+	xp[n - 1] &= ((mp_limb_t) 1 << (k2 % GMP_NUMB_BITS)) - 1;
+      return 0;
+    }
+  if (zp == yp)
+    mpn_sqr (tp, yp, n);
+  else
+    mpn_mul_n (tp, yp, zp, n);
+  return fold_2expp1 (xp, tp, k2);
+}
 #endif
 
+/* Squaring mod 2^k2 + 1 at the mpn level, in the representation used
+   with mpn_mulmod_2expp1, by mpn_sqr and fold_2expp1: c != 0 means
+   y = 2^k2 = -1. Returns the carry of the result in the same way. tp
+   has room for 2 * n limbs. */
+static int
+sqrmod_2expp1 (mp_ptr xp, mp_srcptr yp, int c, unsigned long k2, mp_ptr tp)
+{
+  mp_size_t n;
+
+  n = BITS_TO_LIMBS (k2);
+  if (c != 0)
+    {
+      MPN_ZERO (xp, n);
+      xp[0] = 1;
+      return 0;
+    }
+  mpn_sqr (tp, yp, n);
+  return fold_2expp1 (xp, tp, k2);
+}
+
 /*
 Pepin's Test for k>=1
 
@@ -86,25 +182,32 @@ F_k = 2^(2^k)+1 is prime if and only if
 // but this is really for benchmarks etc
 // according to Prime Numbers , A computational Perspective , k=24 is the largest Pepin test ever run 2002
 // Going from k to k+1 we expect the runtime to increase by a factor of 4+epsilon , So runtime=A*4^k
-int
-fermat_prime_p (unsigned long k)
+// sqr selects sqrmod_2expp1 rather than mpn_mulmod_2expp1 with xp , xp
+// if r is not 0 it is set to the residue 3^((F_k-1)/2) mod F_k
+static int
+pepin (unsigned long k, int sqr, mpz_ptr r)
 {
   unsigned long i, k2;
   int c;
   mp_size_t n;
-  mp_ptr tp, xp, yp, sp;
+  mp_ptr tp, xp, yp, sp, wp;
 
   if (k >= BITS_PER_ULONG)
     k = BITS_PER_ULONG - 1;	// this should force a out of memory rather than some sort of crash
   if (k == 0)
-    return 1;
+    {
+      if (r != 0)
+	mpz_set_ui (r, 2);
+      return 1;
+    }
   k2 = 1;
   k2 <<= k;			// k2=2^k
 // doing calcs mod F_k = 2^(2^k)+1= 2^k2+1 , so need k2 bits
   n = BITS_TO_LIMBS (k2);
-  tp = __GMP_ALLOCATE_FUNC_LIMBS (4 * n);
+  tp = __GMP_ALLOCATE_FUNC_LIMBS (6 * n);
   xp = tp;
   yp = tp + 2 * n;
+  wp = tp + 4 * n;
   MPN_ZERO (xp, n);
   xp[0] = 3;
   c = 0;
@@ -112,21 +215,173 @@ fermat_prime_p (unsigned long k)
     {
       if (c != 0)
 	c = 3;			// as we are squaring , dont need to do this , as for Pepin test it doesn't matter
-      c = mpn_mulmod_2expp1 (yp, xp, xp, c, k2, yp);	// or better a mpn_sqrmod_2expp1
+      if (sqr)
+	c = sqrmod_2expp1 (yp, xp, c, k2, wp);
+      else
+	c = mpn_mulmod_2expp1 (yp, xp, xp, c, k2, yp);
       sp = xp;
       xp = yp;
       yp = sp;
     }
-  __GMP_FREE_FUNC_LIMBS (tp, 4 * n);
-  // we could return the low limb of the computation as a check
+  // the residue is 2^k2 if c is set , and in xp if not
+  if (r != 0)
+    {
+      if (c != 0)
+	{
+	  mpz_set_ui (r, 1);
+	  mpz_mul_2exp (r, r, k2);
+	}
+      else
+	mpz_import (r, n, -1, sizeof (mp_limb_t), 0, GMP_NAIL_BITS, xp);
+    }
+  __GMP_FREE_FUNC_LIMBS (tp, 6 * n);
   return c;
 }
 
+int
+fermat_prime_p (unsigned long k)
+{
+  return pepin (k, 0, 0);
+}
+
+int
+fermat_prime_sqr_p (unsigned long k)
+{
+  return pepin (k, 1, 0);
+}
+
+// the low 64 bits of x
+static unsigned long long
+res64 (mpz_srcptr x)
+{
+  unsigned long long v;
+
+  v = mpz_getlimbn (x, 0);
+#if GMP_NUMB_BITS < 64
+  v |= (unsigned long long) mpz_getlimbn (x, 1) << GMP_NUMB_BITS;
+#endif
+  return v;
+}
+
+/*
+Pepin's test with the residue as a check , as for the Lucas-Lehmer tests that
+report the low 64 bits of the last residue , so that runs with MPIR and GMP , or
+on different machines , can be compared . The low 64 bits of 3^((F_k-1)/2) mod F_k
+are put in *res and if file is not 0 the residue is written there in hex after a
+line with k and the 64 bit residue
+*/
+int
+fermat_prime_res_p (unsigned long k, unsigned long long *res, const char *file)
+{
+  mpz_t r;
+  int c;
+  FILE *fp;
+
+  mpz_init (r);
+  c = pepin (k, 1, r);
+  if (res != 0)
+    *res = res64 (r);
+  if (file != 0 && (fp = fopen (file, "w")) != 0)
+    {
+      fprintf (fp, "F%lu RES64 %016llx\n", k, res64 (r));
+      mpz_out_str (fp, 16, r);
+      fprintf (fp, "\n");
+      fclose (fp);
+    }
+  mpz_clear (r);
+  return c;
+}
+
+/*
+The known prime factors of F_5 to F_19 , F_20 has none . The cofactors are
+prime up to F_11 , which is fully factored , and composite after that
+*/
+static const char *const fermat_factors[][7] = {
+  {"641", 0},
+  {"274177", 0},
+  {"59649589127497217", 0},
+  {"1238926361552897", 0},
+  {"2424833", "7455602825647884208337395736200454918783366342657", 0},
+  {"45592577", "6487031809", "4659775785220018543264560743076778192897", 0},
+  {"319489", "974849", "167988556341760475137", "3560841906445833920513", 0},
+  {"114689", "26017793", "63766529", "190274191361", "1256132134125569",
+   "568630647535356955169033410940867804839360742060818433", 0},
+  {"2710954639361", "2663848877152141313", "3603109844542291969",
+   "319546020820551643220672513", 0},
+  {"116928085873074369829035993834596371340386703423373313", 0},
+  {"1214251009", "2327042503868417", "168768817029516972383024127016961", 0},
+  {"825753601", "188981757975021318420037633", 0},
+  {"31065037602817", "7751061099802522589358967058392886922693580423169", 0},
+  {"13631489", "81274690703860512587777", 0},
+  {"70525124609", "646730219521", "37590055514133754286524446080499713", 0},
+  {0}
+};
+
+#define FERMAT_FACTORS_MIN	5
+#define FERMAT_FACTORS_MAX	20
+
+/*
+Suyama's test of the cofactor C=F_k/P where P is the product of the known factors
+
+If C is prime then 3^(F_k-1)=3^(P-1)*3^(P(C-1))=3^(P-1) mod C , and 3^(F_k-1) mod F_k
+is the square of the Pepin residue , so the test costs one powering to P-1 more
+than Pepin's test . Returns 1 if C is a probable prime , 0 if not , and -1 for k
+outside 5 to 20 . The 64 bit Pepin residue is put in *res as above , or 0 for k
+outside 5 to 20
+*/
+int
+fermat_cofactor_prp (unsigned long k, unsigned long long *res)
+{
+  mpz_t f, p, q, a, b;
+  const char *const *fp;
+  int ret;
+
+  if (k < FERMAT_FACTORS_MIN || k > FERMAT_FACTORS_MAX)
+    {
+      if (res != 0)
+	*res = 0;
+      return -1;
+    }
+  mpz_init (f);
+  mpz_init (p);
+  mpz_init (q);
+  mpz_init (a);
+  mpz_init (b);
+  mpz_set_ui (f, 1);
+  mpz_mul_2exp (f, f, 1ul << k);
+  mpz_add_ui (f, f, 1);
+  mpz_set_ui (p, 1);
+  for (fp = fermat_factors[k - FERMAT_FACTORS_MIN]; *fp != 0; fp++)
+    {
+      mpz_set_str (q, *fp, 10);
+      mpz_mul (p, p, q);
+    }
+  pepin (k, 1, a);
+  if (res != 0)
+    *res = res64 (a);
+  mpz_mul (a, a, a);
+  mpz_mod (a, a, f);
+  mpz_sub_ui (q, p, 1);
+  mpz_set_ui (b, 3);
+  mpz_powm (b, b, q, f);
+  // the cofactor C
+  mpz_divexact (q, f, p);
+  mpz_sub (a, a, b);
+  ret = mpz_divisible_p (a, q) != 0;
+  mpz_clear (f);
+  mpz_clear (p);
+  mpz_clear (q);
+  mpz_clear (a);
+  mpz_clear (b);
+  return ret;
+}
+
 #ifdef STANDALONE
 int
 main (int argc, char *argv[])
 {
   int k, p;
+  unsigned long long res;
 
   if (argc != 2)
     {
@@ -134,11 +389,15 @@ main (int argc, char *argv[])
       return 1;
     }
   k = atoi (argv[1]);
-  p = fermat_prime_p (k);
+  p = fermat_prime_res_p (k, &res, 0);
   printf ("The Fermat number F(%d)=2^(2^%d)+1 is ", k, k);
   if (p == 0)
     printf ("not ");
-  printf ("prime\n");
+  printf ("prime , RES64 %016llx\n", res);
+  p = fermat_cofactor_prp (k, 0);
+  if (p >= 0)
+    printf ("The cofactor of its known factors is %s\n",
+	    p ? "a probable prime" : "composite");
   return 0;
 }
 #endif
@@ -0,0 +1,823 @@
+/*  Irrational base discrete weighted transform (IBDWT) squaring modulo
+    2^q - 1 and 2^q + 1 for the MPIR benchmark
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of version 2.1 of the GNU General Public License
+    as published by the Free Software Foundation; it is not distributable
+    under version 3 (or any later version) of the GNU General Public License.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    This is the method of R. Crandall and B. Fagin, "Discrete weighted
+    transforms and large-integer arithmetic", Math. Comp. 62 (1994),
+    which is used by Prime95 and other Mersenne number programs. Word j
+    of a residue modulo 2^q - 1 starts at bit p(j) = ceil(q j / n), and
+    with the weights a(j) = 2^(p(j) - q j / n) the cyclic convolution of
+    the weighted words is the product modulo 2^q - 1, without the zero
+    padding of an ordinary FFT multiplication. The words are real, so
+    the n point transform is done as an n / 2 point complex one.
+
+    Modulo 2^q + 1, for q a power of 2, the words have q / n bits each,
+    and the negacyclic convolution is done by the right-angle transform
+    of Crandall: the complex words x(j) + i x(j + n / 2) are weighted by
+    e^(i pi j / n), so that their cyclic convolution of length n / 2 has
+    the low half of the product in its real parts and the high half in
+    its imaginary parts.
+
+    dwt_square runs its passes over the words on c->threads threads,
+    the pool started by dwt_set_threads, which wait between the passes.
+    After the bit reversal, the first stages of the FFT work on blocks
+    of n / (2 threads) points, one for each thread, and the remaining
+    stages split the butterflies of each stage between the threads. The
+    carries are propagated within each thread's share of the words, and
+    then from one share to the next.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ibdwt.h"
+#include "threads.h"
+
+#define DWT_PI          3.14159265358979323846
+#define DWT_MAX_ERROR   0.4
+
+/* The rounding errors of an n = 2^lg point transform of balanced b bit
+   words grow as 2^(2b + lg / 2), and stay below about 1/8 for words of
+   up to (93 - lg) / 4 bits on average. */
+
+unsigned long dwt_length(unsigned long q)
+{   unsigned long n = 2, lg = 1;
+
+    while(4 * (unsigned long long)q > (93 - lg) * (unsigned long long)n)
+    {
+        n <<= 1;
+        ++lg;
+    }
+    return n;
+}
+
+/* Modulo 2^q + 1 the weights are not needed, and wt[2j] and wt[2j + 1]
+   hold cos(pi j / n) and sin(pi j / n) for the right-angle transform
+   instead. The words also need at least 2 bits there, since with
+   1 bit words most of the residues have no balanced form. */
+
+int dwt_init(dwt_ctx *c, unsigned long q, int s, unsigned long n)
+{   unsigned long j, k, m, lg;
+    unsigned long long p0, p1;
+
+    if(n == 0)
+        n = dwt_length(q);
+    for( lg = 0 ; (1ul << lg) < n ; ++lg )
+        ;
+    if(n < 2 || n != 1ul << lg || q < n || q / n >= 32
+            || (s > 0 && ((q & (q - 1)) != 0 || q / n < 2)))
+        return 0;
+    m = n >> 1;
+    c->threads = 1;
+    c->pool = 0;
+    c->q = q;
+    c->s = s < 0 ? -1 : 1;
+    c->n = n;
+    c->big = (unsigned char*)malloc(n);
+    c->x = (double*)malloc(n * sizeof(double));
+    c->wt = (double*)malloc(n * sizeof(double));
+    c->iwt = (double*)malloc(n * sizeof(double));
+    c->re = (double*)malloc(m * sizeof(double));
+    c->im = (double*)malloc(m * sizeof(double));
+    c->re2 = (double*)malloc(m * sizeof(double));
+    c->im2 = (double*)malloc(m * sizeof(double));
+    c->cs = (double*)malloc(m * sizeof(double));
+    c->sn = (double*)malloc(m * sizeof(double));
+    c->rev = (unsigned long*)malloc(m * sizeof(unsigned long));
+    if(!c->big || !c->x || !c->wt || !c->iwt || !c->re || !c->im
+                || !c->re2 || !c->im2 || !c->cs || !c->sn || !c->rev)
+    {
+        dwt_clear(c);
+        return 0;
+    }
+
+    c->bw[0] = ldexp(1.0, (int)(q / n));
+    c->bw[1] = 2.0 * c->bw[0];
+    c->ibw[0] = 1.0 / c->bw[0];
+    c->ibw[1] = 1.0 / c->bw[1];
+    for( j = 0 ; j < n ; ++j )
+    {
+        p0 = ((unsigned long long)q * j + n - 1) / n;
+        p1 = ((unsigned long long)q * (j + 1) + n - 1) / n;
+        c->big[j] = (unsigned char)(p1 - p0 - q / n);
+        if(c->s < 0)
+        {
+            c->wt[j] = pow(2.0, (double)(p0 * n - (unsigned long long)q * j) / n);
+            c->iwt[j] = 1.0 / (c->wt[j] * m);
+        }
+        else
+        {
+            c->wt[j] = (j & 1) ? sin(DWT_PI * (j >> 1) / n) : cos(DWT_PI * (j >> 1) / n);
+            c->iwt[j] = 1.0 / m;
+        }
+    }
+    for( k = 0 ; k < m ; ++k )
+    {
+        c->cs[k] = cos(2.0 * DWT_PI * k / n);
+        c->sn[k] = -sin(2.0 * DWT_PI * k / n);
+        for( j = 0, p0 = k, p1 = 1 ; p1 < m ; p1 <<= 1, p0 >>= 1 )
+            j = (j << 1) | (p0 & 1);
+        c->rev[k] = j;
+    }
+    c->err = 0.0;
+    dwt_set_ui(c, 0);
+    return 1;
+}
+
+void dwt_clear(dwt_ctx *c)
+{
+    free(c->big);
+    free(c->x);
+    free(c->wt);
+    free(c->iwt);
+    free(c->re);
+    free(c->im);
+    free(c->re2);
+    free(c->im2);
+    free(c->cs);
+    free(c->sn);
+    free(c->rev);
+    pool_destroy(c->pool);
+    c->pool = 0;
+    c->threads = 1;
+    c->big = 0;
+    c->x = c->wt = c->iwt = c->re = c->im = c->re2 = c->im2 = 0;
+    c->cs = c->sn = 0;
+    c->rev = 0;
+}
+
+void dwt_set_threads(dwt_ctx *c, unsigned int t)
+{   unsigned int u = 1;
+
+    while(2 * u <= t && 2 * u <= DWT_MAX_THREADS && 2 * u <= c->n / 4)
+        u <<= 1;
+    if(u == c->threads)
+        return;
+    pool_destroy(c->pool);
+    c->pool = 0;
+    if(u > 1 && !(c->pool = pool_create(u)))
+        u = 1;
+    c->threads = u;
+}
+
+/* add the carry cy in at word j, and on round the words until it is
+   absorbed; bit q is bit 0 with the sign s, since 2^q = -s */
+
+static void dwt_carry(dwt_ctx *c, double *x, unsigned long j, double cy)
+{   double v;
+
+    for( ; cy != 0.0 ; ++j )
+    {
+        if(j == c->n)
+        {
+            j = 0;
+            cy = c->s < 0 ? cy : -cy;
+        }
+        v = x[j] + cy;
+        cy = floor(v * c->ibw[c->big[j]] + 0.5);
+        x[j] = v - cy * c->bw[c->big[j]];
+    }
+}
+
+void dwt_set_ui(dwt_ctx *c, unsigned long v)
+{   unsigned long j;
+
+    for( j = 0 ; j < c->n ; ++j )
+        c->x[j] = 0.0;
+    dwt_carry(c, c->x, 0, (double)v);
+}
+
+void dwt_add_si(dwt_ctx *c, long a)
+{
+    dwt_carry(c, c->x, 0, (double)a);
+}
+
+/* the passes of dwt_mul, each of which is run by the pool with
+   thread t working on its share [lo, hi) of len items; PACK and the
+   FFT passes work on the words x and the transform (re, im) */
+
+enum { DWT_PACK, DWT_BITREV, DWT_BLOCKS, DWT_STAGE, DWT_MUL, DWT_ROUND };
+
+typedef struct
+{   dwt_ctx        *c;
+    int             pass;
+    int             inv;
+    unsigned long   h;
+    long            a;
+    double         *z;          /* the words of the result    */
+    const double   *x;          /* the words to be packed     */
+    double         *re, *im;    /* the transform worked on    */
+    int             sqr;        /* the transform of z only    */
+} dwt_job;
+
+static void dwt_share(unsigned long len, unsigned int t, unsigned int nt,
+                                    unsigned long *lo, unsigned long *hi)
+{
+    *lo = (unsigned long)((unsigned long long)len * t / nt);
+    *hi = (unsigned long)((unsigned long long)len * (t + 1) / nt);
+}
+
+/* the FFT butterfly on points i and j = i + h with the twiddle factor
+   e^(-+2 pi i k / n) */
+
+static void dwt_bfly(dwt_ctx *c, double *re, double *im, unsigned long i,
+                            unsigned long j, unsigned long k, int inv)
+{   double wr, wi, tr, ti;
+
+    wr = c->cs[k];
+    wi = inv ? -c->sn[k] : c->sn[k];
+    tr = wr * re[j] - wi * im[j];
+    ti = wr * im[j] + wi * re[j];
+    re[j] = re[i] - tr;
+    im[j] = im[i] - ti;
+    re[i] += tr;
+    im[i] += ti;
+}
+
+/* Z(k) and Z(m - k) of the half length transform of the packed words
+   z(j) = y(2j) + i y(2j + 1) give Y(k) and Y(k + m) of the real words
+   as E +- T, with T = w^k O and w = e^(-2 pi i / n); multiply these by
+   those of a second transform (E2, T2) and return the transform of the
+   packed products as E' + i O', where E' = E E2 + T T2 and O' =
+   (E T2 + T E2) / w^k */
+
+static void dwt_split(dwt_ctx *c, unsigned long k, double zr, double zi,
+            double yr, double yi, double *er, double *ei, double *tr, double *ti)
+{   double odr, odi;
+
+    *er = 0.5 * (zr + yr);
+    *ei = 0.5 * (zi - yi);
+    odr = 0.5 * (zi + yi);
+    odi = 0.5 * (yr - zr);
+    *tr = c->cs[k] * odr - c->sn[k] * odi;
+    *ti = c->cs[k] * odi + c->sn[k] * odr;
+}
+
+static void dwt_mul_point(dwt_ctx *c, unsigned long k, double er, double ei,
+            double tr, double ti, double er2, double ei2, double tr2,
+            double ti2, double *rr, double *ri)
+{   double fr, fi, gr, gi;
+
+    fr = er * er2 - ei * ei2 + tr * tr2 - ti * ti2;
+    fi = er * ei2 + ei * er2 + tr * ti2 + ti * tr2;
+    gr = er * tr2 - ei * ti2 + tr * er2 - ti * ei2;
+    gi = er * ti2 + ei * tr2 + tr * ei2 + ti * er2;
+    *rr = fr - (c->cs[k] * gi - c->sn[k] * gr);
+    *ri = fi + (c->cs[k] * gr + c->sn[k] * gi);
+}
+
+/* the products at points k and m - k (the same point for k = 0 and
+   k = m / 2) */
+
+static void dwt_mul_pair(dwt_ctx *c, dwt_job *jb, unsigned long k)
+{   unsigned long m = c->n >> 1, j = (m - k) & (m - 1);
+    double *re = c->re, *im = c->im, *yre = c->re2, *yim = c->im2;
+    double er, ei, tr, ti, fr, fi, ur, ui, er2, ei2, tr2, ti2, fr2, fi2, ur2, ui2;
+
+    dwt_split(c, k, re[k], im[k], re[j], im[j], &er, &ei, &tr, &ti);
+    dwt_split(c, j, re[j], im[j], re[k], im[k], &fr, &fi, &ur, &ui);
+    if(jb->sqr)
+    {
+        er2 = er; ei2 = ei; tr2 = tr; ti2 = ti;
+        fr2 = fr; fi2 = fi; ur2 = ur; ui2 = ui;
+    }
+    else
+    {
+        dwt_split(c, k, yre[k], yim[k], yre[j], yim[j], &er2, &ei2, &tr2, &ti2);
+        dwt_split(c, j, yre[j], yim[j], yre[k], yim[k], &fr2, &fi2, &ur2, &ui2);
+    }
+    dwt_mul_point(c, k, er, ei, tr, ti, er2, ei2, tr2, ti2, re + k, im + k);
+    if(j != k)
+        dwt_mul_point(c, j, fr, fi, ur, ui, fr2, fi2, ur2, ui2, re + j, im + j);
+}
+
+static void dwt_thread(void *arg, unsigned int t)
+{   dwt_job *jb = (dwt_job*)arg;
+    dwt_ctx *c = jb->c;
+    unsigned long m = c->n >> 1, nt = c->threads, lo, hi, h, i, j, k, s;
+    const double *x = jb->x, *wt = c->wt;
+    double *z = jb->z, *re = jb->re, *im = jb->im, v, r, e, cy;
+
+    switch(jb->pass)
+    {
+    case DWT_PACK:
+        dwt_share(m, t, nt, &lo, &hi);
+        for( j = lo ; j < hi ; ++j )
+            if(c->s < 0)
+            {
+                re[c->rev[j]] = x[2 * j] * wt[2 * j];
+                im[c->rev[j]] = x[2 * j + 1] * wt[2 * j + 1];
+            }
+            else
+            {
+                re[c->rev[j]] = x[j] * wt[2 * j] - x[j + m] * wt[2 * j + 1];
+                im[c->rev[j]] = x[j] * wt[2 * j + 1] + x[j + m] * wt[2 * j];
+            }
+        break;
+
+    case DWT_BITREV:
+        dwt_share(m, t, nt, &lo, &hi);
+        for( i = lo ; i < hi ; ++i )
+            if(i < (j = c->rev[i]))
+            {
+                v = re[i]; re[i] = re[j]; re[j] = v;
+                v = im[i]; im[i] = im[j]; im[j] = v;
+            }
+        break;
+
+    case DWT_BLOCKS:
+        dwt_share(m, t, nt, &lo, &hi);
+        for( h = 1, s = m ; h < hi - lo ; h <<= 1, s >>= 1 )
+            for( i = lo ; i < hi ; i += 2 * h )
+                for( k = 0 ; k < h ; ++k )
+                    dwt_bfly(c, re, im, i + k, i + k + h, k * s, jb->inv);
+        break;
+
+    case DWT_STAGE:
+        h = jb->h;
+        s = m / h;
+        dwt_share(m / 2, t, nt, &lo, &hi);
+        for( j = lo ; j < hi ; ++j )
+        {
+            k = j & (h - 1);
+            i = 2 * (j - k) + k;
+            dwt_bfly(c, re, im, i, i + h, k * s, jb->inv);
+        }
+        break;
+
+    case DWT_MUL:
+        if(c->s > 0)
+        {
+            const double *yre = jb->sqr ? re : c->re2, *yim = jb->sqr ? im : c->im2;
+
+            dwt_share(m, t, nt, &lo, &hi);
+            for( j = lo ; j < hi ; ++j )
+            {
+                v = re[j] * yre[j] - im[j] * yim[j];
+                im[j] = re[j] * yim[j] + im[j] * yre[j];
+                re[j] = v;
+            }
+            break;
+        }
+        if(t == 0)
+            dwt_mul_pair(c, jb, 0);
+        dwt_share(m / 2, t, nt, &lo, &hi);
+        for( k = lo + 1 ; k <= hi ; ++k )
+            dwt_mul_pair(c, jb, k);
+        break;
+
+    case DWT_ROUND:
+        dwt_share(c->n, t, nt, &lo, &hi);
+        cy = t == 0 ? -(double)jb->a : 0.0;
+        e = 0.0;
+        for( j = lo ; j < hi ; ++j )
+        {
+            if(c->s < 0)
+                v = (j & 1) ? im[j >> 1] : re[j >> 1];
+            else if(j < m)
+                v = re[j] * wt[2 * j] + im[j] * wt[2 * j + 1];
+            else
+                v = im[j - m] * wt[2 * (j - m)] - re[j - m] * wt[2 * (j - m) + 1];
+            v *= c->iwt[j];
+            r = floor(v + 0.5);
+            if(fabs(v - r) > e)
+                e = fabs(v - r);
+            r += cy;
+            cy = floor(r * c->ibw[c->big[j]] + 0.5);
+            z[j] = r - cy * c->bw[c->big[j]];
+        }
+        c->cy[t] = cy;
+        c->terr[t] = e;
+        break;
+    }
+}
+
+static void dwt_pass(dwt_ctx *c, dwt_job *jb, int pass)
+{
+    jb->pass = pass;
+    if(c->pool)
+        pool_run(c->pool, dwt_thread, jb);
+    else
+        dwt_thread(jb, 0);
+}
+
+/* the n / 2 point complex FFT of (re, im), with the points already in
+   bit reversed order, and with the inverse transform unscaled */
+
+static void dwt_fft(dwt_ctx *c, dwt_job *jb, int inv)
+{   unsigned long h;
+
+    jb->inv = inv;
+    dwt_pass(c, jb, DWT_BLOCKS);
+    for( h = (c->n >> 1) / c->threads ; h < c->n >> 1 ; h <<= 1 )
+    {
+        jb->h = h;
+        dwt_pass(c, jb, DWT_STAGE);
+    }
+}
+
+/* z = z * y - a, or z = z^2 - a if y is z */
+
+static void dwt_mul_sub(dwt_ctx *c, double *z, const double *y, long a)
+{   dwt_job jb;
+    unsigned int t;
+
+    jb.c = c;
+    jb.a = a;
+    jb.z = z;
+    jb.sqr = y == z;
+    if(!jb.sqr)
+    {
+        jb.x = y;
+        jb.re = c->re2;
+        jb.im = c->im2;
+        dwt_pass(c, &jb, DWT_PACK);
+        dwt_fft(c, &jb, 0);
+    }
+    jb.x = z;
+    jb.re = c->re;
+    jb.im = c->im;
+    dwt_pass(c, &jb, DWT_PACK);
+    dwt_fft(c, &jb, 0);
+    dwt_pass(c, &jb, DWT_MUL);
+    dwt_pass(c, &jb, DWT_BITREV);
+    dwt_fft(c, &jb, 1);
+    dwt_pass(c, &jb, DWT_ROUND);
+
+    for( t = 0 ; t < c->threads ; ++t )
+    {
+        if(c->terr[t] > c->err)
+            c->err = c->terr[t];
+        dwt_carry(c, z, (unsigned long)((unsigned long long)c->n * (t + 1) / c->threads), c->cy[t]);
+    }
+}
+
+void dwt_square(dwt_ctx *c, long a)
+{
+    dwt_mul_sub(c, c->x, c->x, a);
+}
+
+void dwt_mul(dwt_ctx *c, double *z, const double *y)
+{
+    dwt_mul_sub(c, z, y, 0);
+}
+
+/* Modulo 2^q - 1, with the words made non-negative, 0 is either 0 or
+   2^q - 1, all of whose words are 2^bits[j] - 1. Modulo 2^q + 1 the
+   balanced words give each residue one form at most. */
+
+int dwt_is_zero(dwt_ctx *c)
+{   unsigned long j, z = 0, f = 0;
+    double cy = 0.0, v;
+
+    if(c->s > 0)
+    {
+        for( j = 0 ; j < c->n ; ++j )
+            if(c->x[j] != 0.0)
+                return 0;
+        return 1;
+    }
+    for( j = 0 ; j < c->n || cy != 0.0 ; ++j )
+    {
+        v = c->x[j & (c->n - 1)] + cy;
+        cy = floor(v * c->ibw[c->big[j & (c->n - 1)]]);
+        c->x[j & (c->n - 1)] = v - cy * c->bw[c->big[j & (c->n - 1)]];
+    }
+    for( j = 0 ; j < c->n ; ++j )
+    {
+        z += c->x[j] == 0.0;
+        f += c->x[j] == c->bw[c->big[j]] - 1.0;
+    }
+    return z == c->n || f == c->n;
+}
+
+int dwt_mersenne_prime_p(unsigned long q)
+{   dwt_ctx c;
+    unsigned long i, n;
+    int r;
+
+    if(q == 2)
+        return 1;
+    for( n = dwt_length(q) ; ; n <<= 1 )
+    {
+        if(!dwt_init(&c, q, -1, n))
+            return 0;
+        dwt_set_ui(&c, 4);
+        for( i = 2 ; i < q && c.err < DWT_MAX_ERROR ; ++i )
+            dwt_square(&c, 2);
+        if(c.err < DWT_MAX_ERROR)
+        {
+            r = dwt_is_zero(&c);
+            dwt_clear(&c);
+            return r;
+        }
+        dwt_clear(&c);
+    }
+}
+
+/* F(k) is prime if and only if 3^((F(k) - 1) / 2) = -1 mod F(k) */
+
+int dwt_fermat_prime_p(unsigned long k)
+{   dwt_ctx c;
+    unsigned long i, n, q = 1ul << k;
+    int r;
+
+    if(k < 2)
+        return 1;
+    for( n = dwt_length(q) ; ; n <<= 1 )
+    {
+        if(!dwt_init(&c, q, 1, n))
+            return 0;
+        dwt_set_ui(&c, 3);
+        for( i = 1 ; i < q && c.err < DWT_MAX_ERROR ; ++i )
+            dwt_square(&c, 0);
+        if(c.err < DWT_MAX_ERROR)
+        {
+            dwt_add_si(&c, 1);
+            r = dwt_is_zero(&c);
+            dwt_clear(&c);
+            return r;
+        }
+        dwt_clear(&c);
+    }
+}
+
+/* The checkpoint file holds q, s (0 for -1, 1 for 1), n and i0 as 32
+   bit little endian numbers after the magic number, then the n words of
+   x0 as 32 bit two's complement numbers, and the FNV-1a hash of all of
+   these bytes. It is written under a temporary name and then renamed
+   over the last one, which is atomic on POSIX systems, so that a crash
+   while writing it leaves the last one in place. On Windows rename does
+   not replace a file, so the last one is removed first, and if a crash
+   comes between the two, the temporary file is read instead. */
+
+#define DWT_MAGIC       0x54574442ul
+#define DWT_HEADER      20
+
+static void dwt_put32(unsigned char *p, unsigned long v)
+{
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+    p[2] = (unsigned char)(v >> 16);
+    p[3] = (unsigned char)(v >> 24);
+}
+
+static unsigned long dwt_get32(const unsigned char *p)
+{
+    return p[0] | (unsigned long)p[1] << 8
+                | (unsigned long)p[2] << 16 | (unsigned long)p[3] << 24;
+}
+
+static unsigned long dwt_hash(const unsigned char *p, size_t len)
+{   unsigned long h = 2166136261ul;
+
+    while(len--)
+        h = ((h ^ *p++) * 16777619ul) & 0xfffffffful;
+    return h;
+}
+
+static void dwt_gerbicz_save(dwt_gerbicz *g)
+{   dwt_ctx *c = g->c;
+    size_t j, len = DWT_HEADER + 4 * c->n;
+    unsigned char *p = (unsigned char*)malloc(len + 4);
+    char *tmp = (char*)malloc(strlen(g->file) + 5);
+    FILE *f;
+
+    if(p && tmp)
+    {
+        dwt_put32(p, DWT_MAGIC);
+        dwt_put32(p + 4, c->q);
+        dwt_put32(p + 8, c->s > 0);
+        dwt_put32(p + 12, c->n);
+        dwt_put32(p + 16, g->i0);
+        for( j = 0 ; j < c->n ; ++j )
+            dwt_put32(p + DWT_HEADER + 4 * j, (unsigned long)(long)g->x0[j]);
+        dwt_put32(p + len, dwt_hash(p, len));
+        strcat(strcpy(tmp, g->file), ".tmp");
+        if((f = fopen(tmp, "wb")) != 0)
+        {
+            j = fwrite(p, 1, len + 4, f);
+            if(fclose(f) == 0 && j == len + 4)
+            {
+#if defined( _WIN32 )
+                remove(g->file);
+#endif
+                rename(tmp, g->file);
+            }
+        }
+    }
+    free(tmp);
+    free(p);
+}
+
+/* 1 if the file name is a checkpoint for this modulus and transform
+   length and its hash is right, with its len + 4 bytes read into p */
+
+static int dwt_gerbicz_read(dwt_gerbicz *g, const char *name,
+                                    unsigned char *p, size_t len)
+{   dwt_ctx *c = g->c;
+    FILE *f;
+    int ok = 0;
+
+    if((f = fopen(name, "rb")) != 0)
+    {
+        ok = fread(p, 1, len + 4, f) == len + 4 && fgetc(f) == EOF
+                && dwt_get32(p) == DWT_MAGIC && dwt_get32(p + 4) == c->q
+                && dwt_get32(p + 8) == (unsigned long)(c->s > 0)
+                && dwt_get32(p + 12) == c->n
+                && dwt_get32(p + len) == dwt_hash(p, len);
+        fclose(f);
+    }
+    return ok;
+}
+
+/* 1 if the checkpoint file, or failing that the temporary file of an
+   interrupted save, is good, with g set up to resume from it */
+
+static int dwt_gerbicz_load(dwt_gerbicz *g)
+{   dwt_ctx *c = g->c;
+    size_t j, len = DWT_HEADER + 4 * c->n;
+    unsigned char *p = (unsigned char*)malloc(len + 4);
+    char *tmp = (char*)malloc(strlen(g->file) + 5);
+    unsigned long v;
+    int ok = 0;
+
+    if(p && tmp)
+    {
+        ok = dwt_gerbicz_read(g, g->file, p, len);
+        if(!ok)
+            ok = dwt_gerbicz_read(g, strcat(strcpy(tmp, g->file), ".tmp"), p, len);
+    }
+    if(ok)
+    {
+        g->i = g->i0 = dwt_get32(p + 16);
+        for( j = 0 ; j < c->n ; ++j )
+        {
+            v = dwt_get32(p + DWT_HEADER + 4 * j);
+            c->x[j] = v & 0x80000000ul ? -(double)(0x100000000ull - v) : (double)v;
+        }
+    }
+    free(tmp);
+    free(p);
+    return ok;
+}
+
+int dwt_gerbicz_init(dwt_gerbicz *g, dwt_ctx *c, unsigned long L,
+                                                const char *file)
+{   size_t bytes = c->n * sizeof(double);
+
+    g->c = c;
+    g->L = L;
+    g->i = g->i0 = g->b = 0;
+    g->checks = g->fails = 0;
+    g->file = file;
+    g->x0 = (double*)malloc(bytes);
+    g->d = (double*)malloc(bytes);
+    g->dp = (double*)malloc(bytes);
+    g->t = (double*)malloc(bytes);
+    if(!g->x0 || !g->d || !g->dp || !g->t)
+    {
+        dwt_gerbicz_clear(g);
+        return 0;
+    }
+    if(file)
+        dwt_gerbicz_load(g);
+    memcpy(g->x0, c->x, bytes);
+    memcpy(g->d, c->x, bytes);
+    return 1;
+}
+
+void dwt_gerbicz_clear(dwt_gerbicz *g)
+{
+    free(g->x0);
+    free(g->d);
+    free(g->dp);
+    free(g->t);
+    g->x0 = g->d = g->dp = g->t = 0;
+}
+
+/* check d = x0 * dp^(2^L); on success start the blocks again from the
+   residue now, and on failure go back to x0 */
+
+static int dwt_gerbicz_check(dwt_gerbicz *g)
+{   dwt_ctx *c = g->c;
+    size_t bytes = c->n * sizeof(double);
+    unsigned long j;
+    int ok;
+
+    ++g->checks;
+    memcpy(g->t, g->dp, bytes);
+    for( j = 0 ; j < g->L ; ++j )
+        dwt_mul(c, g->t, g->t);
+    dwt_mul(c, g->t, g->x0);
+    for( j = 0 ; j < c->n && g->t[j] == g->d[j] ; ++j )
+        ;
+    ok = j == c->n;
+    if(ok)
+    {
+        memcpy(g->x0, c->x, bytes);
+        g->i0 = g->i;
+        if(g->file)
+            dwt_gerbicz_save(g);
+    }
+    else
+    {
+        ++g->fails;
+        memcpy(c->x, g->x0, bytes);
+        g->i = g->i0;
+    }
+    memcpy(g->d, g->x0, bytes);
+    g->b = 0;
+    return ok;
+}
+
+int dwt_gerbicz_run(dwt_gerbicz *g, unsigned long i)
+{   dwt_ctx *c = g->c;
+    unsigned long k;
+    int fails = 0;
+
+    if(g->L == 0)
+    {
+        for( ; g->i < i ; ++g->i )
+            dwt_square(c, 0);
+        return 0;
+    }
+    while(g->i < i)
+    {
+        k = g->L - (g->i - g->i0) % g->L;
+        if(k > i - g->i)
+            k = i - g->i;
+        for( ; k > 0 ; --k, ++g->i )
+            dwt_square(c, 0);
+        if((g->i - g->i0) % g->L == 0)
+        {
+            memcpy(g->dp, g->d, c->n * sizeof(double));
+            dwt_mul(c, g->d, c->x);
+            ++g->b;
+        }
+        if(g->b == g->L || (g->i == i && g->b > 0))
+        {
+            if(dwt_gerbicz_check(g))
+                fails = 0;
+            else if(++fails == 3)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* 3^(2^i) by dwt_gerbicz_run, with the transform length doubled if the
+   checks keep failing; then x + a = 0 for a probable prime */
+
+static int dwt_prp(unsigned long q, int s, unsigned long i, long a,
+                            unsigned long L, const char *file)
+{   dwt_ctx c;
+    dwt_gerbicz g;
+    unsigned long n;
+    int r;
+
+    for( n = dwt_length(q) ; ; n <<= 1 )
+    {
+        if(!dwt_init(&c, q, s, n))
+            return 0;
+        dwt_set_ui(&c, 3);
+        if(!dwt_gerbicz_init(&g, &c, L, file))
+        {
+            dwt_clear(&c);
+            return 0;
+        }
+        r = dwt_gerbicz_run(&g, i);
+        dwt_gerbicz_clear(&g);
+        if(r == 0)
+        {
+            dwt_add_si(&c, a);
+            r = dwt_is_zero(&c);
+            dwt_clear(&c);
+            return r;
+        }
+        dwt_clear(&c);
+    }
+}
+
+int dwt_mersenne_prp(unsigned long q, unsigned long L, const char *file)
+{
+    return dwt_prp(q, -1, q, -9, L, file);
+}
+
+int dwt_fermat_prp(unsigned long k, unsigned long L, const char *file)
+{
+    if(k < 2)
+        return 1;
+    return dwt_prp(1ul << k, 1, (1ul << k) - 1, 1, L, file);
+}
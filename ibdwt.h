@@ -0,0 +1,139 @@
+/*  Irrational base discrete weighted transform (IBDWT) squaring modulo
+    2^q - 1 and 2^q + 1 for the MPIR benchmark
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of version 2.1 of the GNU General Public License
+    as published by the Free Software Foundation; it is not distributable
+    under version 3 (or any later version) of the GNU General Public License.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+*/
+
+#ifndef _IBDWT_H
+#define _IBDWT_H
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#define DWT_MAX_THREADS 64
+
+/* a residue modulo 2^q + s (s = -1 or 1) held as n double precision
+   words, word j having bits[j] bits, in the balanced form
+   -2^(bits[j] - 1) <= x[j] < 2^(bits[j] - 1), and the tables used to
+   square it
+*/
+typedef struct
+{   unsigned long   q;          /* the modulus is 2^q + s           */
+    int             s;
+    unsigned long   n;          /* the number of words, a power of 2 */
+    unsigned char  *big;        /* word j has bw[big[j]] bits        */
+    double          bw[2];      /* 2^b and 2^(b + 1) for b = q / n   */
+    double          ibw[2];     /* and their inverses                */
+    double         *x;          /* the words                         */
+    double         *wt;         /* the weights                       */
+    double         *iwt;        /* 1 / (weight * n / 2)              */
+    double         *re, *im;    /* the n / 2 point complex transform */
+    double         *re2, *im2;  /* and that of a second factor       */
+    double         *cs, *sn;    /* cos and -sin of 2 pi k / n        */
+    unsigned long  *rev;        /* bit reversal on n / 2 points      */
+    double          err;        /* the largest rounding error so far */
+    unsigned int    threads;    /* the threads used by dwt_square    */
+    struct thread_pool_s *pool; /* which wait between its passes     */
+    double          cy[DWT_MAX_THREADS];
+    double          terr[DWT_MAX_THREADS];
+} dwt_ctx;
+
+/* the transform length used for 2^q +- 1 by dwt_init when n is 0 */
+unsigned long dwt_length(unsigned long q);
+
+/* set up c for 2^q + s with n words (or dwt_length(q) if n is 0), with
+   the residue set to 0 and one thread; for s = 1, q must be a power of
+   2, as for the Fermat numbers; returns 0 if n is not a power of 2 that
+   gives from 1 to 32 bits per word or memory is short
+*/
+int dwt_init(dwt_ctx *c, unsigned long q, int s, unsigned long n);
+
+void dwt_clear(dwt_ctx *c);
+
+/* run dwt_square on up to t threads (a power of 2, at most n / 4),
+   which are started here and kept until dwt_clear or the next call */
+void dwt_set_threads(dwt_ctx *c, unsigned int t);
+
+/* set the residue to v < 2^31 */
+void dwt_set_ui(dwt_ctx *c, unsigned long v);
+
+/* x = x + a modulo 2^q + s */
+void dwt_add_si(dwt_ctx *c, long a);
+
+/* x = x^2 - a modulo 2^q + s */
+void dwt_square(dwt_ctx *c, long a);
+
+/* z = z * y modulo 2^q + s for residues z and y of n words (such as
+   c->x), or z = z^2 if y is z */
+void dwt_mul(dwt_ctx *c, double *z, const double *y);
+
+/* 1 if the residue is 0 modulo 2^q + s */
+int dwt_is_zero(dwt_ctx *c);
+
+/* Repeated squaring of the residue of c with the error check of
+   R. Gerbicz: d, the product of the residues at the ends of blocks of
+   L iterations, is updated by one multiplication per block, and after
+   L blocks d = x0 * dp^(2^L) is checked at the cost of L squarings,
+   where dp is d before the last block and x0 is the residue at which
+   the blocks started. If the check fails, the squaring goes back to
+   x0. With a file name, the residue is saved there with a checksum
+   after each check that passes, and resumed from there by
+   dwt_gerbicz_init.
+*/
+typedef struct
+{   dwt_ctx        *c;
+    unsigned long   L;          /* iterations per block (0 for none) */
+    unsigned long   i;          /* iterations done                   */
+    unsigned long   i0;         /* iterations at the last check      */
+    unsigned long   b;          /* blocks done since then            */
+    double         *x0;         /* the residue at the last check     */
+    double         *d, *dp;     /* the product and the one before    */
+    double         *t;
+    unsigned long   checks;     /* the checks made                   */
+    unsigned long   fails;      /* and those that failed             */
+    const char     *file;       /* the checkpoint file, or 0         */
+} dwt_gerbicz;
+
+/* start with the residue of c at iteration 0, or resume from the file;
+   returns 0 if memory is short */
+int dwt_gerbicz_init(dwt_gerbicz *g, dwt_ctx *c, unsigned long L,
+                                                const char *file);
+
+void dwt_gerbicz_clear(dwt_gerbicz *g);
+
+/* square until iteration i, checking the blocks completed on the way
+   and at the end (the iterations after the last complete block are not
+   checked); returns 0, or -1 if three checks in a row fail */
+int dwt_gerbicz_run(dwt_gerbicz *g, unsigned long i);
+
+/* the Lucas-Lehmer test of 2^q - 1 for an odd prime q, by dwt_square,
+   which is repeated with a longer transform if the rounding errors
+   become too large: returns 1 if 2^q - 1 is prime and 0 if not
+*/
+int dwt_mersenne_prime_p(unsigned long q);
+
+/* the same for Pepin's test of the Fermat number 2^(2^k) + 1 */
+int dwt_fermat_prime_p(unsigned long k);
+
+/* the base 3 probable prime test of 2^q - 1, 3^(2^q) = 9, and Pepin's
+   test of 2^(2^k) + 1, with Gerbicz checks on blocks of L iterations
+   and the checkpoint file (if not 0): return 1 for a probable prime,
+   0 if not */
+int dwt_mersenne_prp(unsigned long q, unsigned long L, const char *file);
+int dwt_fermat_prp(unsigned long k, unsigned long L, const char *file);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -27,6 +27,7 @@ Boston, MA 02110-1301, USA.
 #else
 #include "gmp.h"
 #endif
+#include "threads.h"
 
 #define BITS_PER_ULONG	(8*sizeof(unsigned long))
 #define BITS_TO_LIMBS(x)	(((x)+GMP_NUMB_BITS-1)/GMP_NUMB_BITS)
@@ -53,27 +54,64 @@ Boston, MA 02110-1301, USA.
 #define NEED_MULMOD
 #endif
 
+/* Reduction mod 2^k - 1 at the mpn level: if the 2 * n limbs at tp are
+   T = H * 2^k + L with L < 2^k, then T = L + H mod 2^k - 1, and the
+   carry out of bit k of L + H is folded back in once more. T < 2^(2k),
+   so H < 2^k. tp has room for 4 * n limbs. */
+static void
+fold_2expm1 (mp_ptr xp, mp_ptr tp, mp_size_t k)
+{
+  mp_size_t i, n, q;
+  unsigned long b;
+  mp_limb_t cy;
+  mp_ptr hp;
+
+  n = BITS_TO_LIMBS (k);
+  q = k / GMP_NUMB_BITS;
+  b = k % GMP_NUMB_BITS;
+  hp = tp + 2 * n;
+  if (b != 0)
+    {
+      mpn_rshift (hp, tp + q, 2 * n - q, b);
+      tp[q] &= ((mp_limb_t) 1 << b) - 1;
+    }
+  else
+    for (i = 0; i < n; i++)
+      hp[i] = tp[n + i];
+  cy = mpn_add_n (xp, tp, hp, n);
+  if (b != 0)
+    {
+      cy = xp[n - 1] >> b;
+      xp[n - 1] &= ((mp_limb_t) 1 << b) - 1;
+    }
+  ASSERT_NOCARRY (mpn_add_1 (xp, xp, n, cy));
+}
+
 #ifdef NEED_MULMOD
-#define MPN_NORMALIZE(pp,pn)	do{while(pn>0 && pp[pn-1]==0)pn--;}while(0)
-#include <string.h>
-#define MPN_COPY(ap,bp,pn)	memcpy(ap,bp,pn*sizeof(ap[0]))
-void	mpn_mulmod_2expm1 (mp_ptr xp,mp_ptr yp,mp_ptr zp,mp_size_t k2,mp_ptr tp)
-{mpz_t x,y,z,m;mp_size_t n,tn;
-
-n=BITS_TO_LIMBS(k2);
-mpz_init2(y,k2);mpz_init2(z,k2);
-mpz_init2(m,k2);mpz_init2(x,2*k2);
-mpz_set_ui(m,1);mpz_mul_2exp(m,m,k2);mpz_sub_ui(m,m,1);
-MPN_COPY(y->_mp_d,yp,n);tn=n;MPN_NORMALIZE(y->_mp_d,tn);y->_mp_size=tn;
-MPN_COPY(z->_mp_d,zp,n);tn=n;MPN_NORMALIZE(z->_mp_d,tn);z->_mp_size=tn;
-mpz_mul(x,y,z);
-mpz_mod(x,x,m);tn=x->_mp_size;if(tn>n)tn=n;
-MPN_COPY(xp,x->_mp_d,tn);if(tn<n)MPN_ZERO(xp+tn,n-tn);
-mpz_clear(x);mpz_clear(y);mpz_clear(z);mpz_clear(m);
-return;}
-#endif
+/* xp = yp * zp mod 2^k2 - 1 for y, z < 2^k2 in n limbs, with the product
+   and the reduction in the 4 * n limbs at tp rather than by mpz_mod */
+void
+mpn_mulmod_2expm1 (mp_ptr xp, mp_ptr yp, mp_ptr zp, mp_size_t k2, mp_ptr tp)
+{
+  mp_size_t n;
 
+  n = BITS_TO_LIMBS (k2);
+  if (zp == yp)
+    mpn_sqr (tp, yp, n);
+  else
+    mpn_mul_n (tp, yp, zp, n);
+  fold_2expm1 (xp, tp, k2);
+}
+#endif
 
+/* Squaring mod 2^k - 1 at the mpn level by mpn_sqr and fold_2expm1.
+   tp has room for 4 * n limbs. */
+static void
+sqrmod_2expm1 (mp_ptr xp, mp_srcptr yp, mp_size_t k, mp_ptr tp)
+{
+  mpn_sqr (tp, yp, BITS_TO_LIMBS (k));
+  fold_2expm1 (xp, tp, k);
+}
 
 static int
 isprime (unsigned long x)
@@ -104,8 +142,9 @@ v(0)=4		v(i)=v(i-1)^2-2
 // trial division(or sieving) would eliminate trial numbers MUCH faster
 // This code is for benchmarking , ie how quick can we run a Lucas-Lehmer test , not how quick can we find Mersenne primes
 // perhaps we should call it lucas_lehmer_p() ?
-int
-mersenne_prime_p (unsigned long k)
+// sqr selects sqrmod_2expm1 rather than mpn_mulmod_2expm1 with xp , xp
+static int
+lucas_lehmer (unsigned long k, int sqr)
 {
   int r, cc;
   unsigned long c, lg;
@@ -129,7 +168,10 @@ mersenne_prime_p (unsigned long k)
   xp[0] = 4;
   for (c = 1; c <= k - 2; c++)
     {
-      mpn_mulmod_2expm1 (rp, xp, xp, k, tp);	//    mpn_sqrmod_2expm1 would be faster
+      if (sqr)
+	sqrmod_2expm1 (rp, xp, k, tp);
+      else
+	mpn_mulmod_2expm1 (rp, xp, xp, k, tp);
       cc = mpn_sub_1 (rp, rp, n, 2);
       ASSERT_NOCARRY (mpn_sub_1 (rp, rp, n, cc));
       sp = xp;
@@ -149,6 +191,209 @@ mersenne_prime_p (unsigned long k)
   return r;
 }
 
+int
+mersenne_prime_p (unsigned long k)
+{
+  return lucas_lehmer (k, 0);
+}
+
+int
+mersenne_prime_sqr_p (unsigned long k)
+{
+  return lucas_lehmer (k, 1);
+}
+
+/*
+Trial factoring of 2^p-1 for an odd prime p
+
+Any factor q of 2^p-1 is q=2kp+1 with q=+-1 mod 8 , so that k=0 or 3p mod 4 ,
+and 2^p=1 mod q . The k in each segment are sieved by the odd primes r below
+TF_SIEVE_MAX , which divide 2kp+1 for k=-1/(2p) mod r , and 2^p mod q is only
+computed for the k that are left . q<2^32 , so the products fit in 64 bits
+*/
+#define TF_SIEVE_MAX	1024
+#define TF_SEGMENT	16384
+
+static unsigned long tf_primes[TF_SIEVE_MAX / 2], tf_nprimes;
+
+static void
+tf_init (void)
+{
+  unsigned long r, n = 0;
+
+  if (tf_nprimes != 0)
+    return;
+  for (r = 3; r < TF_SIEVE_MAX; r += 2)
+    if (isprime (r))
+      tf_primes[n++] = r;
+  tf_nprimes = n;
+}
+
+// 2^p mod q , left to right so that the multiplications by 2 are shifts
+static unsigned long long
+pow2mod (unsigned long p, unsigned long long q)
+{
+  unsigned long long r = 1;
+  int i;
+
+  for (i = BITS_PER_ULONG - 1; i >= 0 && !(p >> i & 1); i--)
+    ;
+  for (; i >= 0; i--)
+    {
+      r = r * r % q;
+      if (p >> i & 1 && (r <<= 1) >= q)
+	r -= q;
+    }
+  return r;
+}
+
+// returns a factor q<2^bits (bits<=32) of 2^p-1 , or 0 if there is none
+// or there is no memory for the sieve , which leaves it to Lucas-Lehmer
+static unsigned long
+mersenne_tf (unsigned long p, unsigned int bits)
+{
+  unsigned long long kmax, k0, k, q;
+  unsigned long i, j, r, kn, *nx;
+  unsigned char sv[TF_SEGMENT];
+
+  // 2^p-1 is its own factor below 2^p , so stop at 2^(p/2)
+  if (bits > 32)
+    bits = 32;
+  if (bits > p / 2)
+    bits = p / 2;
+  kmax = ((1ull << bits) - 1) / (2 * p);
+  if (kmax == 0)
+    return 0;
+  // nx[j] is the next k to be struck out by the j'th sieve prime
+  nx = malloc (tf_nprimes * sizeof (unsigned long));
+  if (nx == 0)
+    return 0;
+  for (j = 0; j < tf_nprimes; j++)
+    {
+      r = tf_primes[j];
+      if (r == p)
+	{
+	  nx[j] = ~0ul;
+	  continue;
+	}
+      // k=-1/(2p) mod r , as 2p*(r-1)/2=-p and 1/p=p^(r-2) mod r
+      for (k = 1, i = r - 2, q = p % r; i != 0; i >>= 1, q = q * q % r)
+	if (i & 1)
+	  k = k * q % r;
+      nx[j] = (unsigned long) ((r - 1) / 2 * k % r);
+      // don't sieve out q=r itself
+      if (2 * nx[j] * p + 1 == r)
+	nx[j] += r;
+    }
+  for (k0 = 0; k0 <= kmax; k0 += TF_SEGMENT)
+    {
+      for (i = 0; i < TF_SEGMENT; i++)
+	sv[i] = (k0 + i) % 4 == 0 || (k0 + i) % 4 == 3 * p % 4;
+      sv[0] &= k0 != 0;
+      for (j = 0; j < tf_nprimes; j++)
+	{
+	  for (i = nx[j]; i < k0 + TF_SEGMENT; i += tf_primes[j])
+	    sv[i - k0] = 0;
+	  if (nx[j] != ~0ul)
+	    nx[j] = i;
+	}
+      kn = kmax - k0 + 1 < TF_SEGMENT ? (unsigned long) (kmax - k0 + 1) : TF_SEGMENT;
+      for (i = 0; i < kn; i++)
+	if (sv[i])
+	  {
+	    q = 2 * (k0 + i) * p + 1;
+	    if (pow2mod (p, q) == 1)
+	      {
+		free (nx);
+		return (unsigned long) q;
+	      }
+	  }
+    }
+  free (nx);
+  return 0;
+}
+
+/*
+A search for Mersenne primes 2^p-1 with p0<=p<=p1 , as it would be run in practice :
+the prime exponents are trial factored to 2^tf_bits , and the Lucas-Lehmer test
+is run on the survivors , with both stages shared out between nthreads threads
+*/
+typedef struct
+{
+  unsigned long *p;		// the prime exponents
+  unsigned long n;		// and their number
+  unsigned char *st;		// 0 factored , 1 survived trial factoring , 2 prime
+  unsigned int tf_bits, nthreads, stage;
+} search_job;
+
+static void
+search_thread (void *arg, unsigned int t)
+{
+  search_job *sj = (search_job *) arg;
+  unsigned long i;
+
+  for (i = t; i < sj->n; i += sj->nthreads)
+    if (sj->stage == 0)
+      sj->st[i] = mersenne_tf (sj->p[i], sj->tf_bits) == 0;
+    else if (sj->st[i])
+      sj->st[i] += lucas_lehmer (sj->p[i], 1);
+}
+
+// returns the number of Mersenne primes found , and the numbers of exponents
+// tried and of Lucas-Lehmer tests run in *tried and *ll if these are not 0 ,
+// all of which are 0 if there is no memory for the list of exponents
+unsigned long
+mersenne_search (unsigned long p0, unsigned long p1, unsigned int tf_bits,
+		 unsigned int nthreads, unsigned long *tried, unsigned long *ll)
+{
+  search_job sj;
+  unsigned long p, i, found = 0, tests = 0;
+
+  if (p0 < 3)
+    p0 = 3;
+  if (nthreads == 0)
+    nthreads = num_cores ();
+  tf_init ();
+  sj.n = 0;
+  sj.p = malloc ((p1 / 2 + 1) * sizeof (unsigned long));
+  if (sj.p == 0)
+    sj.st = 0;
+  else
+    {
+      for (p = p0 | 1; p <= p1; p += 2)
+	if (isprime (p))
+	  sj.p[sj.n++] = p;
+      sj.st = malloc (sj.n + 1);
+    }
+  if (sj.st == 0)
+    {
+      free (sj.p);
+      if (tried)
+	*tried = 0;
+      if (ll)
+	*ll = 0;
+      return 0;
+    }
+  sj.tf_bits = tf_bits;
+  sj.nthreads = nthreads;
+  sj.stage = 0;
+  run_threads (search_thread, &sj, nthreads);
+  sj.stage = 1;
+  run_threads (search_thread, &sj, nthreads);
+  for (i = 0; i < sj.n; i++)
+    {
+      tests += sj.st[i] != 0;
+      found += sj.st[i] == 2;
+    }
+  if (tried)
+    *tried = sj.n;
+  if (ll)
+    *ll = tests;
+  free (sj.st);
+  free (sj.p);
+  return found;
+}
+
 #ifdef STANDALONE
 int
 main (int argc, char *argv[])
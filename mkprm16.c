@@ -0,0 +1,77 @@
+/* mkprm16.c
+
+   Writes prm16.h, the compiled-in table of primes < 65538 used by trn.c,
+   together with the inverse of each odd prime modulo 2^64 and the bound
+   floor((2^64 - 1)/p). An unsigned 64-bit x is divisible by the odd
+   prime p if and only if x*inv(p) mod 2^64 <= floor((2^64 - 1)/p), so
+   trial division by table primes needs a multiply and a compare but no
+   hardware divide.
+
+   Build and run with:  cc mkprm16.c -o mkprm16 && ./mkprm16 > prm16.h
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define NPRIMES  6543  /* primes < 2^16 + 2 */
+#define LIMIT    65538
+
+static unsigned long prime[NPRIMES + 2];
+
+int main(void)
+{
+    static unsigned char comp[LIMIT];
+    unsigned long i, j, n;
+    uint64_t inv;
+
+    for( i = 2, n = 0 ; i < LIMIT ; ++i )
+    {
+        if(comp[i])
+            continue;
+        prime[++n] = i;
+        for( j = i * i ; j < LIMIT ; j += i )
+            comp[j] = 1;
+    }
+    if(n != NPRIMES)
+    {
+        fprintf(stderr, "expected %d primes, found %lu\n", NPRIMES, n);
+        return 1;
+    }
+
+    printf("/* prm16.h --- generated by mkprm16.c, do not edit.\n\n");
+    printf("   ulPrime16[i] is the ith prime (1 <= i <= %d), with zero markers\n", NPRIMES);
+    printf("   at both ends. For odd primes, ullPrime16Inv[i] is the inverse of\n");
+    printf("   ulPrime16[i] modulo 2^64 and ullPrime16Lim[i] is\n");
+    printf("   floor((2^64 - 1)/ulPrime16[i]); see __DIVISIBLE16 in trn.h. */\n\n");
+
+    printf("unsigned long ulPrime16[%d]=\n  {\n  0,", NPRIMES + 2);
+    for( i = 1 ; i <= NPRIMES + 1 ; ++i )
+        printf("%s%lu%s", (i % 10 == 1 ? "\n  " : " "), prime[i],
+               (i <= NPRIMES ? "," : ""));
+    printf("\n  };\n\n");
+
+    printf("uint64_t ullPrime16Inv[%d]=\n  {\n  __ULL(0), __ULL(0),", NPRIMES + 2);
+    for( i = 2 ; i <= NPRIMES + 1 ; ++i )
+    {
+        inv = 0;
+        if(i <= NPRIMES)
+        {
+            /* Newton iteration; each step doubles the number of
+               correct low bits, starting from 3 (p*p == 1 mod 8). */
+            inv = prime[i];
+            for( j = 0 ; j < 5 ; ++j )
+                inv *= 2 - prime[i] * inv;
+        }
+        printf("%s__ULL(0x%016llX)%s", (i % 3 == 2 ? "\n  " : " "),
+               (unsigned long long)inv, (i <= NPRIMES ? "," : ""));
+    }
+    printf("\n  };\n\n");
+
+    printf("uint64_t ullPrime16Lim[%d]=\n  {\n  __ULL(0), __ULL(0),", NPRIMES + 2);
+    for( i = 2 ; i <= NPRIMES + 1 ; ++i )
+        printf("%s__ULL(0x%016llX)%s", (i % 3 == 2 ? "\n  " : " "),
+               (unsigned long long)(i <= NPRIMES ? UINT64_MAX / prime[i] : 0),
+               (i <= NPRIMES ? "," : ""));
+    printf("\n  };\n");
+    return 0;
+}
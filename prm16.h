@@ -0,0 +1,5038 @@
+/* prm16.h --- generated by mkprm16.c, do not edit.
+
+   ulPrime16[i] is the ith prime (1 <= i <= 6543), with zero markers
+   at both ends. For odd primes, ullPrime16Inv[i] is the inverse of
+   ulPrime16[i] modulo 2^64 and ullPrime16Lim[i] is
+   floor((2^64 - 1)/ulPrime16[i]); see __DIVISIBLE16 in trn.h. */
+
+unsigned long ulPrime16[6545]=
+  {
+  0,
+  2, 3, 5, 7, 11, 13, 17, 19, 23, 29,
+  31, 37, 41, 43, 47, 53, 59, 61, 67, 71,
+  73, 79, 83, 89, 97, 101, 103, 107, 109, 113,
+  127, 131, 137, 139, 149, 151, 157, 163, 167, 173,
+  179, 181, 191, 193, 197, 199, 211, 223, 227, 229,
+  233, 239, 241, 251, 257, 263, 269, 271, 277, 281,
+  283, 293, 307, 311, 313, 317, 331, 337, 347, 349,
+  353, 359, 367, 373, 379, 383, 389, 397, 401, 409,
+  419, 421, 431, 433, 439, 443, 449, 457, 461, 463,
+  467, 479, 487, 491, 499, 503, 509, 521, 523, 541,
+  547, 557, 563, 569, 571, 577, 587, 593, 599, 601,
+  607, 613, 617, 619, 631, 641, 643, 647, 653, 659,
+  661, 673, 677, 683, 691, 701, 709, 719, 727, 733,
+  739, 743, 751, 757, 761, 769, 773, 787, 797, 809,
+  811, 821, 823, 827, 829, 839, 853, 857, 859, 863,
+  877, 881, 883, 887, 907, 911, 919, 929, 937, 941,
+  947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013,
+  1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069,
+  1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151,
+  1153, 1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223,
+  1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289, 1291,
+  1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373,
+  1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447, 1451,
+  1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511,
+  1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583,
+  1597, 1601, 1607, 1609, 1613, 1619, 1621, 1627, 1637, 1657,
+  1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733,
+  1741, 1747, 1753, 1759, 1777, 1783, 1787, 1789, 1801, 1811,
+  1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879, 1889,
+  1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987,
+  1993, 1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039, 2053,
+  2063, 2069, 2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129,
+  2131, 2137, 2141, 2143, 2153, 2161, 2179, 2203, 2207, 2213,
+  2221, 2237, 2239, 2243, 2251, 2267, 2269, 2273, 2281, 2287,
+  2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347, 2351, 2357,
+  2371, 2377, 2381, 2383, 2389, 2393, 2399, 2411, 2417, 2423,
+  2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521, 2531,
+  2539, 2543, 2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617,
+  2621, 2633, 2647, 2657, 2659, 2663, 2671, 2677, 2683, 2687,
+  2689, 2693, 2699, 2707, 2711, 2713, 2719, 2729, 2731, 2741,
+  2749, 2753, 2767, 2777, 2789, 2791, 2797, 2801, 2803, 2819,
+  2833, 2837, 2843, 2851, 2857, 2861, 2879, 2887, 2897, 2903,
+  2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999,
+  3001, 3011, 3019, 3023, 3037, 3041, 3049, 3061, 3067, 3079,
+  3083, 3089, 3109, 3119, 3121, 3137, 3163, 3167, 3169, 3181,
+  3187, 3191, 3203, 3209, 3217, 3221, 3229, 3251, 3253, 3257,
+  3259, 3271, 3299, 3301, 3307, 3313, 3319, 3323, 3329, 3331,
+  3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413,
+  3433, 3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511,
+  3517, 3527, 3529, 3533, 3539, 3541, 3547, 3557, 3559, 3571,
+  3581, 3583, 3593, 3607, 3613, 3617, 3623, 3631, 3637, 3643,
+  3659, 3671, 3673, 3677, 3691, 3697, 3701, 3709, 3719, 3727,
+  3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797, 3803, 3821,
+  3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907,
+  3911, 3917, 3919, 3923, 3929, 3931, 3943, 3947, 3967, 3989,
+  4001, 4003, 4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057,
+  4073, 4079, 4091, 4093, 4099, 4111, 4127, 4129, 4133, 4139,
+  4153, 4157, 4159, 4177, 4201, 4211, 4217, 4219, 4229, 4231,
+  4241, 4243, 4253, 4259, 4261, 4271, 4273, 4283, 4289, 4297,
+  4327, 4337, 4339, 4349, 4357, 4363, 4373, 4391, 4397, 4409,
+  4421, 4423, 4441, 4447, 4451, 4457, 4463, 4481, 4483, 4493,
+  4507, 4513, 4517, 4519, 4523, 4547, 4549, 4561, 4567, 4583,
+  4591, 4597, 4603, 4621, 4637, 4639, 4643, 4649, 4651, 4657,
+  4663, 4673, 4679, 4691, 4703, 4721, 4723, 4729, 4733, 4751,
+  4759, 4783, 4787, 4789, 4793, 4799, 4801, 4813, 4817, 4831,
+  4861, 4871, 4877, 4889, 4903, 4909, 4919, 4931, 4933, 4937,
+  4943, 4951, 4957, 4967, 4969, 4973, 4987, 4993, 4999, 5003,
+  5009, 5011, 5021, 5023, 5039, 5051, 5059, 5077, 5081, 5087,
+  5099, 5101, 5107, 5113, 5119, 5147, 5153, 5167, 5171, 5179,
+  5189, 5197, 5209, 5227, 5231, 5233, 5237, 5261, 5273, 5279,
+  5281, 5297, 5303, 5309, 5323, 5333, 5347, 5351, 5381, 5387,
+  5393, 5399, 5407, 5413, 5417, 5419, 5431, 5437, 5441, 5443,
+  5449, 5471, 5477, 5479, 5483, 5501, 5503, 5507, 5519, 5521,
+  5527, 5531, 5557, 5563, 5569, 5573, 5581, 5591, 5623, 5639,
+  5641, 5647, 5651, 5653, 5657, 5659, 5669, 5683, 5689, 5693,
+  5701, 5711, 5717, 5737, 5741, 5743, 5749, 5779, 5783, 5791,
+  5801, 5807, 5813, 5821, 5827, 5839, 5843, 5849, 5851, 5857,
+  5861, 5867, 5869, 5879, 5881, 5897, 5903, 5923, 5927, 5939,
+  5953, 5981, 5987, 6007, 6011, 6029, 6037, 6043, 6047, 6053,
+  6067, 6073, 6079, 6089, 6091, 6101, 6113, 6121, 6131, 6133,
+  6143, 6151, 6163, 6173, 6197, 6199, 6203, 6211, 6217, 6221,
+  6229, 6247, 6257, 6263, 6269, 6271, 6277, 6287, 6299, 6301,
+  6311, 6317, 6323, 6329, 6337, 6343, 6353, 6359, 6361, 6367,
+  6373, 6379, 6389, 6397, 6421, 6427, 6449, 6451, 6469, 6473,
+  6481, 6491, 6521, 6529, 6547, 6551, 6553, 6563, 6569, 6571,
+  6577, 6581, 6599, 6607, 6619, 6637, 6653, 6659, 6661, 6673,
+  6679, 6689, 6691, 6701, 6703, 6709, 6719, 6733, 6737, 6761,
+  6763, 6779, 6781, 6791, 6793, 6803, 6823, 6827, 6829, 6833,
+  6841, 6857, 6863, 6869, 6871, 6883, 6899, 6907, 6911, 6917,
+  6947, 6949, 6959, 6961, 6967, 6971, 6977, 6983, 6991, 6997,
+  7001, 7013, 7019, 7027, 7039, 7043, 7057, 7069, 7079, 7103,
+  7109, 7121, 7127, 7129, 7151, 7159, 7177, 7187, 7193, 7207,
+  7211, 7213, 7219, 7229, 7237, 7243, 7247, 7253, 7283, 7297,
+  7307, 7309, 7321, 7331, 7333, 7349, 7351, 7369, 7393, 7411,
+  7417, 7433, 7451, 7457, 7459, 7477, 7481, 7487, 7489, 7499,
+  7507, 7517, 7523, 7529, 7537, 7541, 7547, 7549, 7559, 7561,
+  7573, 7577, 7583, 7589, 7591, 7603, 7607, 7621, 7639, 7643,
+  7649, 7669, 7673, 7681, 7687, 7691, 7699, 7703, 7717, 7723,
+  7727, 7741, 7753, 7757, 7759, 7789, 7793, 7817, 7823, 7829,
+  7841, 7853, 7867, 7873, 7877, 7879, 7883, 7901, 7907, 7919,
+  7927, 7933, 7937, 7949, 7951, 7963, 7993, 8009, 8011, 8017,
+  8039, 8053, 8059, 8069, 8081, 8087, 8089, 8093, 8101, 8111,
+  8117, 8123, 8147, 8161, 8167, 8171, 8179, 8191, 8209, 8219,
+  8221, 8231, 8233, 8237, 8243, 8263, 8269, 8273, 8287, 8291,
+  8293, 8297, 8311, 8317, 8329, 8353, 8363, 8369, 8377, 8387,
+  8389, 8419, 8423, 8429, 8431, 8443, 8447, 8461, 8467, 8501,
+  8513, 8521, 8527, 8537, 8539, 8543, 8563, 8573, 8581, 8597,
+  8599, 8609, 8623, 8627, 8629, 8641, 8647, 8663, 8669, 8677,
+  8681, 8689, 8693, 8699, 8707, 8713, 8719, 8731, 8737, 8741,
+  8747, 8753, 8761, 8779, 8783, 8803, 8807, 8819, 8821, 8831,
+  8837, 8839, 8849, 8861, 8863, 8867, 8887, 8893, 8923, 8929,
+  8933, 8941, 8951, 8963, 8969, 8971, 8999, 9001, 9007, 9011,
+  9013, 9029, 9041, 9043, 9049, 9059, 9067, 9091, 9103, 9109,
+  9127, 9133, 9137, 9151, 9157, 9161, 9173, 9181, 9187, 9199,
+  9203, 9209, 9221, 9227, 9239, 9241, 9257, 9277, 9281, 9283,
+  9293, 9311, 9319, 9323, 9337, 9341, 9343, 9349, 9371, 9377,
+  9391, 9397, 9403, 9413, 9419, 9421, 9431, 9433, 9437, 9439,
+  9461, 9463, 9467, 9473, 9479, 9491, 9497, 9511, 9521, 9533,
+  9539, 9547, 9551, 9587, 9601, 9613, 9619, 9623, 9629, 9631,
+  9643, 9649, 9661, 9677, 9679, 9689, 9697, 9719, 9721, 9733,
+  9739, 9743, 9749, 9767, 9769, 9781, 9787, 9791, 9803, 9811,
+  9817, 9829, 9833, 9839, 9851, 9857, 9859, 9871, 9883, 9887,
+  9901, 9907, 9923, 9929, 9931, 9941, 9949, 9967, 9973, 10007,
+  10009, 10037, 10039, 10061, 10067, 10069, 10079, 10091, 10093, 10099,
+  10103, 10111, 10133, 10139, 10141, 10151, 10159, 10163, 10169, 10177,
+  10181, 10193, 10211, 10223, 10243, 10247, 10253, 10259, 10267, 10271,
+  10273, 10289, 10301, 10303, 10313, 10321, 10331, 10333, 10337, 10343,
+  10357, 10369, 10391, 10399, 10427, 10429, 10433, 10453, 10457, 10459,
+  10463, 10477, 10487, 10499, 10501, 10513, 10529, 10531, 10559, 10567,
+  10589, 10597, 10601, 10607, 10613, 10627, 10631, 10639, 10651, 10657,
+  10663, 10667, 10687, 10691, 10709, 10711, 10723, 10729, 10733, 10739,
+  10753, 10771, 10781, 10789, 10799, 10831, 10837, 10847, 10853, 10859,
+  10861, 10867, 10883, 10889, 10891, 10903, 10909, 10937, 10939, 10949,
+  10957, 10973, 10979, 10987, 10993, 11003, 11027, 11047, 11057, 11059,
+  11069, 11071, 11083, 11087, 11093, 11113, 11117, 11119, 11131, 11149,
+  11159, 11161, 11171, 11173, 11177, 11197, 11213, 11239, 11243, 11251,
+  11257, 11261, 11273, 11279, 11287, 11299, 11311, 11317, 11321, 11329,
+  11351, 11353, 11369, 11383, 11393, 11399, 11411, 11423, 11437, 11443,
+  11447, 11467, 11471, 11483, 11489, 11491, 11497, 11503, 11519, 11527,
+  11549, 11551, 11579, 11587, 11593, 11597, 11617, 11621, 11633, 11657,
+  11677, 11681, 11689, 11699, 11701, 11717, 11719, 11731, 11743, 11777,
+  11779, 11783, 11789, 11801, 11807, 11813, 11821, 11827, 11831, 11833,
+  11839, 11863, 11867, 11887, 11897, 11903, 11909, 11923, 11927, 11933,
+  11939, 11941, 11953, 11959, 11969, 11971, 11981, 11987, 12007, 12011,
+  12037, 12041, 12043, 12049, 12071, 12073, 12097, 12101, 12107, 12109,
+  12113, 12119, 12143, 12149, 12157, 12161, 12163, 12197, 12203, 12211,
+  12227, 12239, 12241, 12251, 12253, 12263, 12269, 12277, 12281, 12289,
+  12301, 12323, 12329, 12343, 12347, 12373, 12377, 12379, 12391, 12401,
+  12409, 12413, 12421, 12433, 12437, 12451, 12457, 12473, 12479, 12487,
+  12491, 12497, 12503, 12511, 12517, 12527, 12539, 12541, 12547, 12553,
+  12569, 12577, 12583, 12589, 12601, 12611, 12613, 12619, 12637, 12641,
+  12647, 12653, 12659, 12671, 12689, 12697, 12703, 12713, 12721, 12739,
+  12743, 12757, 12763, 12781, 12791, 12799, 12809, 12821, 12823, 12829,
+  12841, 12853, 12889, 12893, 12899, 12907, 12911, 12917, 12919, 12923,
+  12941, 12953, 12959, 12967, 12973, 12979, 12983, 13001, 13003, 13007,
+  13009, 13033, 13037, 13043, 13049, 13063, 13093, 13099, 13103, 13109,
+  13121, 13127, 13147, 13151, 13159, 13163, 13171, 13177, 13183, 13187,
+  13217, 13219, 13229, 13241, 13249, 13259, 13267, 13291, 13297, 13309,
+  13313, 13327, 13331, 13337, 13339, 13367, 13381, 13397, 13399, 13411,
+  13417, 13421, 13441, 13451, 13457, 13463, 13469, 13477, 13487, 13499,
+  13513, 13523, 13537, 13553, 13567, 13577, 13591, 13597, 13613, 13619,
+  13627, 13633, 13649, 13669, 13679, 13681, 13687, 13691, 13693, 13697,
+  13709, 13711, 13721, 13723, 13729, 13751, 13757, 13759, 13763, 13781,
+  13789, 13799, 13807, 13829, 13831, 13841, 13859, 13873, 13877, 13879,
+  13883, 13901, 13903, 13907, 13913, 13921, 13931, 13933, 13963, 13967,
+  13997, 13999, 14009, 14011, 14029, 14033, 14051, 14057, 14071, 14081,
+  14083, 14087, 14107, 14143, 14149, 14153, 14159, 14173, 14177, 14197,
+  14207, 14221, 14243, 14249, 14251, 14281, 14293, 14303, 14321, 14323,
+  14327, 14341, 14347, 14369, 14387, 14389, 14401, 14407, 14411, 14419,
+  14423, 14431, 14437, 14447, 14449, 14461, 14479, 14489, 14503, 14519,
+  14533, 14537, 14543, 14549, 14551, 14557, 14561, 14563, 14591, 14593,
+  14621, 14627, 14629, 14633, 14639, 14653, 14657, 14669, 14683, 14699,
+  14713, 14717, 14723, 14731, 14737, 14741, 14747, 14753, 14759, 14767,
+  14771, 14779, 14783, 14797, 14813, 14821, 14827, 14831, 14843, 14851,
+  14867, 14869, 14879, 14887, 14891, 14897, 14923, 14929, 14939, 14947,
+  14951, 14957, 14969, 14983, 15013, 15017, 15031, 15053, 15061, 15073,
+  15077, 15083, 15091, 15101, 15107, 15121, 15131, 15137, 15139, 15149,
+  15161, 15173, 15187, 15193, 15199, 15217, 15227, 15233, 15241, 15259,
+  15263, 15269, 15271, 15277, 15287, 15289, 15299, 15307, 15313, 15319,
+  15329, 15331, 15349, 15359, 15361, 15373, 15377, 15383, 15391, 15401,
+  15413, 15427, 15439, 15443, 15451, 15461, 15467, 15473, 15493, 15497,
+  15511, 15527, 15541, 15551, 15559, 15569, 15581, 15583, 15601, 15607,
+  15619, 15629, 15641, 15643, 15647, 15649, 15661, 15667, 15671, 15679,
+  15683, 15727, 15731, 15733, 15737, 15739, 15749, 15761, 15767, 15773,
+  15787, 15791, 15797, 15803, 15809, 15817, 15823, 15859, 15877, 15881,
+  15887, 15889, 15901, 15907, 15913, 15919, 15923, 15937, 15959, 15971,
+  15973, 15991, 16001, 16007, 16033, 16057, 16061, 16063, 16067, 16069,
+  16073, 16087, 16091, 16097, 16103, 16111, 16127, 16139, 16141, 16183,
+  16187, 16189, 16193, 16217, 16223, 16229, 16231, 16249, 16253, 16267,
+  16273, 16301, 16319, 16333, 16339, 16349, 16361, 16363, 16369, 16381,
+  16411, 16417, 16421, 16427, 16433, 16447, 16451, 16453, 16477, 16481,
+  16487, 16493, 16519, 16529, 16547, 16553, 16561, 16567, 16573, 16603,
+  16607, 16619, 16631, 16633, 16649, 16651, 16657, 16661, 16673, 16691,
+  16693, 16699, 16703, 16729, 16741, 16747, 16759, 16763, 16787, 16811,
+  16823, 16829, 16831, 16843, 16871, 16879, 16883, 16889, 16901, 16903,
+  16921, 16927, 16931, 16937, 16943, 16963, 16979, 16981, 16987, 16993,
+  17011, 17021, 17027, 17029, 17033, 17041, 17047, 17053, 17077, 17093,
+  17099, 17107, 17117, 17123, 17137, 17159, 17167, 17183, 17189, 17191,
+  17203, 17207, 17209, 17231, 17239, 17257, 17291, 17293, 17299, 17317,
+  17321, 17327, 17333, 17341, 17351, 17359, 17377, 17383, 17387, 17389,
+  17393, 17401, 17417, 17419, 17431, 17443, 17449, 17467, 17471, 17477,
+  17483, 17489, 17491, 17497, 17509, 17519, 17539, 17551, 17569, 17573,
+  17579, 17581, 17597, 17599, 17609, 17623, 17627, 17657, 17659, 17669,
+  17681, 17683, 17707, 17713, 17729, 17737, 17747, 17749, 17761, 17783,
+  17789, 17791, 17807, 17827, 17837, 17839, 17851, 17863, 17881, 17891,
+  17903, 17909, 17911, 17921, 17923, 17929, 17939, 17957, 17959, 17971,
+  17977, 17981, 17987, 17989, 18013, 18041, 18043, 18047, 18049, 18059,
+  18061, 18077, 18089, 18097, 18119, 18121, 18127, 18131, 18133, 18143,
+  18149, 18169, 18181, 18191, 18199, 18211, 18217, 18223, 18229, 18233,
+  18251, 18253, 18257, 18269, 18287, 18289, 18301, 18307, 18311, 18313,
+  18329, 18341, 18353, 18367, 18371, 18379, 18397, 18401, 18413, 18427,
+  18433, 18439, 18443, 18451, 18457, 18461, 18481, 18493, 18503, 18517,
+  18521, 18523, 18539, 18541, 18553, 18583, 18587, 18593, 18617, 18637,
+  18661, 18671, 18679, 18691, 18701, 18713, 18719, 18731, 18743, 18749,
+  18757, 18773, 18787, 18793, 18797, 18803, 18839, 18859, 18869, 18899,
+  18911, 18913, 18917, 18919, 18947, 18959, 18973, 18979, 19001, 19009,
+  19013, 19031, 19037, 19051, 19069, 19073, 19079, 19081, 19087, 19121,
+  19139, 19141, 19157, 19163, 19181, 19183, 19207, 19211, 19213, 19219,
+  19231, 19237, 19249, 19259, 19267, 19273, 19289, 19301, 19309, 19319,
+  19333, 19373, 19379, 19381, 19387, 19391, 19403, 19417, 19421, 19423,
+  19427, 19429, 19433, 19441, 19447, 19457, 19463, 19469, 19471, 19477,
+  19483, 19489, 19501, 19507, 19531, 19541, 19543, 19553, 19559, 19571,
+  19577, 19583, 19597, 19603, 19609, 19661, 19681, 19687, 19697, 19699,
+  19709, 19717, 19727, 19739, 19751, 19753, 19759, 19763, 19777, 19793,
+  19801, 19813, 19819, 19841, 19843, 19853, 19861, 19867, 19889, 19891,
+  19913, 19919, 19927, 19937, 19949, 19961, 19963, 19973, 19979, 19991,
+  19993, 19997, 20011, 20021, 20023, 20029, 20047, 20051, 20063, 20071,
+  20089, 20101, 20107, 20113, 20117, 20123, 20129, 20143, 20147, 20149,
+  20161, 20173, 20177, 20183, 20201, 20219, 20231, 20233, 20249, 20261,
+  20269, 20287, 20297, 20323, 20327, 20333, 20341, 20347, 20353, 20357,
+  20359, 20369, 20389, 20393, 20399, 20407, 20411, 20431, 20441, 20443,
+  20477, 20479, 20483, 20507, 20509, 20521, 20533, 20543, 20549, 20551,
+  20563, 20593, 20599, 20611, 20627, 20639, 20641, 20663, 20681, 20693,
+  20707, 20717, 20719, 20731, 20743, 20747, 20749, 20753, 20759, 20771,
+  20773, 20789, 20807, 20809, 20849, 20857, 20873, 20879, 20887, 20897,
+  20899, 20903, 20921, 20929, 20939, 20947, 20959, 20963, 20981, 20983,
+  21001, 21011, 21013, 21017, 21019, 21023, 21031, 21059, 21061, 21067,
+  21089, 21101, 21107, 21121, 21139, 21143, 21149, 21157, 21163, 21169,
+  21179, 21187, 21191, 21193, 21211, 21221, 21227, 21247, 21269, 21277,
+  21283, 21313, 21317, 21319, 21323, 21341, 21347, 21377, 21379, 21383,
+  21391, 21397, 21401, 21407, 21419, 21433, 21467, 21481, 21487, 21491,
+  21493, 21499, 21503, 21517, 21521, 21523, 21529, 21557, 21559, 21563,
+  21569, 21577, 21587, 21589, 21599, 21601, 21611, 21613, 21617, 21647,
+  21649, 21661, 21673, 21683, 21701, 21713, 21727, 21737, 21739, 21751,
+  21757, 21767, 21773, 21787, 21799, 21803, 21817, 21821, 21839, 21841,
+  21851, 21859, 21863, 21871, 21881, 21893, 21911, 21929, 21937, 21943,
+  21961, 21977, 21991, 21997, 22003, 22013, 22027, 22031, 22037, 22039,
+  22051, 22063, 22067, 22073, 22079, 22091, 22093, 22109, 22111, 22123,
+  22129, 22133, 22147, 22153, 22157, 22159, 22171, 22189, 22193, 22229,
+  22247, 22259, 22271, 22273, 22277, 22279, 22283, 22291, 22303, 22307,
+  22343, 22349, 22367, 22369, 22381, 22391, 22397, 22409, 22433, 22441,
+  22447, 22453, 22469, 22481, 22483, 22501, 22511, 22531, 22541, 22543,
+  22549, 22567, 22571, 22573, 22613, 22619, 22621, 22637, 22639, 22643,
+  22651, 22669, 22679, 22691, 22697, 22699, 22709, 22717, 22721, 22727,
+  22739, 22741, 22751, 22769, 22777, 22783, 22787, 22807, 22811, 22817,
+  22853, 22859, 22861, 22871, 22877, 22901, 22907, 22921, 22937, 22943,
+  22961, 22963, 22973, 22993, 23003, 23011, 23017, 23021, 23027, 23029,
+  23039, 23041, 23053, 23057, 23059, 23063, 23071, 23081, 23087, 23099,
+  23117, 23131, 23143, 23159, 23167, 23173, 23189, 23197, 23201, 23203,
+  23209, 23227, 23251, 23269, 23279, 23291, 23293, 23297, 23311, 23321,
+  23327, 23333, 23339, 23357, 23369, 23371, 23399, 23417, 23431, 23447,
+  23459, 23473, 23497, 23509, 23531, 23537, 23539, 23549, 23557, 23561,
+  23563, 23567, 23581, 23593, 23599, 23603, 23609, 23623, 23627, 23629,
+  23633, 23663, 23669, 23671, 23677, 23687, 23689, 23719, 23741, 23743,
+  23747, 23753, 23761, 23767, 23773, 23789, 23801, 23813, 23819, 23827,
+  23831, 23833, 23857, 23869, 23873, 23879, 23887, 23893, 23899, 23909,
+  23911, 23917, 23929, 23957, 23971, 23977, 23981, 23993, 24001, 24007,
+  24019, 24023, 24029, 24043, 24049, 24061, 24071, 24077, 24083, 24091,
+  24097, 24103, 24107, 24109, 24113, 24121, 24133, 24137, 24151, 24169,
+  24179, 24181, 24197, 24203, 24223, 24229, 24239, 24247, 24251, 24281,
+  24317, 24329, 24337, 24359, 24371, 24373, 24379, 24391, 24407, 24413,
+  24419, 24421, 24439, 24443, 24469, 24473, 24481, 24499, 24509, 24517,
+  24527, 24533, 24547, 24551, 24571, 24593, 24611, 24623, 24631, 24659,
+  24671, 24677, 24683, 24691, 24697, 24709, 24733, 24749, 24763, 24767,
+  24781, 24793, 24799, 24809, 24821, 24841, 24847, 24851, 24859, 24877,
+  24889, 24907, 24917, 24919, 24923, 24943, 24953, 24967, 24971, 24977,
+  24979, 24989, 25013, 25031, 25033, 25037, 25057, 25073, 25087, 25097,
+  25111, 25117, 25121, 25127, 25147, 25153, 25163, 25169, 25171, 25183,
+  25189, 25219, 25229, 25237, 25243, 25247, 25253, 25261, 25301, 25303,
+  25307, 25309, 25321, 25339, 25343, 25349, 25357, 25367, 25373, 25391,
+  25409, 25411, 25423, 25439, 25447, 25453, 25457, 25463, 25469, 25471,
+  25523, 25537, 25541, 25561, 25577, 25579, 25583, 25589, 25601, 25603,
+  25609, 25621, 25633, 25639, 25643, 25657, 25667, 25673, 25679, 25693,
+  25703, 25717, 25733, 25741, 25747, 25759, 25763, 25771, 25793, 25799,
+  25801, 25819, 25841, 25847, 25849, 25867, 25873, 25889, 25903, 25913,
+  25919, 25931, 25933, 25939, 25943, 25951, 25969, 25981, 25997, 25999,
+  26003, 26017, 26021, 26029, 26041, 26053, 26083, 26099, 26107, 26111,
+  26113, 26119, 26141, 26153, 26161, 26171, 26177, 26183, 26189, 26203,
+  26209, 26227, 26237, 26249, 26251, 26261, 26263, 26267, 26293, 26297,
+  26309, 26317, 26321, 26339, 26347, 26357, 26371, 26387, 26393, 26399,
+  26407, 26417, 26423, 26431, 26437, 26449, 26459, 26479, 26489, 26497,
+  26501, 26513, 26539, 26557, 26561, 26573, 26591, 26597, 26627, 26633,
+  26641, 26647, 26669, 26681, 26683, 26687, 26693, 26699, 26701, 26711,
+  26713, 26717, 26723, 26729, 26731, 26737, 26759, 26777, 26783, 26801,
+  26813, 26821, 26833, 26839, 26849, 26861, 26863, 26879, 26881, 26891,
+  26893, 26903, 26921, 26927, 26947, 26951, 26953, 26959, 26981, 26987,
+  26993, 27011, 27017, 27031, 27043, 27059, 27061, 27067, 27073, 27077,
+  27091, 27103, 27107, 27109, 27127, 27143, 27179, 27191, 27197, 27211,
+  27239, 27241, 27253, 27259, 27271, 27277, 27281, 27283, 27299, 27329,
+  27337, 27361, 27367, 27397, 27407, 27409, 27427, 27431, 27437, 27449,
+  27457, 27479, 27481, 27487, 27509, 27527, 27529, 27539, 27541, 27551,
+  27581, 27583, 27611, 27617, 27631, 27647, 27653, 27673, 27689, 27691,
+  27697, 27701, 27733, 27737, 27739, 27743, 27749, 27751, 27763, 27767,
+  27773, 27779, 27791, 27793, 27799, 27803, 27809, 27817, 27823, 27827,
+  27847, 27851, 27883, 27893, 27901, 27917, 27919, 27941, 27943, 27947,
+  27953, 27961, 27967, 27983, 27997, 28001, 28019, 28027, 28031, 28051,
+  28057, 28069, 28081, 28087, 28097, 28099, 28109, 28111, 28123, 28151,
+  28163, 28181, 28183, 28201, 28211, 28219, 28229, 28277, 28279, 28283,
+  28289, 28297, 28307, 28309, 28319, 28349, 28351, 28387, 28393, 28403,
+  28409, 28411, 28429, 28433, 28439, 28447, 28463, 28477, 28493, 28499,
+  28513, 28517, 28537, 28541, 28547, 28549, 28559, 28571, 28573, 28579,
+  28591, 28597, 28603, 28607, 28619, 28621, 28627, 28631, 28643, 28649,
+  28657, 28661, 28663, 28669, 28687, 28697, 28703, 28711, 28723, 28729,
+  28751, 28753, 28759, 28771, 28789, 28793, 28807, 28813, 28817, 28837,
+  28843, 28859, 28867, 28871, 28879, 28901, 28909, 28921, 28927, 28933,
+  28949, 28961, 28979, 29009, 29017, 29021, 29023, 29027, 29033, 29059,
+  29063, 29077, 29101, 29123, 29129, 29131, 29137, 29147, 29153, 29167,
+  29173, 29179, 29191, 29201, 29207, 29209, 29221, 29231, 29243, 29251,
+  29269, 29287, 29297, 29303, 29311, 29327, 29333, 29339, 29347, 29363,
+  29383, 29387, 29389, 29399, 29401, 29411, 29423, 29429, 29437, 29443,
+  29453, 29473, 29483, 29501, 29527, 29531, 29537, 29567, 29569, 29573,
+  29581, 29587, 29599, 29611, 29629, 29633, 29641, 29663, 29669, 29671,
+  29683, 29717, 29723, 29741, 29753, 29759, 29761, 29789, 29803, 29819,
+  29833, 29837, 29851, 29863, 29867, 29873, 29879, 29881, 29917, 29921,
+  29927, 29947, 29959, 29983, 29989, 30011, 30013, 30029, 30047, 30059,
+  30071, 30089, 30091, 30097, 30103, 30109, 30113, 30119, 30133, 30137,
+  30139, 30161, 30169, 30181, 30187, 30197, 30203, 30211, 30223, 30241,
+  30253, 30259, 30269, 30271, 30293, 30307, 30313, 30319, 30323, 30341,
+  30347, 30367, 30389, 30391, 30403, 30427, 30431, 30449, 30467, 30469,
+  30491, 30493, 30497, 30509, 30517, 30529, 30539, 30553, 30557, 30559,
+  30577, 30593, 30631, 30637, 30643, 30649, 30661, 30671, 30677, 30689,
+  30697, 30703, 30707, 30713, 30727, 30757, 30763, 30773, 30781, 30803,
+  30809, 30817, 30829, 30839, 30841, 30851, 30853, 30859, 30869, 30871,
+  30881, 30893, 30911, 30931, 30937, 30941, 30949, 30971, 30977, 30983,
+  31013, 31019, 31033, 31039, 31051, 31063, 31069, 31079, 31081, 31091,
+  31121, 31123, 31139, 31147, 31151, 31153, 31159, 31177, 31181, 31183,
+  31189, 31193, 31219, 31223, 31231, 31237, 31247, 31249, 31253, 31259,
+  31267, 31271, 31277, 31307, 31319, 31321, 31327, 31333, 31337, 31357,
+  31379, 31387, 31391, 31393, 31397, 31469, 31477, 31481, 31489, 31511,
+  31513, 31517, 31531, 31541, 31543, 31547, 31567, 31573, 31583, 31601,
+  31607, 31627, 31643, 31649, 31657, 31663, 31667, 31687, 31699, 31721,
+  31723, 31727, 31729, 31741, 31751, 31769, 31771, 31793, 31799, 31817,
+  31847, 31849, 31859, 31873, 31883, 31891, 31907, 31957, 31963, 31973,
+  31981, 31991, 32003, 32009, 32027, 32029, 32051, 32057, 32059, 32063,
+  32069, 32077, 32083, 32089, 32099, 32117, 32119, 32141, 32143, 32159,
+  32173, 32183, 32189, 32191, 32203, 32213, 32233, 32237, 32251, 32257,
+  32261, 32297, 32299, 32303, 32309, 32321, 32323, 32327, 32341, 32353,
+  32359, 32363, 32369, 32371, 32377, 32381, 32401, 32411, 32413, 32423,
+  32429, 32441, 32443, 32467, 32479, 32491, 32497, 32503, 32507, 32531,
+  32533, 32537, 32561, 32563, 32569, 32573, 32579, 32587, 32603, 32609,
+  32611, 32621, 32633, 32647, 32653, 32687, 32693, 32707, 32713, 32717,
+  32719, 32749, 32771, 32779, 32783, 32789, 32797, 32801, 32803, 32831,
+  32833, 32839, 32843, 32869, 32887, 32909, 32911, 32917, 32933, 32939,
+  32941, 32957, 32969, 32971, 32983, 32987, 32993, 32999, 33013, 33023,
+  33029, 33037, 33049, 33053, 33071, 33073, 33083, 33091, 33107, 33113,
+  33119, 33149, 33151, 33161, 33179, 33181, 33191, 33199, 33203, 33211,
+  33223, 33247, 33287, 33289, 33301, 33311, 33317, 33329, 33331, 33343,
+  33347, 33349, 33353, 33359, 33377, 33391, 33403, 33409, 33413, 33427,
+  33457, 33461, 33469, 33479, 33487, 33493, 33503, 33521, 33529, 33533,
+  33547, 33563, 33569, 33577, 33581, 33587, 33589, 33599, 33601, 33613,
+  33617, 33619, 33623, 33629, 33637, 33641, 33647, 33679, 33703, 33713,
+  33721, 33739, 33749, 33751, 33757, 33767, 33769, 33773, 33791, 33797,
+  33809, 33811, 33827, 33829, 33851, 33857, 33863, 33871, 33889, 33893,
+  33911, 33923, 33931, 33937, 33941, 33961, 33967, 33997, 34019, 34031,
+  34033, 34039, 34057, 34061, 34123, 34127, 34129, 34141, 34147, 34157,
+  34159, 34171, 34183, 34211, 34213, 34217, 34231, 34253, 34259, 34261,
+  34267, 34273, 34283, 34297, 34301, 34303, 34313, 34319, 34327, 34337,
+  34351, 34361, 34367, 34369, 34381, 34403, 34421, 34429, 34439, 34457,
+  34469, 34471, 34483, 34487, 34499, 34501, 34511, 34513, 34519, 34537,
+  34543, 34549, 34583, 34589, 34591, 34603, 34607, 34613, 34631, 34649,
+  34651, 34667, 34673, 34679, 34687, 34693, 34703, 34721, 34729, 34739,
+  34747, 34757, 34759, 34763, 34781, 34807, 34819, 34841, 34843, 34847,
+  34849, 34871, 34877, 34883, 34897, 34913, 34919, 34939, 34949, 34961,
+  34963, 34981, 35023, 35027, 35051, 35053, 35059, 35069, 35081, 35083,
+  35089, 35099, 35107, 35111, 35117, 35129, 35141, 35149, 35153, 35159,
+  35171, 35201, 35221, 35227, 35251, 35257, 35267, 35279, 35281, 35291,
+  35311, 35317, 35323, 35327, 35339, 35353, 35363, 35381, 35393, 35401,
+  35407, 35419, 35423, 35437, 35447, 35449, 35461, 35491, 35507, 35509,
+  35521, 35527, 35531, 35533, 35537, 35543, 35569, 35573, 35591, 35593,
+  35597, 35603, 35617, 35671, 35677, 35729, 35731, 35747, 35753, 35759,
+  35771, 35797, 35801, 35803, 35809, 35831, 35837, 35839, 35851, 35863,
+  35869, 35879, 35897, 35899, 35911, 35923, 35933, 35951, 35963, 35969,
+  35977, 35983, 35993, 35999, 36007, 36011, 36013, 36017, 36037, 36061,
+  36067, 36073, 36083, 36097, 36107, 36109, 36131, 36137, 36151, 36161,
+  36187, 36191, 36209, 36217, 36229, 36241, 36251, 36263, 36269, 36277,
+  36293, 36299, 36307, 36313, 36319, 36341, 36343, 36353, 36373, 36383,
+  36389, 36433, 36451, 36457, 36467, 36469, 36473, 36479, 36493, 36497,
+  36523, 36527, 36529, 36541, 36551, 36559, 36563, 36571, 36583, 36587,
+  36599, 36607, 36629, 36637, 36643, 36653, 36671, 36677, 36683, 36691,
+  36697, 36709, 36713, 36721, 36739, 36749, 36761, 36767, 36779, 36781,
+  36787, 36791, 36793, 36809, 36821, 36833, 36847, 36857, 36871, 36877,
+  36887, 36899, 36901, 36913, 36919, 36923, 36929, 36931, 36943, 36947,
+  36973, 36979, 36997, 37003, 37013, 37019, 37021, 37039, 37049, 37057,
+  37061, 37087, 37097, 37117, 37123, 37139, 37159, 37171, 37181, 37189,
+  37199, 37201, 37217, 37223, 37243, 37253, 37273, 37277, 37307, 37309,
+  37313, 37321, 37337, 37339, 37357, 37361, 37363, 37369, 37379, 37397,
+  37409, 37423, 37441, 37447, 37463, 37483, 37489, 37493, 37501, 37507,
+  37511, 37517, 37529, 37537, 37547, 37549, 37561, 37567, 37571, 37573,
+  37579, 37589, 37591, 37607, 37619, 37633, 37643, 37649, 37657, 37663,
+  37691, 37693, 37699, 37717, 37747, 37781, 37783, 37799, 37811, 37813,
+  37831, 37847, 37853, 37861, 37871, 37879, 37889, 37897, 37907, 37951,
+  37957, 37963, 37967, 37987, 37991, 37993, 37997, 38011, 38039, 38047,
+  38053, 38069, 38083, 38113, 38119, 38149, 38153, 38167, 38177, 38183,
+  38189, 38197, 38201, 38219, 38231, 38237, 38239, 38261, 38273, 38281,
+  38287, 38299, 38303, 38317, 38321, 38327, 38329, 38333, 38351, 38371,
+  38377, 38393, 38431, 38447, 38449, 38453, 38459, 38461, 38501, 38543,
+  38557, 38561, 38567, 38569, 38593, 38603, 38609, 38611, 38629, 38639,
+  38651, 38653, 38669, 38671, 38677, 38693, 38699, 38707, 38711, 38713,
+  38723, 38729, 38737, 38747, 38749, 38767, 38783, 38791, 38803, 38821,
+  38833, 38839, 38851, 38861, 38867, 38873, 38891, 38903, 38917, 38921,
+  38923, 38933, 38953, 38959, 38971, 38977, 38993, 39019, 39023, 39041,
+  39043, 39047, 39079, 39089, 39097, 39103, 39107, 39113, 39119, 39133,
+  39139, 39157, 39161, 39163, 39181, 39191, 39199, 39209, 39217, 39227,
+  39229, 39233, 39239, 39241, 39251, 39293, 39301, 39313, 39317, 39323,
+  39341, 39343, 39359, 39367, 39371, 39373, 39383, 39397, 39409, 39419,
+  39439, 39443, 39451, 39461, 39499, 39503, 39509, 39511, 39521, 39541,
+  39551, 39563, 39569, 39581, 39607, 39619, 39623, 39631, 39659, 39667,
+  39671, 39679, 39703, 39709, 39719, 39727, 39733, 39749, 39761, 39769,
+  39779, 39791, 39799, 39821, 39827, 39829, 39839, 39841, 39847, 39857,
+  39863, 39869, 39877, 39883, 39887, 39901, 39929, 39937, 39953, 39971,
+  39979, 39983, 39989, 40009, 40013, 40031, 40037, 40039, 40063, 40087,
+  40093, 40099, 40111, 40123, 40127, 40129, 40151, 40153, 40163, 40169,
+  40177, 40189, 40193, 40213, 40231, 40237, 40241, 40253, 40277, 40283,
+  40289, 40343, 40351, 40357, 40361, 40387, 40423, 40427, 40429, 40433,
+  40459, 40471, 40483, 40487, 40493, 40499, 40507, 40519, 40529, 40531,
+  40543, 40559, 40577, 40583, 40591, 40597, 40609, 40627, 40637, 40639,
+  40693, 40697, 40699, 40709, 40739, 40751, 40759, 40763, 40771, 40787,
+  40801, 40813, 40819, 40823, 40829, 40841, 40847, 40849, 40853, 40867,
+  40879, 40883, 40897, 40903, 40927, 40933, 40939, 40949, 40961, 40973,
+  40993, 41011, 41017, 41023, 41039, 41047, 41051, 41057, 41077, 41081,
+  41113, 41117, 41131, 41141, 41143, 41149, 41161, 41177, 41179, 41183,
+  41189, 41201, 41203, 41213, 41221, 41227, 41231, 41233, 41243, 41257,
+  41263, 41269, 41281, 41299, 41333, 41341, 41351, 41357, 41381, 41387,
+  41389, 41399, 41411, 41413, 41443, 41453, 41467, 41479, 41491, 41507,
+  41513, 41519, 41521, 41539, 41543, 41549, 41579, 41593, 41597, 41603,
+  41609, 41611, 41617, 41621, 41627, 41641, 41647, 41651, 41659, 41669,
+  41681, 41687, 41719, 41729, 41737, 41759, 41761, 41771, 41777, 41801,
+  41809, 41813, 41843, 41849, 41851, 41863, 41879, 41887, 41893, 41897,
+  41903, 41911, 41927, 41941, 41947, 41953, 41957, 41959, 41969, 41981,
+  41983, 41999, 42013, 42017, 42019, 42023, 42043, 42061, 42071, 42073,
+  42083, 42089, 42101, 42131, 42139, 42157, 42169, 42179, 42181, 42187,
+  42193, 42197, 42209, 42221, 42223, 42227, 42239, 42257, 42281, 42283,
+  42293, 42299, 42307, 42323, 42331, 42337, 42349, 42359, 42373, 42379,
+  42391, 42397, 42403, 42407, 42409, 42433, 42437, 42443, 42451, 42457,
+  42461, 42463, 42467, 42473, 42487, 42491, 42499, 42509, 42533, 42557,
+  42569, 42571, 42577, 42589, 42611, 42641, 42643, 42649, 42667, 42677,
+  42683, 42689, 42697, 42701, 42703, 42709, 42719, 42727, 42737, 42743,
+  42751, 42767, 42773, 42787, 42793, 42797, 42821, 42829, 42839, 42841,
+  42853, 42859, 42863, 42899, 42901, 42923, 42929, 42937, 42943, 42953,
+  42961, 42967, 42979, 42989, 43003, 43013, 43019, 43037, 43049, 43051,
+  43063, 43067, 43093, 43103, 43117, 43133, 43151, 43159, 43177, 43189,
+  43201, 43207, 43223, 43237, 43261, 43271, 43283, 43291, 43313, 43319,
+  43321, 43331, 43391, 43397, 43399, 43403, 43411, 43427, 43441, 43451,
+  43457, 43481, 43487, 43499, 43517, 43541, 43543, 43573, 43577, 43579,
+  43591, 43597, 43607, 43609, 43613, 43627, 43633, 43649, 43651, 43661,
+  43669, 43691, 43711, 43717, 43721, 43753, 43759, 43777, 43781, 43783,
+  43787, 43789, 43793, 43801, 43853, 43867, 43889, 43891, 43913, 43933,
+  43943, 43951, 43961, 43963, 43969, 43973, 43987, 43991, 43997, 44017,
+  44021, 44027, 44029, 44041, 44053, 44059, 44071, 44087, 44089, 44101,
+  44111, 44119, 44123, 44129, 44131, 44159, 44171, 44179, 44189, 44201,
+  44203, 44207, 44221, 44249, 44257, 44263, 44267, 44269, 44273, 44279,
+  44281, 44293, 44351, 44357, 44371, 44381, 44383, 44389, 44417, 44449,
+  44453, 44483, 44491, 44497, 44501, 44507, 44519, 44531, 44533, 44537,
+  44543, 44549, 44563, 44579, 44587, 44617, 44621, 44623, 44633, 44641,
+  44647, 44651, 44657, 44683, 44687, 44699, 44701, 44711, 44729, 44741,
+  44753, 44771, 44773, 44777, 44789, 44797, 44809, 44819, 44839, 44843,
+  44851, 44867, 44879, 44887, 44893, 44909, 44917, 44927, 44939, 44953,
+  44959, 44963, 44971, 44983, 44987, 45007, 45013, 45053, 45061, 45077,
+  45083, 45119, 45121, 45127, 45131, 45137, 45139, 45161, 45179, 45181,
+  45191, 45197, 45233, 45247, 45259, 45263, 45281, 45289, 45293, 45307,
+  45317, 45319, 45329, 45337, 45341, 45343, 45361, 45377, 45389, 45403,
+  45413, 45427, 45433, 45439, 45481, 45491, 45497, 45503, 45523, 45533,
+  45541, 45553, 45557, 45569, 45587, 45589, 45599, 45613, 45631, 45641,
+  45659, 45667, 45673, 45677, 45691, 45697, 45707, 45737, 45751, 45757,
+  45763, 45767, 45779, 45817, 45821, 45823, 45827, 45833, 45841, 45853,
+  45863, 45869, 45887, 45893, 45943, 45949, 45953, 45959, 45971, 45979,
+  45989, 46021, 46027, 46049, 46051, 46061, 46073, 46091, 46093, 46099,
+  46103, 46133, 46141, 46147, 46153, 46171, 46181, 46183, 46187, 46199,
+  46219, 46229, 46237, 46261, 46271, 46273, 46279, 46301, 46307, 46309,
+  46327, 46337, 46349, 46351, 46381, 46399, 46411, 46439, 46441, 46447,
+  46451, 46457, 46471, 46477, 46489, 46499, 46507, 46511, 46523, 46549,
+  46559, 46567, 46573, 46589, 46591, 46601, 46619, 46633, 46639, 46643,
+  46649, 46663, 46679, 46681, 46687, 46691, 46703, 46723, 46727, 46747,
+  46751, 46757, 46769, 46771, 46807, 46811, 46817, 46819, 46829, 46831,
+  46853, 46861, 46867, 46877, 46889, 46901, 46919, 46933, 46957, 46993,
+  46997, 47017, 47041, 47051, 47057, 47059, 47087, 47093, 47111, 47119,
+  47123, 47129, 47137, 47143, 47147, 47149, 47161, 47189, 47207, 47221,
+  47237, 47251, 47269, 47279, 47287, 47293, 47297, 47303, 47309, 47317,
+  47339, 47351, 47353, 47363, 47381, 47387, 47389, 47407, 47417, 47419,
+  47431, 47441, 47459, 47491, 47497, 47501, 47507, 47513, 47521, 47527,
+  47533, 47543, 47563, 47569, 47581, 47591, 47599, 47609, 47623, 47629,
+  47639, 47653, 47657, 47659, 47681, 47699, 47701, 47711, 47713, 47717,
+  47737, 47741, 47743, 47777, 47779, 47791, 47797, 47807, 47809, 47819,
+  47837, 47843, 47857, 47869, 47881, 47903, 47911, 47917, 47933, 47939,
+  47947, 47951, 47963, 47969, 47977, 47981, 48017, 48023, 48029, 48049,
+  48073, 48079, 48091, 48109, 48119, 48121, 48131, 48157, 48163, 48179,
+  48187, 48193, 48197, 48221, 48239, 48247, 48259, 48271, 48281, 48299,
+  48311, 48313, 48337, 48341, 48353, 48371, 48383, 48397, 48407, 48409,
+  48413, 48437, 48449, 48463, 48473, 48479, 48481, 48487, 48491, 48497,
+  48523, 48527, 48533, 48539, 48541, 48563, 48571, 48589, 48593, 48611,
+  48619, 48623, 48647, 48649, 48661, 48673, 48677, 48679, 48731, 48733,
+  48751, 48757, 48761, 48767, 48779, 48781, 48787, 48799, 48809, 48817,
+  48821, 48823, 48847, 48857, 48859, 48869, 48871, 48883, 48889, 48907,
+  48947, 48953, 48973, 48989, 48991, 49003, 49009, 49019, 49031, 49033,
+  49037, 49043, 49057, 49069, 49081, 49103, 49109, 49117, 49121, 49123,
+  49139, 49157, 49169, 49171, 49177, 49193, 49199, 49201, 49207, 49211,
+  49223, 49253, 49261, 49277, 49279, 49297, 49307, 49331, 49333, 49339,
+  49363, 49367, 49369, 49391, 49393, 49409, 49411, 49417, 49429, 49433,
+  49451, 49459, 49463, 49477, 49481, 49499, 49523, 49529, 49531, 49537,
+  49547, 49549, 49559, 49597, 49603, 49613, 49627, 49633, 49639, 49663,
+  49667, 49669, 49681, 49697, 49711, 49727, 49739, 49741, 49747, 49757,
+  49783, 49787, 49789, 49801, 49807, 49811, 49823, 49831, 49843, 49853,
+  49871, 49877, 49891, 49919, 49921, 49927, 49937, 49939, 49943, 49957,
+  49991, 49993, 49999, 50021, 50023, 50033, 50047, 50051, 50053, 50069,
+  50077, 50087, 50093, 50101, 50111, 50119, 50123, 50129, 50131, 50147,
+  50153, 50159, 50177, 50207, 50221, 50227, 50231, 50261, 50263, 50273,
+  50287, 50291, 50311, 50321, 50329, 50333, 50341, 50359, 50363, 50377,
+  50383, 50387, 50411, 50417, 50423, 50441, 50459, 50461, 50497, 50503,
+  50513, 50527, 50539, 50543, 50549, 50551, 50581, 50587, 50591, 50593,
+  50599, 50627, 50647, 50651, 50671, 50683, 50707, 50723, 50741, 50753,
+  50767, 50773, 50777, 50789, 50821, 50833, 50839, 50849, 50857, 50867,
+  50873, 50891, 50893, 50909, 50923, 50929, 50951, 50957, 50969, 50971,
+  50989, 50993, 51001, 51031, 51043, 51047, 51059, 51061, 51071, 51109,
+  51131, 51133, 51137, 51151, 51157, 51169, 51193, 51197, 51199, 51203,
+  51217, 51229, 51239, 51241, 51257, 51263, 51283, 51287, 51307, 51329,
+  51341, 51343, 51347, 51349, 51361, 51383, 51407, 51413, 51419, 51421,
+  51427, 51431, 51437, 51439, 51449, 51461, 51473, 51479, 51481, 51487,
+  51503, 51511, 51517, 51521, 51539, 51551, 51563, 51577, 51581, 51593,
+  51599, 51607, 51613, 51631, 51637, 51647, 51659, 51673, 51679, 51683,
+  51691, 51713, 51719, 51721, 51749, 51767, 51769, 51787, 51797, 51803,
+  51817, 51827, 51829, 51839, 51853, 51859, 51869, 51871, 51893, 51899,
+  51907, 51913, 51929, 51941, 51949, 51971, 51973, 51977, 51991, 52009,
+  52021, 52027, 52051, 52057, 52067, 52069, 52081, 52103, 52121, 52127,
+  52147, 52153, 52163, 52177, 52181, 52183, 52189, 52201, 52223, 52237,
+  52249, 52253, 52259, 52267, 52289, 52291, 52301, 52313, 52321, 52361,
+  52363, 52369, 52379, 52387, 52391, 52433, 52453, 52457, 52489, 52501,
+  52511, 52517, 52529, 52541, 52543, 52553, 52561, 52567, 52571, 52579,
+  52583, 52609, 52627, 52631, 52639, 52667, 52673, 52691, 52697, 52709,
+  52711, 52721, 52727, 52733, 52747, 52757, 52769, 52783, 52807, 52813,
+  52817, 52837, 52859, 52861, 52879, 52883, 52889, 52901, 52903, 52919,
+  52937, 52951, 52957, 52963, 52967, 52973, 52981, 52999, 53003, 53017,
+  53047, 53051, 53069, 53077, 53087, 53089, 53093, 53101, 53113, 53117,
+  53129, 53147, 53149, 53161, 53171, 53173, 53189, 53197, 53201, 53231,
+  53233, 53239, 53267, 53269, 53279, 53281, 53299, 53309, 53323, 53327,
+  53353, 53359, 53377, 53381, 53401, 53407, 53411, 53419, 53437, 53441,
+  53453, 53479, 53503, 53507, 53527, 53549, 53551, 53569, 53591, 53593,
+  53597, 53609, 53611, 53617, 53623, 53629, 53633, 53639, 53653, 53657,
+  53681, 53693, 53699, 53717, 53719, 53731, 53759, 53773, 53777, 53783,
+  53791, 53813, 53819, 53831, 53849, 53857, 53861, 53881, 53887, 53891,
+  53897, 53899, 53917, 53923, 53927, 53939, 53951, 53959, 53987, 53993,
+  54001, 54011, 54013, 54037, 54049, 54059, 54083, 54091, 54101, 54121,
+  54133, 54139, 54151, 54163, 54167, 54181, 54193, 54217, 54251, 54269,
+  54277, 54287, 54293, 54311, 54319, 54323, 54331, 54347, 54361, 54367,
+  54371, 54377, 54401, 54403, 54409, 54413, 54419, 54421, 54437, 54443,
+  54449, 54469, 54493, 54497, 54499, 54503, 54517, 54521, 54539, 54541,
+  54547, 54559, 54563, 54577, 54581, 54583, 54601, 54617, 54623, 54629,
+  54631, 54647, 54667, 54673, 54679, 54709, 54713, 54721, 54727, 54751,
+  54767, 54773, 54779, 54787, 54799, 54829, 54833, 54851, 54869, 54877,
+  54881, 54907, 54917, 54919, 54941, 54949, 54959, 54973, 54979, 54983,
+  55001, 55009, 55021, 55049, 55051, 55057, 55061, 55073, 55079, 55103,
+  55109, 55117, 55127, 55147, 55163, 55171, 55201, 55207, 55213, 55217,
+  55219, 55229, 55243, 55249, 55259, 55291, 55313, 55331, 55333, 55337,
+  55339, 55343, 55351, 55373, 55381, 55399, 55411, 55439, 55441, 55457,
+  55469, 55487, 55501, 55511, 55529, 55541, 55547, 55579, 55589, 55603,
+  55609, 55619, 55621, 55631, 55633, 55639, 55661, 55663, 55667, 55673,
+  55681, 55691, 55697, 55711, 55717, 55721, 55733, 55763, 55787, 55793,
+  55799, 55807, 55813, 55817, 55819, 55823, 55829, 55837, 55843, 55849,
+  55871, 55889, 55897, 55901, 55903, 55921, 55927, 55931, 55933, 55949,
+  55967, 55987, 55997, 56003, 56009, 56039, 56041, 56053, 56081, 56087,
+  56093, 56099, 56101, 56113, 56123, 56131, 56149, 56167, 56171, 56179,
+  56197, 56207, 56209, 56237, 56239, 56249, 56263, 56267, 56269, 56299,
+  56311, 56333, 56359, 56369, 56377, 56383, 56393, 56401, 56417, 56431,
+  56437, 56443, 56453, 56467, 56473, 56477, 56479, 56489, 56501, 56503,
+  56509, 56519, 56527, 56531, 56533, 56543, 56569, 56591, 56597, 56599,
+  56611, 56629, 56633, 56659, 56663, 56671, 56681, 56687, 56701, 56711,
+  56713, 56731, 56737, 56747, 56767, 56773, 56779, 56783, 56807, 56809,
+  56813, 56821, 56827, 56843, 56857, 56873, 56891, 56893, 56897, 56909,
+  56911, 56921, 56923, 56929, 56941, 56951, 56957, 56963, 56983, 56989,
+  56993, 56999, 57037, 57041, 57047, 57059, 57073, 57077, 57089, 57097,
+  57107, 57119, 57131, 57139, 57143, 57149, 57163, 57173, 57179, 57191,
+  57193, 57203, 57221, 57223, 57241, 57251, 57259, 57269, 57271, 57283,
+  57287, 57301, 57329, 57331, 57347, 57349, 57367, 57373, 57383, 57389,
+  57397, 57413, 57427, 57457, 57467, 57487, 57493, 57503, 57527, 57529,
+  57557, 57559, 57571, 57587, 57593, 57601, 57637, 57641, 57649, 57653,
+  57667, 57679, 57689, 57697, 57709, 57713, 57719, 57727, 57731, 57737,
+  57751, 57773, 57781, 57787, 57791, 57793, 57803, 57809, 57829, 57839,
+  57847, 57853, 57859, 57881, 57899, 57901, 57917, 57923, 57943, 57947,
+  57973, 57977, 57991, 58013, 58027, 58031, 58043, 58049, 58057, 58061,
+  58067, 58073, 58099, 58109, 58111, 58129, 58147, 58151, 58153, 58169,
+  58171, 58189, 58193, 58199, 58207, 58211, 58217, 58229, 58231, 58237,
+  58243, 58271, 58309, 58313, 58321, 58337, 58363, 58367, 58369, 58379,
+  58391, 58393, 58403, 58411, 58417, 58427, 58439, 58441, 58451, 58453,
+  58477, 58481, 58511, 58537, 58543, 58549, 58567, 58573, 58579, 58601,
+  58603, 58613, 58631, 58657, 58661, 58679, 58687, 58693, 58699, 58711,
+  58727, 58733, 58741, 58757, 58763, 58771, 58787, 58789, 58831, 58889,
+  58897, 58901, 58907, 58909, 58913, 58921, 58937, 58943, 58963, 58967,
+  58979, 58991, 58997, 59009, 59011, 59021, 59023, 59029, 59051, 59053,
+  59063, 59069, 59077, 59083, 59093, 59107, 59113, 59119, 59123, 59141,
+  59149, 59159, 59167, 59183, 59197, 59207, 59209, 59219, 59221, 59233,
+  59239, 59243, 59263, 59273, 59281, 59333, 59341, 59351, 59357, 59359,
+  59369, 59377, 59387, 59393, 59399, 59407, 59417, 59419, 59441, 59443,
+  59447, 59453, 59467, 59471, 59473, 59497, 59509, 59513, 59539, 59557,
+  59561, 59567, 59581, 59611, 59617, 59621, 59627, 59629, 59651, 59659,
+  59663, 59669, 59671, 59693, 59699, 59707, 59723, 59729, 59743, 59747,
+  59753, 59771, 59779, 59791, 59797, 59809, 59833, 59863, 59879, 59887,
+  59921, 59929, 59951, 59957, 59971, 59981, 59999, 60013, 60017, 60029,
+  60037, 60041, 60077, 60083, 60089, 60091, 60101, 60103, 60107, 60127,
+  60133, 60139, 60149, 60161, 60167, 60169, 60209, 60217, 60223, 60251,
+  60257, 60259, 60271, 60289, 60293, 60317, 60331, 60337, 60343, 60353,
+  60373, 60383, 60397, 60413, 60427, 60443, 60449, 60457, 60493, 60497,
+  60509, 60521, 60527, 60539, 60589, 60601, 60607, 60611, 60617, 60623,
+  60631, 60637, 60647, 60649, 60659, 60661, 60679, 60689, 60703, 60719,
+  60727, 60733, 60737, 60757, 60761, 60763, 60773, 60779, 60793, 60811,
+  60821, 60859, 60869, 60887, 60889, 60899, 60901, 60913, 60917, 60919,
+  60923, 60937, 60943, 60953, 60961, 61001, 61007, 61027, 61031, 61043,
+  61051, 61057, 61091, 61099, 61121, 61129, 61141, 61151, 61153, 61169,
+  61211, 61223, 61231, 61253, 61261, 61283, 61291, 61297, 61331, 61333,
+  61339, 61343, 61357, 61363, 61379, 61381, 61403, 61409, 61417, 61441,
+  61463, 61469, 61471, 61483, 61487, 61493, 61507, 61511, 61519, 61543,
+  61547, 61553, 61559, 61561, 61583, 61603, 61609, 61613, 61627, 61631,
+  61637, 61643, 61651, 61657, 61667, 61673, 61681, 61687, 61703, 61717,
+  61723, 61729, 61751, 61757, 61781, 61813, 61819, 61837, 61843, 61861,
+  61871, 61879, 61909, 61927, 61933, 61949, 61961, 61967, 61979, 61981,
+  61987, 61991, 62003, 62011, 62017, 62039, 62047, 62053, 62057, 62071,
+  62081, 62099, 62119, 62129, 62131, 62137, 62141, 62143, 62171, 62189,
+  62191, 62201, 62207, 62213, 62219, 62233, 62273, 62297, 62299, 62303,
+  62311, 62323, 62327, 62347, 62351, 62383, 62401, 62417, 62423, 62459,
+  62467, 62473, 62477, 62483, 62497, 62501, 62507, 62533, 62539, 62549,
+  62563, 62581, 62591, 62597, 62603, 62617, 62627, 62633, 62639, 62653,
+  62659, 62683, 62687, 62701, 62723, 62731, 62743, 62753, 62761, 62773,
+  62791, 62801, 62819, 62827, 62851, 62861, 62869, 62873, 62897, 62903,
+  62921, 62927, 62929, 62939, 62969, 62971, 62981, 62983, 62987, 62989,
+  63029, 63031, 63059, 63067, 63073, 63079, 63097, 63103, 63113, 63127,
+  63131, 63149, 63179, 63197, 63199, 63211, 63241, 63247, 63277, 63281,
+  63299, 63311, 63313, 63317, 63331, 63337, 63347, 63353, 63361, 63367,
+  63377, 63389, 63391, 63397, 63409, 63419, 63421, 63439, 63443, 63463,
+  63467, 63473, 63487, 63493, 63499, 63521, 63527, 63533, 63541, 63559,
+  63577, 63587, 63589, 63599, 63601, 63607, 63611, 63617, 63629, 63647,
+  63649, 63659, 63667, 63671, 63689, 63691, 63697, 63703, 63709, 63719,
+  63727, 63737, 63743, 63761, 63773, 63781, 63793, 63799, 63803, 63809,
+  63823, 63839, 63841, 63853, 63857, 63863, 63901, 63907, 63913, 63929,
+  63949, 63977, 63997, 64007, 64013, 64019, 64033, 64037, 64063, 64067,
+  64081, 64091, 64109, 64123, 64151, 64153, 64157, 64171, 64187, 64189,
+  64217, 64223, 64231, 64237, 64271, 64279, 64283, 64301, 64303, 64319,
+  64327, 64333, 64373, 64381, 64399, 64403, 64433, 64439, 64451, 64453,
+  64483, 64489, 64499, 64513, 64553, 64567, 64577, 64579, 64591, 64601,
+  64609, 64613, 64621, 64627, 64633, 64661, 64663, 64667, 64679, 64693,
+  64709, 64717, 64747, 64763, 64781, 64783, 64793, 64811, 64817, 64849,
+  64853, 64871, 64877, 64879, 64891, 64901, 64919, 64921, 64927, 64937,
+  64951, 64969, 64997, 65003, 65011, 65027, 65029, 65033, 65053, 65063,
+  65071, 65089, 65099, 65101, 65111, 65119, 65123, 65129, 65141, 65147,
+  65167, 65171, 65173, 65179, 65183, 65203, 65213, 65239, 65257, 65267,
+  65269, 65287, 65293, 65309, 65323, 65327, 65353, 65357, 65371, 65381,
+  65393, 65407, 65413, 65419, 65423, 65437, 65447, 65449, 65479, 65497,
+  65519, 65521, 65537, 0
+  };
+
+uint64_t ullPrime16Inv[6545]=
+  {
+  __ULL(0), __ULL(0),
+  __ULL(0xAAAAAAAAAAAAAAAB), __ULL(0xCCCCCCCCCCCCCCCD), __ULL(0x6DB6DB6DB6DB6DB7),
+  __ULL(0x2E8BA2E8BA2E8BA3), __ULL(0x4EC4EC4EC4EC4EC5), __ULL(0xF0F0F0F0F0F0F0F1),
+  __ULL(0x86BCA1AF286BCA1B), __ULL(0xD37A6F4DE9BD37A7), __ULL(0x34F72C234F72C235),
+  __ULL(0xEF7BDEF7BDEF7BDF), __ULL(0x14C1BACF914C1BAD), __ULL(0x8F9C18F9C18F9C19),
+  __ULL(0x82FA0BE82FA0BE83), __ULL(0x51B3BEA3677D46CF), __ULL(0x21CFB2B78C13521D),
+  __ULL(0xCBEEA4E1A08AD8F3), __ULL(0x4FBCDA3AC10C9715), __ULL(0xF0B7672A07A44C6B),
+  __ULL(0x193D4BB7E327A977), __ULL(0x7E3F1F8FC7E3F1F9), __ULL(0x9B8B577E613716AF),
+  __ULL(0xA3784A062B2E43DB), __ULL(0xF47E8FD1FA3F47E9), __ULL(0xA3A0FD5C5F02A3A1),
+  __ULL(0x3A4C0A237C32B16D), __ULL(0xDAB7EC1DD3431B57), __ULL(0x77A04C8F8D28AC43),
+  __ULL(0xA6C0964FDA6C0965), __ULL(0x90FDBC090FDBC091), __ULL(0x7EFDFBF7EFDFBF7F),
+  __ULL(0x03E88CB3C9484E2B), __ULL(0xE21A291C077975B9), __ULL(0x3AEF6CA970586723),
+  __ULL(0xDF5B0F768CE2CABD), __ULL(0x6FE4DFC9BF937F27), __ULL(0x5B4FE5E92C0685B5),
+  __ULL(0x1F693A1C451AB30B), __ULL(0x8D07AA27DB35A717), __ULL(0x882383B30D516325),
+  __ULL(0xED6866F8D962AE7B), __ULL(0x3454DCA410F8ED9D), __ULL(0x1D7CA632EE936F3F),
+  __ULL(0x70BF015390948F41), __ULL(0xC96BDB9D3D137E0D), __ULL(0x2697CC8AEF46C0F7),
+  __ULL(0xC0E8F2A76E68575B), __ULL(0x687763DFDB43BB1F), __ULL(0x1B10EA929BA144CB),
+  __ULL(0x1D10C4C0478BBCED), __ULL(0x63FB9AEB1FDCD759), __ULL(0x64AFAA4F437B2E0F),
+  __ULL(0xF010FEF010FEF011), __ULL(0x28CBFBEB9A020A33), __ULL(0xFF00FF00FF00FF01),
+  __ULL(0xD624FD1470E99CB7), __ULL(0x8FB3DDBD6205B5C5), __ULL(0xD57DA36CA27ACDEF),
+  __ULL(0xEE70C03B25E4463D), __ULL(0xC5B1A6B80749CB29), __ULL(0x47768073C9B97113),
+  __ULL(0x2591E94884CE32AD), __ULL(0xF02806ABC74BE1FB), __ULL(0x7EC3E8F3A7198487),
+  __ULL(0x58550F8A39409D09), __ULL(0xEC9E48AE6F71DE15), __ULL(0x2FF3A018BFCE8063),
+  __ULL(0x7F9EC3FCF61FE7B1), __ULL(0x89F5ABE570E046D3), __ULL(0xDA971B23F1545AF5),
+  __ULL(0x79D5F00B9A7862A1), __ULL(0x4DBA1DF32A128A57), __ULL(0x87530217B7747D8F),
+  __ULL(0x30BAAE53BB5E06DD), __ULL(0xEE70206C12E9B5B3), __ULL(0xCDDE9462EC9DBE7F),
+  __ULL(0xAFB64B05EC41CF4D), __ULL(0x02944FF5AEC02945), __ULL(0x2CB033128382DF71),
+  __ULL(0x1CCACC0C84B1C2A9), __ULL(0x19A93DB575EB3A0B), __ULL(0xCEBEEF94FA86FE2D),
+  __ULL(0x6FAA77FB3F8DF54F), __ULL(0x68A58AF00975A751), __ULL(0xD56E36D0C3EFAC07),
+  __ULL(0xD8B44C47A8299B73), __ULL(0x02D9CCAF9BA70E41), __ULL(0x0985E1C023D9E879),
+  __ULL(0x2A343316C494D305), __ULL(0x70CB7916AB67652F), __ULL(0xD398F132FB10FE5B),
+  __ULL(0x6F2A38A6BF54FA1F), __ULL(0x211DF689B98F81D7), __ULL(0x0E994983E90F1EC3),
+  __ULL(0xAD671E44BED87F3B), __ULL(0xF9623A0516E70FC7), __ULL(0x4B7129BE9DECE355),
+  __ULL(0x190F3B7473F62C39), __ULL(0x63DACC9AAD46F9A3), __ULL(0xC1108FDA24E8D035),
+  __ULL(0xB77578472319BD8B), __ULL(0x473D20A1C7ED9DA5), __ULL(0xFBE85AF0FEA2C8FB),
+  __ULL(0x58A1F7E6CE0F4C09), __ULL(0x1A00E58C544986F3), __ULL(0x7194A17F55A10DC1),
+  __ULL(0x7084944785E33763), __ULL(0xBA10679BD84886B1), __ULL(0xEBE9C6BB31260967),
+  __ULL(0x97A3FE4BD1FF25E9), __ULL(0x6C6388395B84D99F), __ULL(0x8C51DA6A1335DF6D),
+  __ULL(0x46F3234475D5ADD9), __ULL(0x905605CA3C619A43), __ULL(0xCEE8DFF304767747),
+  __ULL(0xFF99C27F00663D81), __ULL(0xACCA407F671DDC2B), __ULL(0xE71298BAC1E12337),
+  __ULL(0xFA1E94309CD09045), __ULL(0xBEBCCB8E91496B9B), __ULL(0x312FA30CC7D7B8BD),
+  __ULL(0x6160FF9E9F006161), __ULL(0x6B03673B5E28152D), __ULL(0xFE802FFA00BFE803),
+  __ULL(0xE66FE25C9E907C7B), __ULL(0x3F8B236C76528895), __ULL(0xF6F923BF01CE2C0D),
+  __ULL(0x6C3D3D98BED7C42F), __ULL(0x30981EFCD4B010E7), __ULL(0x6F691FC81EBBE575),
+  __ULL(0xB10480DDB47B52CB), __ULL(0x74CD59ED64F3F0D7), __ULL(0x0105CB81316D6C0F),
+  __ULL(0x9BE64C6D91C1195D), __ULL(0x71B3F945A27B1F49), __ULL(0x77D80D50E508FD01),
+  __ULL(0xA5EB778E133551CD), __ULL(0x18657D3C2D8A3F1B), __ULL(0x2E40E220C34AD735),
+  __ULL(0xA76593C70A714919), __ULL(0x1EEF452124EEA383), __ULL(0x38206DC242BA771D),
+  __ULL(0x4CD4C35807772287), __ULL(0x83DE917D5E69DDF3), __ULL(0x882EF0403B4A6C15),
+  __ULL(0xF8FB6C51C606B677), __ULL(0xB4ABAAC446D3E1FD), __ULL(0xA9F83BBE484A14E9),
+  __ULL(0x0BEBBC0D1CE874D3), __ULL(0xBD418EAF0473189F), __ULL(0x44E3AF6F372B7E65),
+  __ULL(0xC87FDACE4F9E5D91), __ULL(0xEC93479C446BD9BB), __ULL(0xDAC4D592E777C647),
+  __ULL(0xA63EA8C8F61F0C23), __ULL(0xE476062EA5CBBB6F), __ULL(0xDF68761C69DAAC27),
+  __ULL(0xB813D737637AA061), __ULL(0xA3A77AAC1FB15099), __ULL(0x17F0C3E0712C5825),
+  __ULL(0xFD912A70FF30637B), __ULL(0xFBB3B5DC01131289), __ULL(0x856D560A0F5ACDF7),
+  __ULL(0x96472F314D3F89E3), __ULL(0xA76F5C7ED2253531), __ULL(0x816EAE7C7BF69FE7),
+  __ULL(0xB6A2BEA4CFB1781F), __ULL(0xA3900C53318E81ED), __ULL(0x60AA7F5D9F148D11),
+  __ULL(0x6BE8C0102C7A505D), __ULL(0x8FF3F0ED28728F33), __ULL(0x680E0A87E5EC7155),
+  __ULL(0xBBF70FA49FE829B7), __ULL(0xD69D1E7B6A50CA39), __ULL(0x1A1E0F46B6D26AEF),
+  __ULL(0x7429F9A7A8251829), __ULL(0xD9C2219D1B863613), __ULL(0x91406C1820D077AD),
+  __ULL(0x521F4EC02E3D2B97), __ULL(0xBB8283B63DC8EBA5), __ULL(0x431EDA153229EBBF),
+  __ULL(0xAF0BF78D7E01686B), __ULL(0xA9CED0742C086E8D), __ULL(0xC26458AD9F632DF9),
+  __ULL(0xBBFF1255DFF892AF), __ULL(0xCBD49A333F04D8FD), __ULL(0xEC84ED6F9CFDEFF5),
+  __ULL(0x97980CC40BDA9D4B), __ULL(0x777F34D524F5CBD9), __ULL(0x2797051D94CBBB7F),
+  __ULL(0xEA769051B4F43B81), __ULL(0xCE7910F3034D4323), __ULL(0x92791D1374F5B99B),
+  __ULL(0x89A5645CC68EA1B5), __ULL(0x5F8AACF796C0CF0B), __ULL(0xF2E90A15E33EDF99),
+  __ULL(0x8E99E5FEB897C451), __ULL(0xACA2EDA38FB91695), __ULL(0x5D9B737BE5EA8B41),
+  __ULL(0x4AEFE1DB93FD7CF7), __ULL(0xA0994EF20B3F8805), __ULL(0x103890BDA912822F),
+  __ULL(0xB441659D13A9147D), __ULL(0x1E2134440C4C3F21), __ULL(0x263A27727A6883C3),
+  __ULL(0x78E221472AB33855), __ULL(0x95EAC88E82E6FAFF), __ULL(0xF66C258317BE8DAB),
+  __ULL(0x09EE202C7CB91939), __ULL(0x8D2FCA1042A09EA3), __ULL(0x82779C856D8B8BF1),
+  __ULL(0x3879361CBA8A223D), __ULL(0xF23F43639C3182A7), __ULL(0xA03868FC474BCD13),
+  __ULL(0x651E78B8C5311A97), __ULL(0x8FFCE639C00C6719), __ULL(0xF7B460754B0B61CF),
+  __ULL(0x7B03F3359B8E63B1), __ULL(0xA55C5326041EB667), __ULL(0x647F88AB896A76F5),
+  __ULL(0x8FD971434A55A46D), __ULL(0x9FBF969958046447), __ULL(0x9986FEBA69BE3A81),
+  __ULL(0xA668B3E6D053796F), __ULL(0x97694E6589F4E09B), __ULL(0x37890C00B7721DBD),
+  __ULL(0x5AC094A235F37EA9), __ULL(0x31CFF775F2D5D65F), __ULL(0xDDAD8E6B36505217),
+  __ULL(0x5A27DF897062CD03), __ULL(0xE2396FE0FDB5A625), __ULL(0xB352A4957E82317B),
+  __ULL(0xD8AB3F2C60C2EA3F), __ULL(0x6893F702F0452479), __ULL(0x9686FDC182ACF7E3),
+  __ULL(0x6854037173DCE12F), __ULL(0x7F0DED1685C27331), __ULL(0xEEDA72E1FE490B7D),
+  __ULL(0x9E7BFC959A8E6E53), __ULL(0x49B314D6D4753DD7), __ULL(0x2E8F8C5AC4AA1B3B),
+  __ULL(0xB8EF723481163D33), __ULL(0x6A2EC96A594287B7), __ULL(0xDBA41C6D13AAB8C5),
+  __ULL(0xC2ADBE648DC3AAF1), __ULL(0x87A2BADE565F91A7), __ULL(0x4D6FE8798C01F5DF),
+  __ULL(0x3791310C8C23D98B), __ULL(0xF80E446B01228883), __ULL(0x9AED1436FBF500CF),
+  __ULL(0x7839B54CC8B24115), __ULL(0xC128C646AD0309C1), __ULL(0x14DE631624A3C377),
+  __ULL(0x3F7B9FE68B0ECBF9), __ULL(0x284FFD75EC00A285), __ULL(0x37803CB80DEA2DDB),
+  __ULL(0x86B63F7C9AC4C6FD), __ULL(0x8B6851D1BD99B9D3), __ULL(0xB62FDA77CA343B6D),
+  __ULL(0x1F0DC009E34383C9), __ULL(0x496DC21DDD35B97F), __ULL(0xB0E96CE17090F82B),
+  __ULL(0xAADF05ACDD7D024D), __ULL(0xCB138196746EAFB5), __ULL(0x347F523736755D61),
+  __ULL(0xD14A48A051F7DD0B), __ULL(0x474D71B1CE914D25), __ULL(0x386063F5E28C1F89),
+  __ULL(0x1DB7325E32D04E73), __ULL(0xFEF748D3893B880D), __ULL(0x2F3351506E935605),
+  __ULL(0x7A3637FA2376415B), __ULL(0x4AC525D2BAA21969), __ULL(0x3A11C16B42CD351F),
+  __ULL(0x6C7ABDE0049C2A11), __ULL(0x54DAD0303E069AC7), __ULL(0xEBF1AC9FDFE91433),
+  __ULL(0xFAFDDA8237CEC655), __ULL(0xDCE3FF6E71FFB739), __ULL(0xBED5737D6286DB1B),
+  __ULL(0xE479E431FE08B4DF), __ULL(0x9DD9B0DD7742F897), __ULL(0x8F09D7402C5A5E87),
+  __ULL(0x9216D5C4D958738D), __ULL(0xB3139BA11D34CA63), __ULL(0x47D54F7ED644AFAF),
+  __ULL(0x92A81D85CF11A1B1), __ULL(0x754B26533253BDFD), __ULL(0xBBE0EFC980BFD467),
+  __ULL(0xC0D8D594F024DCA1), __ULL(0x8238D43BCAAC1A65), __ULL(0x27779C1FAE6175BB),
+  __ULL(0xA746CA9AF708B2C9), __ULL(0x93F3CD9F389BE823), __ULL(0x5CB4A4C04C489345),
+  __ULL(0xBF6047743E85B6B5), __ULL(0x61C147831563545F), __ULL(0xEDB47C0AE62DEE9D),
+  __ULL(0x0A3824386673A573), __ULL(0xA4A77D19E575A0EB), __ULL(0xA2BEE045E066C279),
+  __ULL(0xC23618DE8AB43D05), __ULL(0x266B515216CB9F2F), __ULL(0xE279EDD9E9C2E85B),
+  __ULL(0xD0C591C221DC9C53), __ULL(0x06DA8EE9C9EE7C21), __ULL(0x9DFEBCAF4C27E8C3),
+  __ULL(0x49AEFF9F19DD6DE5), __ULL(0x86976A57A296E9C7), __ULL(0xA3B9ABF4872B84CD),
+  __ULL(0x34FCA6483895E6EF), __ULL(0x34B5A333988F873D), __ULL(0xD9DD4F19B5F17BE1),
+  __ULL(0xB935B507FD0CE78B), __ULL(0xB450F5540660E797), __ULL(0x63FF82831FFC1419),
+  __ULL(0x8992F718C22A32FB), __ULL(0x5F3253AD0D37E7BF), __ULL(0x007C0FFE0FC007C1),
+  __ULL(0x4D8EBADC0C0640B1), __ULL(0xE2729AF831037BDB), __ULL(0xB8F64BF30FEEBFE9),
+  __ULL(0xDA93124B544C0BF5), __ULL(0x9CF7FF0B593C539F), __ULL(0xD6BD8861FA0E07D9),
+  __ULL(0x5CFE75C0BD8AB891), __ULL(0x43E808757C2E862B), __ULL(0x90CAA96D595C9D93),
+  __ULL(0x8FD550625D07135F), __ULL(0x76B010A86E209F2D), __ULL(0xECC0426447769B25),
+  __ULL(0xE381339CAABE3295), __ULL(0xD1B190A2D0C7673F), __ULL(0xC3BCE3CF26B0E7EB),
+  __ULL(0x5F87E76F56C61CE3), __ULL(0xC06C6857A124B353), __ULL(0x38C040FCBA630F75),
+  __ULL(0xD078BC4FBD533B21), __ULL(0xDE8E15C5DD354F59), __ULL(0xCA61D53D7414260F),
+  __ULL(0xB56BF5BA8EAE635D), __ULL(0x44A72CB0FB6E3949), __ULL(0x879839A714F45BCD),
+  __ULL(0x02A8994FDE5314B7), __ULL(0xB971920CF2B90135), __ULL(0x8A8FD0B7DF9A6E8B),
+  __ULL(0xB31F9A84C1C6EAAD), __ULL(0x92293B02823C6D83), __ULL(0xEEE77FF20FE5DDCF),
+  __ULL(0x0E1EA0F6C496C11D), __ULL(0xFDF2D3D6F88CCB6B), __ULL(0xFA9D74A3457738F9),
+  __ULL(0xEFC3CA3DB71A5785), __ULL(0x8E2071718D0D6DAF), __ULL(0xBC0FDBFEB6CFABFD),
+  __ULL(0x1EEAB613E5E5AEE9), __ULL(0x2D2388E90E9E929F), __ULL(0x81DBAFBA588DDB43),
+  __ULL(0x52EEBC51C4799791), __ULL(0x1C6BC4693B45A047), __ULL(0x06EEE0974498874D),
+  __ULL(0xD85B7377A9953CB9), __ULL(0x4B6DF412D4CAF56F), __ULL(0x6B8AFBBB4A053493),
+  __ULL(0xCC5299C96AC7720B), __ULL(0xADCE84B5C710AA99), __ULL(0x9D673F5AA3804225),
+  __ULL(0xE6541268EFBCE7F7), __ULL(0xFCF41E76CF5BE669), __ULL(0x5C3EB5DC31C383CB),
+  __ULL(0x301832D11D8AD6C3), __ULL(0x2E9C0942F1CE450F), __ULL(0x97F3F2BE37A39A5D),
+  __ULL(0xE8B7D8A9654187C7), __ULL(0xB5D024D7DA5B1B55), __ULL(0xB8BA9D6E7AE3501B),
+  __ULL(0xF50865F71B90F1DF), __ULL(0x739C1682847DF9E1), __ULL(0xC470A4D842B90ED1),
+  __ULL(0x1FB1BE11698CC409), __ULL(0xD8D5512A7CD35D15), __ULL(0xA5496821723E07F9),
+  __ULL(0xBCC8C6D7ABAA8167), __ULL(0x52C396C95EB619A1), __ULL(0x6EB7E380878EC74B),
+  __ULL(0x3D5513B504537157), __ULL(0x314391F8862E948F), __ULL(0xDC0B17CFCD81F5DD),
+  __ULL(0x2F6BEA3EC89044B3), __ULL(0xCE13A05869F1B57F), __ULL(0x7593474E8ACE3581),
+  __ULL(0x07FC329295A05E4D), __ULL(0xB05377CBA4908D23), __ULL(0xE7B2131A628AA39B),
+  __ULL(0x9031DBED7DE01527), __ULL(0x76844B1C670AA9A9), __ULL(0x6A03F4533B08915F),
+  __ULL(0x1DBCA579DB0A3999), __ULL(0x002FFE800BFFA003), __ULL(0x478AB1A3E936139D),
+  __ULL(0x66E722BC4C5CC095), __ULL(0x7A8F63C717278541), __ULL(0xDF6EEE24D292BC2F),
+  __ULL(0x9FC20D17237DD569), __ULL(0xCDF9932356BDA2ED), __ULL(0x97B5E332E80F68D7),
+  __ULL(0x46EEE26FD875E2E5), __ULL(0x3548A8E65157A611), __ULL(0xC288D03BE9B71E3B),
+  __ULL(0x8151186DB38937AB), __ULL(0x7800B910895A45F1), __ULL(0xAEE0B024182EEC3D),
+  __ULL(0x96323EDA173B5713), __ULL(0x0ED0DBD03AE77C8B), __ULL(0xF73800B7828DC119),
+  __ULL(0x1B61715EC22B7CA5), __ULL(0xA8533A991EAD64BF), __ULL(0x7F6C7290E46C2E77),
+  __ULL(0x6325E8D907B01DB1), __ULL(0x28909F70152A1067), __ULL(0xEA7077AF0997A0F5),
+  __ULL(0x7E605CAD10C32E6D), __ULL(0x471B33570635B38F), __ULL(0xAB559FA997A61BB3),
+  __ULL(0xAD4BDAE562BDDAB9), __ULL(0x055E1B2F2ED62F45), __ULL(0x03CD328B1A2DCA9B),
+  __ULL(0xD28F4E08733218A9), __ULL(0xB6800B077F186293), __ULL(0x6FBD138C3FD9C207),
+  __ULL(0xB117CCD12AE88A89), __ULL(0x2F1A1A044046BCEB), __ULL(0x548ABA0B060541E3),
+  __ULL(0xCF4E808CEA111B2F), __ULL(0xDBEC1B4FA855A475), __ULL(0xE3F794EB600D7821),
+  __ULL(0x34FAE0D9A11F7C59), __ULL(0xF006B0CCBBAC085D), __ULL(0x3F45076DC3114733),
+  __ULL(0xEEF49BFA58A1A1B7), __ULL(0x12C4218BEA691FA3), __ULL(0xBC7504E3BD5E64F1),
+  __ULL(0x4EE21C292BB92FAD), __ULL(0x34338B7327A4BACF), __ULL(0x3FE5C0833D6FCCD1),
+  __ULL(0xB1E70743535203C1), __ULL(0xEFBB5DCDFB4E43D3), __ULL(0xCA68467CA5394F9F),
+  __ULL(0x8C51C081408B97A1), __ULL(0x3275A899DFA5DD65), __ULL(0x9E674CB62E1B78BB),
+  __ULL(0xA37FF5BB2A998D47), __ULL(0x792A999DB131A22B), __ULL(0x1B48841BC30D29B9),
+  __ULL(0xF06721D2011D3471), __ULL(0x93FD2386DFF85EBD), __ULL(0x4CE72F54C07ED9B5),
+  __ULL(0xD6D0FD3E71DD827B), __ULL(0x856405FB1EED819D), __ULL(0x8EA8ACEB7C443989),
+  __ULL(0x34A13026F62E5873), __ULL(0x1EEA0208EC0AF4F7), __ULL(0x63679853CEA598CB),
+  __ULL(0xC30B3EBD61F2D0ED), __ULL(0x7EB9037BC7F43BC3), __ULL(0xA583E6F6CE016411),
+  __ULL(0xF1938D895F1A74C7), __ULL(0x80CF1491C1E81E33), __ULL(0x3C0F12886BA8F301),
+  __ULL(0x0E4B786E0DFCC5AB), __ULL(0x672684C93F2D41EF), __ULL(0xE00757BADB35C51B),
+  __ULL(0xD6D84AFE66472EDF), __ULL(0xFBBC0EEDCBBFB6E1), __ULL(0x250F43AA08A84983),
+  __ULL(0x04400E927B1ACAA5), __ULL(0x56572BE34B9D3215), __ULL(0x87964EF7781C62BF),
+  __ULL(0x29ED84051C06E9AF), __ULL(0xB00ACD11ED3F87FD), __ULL(0x06307881744152D9),
+  __ULL(0x7A786459F5C1CCC9), __ULL(0x1308125D74563281), __ULL(0x395310A480B3E34D),
+  __ULL(0x35985BAA8B202837), __ULL(0x96304A6E052B3223), __ULL(0xBD8265FC9AF8FD45),
+  __ULL(0x1B6D0B383EC58E0B), __ULL(0xC21A7C3B68B28503), __ULL(0x236FA180FBFD6007),
+  __ULL(0xC42ACCD440ED9595), __ULL(0x7ACF7128236BA3F7), __ULL(0xF909367A987B9C79),
+  __ULL(0xB64EFB252BFBA705), __ULL(0x980D4F5A7E4CD25B), __ULL(0xE1ECC4EF27B0C37D),
+  __ULL(0x9111AEBB81D72653), __ULL(0x8951F985CB2C67ED), __ULL(0xC439D4FC54E0B5D7),
+  __ULL(0xE857BF31896D533B), __ULL(0xB614BB4CB5023755), __ULL(0x938A89E5473BF1FF),
+  __ULL(0xEAC481ACA34DE039), __ULL(0x14B961BADF4809A7), __ULL(0x76784FECBA352435),
+  __ULL(0xEFA689BB58AEF5E1), __ULL(0xB2B2C4DB9C3A8197), __ULL(0x2503BC992279F8CF),
+  __ULL(0xD2AB9AEC5CA1541D), __ULL(0x3E78BA1460F99AF3), __ULL(0x0A01426572CFCB63),
+  __ULL(0xBEA857968F3CBD67), __ULL(0x78DB213EEFE659E9), __ULL(0x963E8541A74D35F5),
+  __ULL(0x9E22D152776F2E43), __ULL(0x05D10D39D1E1F291), __ULL(0x374468DCCACED1DD),
+  __ULL(0x8D145C7D110C5AD5), __ULL(0x3251A39F5ACB5737), __ULL(0xA66E50171443506F),
+  __ULL(0x124F69AD91DD4CBD), __ULL(0xEC24F8F2A61A2793), __ULL(0xB472148E656B7A51),
+  __ULL(0x0ADF9570E1142F07), __ULL(0x89BF33B065119789), __ULL(0x8F0149803CB291EB),
+  __ULL(0x8334B63AFD190A31), __ULL(0x920908D50D6ABA7D), __ULL(0x57D8B018C5A33D53),
+  __ULL(0xEA1773092DC27EE5), __ULL(0xCAE5F38B7BF2E00F), __ULL(0x2BD02DF34F695349),
+  __ULL(0xDDFECD5BE62E2EB7), __ULL(0xDBF849EBEC96C4A3), __ULL(0xDA31D4D0187357C5),
+  __ULL(0xE34E21CC2D5418A7), __ULL(0x68CA5137A9E574AD), __ULL(0x3EAA0D0F804BFD19),
+  __ULL(0x554FB753CC20E9D1), __ULL(0x797AFCCA1300756B), __ULL(0x8B8D950B52EEEA77),
+  __ULL(0xFB6CD166ACABC185), __ULL(0x4EB6C5ED9437A7AF), __ULL(0xD1EDDBD91B790CDB),
+  __ULL(0x93D714EA4D8948E9), __ULL(0x3CA13ED8145188D3), __ULL(0x829086016DA89C57),
+  __ULL(0xD7DA1F432124A543), __ULL(0x7EAD5581632FB07F), __ULL(0x35443837F63EC3BD),
+  __ULL(0x89E2B200E5519461), __ULL(0xE9AE44F0B7289C0B), __ULL(0x94387A277B9FA817),
+  __ULL(0xC84F1A58ABFC2C25), __ULL(0x71101D8E3C83377B), __ULL(0xC024ABE5C50BA69D),
+  __ULL(0x15DE4EB365A65D73), __ULL(0x09ED28A76BCCA931), __ULL(0x816BFFBF4A00205B),
+  __ULL(0x1F5C71543D558069), __ULL(0xF25C64D0EC53B859), __ULL(0x96C02C2EF1E0FF0F),
+  __ULL(0x19A804816870A333), __ULL(0x6DE49ADD0971C555), __ULL(0x528087E684C71AAB),
+  __ULL(0xA94152C269BCDEEF), __ULL(0x0379450A3C2B6BDF), __ULL(0xD2CD38BAFE5373E1),
+  __ULL(0xC29DF2BEA71D8BAD), __ULL(0xC15862775F302E83), __ULL(0x1016AF2FE55EDE09),
+  __ULL(0x3D26DBD9D1910715), __ULL(0x621DAB2DFAF3DFBF), __ULL(0xB6F1D7AC287338B1),
+  __ULL(0x8D9E9F0C3F9E7FD9), __ULL(0x60A93F8762E914BB), __ULL(0xB14371F247C159C9),
+  __ULL(0x6DD3B484471D4EB3), __ULL(0xCD172F4701C1684D), __ULL(0x0372E686ED8BB537),
+  __ULL(0xBC07F7CA65C5B071), __ULL(0xAB2B6170C3F78D9B), __ULL(0xF3D74F461FE6F5B5),
+  __ULL(0xDBC13F4B31F3230B), __ULL(0xD1420716E3F1572D), __ULL(0xD5BE2FD4D805464F),
+  __ULL(0xC68B97C136943851), __ULL(0x9E27918AF7CFB473), __ULL(0x5EC8AB6C36AC7F41),
+  __ULL(0x964076331DD90979), __ULL(0x30198EFF77B002D7), __ULL(0x3AF7CB9583ECE011),
+  __ULL(0x34CE06F643D9883B), __ULL(0x79F767E528708C55), __ULL(0x185332D2EF2313CD),
+  __ULL(0x43B611B84C8332A3), __ULL(0xC2E215E4F43BB63D), __ULL(0xF94B9DD22CE44E97),
+  __ULL(0xD895834A1DB166A5), __ULL(0x347D2F16D19B8D09), __ULL(0x1B54D4DC45B7D98D),
+  __ULL(0x117AC30D9A044877), __ULL(0x0E10B78A67A526E9), __ULL(0x92DA68A818688A9F),
+  __ULL(0xCF2B6C87F741F84B), __ULL(0xD264F9BD41E18ED9), __ULL(0x733CBEAA97166D8F),
+  __ULL(0xC9F475B021D22E81), __ULL(0x731F76F2EC4C852B), __ULL(0xDAF6F0C978F69945),
+  __ULL(0x749C8AD20C61EC93), __ULL(0x09307FF8BD3C1261), __ULL(0x334A69FB5A486E2D),
+  __ULL(0x1F36C7BF31578617), __ULL(0x31EBBCC279EA6103), __ULL(0x42E2AAD119F466EB),
+  __ULL(0x106EC05A0AB1450D), __ULL(0xB1B38DB92A99E731), __ULL(0x784AE377E67071E7),
+  __ULL(0x3E9E1471BA6671D7), __ULL(0x82C29B59D4D73D0F), __ULL(0xC23DD07128B5525D),
+  __ULL(0x4D4E5CE0E9245133), __ULL(0xC8FD1057C09F8CC5), __ULL(0xEA1516E94F394035),
+  __ULL(0xB5E3319C564EE9DF), __ULL(0x126A69F90D822D8B), __ULL(0x501ED6348857AA19),
+  __ULL(0xDE344A324EEE1C83), __ULL(0x1DD9690CB2C406D1), __ULL(0x08D6C5178D5E4387),
+  __ULL(0x4CEA4050A3E8FDC1), __ULL(0xC114A06ACC83F777), __ULL(0x20B060EBC0EA01DB),
+  __ULL(0xFE50045ACB78C99F), __ULL(0x291A68705B196E91), __ULL(0xC1042C724273E2BB),
+  __ULL(0x2CEE680BB165B7C9), __ULL(0xFD2FF9F12E0776D5), __ULL(0x166A5DA63AF2CC6F),
+  __ULL(0xEDD16A5930408D27), __ULL(0x2ADF30C26528844F), __ULL(0x9A48D6572B5EEC7B),
+  __ULL(0x6E8BF2877503CB9D), __ULL(0xEA27A191A7045389), __ULL(0x6EB091F34DD45D3F),
+  __ULL(0xDC8A6CABB2937D41), __ULL(0xBC2F04F254922A05), __ULL(0x41431F4D6EB38631),
+  __ULL(0x7BD717435A08291F), __ULL(0x4232DF9C91FC1A55), __ULL(0xA4651E1D5382EAB7),
+  __ULL(0x7CFB5409DE4CF3C5), __ULL(0xCDD636FB068B9929), __ULL(0xEE8F95E740462C97),
+  __ULL(0x490F97B3A758B4A5), __ULL(0x641431563C441287), __ULL(0xB743DAD3EC45916B),
+  __ULL(0x7B188BE8F55C878D), __ULL(0xD805648B2CA54EF9), __ULL(0x76DBE6EEF60123AF),
+  __ULL(0x3711525E6A9E8867), __ULL(0x85C2215CB383D8F5), __ULL(0xE58F554C89825857),
+  __ULL(0x8FBD3B17C01DACD9), __ULL(0x4C8C39DC7AEDEE65), __ULL(0x653AC6DDA86CD3B3),
+  __ULL(0x0D61C6791A9C2C81), __ULL(0xB627A30090354237), __ULL(0x83A89A539C527C23),
+  __ULL(0x28C8C09330E90D71), __ULL(0xEE1178D27B1F029B), __ULL(0xCECC740B37860AB5),
+  __ULL(0x79736FDE910C485F), __ULL(0x6873D51F2487234F), __ULL(0x2A112180614FB973),
+  __ULL(0xCB04CEA98508F4EB), __ULL(0xC2FCD2C527E28D7D), __ULL(0x980203EE10393C69),
+  __ULL(0x3FA90A1D7D75681F), __ULL(0xDBF3BFEFEF217CC3), __ULL(0x66A17FD3087B41E5),
+  __ULL(0x962195D496FBBD3B), __ULL(0xC705A86155443E49), __ULL(0x3F298EE0BE6FEBFF),
+  __ULL(0xAA99B084E62FA613), __ULL(0x1F000CB7D0B46FE1), __ULL(0x9ED7858637C9B2CF),
+  __ULL(0x4D871AAF27C106FB), __ULL(0x2E6A467CDC75A4F3), __ULL(0xE9D938FB696DDE8D),
+  __ULL(0x40EC71B0B1554485), __ULL(0x3AAE12F861E5F3E9), __ULL(0xA97565873959F843),
+  __ULL(0x0B5A960C09FBCA8F), __ULL(0x463FE3D268012C91), __ULL(0xE59A6BD5F5EE1BDD),
+  __ULL(0x6542E84D7775CE45), __ULL(0x8B6EEF58FD9EFFA9), __ULL(0x58993DBB9F98075F),
+  __ULL(0x2997955A810ACF61), __ULL(0x76E3D2F5077DB451), __ULL(0xB37C1D2867E30907),
+  __ULL(0x53CE6E09BD8D8695), __ULL(0x39DB291EA2A6B0E3), __ULL(0xDDD265AB9C58847D),
+  __ULL(0x5BECA8562DDDD0CB), __ULL(0xB69031C153DDBED7), __ULL(0xD03C2271B42A6FCD),
+  __ULL(0xCD6FD19E63E40EA3), __ULL(0xF7687AA8E4FD7BF1), __ULL(0x649DFDA112A272A7),
+  __ULL(0xECF7866A56D526DF), __ULL(0x72BBF1CFDAEBFEAD), __ULL(0x55F6A48DF7055719),
+  __ULL(0x80060BFFCFA00183), __ULL(0x8A104F309919B087), __ULL(0x98FA7DB7652F6A15),
+  __ULL(0x5D7D1B3DF70F7AC1), __ULL(0x16AB7B5E04CC1F6B), __ULL(0x78A5BFD2E5ECECF9),
+  __ULL(0x6506392E171D869F), __ULL(0xC3FC12E221EF146D), __ULL(0xF8AA132822C33657),
+  __ULL(0x894496574F536F43), __ULL(0x8B2546B08FB4CBD5), __ULL(0x043BBB561BD1AA7F),
+  __ULL(0x2412C7CC4EA7A12B), __ULL(0x6F0BD406DD71696F), __ULL(0xAD475C6988D54B71),
+  __ULL(0xD812E5D48DBBBA27), __ULL(0x22AACA437BA04893), __ULL(0xDBA6FF1FECD5F09D),
+  __ULL(0x13016D3396286773), __ULL(0xC746494631BCFA41), __ULL(0xD14888565BF6A10D),
+  __ULL(0xC002EF885F0ADF05), __ULL(0xE5A04DA7FEE6ADE7), __ULL(0xC114CE5468593BC7),
+  __ULL(0x0BB6747DD7F577B7), __ULL(0x395CE5A20F285839), __ULL(0x6EEE8BE66E8618EF),
+  __ULL(0x52ACF64297F1241B), __ULL(0x361DCC48A364093D), __ULL(0x342D6F475D72E629),
+  __ULL(0x5E978BD46410D413), __ULL(0xCC3433D75BA015AD), __ULL(0x1C83B7628458D4FB),
+  __ULL(0xF9CA45637E38F809), __ULL(0xCBED792FFAF6B115), __ULL(0x9ABD961D8C0E8C8D),
+  __ULL(0xE69572FA659340AF), __ULL(0x9187E7483A6436FD), __ULL(0x1E9C726993BED9D9),
+  __ULL(0x243554DB91976365), __ULL(0x04D06FF994C0088F), __ULL(0x25B76ABCB74889DD),
+  __ULL(0x3A409642893C779B), __ULL(0x8F8F620D8BC0C927), __ULL(0x6F9F196B3369855F),
+  __ULL(0x92A522BB0638ED99), __ULL(0x96270F1EFDD7004F), __ULL(0xB4844B380FDAA79D),
+  __ULL(0x108936AA5F9C1495), __ULL(0x0B60F606F104C9EB), __ULL(0xC663DFE8263B302F),
+  __ULL(0xC91A280B9110B15B), __ULL(0x0904287118D10969), __ULL(0x160D36A5D31BF553),
+  __ULL(0xE84F5FDA3C67AD21), __ULL(0xBD85701F72D4B6ED), __ULL(0x4C50CF5924DEE1C3),
+  __ULL(0x2455AAF1633BB6E5), __ULL(0xD775B39F549B8AC7), __ULL(0x87FCDDA7A252CB49),
+  __ULL(0x53DF2E3BD254A739), __ULL(0x8915E69623A5F7EF), __ULL(0x1EF24C80742DD08B),
+  __ULL(0xB4D87AAA6FB1E897), __ULL(0x788573E8B92DBBFB), __ULL(0x02527B137B0878C1),
+  __ULL(0x1870A7C8DEE9F4F5), __ULL(0x39B99E40910A224B), __ULL(0x45821C0ABD4DF247),
+  __ULL(0x10FE2B2F50E02FB3), __ULL(0x5762B90C043F0345), __ULL(0x82A67B9193B27BBD),
+  __ULL(0xA6E914E28EC37693), __ULL(0x835D9A4FACAF445F), __ULL(0x48DEF8175884F82D),
+  __ULL(0xAE900E2D7C9A6F7B), __ULL(0x1C08431BDD18BE89), __ULL(0xB370A66D684FD83F),
+  __ULL(0xB4BE33E18F93B279), __ULL(0x310C50872A7DD5E3), __ULL(0x447AB1281276697D),
+  __ULL(0xC2F122216B2A6C21), __ULL(0xAB99C8B5AE1C3059), __ULL(0xB78E17A2227D593B),
+  __ULL(0xABF97D03F7269C5D), __ULL(0x867AEFC9FDBFE7FF), __ULL(0xF7F7AD182E47D5B7),
+  __ULL(0x50DFF95A9847721B), __ULL(0xE4CB8A0E83CB6A35), __ULL(0x8DA72ECDF9247A1D),
+  __ULL(0xC5B04BFC87F31D87), __ULL(0xE2DCF622EA2B00F3), __ULL(0xB9CE9F2E4972F46B),
+  __ULL(0x1ED785C911BF59F9), __ULL(0x4DDB8A4EED70E085), __ULL(0x81E93B4DF68C24FD),
+  __ULL(0xEE0D0812AFCD8357), __ULL(0xF62E3BA72268A891), __ULL(0x3194D367C8154147),
+  __ULL(0xD096EDE8E30C20D5), __ULL(0xD68624D27B87A77F), __ULL(0xB728FCDC11C8204D),
+  __ULL(0x9D6B6038077E066F), __ULL(0xAA732D7A4A360D93), __ULL(0x36AF98A423972DB5),
+  __ULL(0xC31D00DA12940F17), __ULL(0xED85352107410B25), __ULL(0x829C85EE6DB8567B),
+  __ULL(0xEF60258952CC6D89), __ULL(0xCF28C2E0DA787741), __ULL(0x57567D8494AF28F7),
+  __ULL(0x2C7C98518F174031), __ULL(0xB28B363A36825AE7), __ULL(0xED1FFEB64F9AE769),
+  __ULL(0xCBBB0115E9B9A31F), __ULL(0x8D3C5FECB7F9E4ED), __ULL(0x816271698195CFC3),
+  __ULL(0x9AC939D1C2B1D35D), __ULL(0xDD9FB7017B0EC455), __ULL(0xC94CAB1E57276E3D),
+  __ULL(0x8B8806B117C79913), __ULL(0xA9E63292A3269FD1), __ULL(0x76DA5710F1E989FB),
+  __ULL(0xDDED6688D83A918D), __ULL(0x4E446B6A305428F9), __ULL(0x4DDACA7A3696CFB1),
+  __ULL(0x7EADC4EB87F26ED3), __ULL(0x76C13A0FF04C00C9), __ULL(0xCBF800504D2A2681),
+  __ULL(0x0731DADA6C4FEC9B), __ULL(0xBCB52A664E63F627), __ULL(0xF1F9ABDA071C2AA9),
+  __ULL(0xF262FFA620FFE20B), __ULL(0x93774A3D57199A99), __ULL(0xFB3541CD467A1903),
+  __ULL(0x6828CAB6B4FE8F51), __ULL(0x12AC03E3D624CC9D), __ULL(0x6363BD1E9BB7D7F7),
+  __ULL(0x334CFD676A484D2F), __ULL(0xD511ACD86F143A53), __ULL(0x73FC2490E0062BE5),
+  __ULL(0x10780DDA36B78B55), __ULL(0xABF601274064E0AB), __ULL(0x3EF3E4CA27E4A2CD),
+  __ULL(0x9216A26E690A16F1), __ULL(0xBAE4849E6034BDA7), __ULL(0xF943A0520E01E9E1),
+  __ULL(0x7C89958F48F6658B), __ULL(0xE67128750E0545A5), __ULL(0xC6C9E1D414516CCF),
+  __ULL(0x805307F996E9E81D), __ULL(0x3EDDD2CFF46AD5BF), __ULL(0x35582C1AEB5AAE85),
+  __ULL(0x4973C88573EF6EB1), __ULL(0x3063F627C1E715D9), __ULL(0x711AD679A8DCC243),
+  __ULL(0x51C224A17A3DB4B3), __ULL(0x612325CA50DDAED5), __ULL(0x9929A7B6B7958B37),
+  __ULL(0xA78D222E5A857BB9), __ULL(0x3AD0FFE3198D139B), __ULL(0x08B4659AC547ED17),
+  __ULL(0x1752E8904AFF1003), __ULL(0x60745C37EE4E5925), __ULL(0x29E2DA1F6557EE51),
+  __ULL(0x80D78C24AC49CB89), __ULL(0xC56C3B495C8D1F79), __ULL(0xCF5BDF9F5088AC2F),
+  __ULL(0x8A44800E4FAE4E7D), __ULL(0xDD76384277E578E7), __ULL(0x20B1562D2703FACB),
+  __ULL(0xEF56CAF96E9D8E3B), __ULL(0xF54061416AEDE033), __ULL(0xE0BC78C21A26E4FF),
+  __ULL(0x0524F92731A179CD), __ULL(0x5D3B4AD7DEAFEC8B), __ULL(0x508828F744DA88AD),
+  __ULL(0x6E82014031710BCF), __ULL(0xADF3B77A22595DD1), __ULL(0x0D8F0C03F7EA8A87),
+  __ULL(0x2C49E3483C3A05F3), __ULL(0xCCECBC98C91274C1), __ULL(0x273A08941BB71E77),
+  __ULL(0xDEAD5A1E3F341BAF), __ULL(0x83EEE092593309FD), __ULL(0x4AF5F1BD3AE87CE9),
+  __ULL(0x4CA85AD2301C9E6D), __ULL(0x1B19592CD31A3943), __ULL(0x3E7AA05E6DCD81BB),
+  __ULL(0x86336CECB02BA47F), __ULL(0xA96B30D0C8A44B2B), __ULL(0xB7C63FA0CFCA0571),
+  __ULL(0x8EAF59B405A642B5), __ULL(0xDF29E9CBB536DC17), __ULL(0xED14132C82C1D43F),
+  __ULL(0xAF68778E34CAAB0D), __ULL(0xA4F04A3368941D31), __ULL(0xE9960969357C07E7),
+  __ULL(0xEB47B62B7360B469), __ULL(0x64C653D779AE730F), __ULL(0x479702D3319915C7),
+  __ULL(0xEF3C3EEBC6803239), __ULL(0x93807B1A2E3C0E1B), __ULL(0x8167E33E3F478029),
+  __ULL(0x60CB76E38C339397), __ULL(0xAE34788FFE4BC283), __ULL(0x4B6246A0C6C093A5),
+  __ULL(0x872E594B12B03EFB), __ULL(0xBC0AE83CE9045B15), __ULL(0x0AD30A3917E0968D),
+  __ULL(0x124EF5A4E1C7CD63), __ULL(0x5B98FE0E9FE17AAF), __ULL(0x414306CFE45400FD),
+  __ULL(0xA06D1B4FD391E8BB), __ULL(0x11939803A60C2381), __ULL(0x668C11CC37EA6B23),
+  __ULL(0x83F9B2089DC10645), __ULL(0x65DC8AE47AF277A9), __ULL(0x6E2368B9C685770B),
+  __ULL(0x3EA137AEBA5A6B2D), __ULL(0x735F57ADCA48F19D), __ULL(0x69A8DE0BA1B18107),
+  __ULL(0x8FB84BDF5822BD79), __ULL(0xB8FAB3B748562721), __ULL(0xA6C658EA10A65C3B),
+  __ULL(0xE56381F33AB5E549), __ULL(0xE3C224DA14988139), __ULL(0x438C253E6D99F513),
+  __ULL(0xC1B99F8841A3A6E1), __ULL(0x63FA18C79C54FA8B), __ULL(0xE7F6F609619D0D1D),
+  __ULL(0x7B39EF3B70AFC109), __ULL(0x73922C61CA7452BF), __ULL(0x28D96828332372C1),
+  __ULL(0x6B6E92968C4E8463), __ULL(0x571861F084962EDB), __ULL(0xD935C64F140F1EF5),
+  __ULL(0x96459F8FD72A4C4B), __ULL(0x410BA9A2A18242D9), __ULL(0xCF90979F89870391),
+  __ULL(0x10F94FF26BC00ADD), __ULL(0xA6619FBB9DA139B3), __ULL(0x765A23334EFB03D5),
+  __ULL(0x6F2F613B5E631837), __ULL(0x666B99BFBCD368B9), __ULL(0x922B78EB01ED45BD),
+  __ULL(0x7079A199C31DE6A9), __ULL(0xA181ABCDA167BE5F), __ULL(0x2F6DBBCAB3A9822D),
+  __ULL(0xC5A83FF0E43EBA17), __ULL(0x28C68613DDA7D97B), __ULL(0x5CF33ED49EFA5007),
+  __ULL(0x9125FDEAD661590D), __ULL(0xAEE67F478C7325E7), __ULL(0x735B1274A0E89653),
+  __ULL(0x733B56EAE1A4E621), __ULL(0x1944FFB316FFE65D), __ULL(0xF26BC3CFD2A01449),
+  __ULL(0xB5827BA68B83E201), __ULL(0xAC139507E48EEFB7), __ULL(0xEB7676B25834FDA3),
+  __ULL(0xAD898F4763DA5C1B), __ULL(0xEA906F224398F9A7), __ULL(0xA8AFF3CACA28CDAD),
+  __ULL(0x46C53AA36B19B083), __ULL(0x9ADA32B09603E8CF), __ULL(0xD31F842EF5D8E915),
+  __ULL(0x6124AF44730A33F9), __ULL(0x828EC4C2B6E64A85), __ULL(0x3D6F49DF999638AF),
+  __ULL(0x7641460A0EA89B65), __ULL(0x97703F98FB7FE291), __ULL(0xD343C209E3E6B7B9),
+  __ULL(0x4E5FC01F6A41406F), __ULL(0xB78A05B08AA4BCBD), __ULL(0x3434A14919D34561),
+  __ULL(0xCCEAD7DEE120F525), __ULL(0xE1375A2BCCD87673), __ULL(0xF727D51420A57141),
+  __ULL(0x2C3B68CFBCEBB00D), __ULL(0xDA91E2F3E17542F7), __ULL(0xB55F6100AE95D6E3),
+  __ULL(0x6A0C608E0BBAA975), __ULL(0xAC5F2FC151C016CB), __ULL(0xB1E5AF8146E4D00F),
+  __ULL(0x6E283D3B112602C7), __ULL(0xF9A48BCB76C96E55), __ULL(0xA776780CA4C0E101),
+  __ULL(0x8D40A2D47D99C7C5), __ULL(0x4ED9D8A7AEDCEFEF), __ULL(0x55C5CF9586072313),
+  __ULL(0x62C640E386EF1F09), __ULL(0xDB876E7FEB8B02F9), __ULL(0x5B85AC1558BDF263),
+  __ULL(0xB2B13930C2A889B1), __ULL(0xDF53C897124F8C57), __ULL(0x68A69390FDCE78DD),
+  __ULL(0x5A1E8F0261E6E7B3), __ULL(0xCCE38A9CCAAB014D), __ULL(0xB0CD4811FE6A8171),
+  __ULL(0x911C24573E445027), __ULL(0x9E86401E61CAC4A9), __ULL(0xFD2731405F265EB5),
+  __ULL(0x3F4C00205C05B02D), __ULL(0xE92E3D0A829A974F), __ULL(0xDEC216E5AA47169D),
+  __ULL(0xA0397BF3448BCD73), __ULL(0x9ECF538D7EFA905B), __ULL(0xB1037B5F84886421),
+  __ULL(0x941BB5A5E99E83D7), __ULL(0xF35FB6CFF87B10C3), __ULL(0xDE7A61B7B2A0913B),
+  __ULL(0xFFEFFF7FFBFFDFFF), __ULL(0xED39F9339C94D0F1), __ULL(0x5E6857F5C89EBA13),
+  __ULL(0x597EE5007793A235), __ULL(0xAE5B807B69974F97), __ULL(0x5669491A56417C19),
+  __ULL(0x48E977AFB0EF2FA5), __ULL(0x1B645813A0B7DAFB), __ULL(0x0C2CFC30747D8977),
+  __ULL(0x9CAEFAF424881885), __ULL(0x96A2B427FACD28B1), __ULL(0x619E325A834A3B9F),
+  __ULL(0xBC0258BD75DB614B), __ULL(0x6C3A67A8D325916D), __ULL(0x744285B9383F6FD9),
+  __ULL(0x792D5F45B4C7B947), __ULL(0x9AFA9D0A8EC258D5), __ULL(0xBC88D62B178355B9),
+  __ULL(0x08174ACF9B79C361), __ULL(0x5323B91AD88ADA03), __ULL(0x3ECCA4146EFA2851),
+  __ULL(0xC1EED34A7971E589), __ULL(0x0DE35E7852C78FEB), __ULL(0x0CD8E8A7B77E5E0D),
+  __ULL(0xD64028DE188224CB), __ULL(0x3AA0C760BDA6F2D7), __ULL(0x24CF602012773CE5),
+  __ULL(0xEF7B5E9592DF0E0F), __ULL(0x2724F615C53CEA33), __ULL(0x8D0445F29ABEDEFF),
+  __ULL(0x76A2B82410D295C5), __ULL(0x2F9EC39EE294D11B), __ULL(0x3C49D6FC0E17E91D),
+  __ULL(0x3D1B08CF9D5D6EC1), __ULL(0xBEE559FAE482A0F9), __ULL(0x3F41C760C30655AF),
+  __ULL(0x764C964BA0A416E9), __ULL(0x4CBFC0AE9AA326D3), __ULL(0x09782247FA7C7A9F),
+  __ULL(0x461B34965141EBBB), __ULL(0x546AE72F730E1FD5), __ULL(0x7C4183984C9CAF4D),
+  __ULL(0x443893EFAE8721BD), __ULL(0x2148ABB7F4546E27), __ULL(0x303B78FF41B00261),
+  __ULL(0x3EFF7ECC31C1D54F), __ULL(0x5C8DD7D22ED3757B), __ULL(0xBAFE5E4872A2849D),
+  __ULL(0xA4DEABA77A16EE41), __ULL(0x6A57EDC34EF54FF7), __ULL(0xB0181D14018961E7),
+  __ULL(0xF2FA1F98FF613E75), __ULL(0x164DF29B02A033ED), __ULL(0xC001E328B9AAC659),
+  __ULL(0xF80401C48B6AAF11), __ULL(0x59FEFFAD1258C25D), __ULL(0xA663C3607F21C133),
+  __ULL(0xEC984CEA279318AB), __ULL(0xA04683EC23600C39), __ULL(0x8AF765AD7EC08CEF),
+  __ULL(0x1CE90AB3BC8FE813), __ULL(0x528A3D970B83E1E1), __ULL(0x016F6125575D29AD),
+  __ULL(0xA5F962B7DB3D8C83), __ULL(0xC8D70658BC59F6D1), __ULL(0xF9656C8DC7052C09),
+  __ULL(0xE1EF7EC2BBDA1763), __ULL(0x707AA6C7C667B4AF), __ULL(0x3F4F300341CF6F4B),
+  __ULL(0x08FB60D325FDD957), __ULL(0x6B3AF4D2FA2A52BB), __ULL(0x5194721CF6AF1DDD),
+  __ULL(0xE15471C083B99D7F), __ULL(0xE11E724FE594864D), __ULL(0x50A1BA159B270337),
+  __ULL(0x90F7A3A7F007DE71), __ULL(0xA6B2F2DAD15773B5), __ULL(0xD961C5D3CEAA795F),
+  __ULL(0x97503B970652A10B), __ULL(0x63AB4F5C61985B07), __ULL(0xB10263A8D57B6895),
+  __ULL(0x0C40268F29A10953), __ULL(0xD52A84BEB78CA121), __ULL(0xD70C4B500A8BCAED),
+  __ULL(0xCB8BC0E50EA18AE5), __ULL(0x72EA5984BBBB3EC7), __ULL(0xF00FFEA10823DFAB),
+  __ULL(0xC02DAB1D24645B39), __ULL(0x83A36D8D1CCB10A3), __ULL(0x865BA87EC3351C97),
+  __ULL(0x3D51C4C905E32919), __ULL(0xA063231A01A603CF), __ULL(0x7209600DA2FC8FFB),
+  __ULL(0x6CABE5C15791571D), __ULL(0x6ED50B8A2A21F78D), __ULL(0x5C39327C880705B1),
+  __ULL(0x93766AD6C0E618DB), __ULL(0xD7FF522F04C7F4E9), __ULL(0x9632957DB9A2764B),
+  __ULL(0x3870B60DF29DF143), __ULL(0xFD9B3E995B9A832B), __ULL(0xFAE1B64336879B6F),
+  __ULL(0x5B4F64DD92900FBD), __ULL(0xF36F28233AA65417), __ULL(0x3F7D0AF5B6813825),
+  __ULL(0x2DD65D861F364551), __ULL(0xED16BE65FF45CC3F), __ULL(0x913517022715630D),
+  __ULL(0xA2F8FC6528C56679), __ULL(0x7CB887131DF1FD7D), __ULL(0x5F80678112D24C75),
+  __ULL(0xD80A7A37C96239CB), __ULL(0xCBFCC59631976B0F), __ULL(0xF4FC05ACB7422D3B),
+  __ULL(0x281D221BF7372E49), __ULL(0xC45D9DAA1A2708CD), __ULL(0xAB8B955979FE47A3),
+  __ULL(0xEBDB17947D9353A7), __ULL(0x71C652B85552F829), __ULL(0xF150B965BDE7B819),
+  __ULL(0xFA82319DB4C69315), __ULL(0x6607C749F35DEBC1), __ULL(0xF7ABF1C5266A486B),
+  __ULL(0x2B714DA81F83B485), __ULL(0x00F659777687379F), __ULL(0x83020F7045E2B757),
+  __ULL(0x49EB67E096416843), __ULL(0x754B18EC3B5505C9), __ULL(0x5ED330EB790D74D5),
+  __ULL(0x1BC8A6CFF7AB9B7F), __ULL(0x6A228E8DC982344D), __ULL(0xF67E43E9D1492193),
+  __ULL(0xBFE5CA8B81DEBF61), __ULL(0x8FEEFD5B137DB24F), __ULL(0x5ACCCF96F3B6A99D),
+  __ULL(0x4E0E1A4CB8968073), __ULL(0xA318D4913A9BBA0D), __ULL(0x1B3BC4508F1220E3),
+  __ULL(0x6C1874BC953C6805), __ULL(0xCA1E3D2F0A9D0EE7), __ULL(0xC81F0BF7DBBE1B69),
+  __ULL(0x830652164C71D375), __ULL(0x34B96716C144971F), __ULL(0xF15C8349A044675D),
+  __ULL(0xEA0F6B88DC19DCC7), __ULL(0xC3FECF6822D44633), __ULL(0xB1CAC32B2858DB01),
+  __ULL(0xC7A9CB1EC2D438B7), __ULL(0xCD5160970C616D1B), __ULL(0x64019E0AD6156729),
+  __ULL(0xE4693042C08EFA97), __ULL(0x99CC8957F34F13D1), __ULL(0xABB47C7EDBD3DA15),
+  __ULL(0xA09EE04E26608F6B), __ULL(0x18C6DB9CC91C3C63), __ULL(0xC1B56EC75D3FD1AF),
+  __ULL(0x65C3B47C020787BB), __ULL(0xB50C3D1D171E1A81), __ULL(0x015BB06D814AA545),
+  __ULL(0x11E2755E2239C09B), __ULL(0x9E1319D4D99CAA27), __ULL(0x19489B7A1C7288B5),
+  __ULL(0x26CEDA1F4FEDB65F), __ULL(0x4725E236A2A1AD03), __ULL(0xD4D56AD761730351),
+  __ULL(0x72DEBEA0F35C3D95), __ULL(0xEF77488300A94F05), __ULL(0x4BABAE383B08C12F),
+  __ULL(0x5C809EF3FA660A69), __ULL(0x81BAAC7F3F62DE21), __ULL(0x715E37FFCA0E2BC7),
+  __ULL(0x087AD341DCF98C49), __ULL(0x82973CF13E92B6CD), __ULL(0x51A4FF653A46B5A3),
+  __ULL(0x3F021364229408EF), __ULL(0x8E1687C272DB793D), __ULL(0xA1E74F3C2750E997),
+  __ULL(0x6BE32C934626D619), __ULL(0xCAFFD118FED27C1D), __ULL(0x3E2CF01F6379C2F3),
+  __ULL(0x53F4CF2F3F24C9BF), __ULL(0xDE6AB42333C8F363), __ULL(0x0EF38DB642BF0DDB),
+  __ULL(0xC14F750F8414C1E9), __ULL(0xFCA3E0A430A71B6D), __ULL(0x89196248031FC9D9),
+  __ULL(0x54BE5AB3AFC1F88F), __ULL(0x82D879344FEFC8B3), __ULL(0xC4AE6C822B2A1981),
+  __ULL(0xC06F57BD51A9D82B), __ULL(0xED53BE205080386F), __ULL(0xC2AFFC451C004F93),
+  __ULL(0xA095F848B4D5755F), __ULL(0x9C1110A019A62D25), __ULL(0x4F61A68A73D0F87B),
+  __ULL(0xA3AAA877162939EB), __ULL(0x645900CC9D46D379), __ULL(0xD9F3AD9D2AEB8EE3),
+  __ULL(0x6520BB0FE391E27D), __ULL(0xFD110F4F617EE175), __ULL(0xE944DC600F9DC80F),
+  __ULL(0x7DC794305C68D55D), __ULL(0x2F40082FAF5D80A7), __ULL(0x13F336257EF04529),
+  __ULL(0xADF2C9BFE0FC331D), __ULL(0xB589D4991AF43E87), __ULL(0xE288F19FAA816985),
+  __ULL(0x19DCA71F9BE8B4DB), __ULL(0x62308F9914D29DFD), __ULL(0xDD26EFEC163FF49F),
+  __ULL(0xD72E59739B6FCD43), __ULL(0xB14B8F482930FA65), __ULL(0x57E9159F6B8E55BB),
+  __ULL(0xBCF3F6C6CF52E247), __ULL(0xE867194B2C07987F), __ULL(0x7E8C1D348619EBBD),
+  __ULL(0xCF72338EFC3CE693), __ULL(0xC9A64859770696B5), __ULL(0xB2A71A33E6AE1017),
+  __ULL(0xED67240F6C078F4F), __ULL(0xBE7B7A7F0148DF7B), __ULL(0xC75B758A3BC3AE89),
+  __ULL(0xED1BD8A86FAFE841), __ULL(0x34B4234DAC2ABF0D), __ULL(0xDEF9319A487B9131),
+  __ULL(0x127A3231307655CB), __ULL(0x80367D8EF65BE70F), __ULL(0x6AB7FF001331C2AB),
+  __ULL(0x3FA1AA1BD4BAC5B7), __ULL(0x3A4D0D5BA89C66C5), __ULL(0x4D3B50A01A59E21B),
+  __ULL(0x6BC40EDC5E737213), __ULL(0x07A07D388DC553DF), __ULL(0x469F5625BA795BE1),
+  __ULL(0xC376F4ADDE3630D1), __ULL(0x042CD53AD317AF15), __ULL(0x8A4637CE8127C7BF),
+  __ULL(0x3B5A1532E97C49F9), __ULL(0x53B021BBB0BA20B1), __ULL(0x8394A7698980C7D3),
+  __ULL(0x1F63D185A93CEBF5), __ULL(0xA1E436953C807BA1), __ULL(0x418A6EBC74547357),
+  __ULL(0x6136D92B2E7E67DD), __ULL(0xF709B3E898481781), __ULL(0x37B41E737295D727),
+  __ULL(0xFAA86F45B15EF35F), __ULL(0x3C9E35F6EA77DC73), __ULL(0x6A2A5E360D671295),
+  __ULL(0x8A516A5EC3906741), __ULL(0x21BF7DE7F343D07D), __ULL(0x06D48BBD1E09D769),
+  __ULL(0x9FB5976327879353), __ULL(0xFD61CB9760DD931F), __ULL(0x8637F477889074E5),
+  __ULL(0x802EDE94C2FF18C7), __ULL(0x1A10D30FC6A689AB), __ULL(0x3D17C4E7FCAF3BCD),
+  __ULL(0x076713B3261BE7F1), __ULL(0x4C6B13F62D5E9AE1), __ULL(0xC12F60EBB3AB4E8B),
+  __ULL(0x2AFC63359AE646BF), __ULL(0x09B6FB530614B077), __ULL(0x08951E25C35172F5),
+  __ULL(0x10A50BC3CC7EE06D), __ULL(0x007BA4237342F6D9), __ULL(0x32BB55FE36C9558F),
+  __ULL(0x9A16561CFE6E9EDD), __ULL(0xFEA6A6D82E0F2D2B), __ULL(0x5E6B7280BC054C37),
+  __ULL(0xEBE86B38DC06D56F), __ULL(0x94088E7B34781493), __ULL(0xF4B5B35EDCA9FA61),
+  __ULL(0xB7414747CF05EE17), __ULL(0x1255DE8B88198903), __ULL(0x0FC30F671354C63F),
+  __ULL(0x31D49026B21B0EEB), __ULL(0x59C9A3C6264BC77D), __ULL(0x950B668EC855D9E7),
+  __ULL(0x41D204D2916463CB), __ULL(0x0D93A0149D933E59), __ULL(0x890721B3D1589BE5),
+  __ULL(0xA232341C51E8973B), __ULL(0xB03ED9EE9EE3D601), __ULL(0x7103BB43AA88301B),
+  __ULL(0xA70693D6DF71E835), __ULL(0x8ADB021C9DA5E1AD), __ULL(0xA51C90CBAE5B5CCF),
+  __ULL(0xA168C71BC5AAACAF), __ULL(0x64F0AB37C5FB82FD), __ULL(0x6697F17637A6B19F),
+  __ULL(0x7F4DDD231345776D), __ULL(0xAC49150D6A043243), __ULL(0x487AC16B8D726F65),
+  __ULL(0xD39E1843A8458ABB), __ULL(0x25DF3583C07CF42B), __ULL(0xCACC04FBEECA6BB9),
+  __ULL(0x04AD78BF9E376D23), __ULL(0xB9B398C86C61F527), __ULL(0x16BD48A143A7ABB5),
+  __ULL(0xD0E1D422BC54BB89), __ULL(0xDC9D8BB0866C8A73), __ULL(0xE5944E779233C40D),
+  __ULL(0x52A97B9E866FD205), __ULL(0xDD42FAFBEAD0FD75), __ULL(0xE4F3B63968346ACB),
+  __ULL(0xD72D8D50EBFC2DC3), __ULL(0xE4BAF3D213B38611), __ULL(0xE402B2EB214B5033),
+  __ULL(0x18BF7BC35C48571B), __ULL(0xD5FC6E6649EC9497), __ULL(0x05E17C135B0F4DD1),
+  __ULL(0x6BC1AF1E70BBC7FB), __ULL(0x631A1C726F858415), __ULL(0x05B03958A1DD44BF),
+  __ULL(0xBAD1F6FDDA128663), __ULL(0x614D3C84E81A0BAF), __ULL(0xEFB50B3D21F279FD),
+  __ULL(0xF8193F5F4CDF14D9), __ULL(0x9CCBD7902D519665), __ULL(0x9C77FFD0D8F9938F),
+  __ULL(0xDC0D85F7DBC0FBB3), __ULL(0xBF1C384D55C30F45), __ULL(0x0F1862EC106D0427),
+  __ULL(0xF4880FF6D33FF8A9), __ULL(0xF4677DA6ABEB600B), __ULL(0xE86676D2D6F6C42D),
+  __ULL(0x1D86032928A7A899), __ULL(0x02C4366A219BE795), __ULL(0x416EC05EF9B8B905),
+  __ULL(0x55593883049FB7D7), __ULL(0xDEE48FFEE834A4C3), __ULL(0x41AAAC9BB9A5653B),
+  __ULL(0xDA2886727AF0A649), __ULL(0x43C49EDC49338955), __ULL(0x704BF0778A752239),
+  __ULL(0x89DCA353F4D542EF), __ULL(0x1ADAB0980D9BCBA7), __ULL(0x4100A83461F7E38B),
+  __ULL(0xE28DFF97B5389ACF), __ULL(0x07BC7FDA5BE2C61D), __ULL(0x935864C348D60209),
+  __ULL(0x2F1785FA1461E3C1), __ULL(0xFDD5BC4BB0297F67), __ULL(0x350916589E345BE9),
+  __ULL(0x6C54C161128823D9), __ULL(0xECB9F1D4DD636D47), __ULL(0x2DF936CDDE9C1381),
+  __ULL(0x0B6E61B15A08D937), __ULL(0xD83940B9381BD19B), __ULL(0xDDF532ABCD59EF5F),
+  __ULL(0xA10C9A16848E1725), __ULL(0xCFFD7E8E98FA627B), __ULL(0xC213026497CE7107),
+  __ULL(0xEA0DF9B45187D8E3), __ULL(0x7E8F7FCF70195A2F), __ULL(0xBFE2097F4683EF53),
+  __ULL(0x628824E638321721), __ULL(0xD4CD67EDA48678CB), __ULL(0x97753BEB6CF36B59),
+  __ULL(0x8FCFEDD70194820F), __ULL(0x529B6F8B0316D2FF), __ULL(0x33BF0FCA57FDB0B7),
+  __ULL(0xD3AACAD2A015FD35), __ULL(0xACE997F8057F0EDF), __ULL(0x8DCE9BC7AA9223F3),
+  __ULL(0x32CB2134F56AC76B), __ULL(0xCC97A942C13854F9), __ULL(0xD2DB7766E3DAD385),
+  __ULL(0xCD3A3E2FFEF136A1), __ULL(0x5C8008758C153C6D), __ULL(0x354CA5ED8F04F391),
+  __ULL(0x0E2FD4C7D87858B9), __ULL(0x11C20B5B3932C0B5), __ULL(0x3ABC15208056F661),
+  __ULL(0x638FC7954C74C699), __ULL(0x0A7014A82496497B), __ULL(0xEF0B4FA8D60F189D),
+  __ULL(0xCE1EA1B92AB6C90D), __ULL(0x605B92DCF06183F7), __ULL(0xA9F42C14DCC1B25B),
+  __ULL(0x7FBA3D42350FCE1F), __ULL(0x85C57093D043D201), __ULL(0xB78A4A7594286CAB),
+  __ULL(0xF4B3CE609841DFB7), __ULL(0xBD76FA33B9BAD0C5), __ULL(0x0BBC6784F4F54E29),
+  __ULL(0x054FE5FB45F7CDDF), __ULL(0x3487D58656BA3DAD), __ULL(0xF09A3181A81E51A5),
+  __ULL(0x9EE617291AC67CFB), __ULL(0x3E19EC22E16CE787), __ULL(0xC1696197C3F16009),
+  __ULL(0x1AF6E582E300C1BF), __ULL(0xF5304617434E9D67), __ULL(0x3765E2F6A8BD51D3),
+  __ULL(0xE3DA2EBBC082F08F), __ULL(0x70AB1C82EA6ADBC9), __ULL(0xC4514C1226ED917F),
+  __ULL(0x90CCA52D8CFE9A4D), __ULL(0x14F4AF4A44C01F9B), __ULL(0x03223C2451223127),
+  __ULL(0xE5B84DBEFF3FC7B5), __ULL(0x214CC8F520F4F50B), __ULL(0x73E5D840A8C4092D),
+  __ULL(0x8C3D6CB13FB75A51), __ULL(0xA237DEF2CACE0F07), __ULL(0x186CFF099A7D6141),
+  __ULL(0xD84F35C886FB71EB), __ULL(0xCD670DC8256F6E05), __ULL(0xFA77FB0B98B8595B),
+  __ULL(0x2DC1304AB55B04D7), __ULL(0x7686A91A892209C3), __ULL(0xB55432F521D645CD),
+  __ULL(0xF25451E56C940F39), __ULL(0xA6E946AE189DA4A3), __ULL(0x41D7D80E729AA1F1),
+  __ULL(0x12EADB13BE985097), __ULL(0xF99338C396BDDD19), __ULL(0x929CBA50092460C1),
+  __ULL(0x94A3109B5D460B8D), __ULL(0xD331B61EBE996263), __ULL(0x53468C6BA6C8A185),
+  __ULL(0x1B07E212E4E279B1), __ULL(0x76ED63CF6A462C67), __ULL(0xD755268F25C20F8F),
+  __ULL(0x04A826F0C3E1E8DD), __ULL(0x82232AA4609D01D5), __ULL(0x8AC9E0CD74F01081),
+  __ULL(0x8ED955FA91DBD72B), __ULL(0x6C8DCCD45287202D), __ULL(0x623DF867E2A15303),
+  __ULL(0x416E4B9945E0177B), __ULL(0xC29CA7145480B8EB), __ULL(0x464D195F3BE2772F),
+  __ULL(0x6573564478608931), __ULL(0x7801D6C034283453), __ULL(0x1B53ED324A00A075),
+  __ULL(0xC0DF1EE014B573D7), __ULL(0x0A697468BECB85E5), __ULL(0x1E71A4B5BEFBC45D),
+  __ULL(0x2FC6F7AEC97D6249), __ULL(0xD050FE5008FFD001), __ULL(0x802D49118B3F9EC5),
+  __ULL(0xFD8722CBF5F1FF8B), __ULL(0xECFAE9ADBB9A6C19), __ULL(0xCC26145DFEF68587),
+  __ULL(0x937AB927154B28F3), __ULL(0x576A88ADF69B4CFD), __ULL(0x554C822407DC17E9),
+  __ULL(0xC40C534CBE817FD3), __ULL(0x6AC0436F4BD7EB57), __ULL(0x61D9A4F651759091),
+  __ULL(0x0D9DAD30BFC739C9), __ULL(0x7DF2AD5C89AEC8D5), __ULL(0xAC13357140DC484D),
+  __ULL(0x69DAE56AF7899071), __ULL(0x7F93F9FD52F91ABD), __ULL(0x21445D2E3DA4030B),
+  __ULL(0x1245025D032F7399), __ULL(0x0F4FA7A9CC3CD589), __ULL(0x0439D9CD544B3F3F),
+  __ULL(0x541DEE92E99790F7), __ULL(0x1584FD8FA5D2B4E3), __ULL(0x29D9C66FF8762831),
+  __ULL(0x88C608F7D497C2E7), __ULL(0xE41C3CD023AF8B1F), __ULL(0xC8C7732016E80CED),
+  __ULL(0xFE8C8ECE4790FE0F), __ULL(0xC1A0D1B75BDA5A33), __ULL(0x3832760739E96C55),
+  __ULL(0x1C86172327A4C1AB), __ULL(0x7EE8B0B086C2AD39), __ULL(0x5049F99AC5EE9B29),
+  __ULL(0x2C7458D3D9D092E1), __ULL(0x7E9605FB3D422E97), __ULL(0x6885E31554E646A5),
+  __ULL(0x4B452CEB18516D09), __ULL(0x9F64BF62CC7FE36B), __ULL(0x61526231CEC2B98D),
+  __ULL(0x11DF6B567BA0D063), __ULL(0x146B87816D9DAAF5), __ULL(0x2019462193BC32A1),
+  __ULL(0xF92881100D475A57), __ULL(0xE29A3605384E8065), __ULL(0x05282466A6985BBB),
+  __ULL(0x8F9B77811F0D8E7F), __ULL(0x279FA4F87988AF71), __ULL(0x96BBA13CCA0692A9),
+  __ULL(0x7199D361C2C6AA5F), __ULL(0x588FDB97B0E70299), __ULL(0xAD6E2E159D077751),
+  __ULL(0x77A14F09627D46EB), __ULL(0x96CFC3E46FF03FF7), __ULL(0xAAFE934132F37F7D),
+  __ULL(0xD949C0D13EAE6253), __ULL(0x910E29389FC1D3E5), __ULL(0xCBDD03F15985DFC7),
+  __ULL(0x4B018007AE3BCDFF), __ULL(0x562DED7E3614FC39), __ULL(0x092001EAB7050D3D),
+  __ULL(0xD55113069BAE25A7), __ULL(0xD11B32C8F1DA2035), __ULL(0x8E066B6045898A19),
+  __ULL(0xBC75AC3A145B101D), __ULL(0xBE04CE7BFA5BF5E9), __ULL(0xAD339AE5041C31F5),
+  __ULL(0x84931A2D72CFDF4B), __ULL(0x078E8C62EED7EA43), __ULL(0xE5D8C7B549B36C8F),
+  __ULL(0xD5FBEAD55EA28DDD), __ULL(0xAD90FDF57F654747), __ULL(0x924B50F64601DCB3),
+  __ULL(0xCF92CD893053E045), __ULL(0x52EDC20F748C01A9), __ULL(0x5B026E087E96695F),
+  __ULL(0x0AF500E36EC65517), __ULL(0xB0470A33BD9E0125), __ULL(0x925F812256FBCC7B),
+  __ULL(0x09304A23D8F54B07), __ULL(0xB73E15C72C208779), __ULL(0x4D4139BE84BC22E3),
+  __ULL(0xFAC3C118E5B9942F), __ULL(0x343521E808076631), __ULL(0xA37BEC97E019C559),
+  __ULL(0xA3FBD64AD093FAE5), __ULL(0xAFB45119B137363B), __ULL(0xCC1C03D85EF3EF49),
+  __ULL(0xCF7013C10DA8CAB7), __ULL(0x37324EF3E5A4B0AD), __ULL(0xD52E2463D3FCF383),
+  __ULL(0x4790DEE2488FF3CF), __ULL(0x3B12EC55B0FCC71D), __ULL(0xA801B78987EE5CC1),
+  __ULL(0x120F043160E78677), __ULL(0x20D47AD484CCC4D3), __ULL(0xE70161D151EEE89F),
+  __ULL(0x79F59C82A7D03857), __ULL(0x1DF35BC6FA256143), __ULL(0x9719B6F504AF29BB),
+  __ULL(0x097B1336CE48C6C9), __ULL(0xB30FE77456C38C7F), __ULL(0xC38247F1DE06F32B),
+  __ULL(0x761CB47109967061), __ULL(0x9D4A8A3C26A7980B), __ULL(0x6B7F4639F02BA825),
+  __ULL(0xEF065C609793E289), __ULL(0x8D617121ADB9DC41), __ULL(0x061EDA861C61D9E3),
+  __ULL(0x26700855FBA39C5B), __ULL(0x4D50742EEB905CC3), __ULL(0x94C874E6A4FE5D11),
+  __ULL(0xCF3D2FD673C1C155), __ULL(0xE6FB8EDACA8FCC01), __ULL(0x0C1A0C2DB7BC3AEF),
+  __ULL(0xBE61D26945D7B61B), __ULL(0xB6C5AAD056E9E829), __ULL(0xECE774213D828613),
+  __ULL(0x63830DFFF631C187), __ULL(0x3202904A6238BE8D), __ULL(0x04034965902328FD),
+  __ULL(0xB3A71E8CE30DF767), __ULL(0xF19B66E8631BED4B), __ULL(0x844894D37C589BD9),
+  __ULL(0xB5B93BB8F75BF565), __ULL(0xDE49C8F4DBA40B81), __ULL(0x24C0393F96079323),
+  __ULL(0x97FAAC6437520C71), __ULL(0x84FDD03233268B27), __ULL(0x34AAD4D603AFF1B5),
+  __ULL(0xD6F37B69A20C932D), __ULL(0x9EAA08B18337A24F), __ULL(0x4C32E67E305BF073),
+  __ULL(0xDE33DEE277162579), __ULL(0xBA8B10A3DD3E435B), __ULL(0x13BE43D0B8E00F21),
+  __ULL(0x2FACE3A5DCD43C11), __ULL(0xC5B672896806CAFF), __ULL(0x22D371D484F7E939),
+  __ULL(0x2797DFE7498452A7), __ULL(0x48D35268A4EE3535), __ULL(0xFF52B022001CE2A5),
+  __ULL(0x788260BB1206CDFB), __ULL(0xD5CE5DE4C28CDBF3), __ULL(0xC2808DCFAA5F5AC1),
+  __ULL(0xF6B73EE3827C33B1), __ULL(0x3CD487F80F21F46D), __ULL(0xBB178FDC5DF2C98F),
+  __ULL(0xBC730AB8D683EB91), __ULL(0x550BEA143CD33447), __ULL(0x94E53E18F19561B3),
+  __ULL(0xDF3EC2EBD3CDABD5), __ULL(0xBE575BACF0CE0A81), __ULL(0x7EB3C12E5E011545),
+  __ULL(0x1064ACBED1AD496F), __ULL(0x482F9D3090C84EA9), __ULL(0x34DE243A47132893),
+  __ULL(0x2A53F27FF410EE61), __ULL(0x4EB6423D19B5B807), __ULL(0x0F5EEC4B1AD0AD95),
+  __ULL(0x544DC5E97C9ABA3F), __ULL(0xBD5AA405223E62EB), __ULL(0xB24B9B04EC375B7D),
+  __ULL(0x9DE196F4CE13CA75), __ULL(0xC02E4E53AB7A0DD7), __ULL(0xADC02E47754F990F),
+  __ULL(0x390433C2519026CD), __ULL(0xD9A628173F5B57B7), __ULL(0x0E1345C8D8797AF1),
+  __ULL(0x6CAB580E09DD298B), __ULL(0x71FC1FF5F62562D1), __ULL(0x5D166A00421DEC1D),
+  __ULL(0xC65273226FE35F87), __ULL(0x02D240351B4F32F3), __ULL(0x32888929744BF285),
+  __ULL(0xA6C032AC629F20AF), __ULL(0x213EADE1C6297DDB), __ULL(0xF37CEB016AB3B1E9),
+  __ULL(0xFC945DC94F46EDA1), __ULL(0xEFFE87A75A51C643), __ULL(0xBB857C0A5CDC4365),
+  __ULL(0xC029118BB9860123), __ULL(0xC56706DF937E286F), __ULL(0xA61B4065D6309D25),
+  __ULL(0xA4042B6076CAE04F), __ULL(0xE4715F270D2CEF89), __ULL(0xBEF4370888609E73),
+  __ULL(0x1147E0E7D24EA605), __ULL(0xCF9ECD85BCC1E231), __ULL(0xABEF9A436008BECB),
+  __ULL(0xC974D3C39C460159), __ULL(0x400F230F0BC56AC7), __ULL(0xC87A071724D0C901),
+  __ULL(0xCC569987EA9F6BAB), __ULL(0x80278B420EDD86B7), __ULL(0x57735305C9F54B13),
+  __ULL(0xDB86DE8814FF38BF), __ULL(0x342E3F001728C38D), __ULL(0x15FEBBDCC3B66AF9),
+  __ULL(0x50423F19BA767FAF), __ULL(0xFF0F8D44549AD4F5), __ULL(0x7E9E5D1163A8ACA1),
+  __ULL(0x25C6E9274AABA0DD), __ULL(0x6AE3F1A81A17887F), __ULL(0xEE12099CE22BE345),
+  __ULL(0xC77461461D95B40B), __ULL(0x8A56EB9BBFAE5C99), __ULL(0x144C8670A1D10B03),
+  __ULL(0x4746002DE3ED9279), __ULL(0xD6E06C532D95497D), __ULL(0x3C7F14073B1E441F),
+  __ULL(0x0C67E4F8C2A1D911), __ULL(0x1D9928202C0A393B), __ULL(0x2A2FEC45F8F5B9C7),
+  __ULL(0xEBE65DB7A1E3D4CD), __ULL(0xBB5B32A855CA93A3), __ULL(0x603075BA9FBD4BE1),
+  __ULL(0xE13C04C4CCC582FB), __ULL(0x143A91B6183B5A1D), __ULL(0xFA46A4DC12D7D7C1),
+  __ULL(0x291081ED8E3DF177), __ULL(0xDEB12E2236BFD163), __ULL(0xF9B70794C382CBDB),
+  __ULL(0x02182CBA82D03367), __ULL(0xD59120A898D8239F), __ULL(0x0595ED06CA9BB96D),
+  __ULL(0xE1DBBEB84080268F), __ULL(0x6DDDBC0012248891), __ULL(0x900C2DF4D8E500D5),
+  __ULL(0x1E76C78B96F9E66F), __ULL(0x3FFA58971A069BA9), __ULL(0x0578D31CB811EF17),
+  __ULL(0xF6DDD8C042942507), __ULL(0x4A6C7943218E860D), __ULL(0xE14E2BFD88D96179),
+  __ULL(0xBBE965D54B91CE2F), __ULL(0xFACF2C01C273407D), __ULL(0x17C03DEDAAF43AE7),
+  __ULL(0xAC9B63E8033C5F75), __ULL(0x8DC1DE357B670B21), __ULL(0xD9E820C451EACCCB),
+  __ULL(0x183651CB8A4EC6FF), __ULL(0x9B9A768DA3B0C701), __ULL(0x98F11094C1CA5135),
+  __ULL(0xE48129F3B6B3BE8B), __ULL(0xDDAA7F5C7C1B3AAD), __ULL(0xF8879E7314857319),
+  __ULL(0xB244960B0463ADCF), __ULL(0xBB37A5030EB16615), __ULL(0xA9DFF79DC55956C1),
+  __ULL(0x7A48D7FBAC05A785), __ULL(0x264E1312F3B54ED3), __ULL(0x515E460C39E42B43),
+  __ULL(0xFD567E494091E0C9), __ULL(0x6EDFF0F889A0C7D5), __ULL(0x8FA85D9D9EBB9D2B),
+  __ULL(0xD4E6DA83D4F8A623), __ULL(0xBC3C1AC07049A771), __ULL(0xF1B0A28CFB4249BD),
+  __ULL(0x44D8FE480AB18493), __ULL(0xBF46899AC41DEA61), __ULL(0x0DEDA60C09A4DE17),
+  __ULL(0x43860634CE28BD4F), __ULL(0xE0DF80FF1DB91D7B), __ULL(0x3F11A6A75D2CA373),
+  __ULL(0x2E220BABFA1CB63F), __ULL(0xC749B7FE7A3F5B05), __ULL(0x904E40E0877DE675),
+  __ULL(0xBE2C641CF2FE5BED), __ULL(0x06FE1E3713F126C3), __ULL(0xFE83FA8BA484150F),
+  __ULL(0x43AD8EF6415DE933), __ULL(0x28E366FF161DC0AB), __ULL(0x4D73DE74EB5AA01B),
+  __ULL(0xE5FC2D859640C53D), __ULL(0xF94E9C9AA484C1DF), __ULL(0xA7F8FBE3DDF39597),
+  __ULL(0x06C6034432F4B483), __ULL(0x031C44CEB27ADED1), __ULL(0x2DB7A4301A133F63),
+  __ULL(0xE08D061665234EB1), __ULL(0xBCC62A30907E65D3), __ULL(0xA163B2844190174B),
+  __ULL(0x50454FF207284157), __ULL(0x5E71D1D25E94DF65), __ULL(0x67779828164D0FC9),
+  __ULL(0xF3FD0FAAFADB6B37), __ULL(0xFCA8678A003D1D2D), __ULL(0xF5B86F6BE4850999),
+  __ULL(0x0A451D1B55E3C307), __ULL(0x7214828AE02E4205), __ULL(0x6FCF51AC568D2E7D),
+  __ULL(0x80ECF5FF15368921), __ULL(0x751FE78CACD9F2ED), __ULL(0x0F6DA082E4D39DC3),
+  __ULL(0x04BB9E7E0A6A6E3B), __ULL(0x3F740A3D44333255), __ULL(0x11C6B079323E87AB),
+  __ULL(0x22559090EBF015F1), __ULL(0xD8EAD59E3E17A713), __ULL(0xBC629076CA9308E1),
+  __ULL(0xCEF60A3F5840CC8B), __ULL(0x28520F835ABACCA5), __ULL(0xD72776146E6E4309),
+  __ULL(0x4928460D880A1F8D), __ULL(0x20E317500495C0DB), __ULL(0x6FC3E132CD665CE9),
+  __ULL(0x9577780AA518E09F), __ULL(0x8541DCF952372591), __ULL(0xAB3FDEA4FECE6BB3),
+  __ULL(0xEE2FA08B48F40481), __ULL(0x69621395C6ECAAB9), __ULL(0x5ABADCAF3804B293),
+  __ULL(0x46CC0E27F3CA205F), __ULL(0x2C3ED6C5BCF8342D), __ULL(0x7BE26DBC5FF4BC17),
+  __ULL(0x5894224072C0E025), __ULL(0x64CBB391F1909207), __ULL(0x1FF29AD0CC695A89),
+  __ULL(0x0AB9D6890B540CEB), __ULL(0x271E49B0062791E3), __ULL(0x38CA5A3E2827FD31),
+  __ULL(0x13226894432DE7E7), __ULL(0x3FD42DA01B414821), __ULL(0xEB7E9F558B7AE1CB),
+  __ULL(0xB57ADF0F4B56585D), __ULL(0x95FE3BB431EFC3FF), __ULL(0xB789BDB44E0FC401),
+  __ULL(0xABC12FBE306472C5), __ULL(0x3C4441FE5E5434F1), __ULL(0xBE2A4DA6802CBBA7),
+  __ULL(0x22FEFC41EF003FDF), __ULL(0x21C287DEE36D2019), __ULL(0x87F2946352EE361D),
+  __ULL(0x354D0399D878F06B), __ULL(0xB2A5D8D5B36D5AAF), __ULL(0x661929FD617D67DB),
+  __ULL(0x8678520C185293D3), __ULL(0xAF150307B30A156D), __ULL(0x5672A28056DC9043),
+  __ULL(0xA20ECA8B13AC0491), __ULL(0x3FA61C95F7D65C4D), __ULL(0x8BEB2F86AE9BF9B9),
+  __ULL(0xBD2838A4A5E70327), __ULL(0xF689462FD8B1AB17), __ULL(0x1334FE01BEFFD19D),
+  __ULL(0x61B3A63FD6E9333F), __ULL(0x51045C3495DBC4F7), __ULL(0x94591EE571D59C31),
+  __ULL(0x5C34E7CC57DE7B75), __ULL(0x34B7CC5990FA7F1F), __ULL(0x543EAEE3A94B3411),
+  __ULL(0xAA25B1A0809944C7), __ULL(0xF55CD9DC1AF215AB), __ULL(0x138223377215D9C5),
+  __ULL(0xBE385606B5E7CF29), __ULL(0x08B8FDDB2DACD513), __ULL(0x580E0146B21AFEDF),
+  __ULL(0x360029E0F36B86E1), __ULL(0x76DAAE6A596A1AA5), __ULL(0x44515FA3732605FB),
+  __ULL(0x6C1C6CAA9CBA0887), __ULL(0xFDF58487E92432BF), __ULL(0xC2FFDA640FFF376B),
+  __ULL(0x08300D485AC3C18F), __ULL(0x8B067E4026892FBB), __ULL(0x3A063739BF66EADD),
+  __ULL(0x06F238B548AA9CC9), __ULL(0x08AF8911633C19B3), __ULL(0x129457D78EBC334D),
+  __ULL(0x717040B5EADA2371), __ULL(0x53ED19CCB9AE1227), __ULL(0xBF9D51EA063330B5),
+  __ULL(0x6607C04DD610D503), __ULL(0x943116D7A61F394F), __ULL(0x473941215E0A889D),
+  __ULL(0x7015834BED45FF73), __ULL(0xA961CA982F48D241), __ULL(0x1A17250C38426C79),
+  __ULL(0xC4ABF3403F29A92F), __ULL(0xD856A6D06580A33B), __ULL(0x78343DD9FACEDECD),
+  __ULL(0x04C9A0AABDECB039), __ULL(0xD05E1AC7F8E8F0EF), __ULL(0x763E8BC0E80272F1),
+  __ULL(0x96DA78C781A67435), __ULL(0x2676AC7D9811618B), __ULL(0xC8A49B67AF0C3E19),
+  __ULL(0x769596DC1717C8CF), __ULL(0xF37DE6E31BE4ECFB), __ULL(0xD709E938E97ED1C1),
+  __ULL(0xAA115B4202578D67), __ULL(0x4E86BD7ED680334B), __ULL(0x5C927CB8F3BD436D),
+  __ULL(0x2F7B92D18ED0FB47), __ULL(0x9FBBE88372A20181), __ULL(0x5ED6A87865342737),
+  __ULL(0xC8FA3C632FFB2561), __ULL(0xA00DC6619AB26789), __ULL(0x89079235E80F2C95),
+  __ULL(0xB390A1699592313F), __ULL(0x1BD1CB22251FE1EB), __ULL(0x87B7FD9414D6900D),
+  __ULL(0xEDF03B60891A3B79), __ULL(0x9A914A3C80C594E7), __ULL(0xEDF97A2328F78D53),
+  __ULL(0xDA901E47C9ED8521), __ULL(0x1C5C863D6591F4D7), __ULL(0x1EAEE1FBF6C8B00F),
+  __ULL(0x2A2D5E2E317EC0FF), __ULL(0xA35542621FA114A3), __ULL(0xB175CB3FB5E6A7C5),
+  __ULL(0x5F5F880736A7A687), __ULL(0xAC526DB9BFC241F3), __ULL(0x4DF17BC51C931015),
+  __ULL(0xED138644B50C50C1), __ULL(0x42D25CEA73C618E9), __ULL(0x226E9E46287DDC9F),
+  __ULL(0x7E45D1166235DA6D), __ULL(0x31155704059D6C57), __ULL(0xAE13307A41E2FAC9),
+  __ULL(0x06C1D4BF77E971D5), __ULL(0xDA0EA2C189CFF023), __ULL(0xE3B2EA4E5FEE6171),
+  __ULL(0x09642DEB8D7B7C25), __ULL(0x87B9D8C02323B03F), __ULL(0x039ADF6A087EC505),
+  __ULL(0xCAD69EE7BAEF705B), __ULL(0xA5A294E96FA91075), __ULL(0x689D98A2DA868859),
+  __ULL(0x4492801205E9F0C3), __ULL(0x53D3A59AD048D111), __ULL(0x85CA457B41C71555),
+  __ULL(0x86E7168280F19A13), __ULL(0x9324215ECB1F43E1), __ULL(0xB87D57896491DBAD),
+  __ULL(0xA2D29A8031DE7E83), __ULL(0x3E345FE6937718D1), __ULL(0xCF2C109FA2DBAFBF),
+  __ULL(0x3781E4054A760C6B), __ULL(0xC008F6566AD4D28D), __ULL(0xB91B04BD1D3193F5),
+  __ULL(0x7B117983D43263A1), __ULL(0x9A7767D4E55EDB57), __ULL(0xA5B9BFA599F5C965),
+  __ULL(0x07B7B876E5348537), __ULL(0x25D64688336B8071), __ULL(0x4DE991225C7C730B),
+  __ULL(0x0B12C2767F186399), __ULL(0xD392DDD285C60851), __ULL(0xEED12202C0229D07),
+  __ULL(0xF6C3475163A5BA95), __ULL(0xD6FC58812611BB53), __ULL(0x01C9C4F5B7D37B1F),
+  __ULL(0x2F2EC055C51067C3), __ULL(0x5FC65E6B98BE80C7), __ULL(0xEC2D206DD4B08149),
+  __ULL(0xCE45E6914E579D39), __ULL(0x86284FD2FBCD82A3), __ULL(0xBD01C475F8C6CFF1),
+  __ULL(0x1C78C54A1B42063D), __ULL(0x84527B8A243482E1), __ULL(0x90DD1B60AC45A1FB),
+  __ULL(0xD709C4D5A86EC91D), __ULL(0xBDAA7CE15AD4EFF3), __ULL(0x53C66EEF106A2EBF),
+  __ULL(0x9E17C7CEE8A1F6E9), __ULL(0x181D7B8ADD65086D), __ULL(0x642019ECF407E343),
+  __ULL(0x0F90CB9716B6E847), __ULL(0x73B2D8E39C1F75B3), __ULL(0x6C80C5269126049B),
+  __ULL(0xD7EF4F5A8FC8B103), __ULL(0xE56A5A7B59E36C07), __ULL(0x8E42D73F5B780195),
+  __ULL(0x0AB1518A7CC0AE3F), __ULL(0xEF24E370D2D7DBE3), __ULL(0x4F583C9310EB41D7),
+  __ULL(0x396BE19B148D0D0F), __ULL(0x61B2460608F23F3B), __ULL(0x604C271B6BA2B049),
+  __ULL(0x7CE32518575E3ACD), __ULL(0x6024593C5A918BB7), __ULL(0x26011E9B31D1FA29),
+  __ULL(0xD37204A0BC42B9DF), __ULL(0x77866F0330BB7D8B), __ULL(0xDE75CE173F227A19),
+  __ULL(0x62EFD913F5AA44CF), __ULL(0x70DB02A41B589A6B), __ULL(0xF3E86B3B16A951DB),
+  __ULL(0x12F7171C6AEAAAFD), __ULL(0x0293B83471DF1DD3), __ULL(0x24848310D3DFE1A1),
+  __ULL(0xF40D1006FB9732BB), __ULL(0xD0E4DA34308CC6D5), __ULL(0xF59C60E29B4F9C2B),
+  __ULL(0x91253505A32F664D), __ULL(0xF024CAE676F1D3B9), __ULL(0xBFB033326E4BBE71),
+  __ULL(0xDBFD0E7DE0035D27), __ULL(0xA6874220C19853B5), __ULL(0x4573F46D50561B9D),
+  __ULL(0x782CB0E833A3EC0D), __ULL(0xE8FD149DAE6792E3), __ULL(0xEBDF60896F69655B),
+  __ULL(0x1430C196CCDDA575), __ULL(0xBE24731EB93D12CB), __ULL(0xF4A593E026B86E11),
+  __ULL(0x573BA9871FBBBAB7), __ULL(0x6862E609A2244BEF), __ULL(0x477F65886CD178DF),
+  __ULL(0x2CE363DBF55620AD), __ULL(0x2C606FFBF312FC97), __ULL(0x997FB1E762F96FFB),
+  __ULL(0x1FA8E05AEEAAE287), __ULL(0x4AC436AF16FBBB09), __ULL(0x17A32C7F1DB2F3AF),
+  __ULL(0x8265F5DF4CD95867), __ULL(0x930E13F7A2207CD9), __ULL(0xB121B63D52ECCC23),
+  __ULL(0x1EB7B6B13334B745), __ULL(0xC5E6A2A2D046529B), __ULL(0x120913AD27B8EC2D),
+  __ULL(0xC221C95830D51099), __ULL(0xBC67F44C6A14F34F), __ULL(0x5AAB887C2E9CD29D),
+  __ULL(0xA3DDB105012A8F95), __ULL(0x527610241E468DF7), __ULL(0xFF2141600CBDE32F),
+  __ULL(0x9AA49DDE8EDF4021), __ULL(0x1D743D8F1A421FD7), __ULL(0x85AD0C077AC7CCC3),
+  __ULL(0x5DD67464493291E5), __ULL(0x09F6E767C04C4D11), __ULL(0x4CB8D6CAD11D0E49),
+  __ULL(0x21E129BA7A248A39), __ULL(0xF9979FF16BC527A3), __ULL(0x88BEEC9962B533A7),
+  __ULL(0xE473D37149748B8B), __ULL(0xD0A7D709A3999819), __ULL(0x7F7ACDEB73B5F4F3),
+  __ULL(0xB65711379409ABBF), __ULL(0x109C52521D9E2E8D), __ULL(0xAB8694F9CE5C6563),
+  __ULL(0xD8D44E66606784B1), __ULL(0x76822C67EA929FDB), __ULL(0x5AAEF55CFB02C3E9),
+  __ULL(0x8BD5F329A7C6CD6D), __ULL(0x33EB3FFD31C19A8F), __ULL(0x2697893F20BD2A2B),
+  __ULL(0xC1A14731CFB85A6F), __ULL(0xBC767E0A49869F61), __ULL(0x3BC58DD14BAE032D),
+  __ULL(0x0CEE8A06C9499603), __ULL(0xF59A734B9DBDBF25), __ULL(0x17C57588630AD695),
+  __ULL(0xB60BF500C55D2B3F), __ULL(0xC97055D51CE31579), __ULL(0xCE3408A8640EEEE7),
+  __ULL(0xAEEAC819AD4E1753), __ULL(0x04649E9D13A53D49), __ULL(0x459D2911D10F2633),
+  __ULL(0xE71BC655CD42BFCD), __ULL(0x36D11A6517534BF1), __ULL(0x318A7967D8464D1B),
+  __ULL(0xD13E8768D4EE5183), __ULL(0x1B45AD20E13AF3D1), __ULL(0x32E29D8947074AC1),
+  __ULL(0x7ABD37D01503BCF9), __ULL(0x56290DB075F046DB), __ULL(0x414B640E04FD8FFD),
+  __ULL(0xE3F72DCAC1931EA1), __ULL(0x9140DA5AE5182447), __ULL(0x1F5F4841BCDA1BD5),
+  __ULL(0x5C29D81586C17A7F), __ULL(0x53EA3496B8CB396F), __ULL(0x688E9186D40B160B),
+  __ULL(0xA407FAD54D5F6625), __ULL(0x5F8824DA2FAC314F), __ULL(0xA7F258F14598B773),
+  __ULL(0x6BABCA0E96D9EBF7), __ULL(0x87181110D283EA69), __ULL(0x2089D2B2B7C127CB),
+  __ULL(0x8E1037235561890F), __ULL(0x7A7D4E3484987E5D), __ULL(0x7804759A17780BC7),
+  __ULL(0x9A3BF7D43B23BA01), __ULL(0x13951A862D7314AB), __ULL(0x852D0C7E64C72839),
+  __ULL(0x72143C5605E8741B), __ULL(0x6C6050BF605465AD), __ULL(0xF34C8FDBBC6EC997),
+  __ULL(0x8A092538FEB424FB), __ULL(0x4BA52568DA29C809), __ULL(0x965869CFADC40115),
+  __ULL(0x5B9D571DFCE5B66B), __ULL(0xC4FFA4EC0FFEDC8D), __ULL(0xA97A43F62A52BDF5),
+  __ULL(0x1AA26AE81E4F43C9), __ULL(0x3D0D6870B64AA8B3), __ULL(0x6F3D7E2619F5797F),
+  __ULL(0xF81D295860C9F981), __ULL(0x2A665213DFD97123), __ULL(0xE8A41494B72FEC45),
+  __ULL(0xB7CA2F8E06F06FB5), __ULL(0x375D144EF833BD99), __ULL(0x0F0D244194B04251),
+  __ULL(0x99705DD0B9989AF7), __ULL(0xF8A76135AB60B379), __ULL(0x6CA51F06FD9D002F),
+  __ULL(0x8030CBFF7DE0015B), __ULL(0xEC46FC1E1970C27D), __ULL(0x4697CBF63C5CF51F),
+  __ULL(0x07232A37B77106ED), __ULL(0xDE533713DA4B9B49), __ULL(0x3B7D9D035D826DCD),
+  __ULL(0x6532BB97776FC7EF), __ULL(0x33545474DDBF60A7), __ULL(0x5184E28CB707208B),
+  __ULL(0xBE0CD821D6D34519), __ULL(0x77CD89F799645FCF), __ULL(0x7BEB9BD762D3131D),
+  __ULL(0x0E5D083DE3F27709), __ULL(0x37727FD6B4A28A63), __ULL(0xB431C2D2929E4985),
+  __ULL(0xF233CC1E57F961B1), __ULL(0xD3DC1237767344F5), __ULL(0xAC3744A31DD4F78F),
+  __ULL(0xF4E2D0B3D6F59991), __ULL(0x6C68CCE6954FA9D5), __ULL(0x10D61E668E7E7F2B),
+  __ULL(0xECF1C0F27B0ECE37), __ULL(0xCC317C74CF485EB9), __ULL(0x872C09AA455C1CA9),
+  __ULL(0x6EC4E3831B09482D), __ULL(0xC2435F4167C3A151), __ULL(0x93D3AD51CD67A83F),
+  __ULL(0xF3117D09EF8760EB), __ULL(0x350E2A6D742025E3), __ULL(0x57B1BD833C3D4875),
+  __ULL(0xDEF8E40CDADE3C21), __ULL(0x11E4B8CD36272DE5), __ULL(0xDEAF76DA0807AB33),
+  __ULL(0xAD1A0A4E143FB801), __ULL(0xB5F1DDD18BA0A5B7), __ULL(0x2E4726E8472E03A3),
+  __ULL(0x115450DC707EC21B), __ULL(0xA822109DC9369429), __ULL(0xAACCFBA8DBFCBA35),
+  __ULL(0xD7B44FF440E210D1), __ULL(0x9BD4DD6F10208F15), __ULL(0x343017AFC0E8E177),
+  __ULL(0xBAFFAE98FD2A74FD), __ULL(0x77539C343F6A7FE9), __ULL(0x2048F91A7E83A7D3),
+  __ULL(0x74767A9808BA2443), __ULL(0x8D46919C73270165), __ULL(0x2B5AB23F1D0BA1C9),
+  __ULL(0x4B5045DF3D97B727), __ULL(0x622599B8A0C25D93), __ULL(0x9832C757950B9B61),
+  __ULL(0x5A7E972D562D3D89), __ULL(0x4670557E5BC8E405), __ULL(0x590BE4D6645634ED),
+  __ULL(0x88CBB13046DBE60F), __ULL(0x12ED4AD821A8F8C7), __ULL(0x01CB52D2839F69AB),
+  __ULL(0x7681B0CB7992ADC5), __ULL(0x9903B51626010329), __ULL(0x475FEFCEC43FF2DF),
+  __ULL(0xD4A24FBBFDFA2D83), __ULL(0x8E7F98D9FD13BC87), __ULL(0x9303665D4FD5D615),
+  __ULL(0x96286D13A3CAE18D), __ULL(0x0E08359088CD6BFD), __ULL(0x505E676CB9B3804B),
+  __ULL(0x94BD58DB5EC4D6D9), __ULL(0xA3593F1FFDD22865), __ULL(0x042E04A801DA03BB),
+  __ULL(0x57368F250E86C627), __ULL(0x0BD9B85AAD586903), __ULL(0x4EC5751946971C9D),
+  __ULL(0x9B656AA52D17F65B), __ULL(0x7A89AC18DAA6B21F), __ULL(0x558F15E31D69BA21),
+  __ULL(0x246E28314267CBED), __ULL(0x61F0A7C9FB96B9D7), __ULL(0x33623DBF39FA30AB),
+  __ULL(0x784506C3D16364EF), __ULL(0x0499DF5FD012C835), __ULL(0xF5D7D4BA852FB58B),
+  __ULL(0x1176028187788409), __ULL(0xE3F608C0F5A4C5C1), __ULL(0x537E41A036B8388D),
+  __ULL(0x760D6CC1DDCE4167), __ULL(0xBACC97189870D9F5), __ULL(0x5A15F5020E531243),
+  __ULL(0xA8F077A49A62FED5), __ULL(0x00C74AA3F00DF581), __ULL(0x58BEF6A5D17E5B37),
+  __ULL(0x855C218A8D544BB9), __ULL(0x2D8C4E46256B946F), __ULL(0x8ADD5D393C49BE51),
+  __ULL(0xDE8F781A00AB35EB), __ULL(0x6982C9DFA91EA40D), __ULL(0xA461A8A188FC9E7D),
+  __ULL(0xAE1BDDF608BCA153), __ULL(0xEF5EC616E03FA2E5), __ULL(0xEE3293FF69AE240F),
+  __ULL(0xBFB414BD360532B7), __ULL(0xA0E86672AE53A8A3), __ULL(0xCCC8064A00D37BC5),
+  __ULL(0x82D134D07CAD371B), __ULL(0xC09BE88495FF70DF), __ULL(0x6066A0FF14EED8AD),
+  __ULL(0x921B6C60727B2DD1), __ULL(0xC351DE511C5A55F3), __ULL(0x0A37B9BD0F6D196B),
+  __ULL(0xE1EA15550CCA96F9), __ULL(0x33EEBF2401A54CE9), __ULL(0x998695DA0A28EE6D),
+  __ULL(0x7810A6F210D67665), __ULL(0x1BC6471B200DFE47), __ULL(0x076A511E3B07F54D),
+  __ULL(0x5B48BE9A436B5025), __ULL(0x42C3A48861C15B7B), __ULL(0x710A8041F03A8A9D),
+  __ULL(0xC6E71BED90F2C173), __ULL(0x119265A10659A43F), __ULL(0x9C69B581F23301E3),
+  __ULL(0x38ADED767CCD8469), __ULL(0x46270B3E70F76475), __ULL(0x2125F8E8B5E3301F),
+  __ULL(0xC56D048BD70B51CB), __ULL(0x217E6CEA0FC8F9ED), __ULL(0x9518E9391B633C59),
+  __ULL(0x87467D11F2B34511), __ULL(0x8A4644F3F477E5C7), __ULL(0x70F10A4D568FB401),
+  __ULL(0xF18ECDCB5C6D61B7), __ULL(0x486CDFE72CAAE2C5), __ULL(0x6D4C1CC46D7122EF),
+  __ULL(0x460AF63BF62B233D), __ULL(0x05A30CCFA8C0AE13), __ULL(0x056CCD63732237E1),
+  __ULL(0x4D559410C02FE3A5), __ULL(0xA97D6BD5F3CB8EFB), __ULL(0x27D8AD8AA2FA1D63),
+  __ULL(0x871B6B70427250FD), __ULL(0x731A8D64E0BB5F67), __ULL(0x90919705FBBB57A1),
+  __ULL(0xBAC2E3A9C5B40F57), __ULL(0x629D4E99E7F538BB), __ULL(0xD765B24C8CDC5DC9),
+  __ULL(0xCFBC70E50803737F), __ULL(0x6CCA601E84045645), __ULL(0x81CF0724B5A0B19B),
+  __ULL(0xA9216888816747A9), __ULL(0x4FEF200B3FF88005), __ULL(0x5572314C5DE9F721),
+  __ULL(0x2458448DF23E06D7), __ULL(0xB1AAEC1A0BB92411), __ULL(0x2DA0A36EB599AC3B),
+  __ULL(0x979831267C833055), __ULL(0x75D3C707063177CD), __ULL(0xBB24AFB5DFE501EF),
+  __ULL(0xFB15ABEEEEB64513), __ULL(0x243A1E6849845297), __ULL(0xFE28E042C52C9F19),
+  __ULL(0xCCA7A6F72D4819CF), __ULL(0x80474BCA79E475FB), __ULL(0xCF43BCD8461B42C1),
+  __ULL(0x48675E1168B31BB1), __ULL(0x2F26978CAD312AE9), __ULL(0x5550EC4BB7481C6D),
+  __ULL(0x6D1BE9D5A88D7743), __ULL(0x74472BACDB15F281), __ULL(0xC34FF999D903292B),
+  __ULL(0x1D876F100DD2BD45), __ULL(0x4A768EF20A6395BD), __ULL(0x5228BE9AE9695093),
+  __ULL(0x6D7C042B9BC1DB51), __ULL(0xAD76BA20C473297B), __ULL(0xA3E67142BC2F5C79),
+  __ULL(0xC95A6372FCBF992F), __ULL(0xD347AC3CFF3DF5E7), __ULL(0x5AE27AD4EB98B621),
+  __ULL(0xBBDEFE86346217E5), __ULL(0x80362C3F0C38E449), __ULL(0x712812FAA70AB533),
+  __ULL(0x551EA56B8CCC4ECD), __ULL(0x83E0461D7F1F4DA3), __ULL(0xB2275D6B048BC9A7),
+  __ULL(0x7684AE16F8A32E29), __ULL(0xFECBEF414D76E435), __ULL(0x120332BFEB880083),
+  __ULL(0xCF58DA9969CF141D), __ULL(0x76056538A046C787), __ULL(0x1B60BE302FA63915),
+  __ULL(0x3744BDA8EF2808AF), __ULL(0x1B11258C8E8925DB), __ULL(0x0875B24AF37B8D9F),
+  __ULL(0x0A92DB9C5C30ED57), __ULL(0x771C8EC69DF0BBC9), __ULL(0x8C5C27C949997A4D),
+  __ULL(0x38431F5BCF432923), __ULL(0x76B3BEFC24B53271), __ULL(0x916D7A5B30FB0CBD),
+  __ULL(0xA20CBF48CE7FE793), __ULL(0xBBBE1EF49E0F1561), __ULL(0x028DF602B841C84F),
+  __ULL(0x897C488780D5107B), __ULL(0xD912216A413AAF9D), __ULL(0xC319F78B142D4141),
+  __ULL(0xC48898FE4FEC4E05), __ULL(0x9055DED595C0CA31), __ULL(0x2DB3431C593E84E7),
+  __ULL(0xE70C2DAC14EF6959), __ULL(0x25536002D60D8C33), __ULL(0x4082629FC479EEB7),
+  __ULL(0x4A58BECD193DEF39), __ULL(0xC0B94A3986199D29), __ULL(0x238E21E32AAB34AD),
+  __ULL(0xF10EFDF0F85BD8A5), __ULL(0xDDFDF4AB0FE320BF), __ULL(0x567C3C301461D2F9),
+  __ULL(0x9095584A115BAA4B), __ULL(0x89468A1B54445C57), __ULL(0x4DFC18D405971265),
+  __ULL(0x11FC0C556E08C8DD), __ULL(0x33C2DA57CB8F37B3), __ULL(0xE91BA8B56CCFF081),
+  __ULL(0xC05149C7D673514D), __ULL(0x4F2E290470504637), __ULL(0x055AA0F283B05171),
+  __ULL(0x1DA82273FD8A002D), __ULL(0x49A01145FC1BC499), __ULL(0x219BA0C5FBA8674F),
+  __ULL(0x7789E103B9CCBE07), __ULL(0xE31D7CA1E53C1D73), __ULL(0x8353A33A608E572F),
+  __ULL(0xF1AF6BEB02914069), __ULL(0x73E2658225CB1453), __ULL(0xAF7694725DE38555),
+  __ULL(0xAD8EF82FE6FFAFFF), __ULL(0x9740BA5F6938DAAB), __ULL(0x108738C33E1B0A13),
+  __ULL(0x95E9A81976C4F235), __ULL(0xC57135FABC4C4C19), __ULL(0xC7B54B17D9CC821D),
+  __ULL(0x9B45B917D6D39FBF), __ULL(0x86BEFB4745BA428D), __ULL(0xEB28E54E177E5977),
+  __ULL(0x6AE11CD8790273DB), __ULL(0xE1E0F24367317091), __ULL(0x56DB9958B2768947),
+  __ULL(0x8D3BEDDDB1C67E2B), __ULL(0x304A772B6D014D9B), __ULL(0xF36C328EB78CCB5F),
+  __ULL(0x173E065FF8759361), __ULL(0xD6BE5FB83DBF8D07), __ULL(0xC7156706BF0CC979),
+  __ULL(0x2DC6207CB3FA687D), __ULL(0x8BD014C510D374CB), __ULL(0xEBE852F0B08E8CE5),
+  __ULL(0x7C4FD18ACAF4DE0F), __ULL(0xE51476338B153A33), __ULL(0x6F77F27944884CB7),
+  __ULL(0x3B7FD2327790F2A3), __ULL(0xE588FCFA2A05E5C5), __ULL(0xFAB86AAD8FB8BFF1),
+  __ULL(0x4DB435205279F6A7), __ULL(0x1702B2FB5A80668B), __ULL(0x6F3BCE8EAF0562AD),
+  __ULL(0x17D71DE9449A391D), __ULL(0xED237EE940300877), __ULL(0xC4427B648C1970F9),
+  __ULL(0x53FFC121F9B04F91), __ULL(0xFFF36E6E000648C9), __ULL(0xD42DAC6DBE7B74B9),
+  __ULL(0xB81061801DD1AD6F), __ULL(0xC0734EF7D9773E27), __ULL(0xD0CC6FF85B0BD261),
+  __ULL(0xB282A6E902056A0B), __ULL(0x0CF1F3E01BD34617), __ULL(0x9A1827A573286489),
+  __ULL(0x09810EDC96BEBE41), __ULL(0x5D64F3330B234BE3), __ULL(0x3D0EC68C2DB52E5B),
+  __ULL(0x773F99985968AA1F), __ULL(0x7F91047516AD7BCB), __ULL(0x652CCAB10B43125D),
+  __ULL(0xDD9B71D76BEFBFC7), __ULL(0xF983D56ED17EDC39), __ULL(0x09D204691FD6481B),
+  __ULL(0x484E435F22F3ED3D), __ULL(0x17D027900928EA29), __ULL(0xBD44CD3F8A4C3813),
+  __ULL(0x7BF05D535A3EA9DF), __ULL(0x9CF6E83A22C9FD97), __ULL(0x08BD8A981FCD0A6B),
+  __ULL(0xB4A98A504C0AF08D), __ULL(0xF5D43AC401CC6763), __ULL(0x13A730DC0E6BD1A1),
+  __ULL(0xABCD9431A5088765), __ULL(0x2125CE1A454DA2BB), __ULL(0xB6E04DF5BEF5ED81),
+  __ULL(0x9FF71638F1559B9B), __ULL(0xB775F7EFA1444D27), __ULL(0x48F76AF7E0B8C3B5),
+  __ULL(0xE8A8B8FC2A0F452D), __ULL(0xB5E575C8D0BD1803), __ULL(0x7651C61F45DCB651),
+  __ULL(0xD98691CC7BBA2273), __ULL(0x90EC0D190C3D6DEB), __ULL(0xEA8863D5864CCEF7),
+  __ULL(0x0A31EFBDB53A6779), __ULL(0x73B2086C9F755953), __ULL(0x08CE6E553DA81AED),
+  __ULL(0xD6C437D06F56C5C3), __ULL(0xC7B54C355A16ACFF), __ULL(0x06642A831F98643D),
+  __ULL(0x8DC221F422FD0735), __ULL(0x53C400A01F2D748B), __ULL(0xB18A8D53A2BE3CC1),
+  __ULL(0x61B80452C472478D), __ULL(0x05C38D27A37D6677), __ULL(0x9DE6860E93371E63),
+  __ULL(0x6A4200126CE598F5), __ULL(0xA10E8BF349C3C64B), __ULL(0xCD4BB894045BEC81),
+  __ULL(0x0AD9497054DFD32B), __ULL(0x79191B0566410237), __ULL(0xD5C73397B0A16B6F),
+  __ULL(0xAC430C436E465FBD), __ULL(0xF020586C6C9150A9), __ULL(0x9A56CBD91C3C085F),
+  __ULL(0xCB59F67659480F03), __ULL(0xF9A23CF075E9C289), __ULL(0x1F8AD896422F7053),
+  __ULL(0x0741FCBC0EEBB459), __ULL(0xEEF05B4F6E8D3B0F), __ULL(0x289891843C157D3B),
+  __ULL(0x8CC331F134EB805D), __ULL(0x8378966A7A25BF33), __ULL(0x26F445F4A46FABFF),
+  __ULL(0x1D59EF08B88E1AC5), __ULL(0x84AB3EDDF18F1CF1), __ULL(0x05572C4844FC961B),
+  __ULL(0x7046343FB017C829), __ULL(0xE0172E53883F5E1D), __ULL(0x7C593F77F78BA187),
+  __ULL(0x9E847849FCCB64F3), __ULL(0x765E4F6720F5BBC1), __ULL(0xDC7A4C92C993DDF9),
+  __ULL(0x69A6D818313D0FDB), __ULL(0xF71536B962E208FD), __ULL(0x35CF5583DBA3079F),
+  __ULL(0xFDD7D2F70D614FA1), __ULL(0x7BF4641EF0F7B843), __ULL(0xE26C79565C20D565),
+  __ULL(0x0581BC246D78EC91), __ULL(0x9DD7DCB5FAF64A6F), __ULL(0x742539A5A215EC71),
+  __ULL(0x67451438AE70D1B5), __ULL(0x5F00DCBDCB4B8F99), __ULL(0x416567E8AB9E7A7B),
+  __ULL(0x8D139E2E8CBC0A0D), __ULL(0x5E584EF26DF48431), __ULL(0x7E67493A8C30671F),
+  __ULL(0xA0A3F01FD86DC359), __ULL(0x618A8BA4015DB3C3), __ULL(0xC6B7AD0C4C98ACC7),
+  __ULL(0xB2094B9F47E16855), __ULL(0x40490305C64D08B7), __ULL(0x77AB705235AF81C5),
+  __ULL(0xD1C666A0277AFD13), __ULL(0x9892D7BB229BCA97), __ULL(0x7C369F18ED5DC183),
+  __ULL(0xC5759008D2EE0909), __ULL(0xD3AD5C6F5BC12A15), __ULL(0x7B2723E7AA31A1AF),
+  __ULL(0xC009C07EC67013B1), __ULL(0x269170578A2FD2D3), __ULL(0x870E5EB2D55BD44B),
+  __ULL(0xB95BA007DE5EF657), __ULL(0xCB56D6E15E36A98F), __ULL(0xFBA5D1B15ADF04C9),
+  __ULL(0xC48D351F53805B4D), __ULL(0xF9B3D89A513F7A27), __ULL(0xEAB4E0A7BB8B1E99),
+  __ULL(0x1A9274ACAA84D351), __ULL(0xFA7B50DC73AF9807), __ULL(0x2A6B80491CE5D479),
+  __ULL(0x67A90E272992DA69), __ULL(0x37A503515627EDD7), __ULL(0xC2A50CA6840B4FE5),
+  __ULL(0x2AF79C7FD7CA4B3B), __ULL(0x9F70B9837EA22F55), __ULL(0x75C44920523105A3),
+  __ULL(0xE827E13AF2BDD8EF), __ULL(0x6C4DBD639D41C93D), __ULL(0x7F109F4684F441A7),
+  __ULL(0xE45B9F2D5BAE098B), __ULL(0x5331C9FFBEA6B0CF), __ULL(0x8A6C6C5A88D294FB),
+  __ULL(0x64DDE400B224B809), __ULL(0x12A4F2546ECC99BF), __ULL(0xA54C1FD8523B4363),
+  __ULL(0x90FB36E3B128D285), __ULL(0x3849162C7C8B2DF5), __ULL(0x2829F55F16F5859F),
+  __ULL(0x4F02E78C8FA0A643), __ULL(0x599927E070E8AA91), __ULL(0x07A53A01751649DD),
+  __ULL(0x27BA8D81C04F282B), __ULL(0x05FF603FF957FFB9), __ULL(0x407592959F865C45),
+  __ULL(0xF8BBB603F37A086F), __ULL(0x1DEDC7897C4C9F93), __ULL(0xBAB21CAE7D457D25),
+  __ULL(0xD7F0384AA7D63251), __ULL(0x567A309F6360327D), __ULL(0x25FF260218245CD7),
+  __ULL(0x3FF4F585CA6DB23B), __ULL(0x04E592D29B6EA8FF), __ULL(0x831BEB14D690A901),
+  __ULL(0x724BD2726F1FDDCD), __ULL(0x27BC113C680366B7), __ULL(0x85591229D7663CA3),
+  __ULL(0x6987D9810D030B1B), __ULL(0xE7C7E4E948D464DF), __ULL(0xB1083A7B994F908B),
+  __ULL(0x964D6E6B09C02277), __ULL(0x27F71C76FDACB985), __ULL(0xD918D33CA63BC49F),
+  __ULL(0xA8FFE5A1D0008CA1), __ULL(0x41FFB3DDE9F84A65), __ULL(0xE4CA004C1961B247),
+  __ULL(0x88FD61EBF39C19D5), __ULL(0xAA261669F22D4EB9), __ULL(0xFD086EEC1BFB4C61),
+  __ULL(0xEB140B1699403C99), __ULL(0x9A5F8C4FB2155F4F), __ULL(0xC4A4AF43EB571E9D),
+  __ULL(0x1ADDA60F55EB0F0D), __ULL(0x1D0C9B18A7596131), __ULL(0xB56866D77FA7185B),
+  __ULL(0x945926FD6AD80DED), __ULL(0xA0BC245879D1B70F), __ULL(0x627F8D1B308712AB),
+  __ULL(0xF5D8C5CB81EFB6C5), __ULL(0xD5CFEB1AD59B96EF), __ULL(0x37A42D2F6624B73D),
+  __ULL(0xD157964620EB9797), __ULL(0x2F2BDC05F175A683), __ULL(0x7FC762C4C41BB7A5),
+  __ULL(0xFC3238383E09E4FD), __ULL(0x54430C1F1A0517D3), __ULL(0x5C72A9BB2BA63BF5),
+  __ULL(0xFDEE332391097165), __ULL(0xE9EA66E12404068F), __ULL(0x3B016F94017E0CBB),
+  __ULL(0xEAD1F79D2D09C6B3), __ULL(0xBF1F399AF9252A45), __ULL(0x40EDADFB4818A727),
+  __ULL(0x88AB93A5CA011B0B), __ULL(0x4F0DFF4CFAB5CB99), __ULL(0x877017A38528E203),
+  __ULL(0xB839729171EFD59D), __ULL(0xA02AE9A744646295), __ULL(0x7A14421D8AD83741),
+  __ULL(0x1803DFF6FD1AE8F7), __ULL(0x3ED4FB820B19BF5B), __ULL(0xD47ACB25BED2207D),
+  __ULL(0x9B0E58BC3A49631F), __ULL(0x1417856705DB9811), __ULL(0x0899202DAD4CE949),
+  __ULL(0xCD755D5D180EA6FF), __ULL(0x7A7D4F311B1BD9AB), __ULL(0x99C9DFF705326EA7),
+  __ULL(0x35D2E84959ED5913), __ULL(0xAE32775AEF8A6AE1), __ULL(0xED6A73F0E650518D),
+  __ULL(0xAA2018BA43656863), __ULL(0xE4D558AD86A28785), __ULL(0xC3AB27CAB865A267),
+  __ULL(0x71CB3FC0429AC2F5), __ULL(0x422D515E6168EEDD), __ULL(0x66A030FE72539DB3),
+  __ULL(0x56ED3F62074DECB9), __ULL(0xA79DB1A09E37EAA9), __ULL(0xB9ED5DB1C824825F),
+  __ULL(0x79429E07DF164F51), __ULL(0xFD615069C695FD7B), __ULL(0x1EC744B324A6A995),
+  __ULL(0xD40B2DA8E9469F31), __ULL(0xDEE15140B159FA53), __ULL(0x2697D034DDD5B3CB),
+  __ULL(0xE4A95E7BB3860E59), __ULL(0x65294472014FEBE5), __ULL(0x4998DA586D7BE73B),
+  __ULL(0x63ECEC9A12D4CA5D), __ULL(0x683733D0385BA5FF), __ULL(0xAC8975F077A3A601),
+  __ULL(0x383EFC973F7C84C5), __ULL(0x8F349832E551D6F1), __ULL(0x5592E984BEFF801B),
+  __ULL(0x35C1E80BCF787DA7), __ULL(0x66A3C1E7E07CA1DF), __ULL(0x1D9D2D051747E219),
+  __ULL(0x02CB573BB0792CCF), __ULL(0x8740EF08475F6EF3), __ULL(0x2EC9BF7B77146E85),
+  __ULL(0x214A6DA2370145D3), __ULL(0xC8F509B379B62157), __ULL(0x7F3001F20CC19F47),
+  __ULL(0x01A2AB856E61657F), __ULL(0x59323B74EFA38E4D), __ULL(0x8EAA904A02A0A0BD),
+  __ULL(0xA7F76FA67A08FBB5), __ULL(0x669DC3A4DBEE0961), __ULL(0x2484F86B9828290B),
+  __ULL(0xC4AB250744D6E999), __ULL(0x1A6B3D9F407CDA73), __ULL(0x6DB20673B7D10D5B),
+  __ULL(0x2A4A701BA2ECD2ED), __ULL(0x7A497B711520140F), __ULL(0xACF89FF24863A033),
+  __ULL(0xDD01A8D88E2C1255), __ULL(0xBF1FA8717D58A501), __ULL(0x267DDFFFA60933EF),
+  __ULL(0x0CF131144662D129), __ULL(0x7AB1A1BAD6DB60DF), __ULL(0x91922CA783A048AD),
+  __ULL(0x6059814F8E738B83), __ULL(0x8ECA7B1594B2D415), __ULL(0xE92E6FD8E9E786F9),
+  __ULL(0xC7D713A97724D663), __ULL(0x32F357786C719057), __ULL(0x8D00FEAD5D001EC9),
+  __ULL(0x00EDBE3FC8C27A37), __ULL(0x2931CC5023CFD427), __ULL(0xC26B7D5A8AD4B00B),
+  __ULL(0x462064297CAB0D51), __ULL(0x280CD001EAE2AE79), __ULL(0x8F45BF3531E8057D),
+  __ULL(0xAC4E4985A6DAF4C3), __ULL(0x073079FDA1013511), __ULL(0xF311A6AB0778B53B),
+  __ULL(0x0677DCF3BA08D955), __ULL(0x5BF2A7AE89FE10CD), __ULL(0x9D3E87CBC253F239),
+  __ULL(0xCD9C4923C6DA4FA3), __ULL(0xF113210E16BF12EF), __ULL(0xA6969E6F73214635),
+  __ULL(0xB8CF07E8FF1F0019), __ULL(0xA288CAD00A966ACF), __ULL(0x2984CF6BA029FEFB),
+  __ULL(0x97303DEFE306D209), __ULL(0xCD0E45AE65EE8D77), __ULL(0x2D44D5CC24B58D63),
+  __ULL(0x9004AE2B71E63C85), __ULL(0xF5D6DBDFCE6E6CB1), __ULL(0xD69623E562E4828F),
+  __ULL(0x634CD8B4C11593DD), __ULL(0x0CAF974FC2923D47), __ULL(0x4FBAA1095FC8FCD5),
+  __ULL(0x25D39FB9CB31A937), __ULL(0x3C4A64B265A5D9B9), __ULL(0x122CEBAD3D2F8B17),
+  __ULL(0x24B4982085897E95), __ULL(0x361D9088CDB9133F), __ULL(0x564BDF2F4B1033EB),
+  __ULL(0x6051BCB9EF567D79), __ULL(0x04AA4588FDA97C31), __ULL(0x18AA87BD37E456E7),
+  __ULL(0x179AC6A2D76F5B75), __ULL(0x40ACDE8009A460E5), __ULL(0xE83804375F01A549),
+  __ULL(0x6B188590378EE7CD), __ULL(0x785D1E46BDD386A3), __ULL(0x739B4E60D8F1F51B),
+  __ULL(0xF352F67E38DEAAA7), __ULL(0x3FCB10FB6F55AF29), __ULL(0x52F552B364EBDBD1),
+  __ULL(0x4D2AF9D53FD36215), __ULL(0xCB61561EA5C332C1), __ULL(0x362EB88BE2483C77),
+  __ULL(0xC0FBB94F514499AF), __ULL(0x5864E31A693CB7FD), __ULL(0x4F49D08C06208AD3),
+  __ULL(0x547DB40AEBE18C6D), __ULL(0x531FCF01F5926E57), __ULL(0x61CF6D3B28C53465),
+  __ULL(0xD6AC22CA79F07CC9), __ULL(0x4E9AD660F68B05BD), __ULL(0x8BFA25C8C95FBE0B),
+  __ULL(0xCBB7191F6C0F9699), __ULL(0x7F80EC63CA7F0E25), __ULL(0xEE9BB6F9DD689889),
+  __ULL(0x744306CB5CB8B241), __ULL(0x03A2E2C56CD253F7), __ULL(0x277A6370F771025B),
+  __ULL(0xB95BBDCD56D6E5E7), __ULL(0x6B7443CCFD58E275), __ULL(0x82564F325FADE2C3),
+  __ULL(0xEBD961539DAEF311), __ULL(0x410785AFD7506755), __ULL(0xE28A5D2F875AAFB7),
+  __ULL(0x3C0D7B697C4E20C5), __ULL(0xE643D70DB9241C1B), __ULL(0x0A9DA1B398AB4C13),
+  __ULL(0x4858FBFEAEC2A5E1), __ULL(0x34FD144691053197), __ULL(0xBBAF972A82577083),
+  __ULL(0x5C5BF4A8D54DA1A5), __ULL(0x4673C9172D1C3AD1), __ULL(0xC671E112C0E23009),
+  __ULL(0x6C569A4D5FB7048D), __ULL(0xF97774EEB8FDF3F9), __ULL(0x7CFBFB8C4A696D67),
+  __ULL(0xB292675B86B311D9), __ULL(0x1EA155DB0C8676BB), __ULL(0x90E174FEB81001DD),
+  __ULL(0x3D4CAC0726E6EA4D), __ULL(0x445426F766969923), __ULL(0xAAA6284EE20F3D5F),
+  __ULL(0x3A966FC3FC68592D), __ULL(0xB712A9830EBBB84F), __ULL(0xD127748CC264DF07),
+  __ULL(0x2EA5EC62EEEE3673), __ULL(0xBDF50E5ED3644169), __ULL(0x4907B2187CBB2E55),
+  __ULL(0x22BC09222A92DF39), __ULL(0x0ABAB62ADAB071F1), __ULL(0xC04296843AE52097),
+  __ULL(0x7F8DB69DF6A6B3FB), __ULL(0xC173BCBC6E743B1D), __ULL(0xECF64406422D21F3),
+  __ULL(0x7A4BAC7F14E59A77), __ULL(0xD31BA3522E00FC67), __ULL(0x2FBBB6B8E9F7ECF5),
+  __ULL(0xA551072E693C1A4B), __ULL(0x938630A93BE8BA6D), __ULL(0x8E7E03D578A42A47),
+  __ULL(0xD9CDBFB6F01CA7B3), __ULL(0x8940FB17DD43F3BD), __ULL(0xB59D865823E684A9),
+  __ULL(0x28881C0666554461), __ULL(0xAF146DB800EB677B), __ULL(0x403CD51F68965395),
+  __ULL(0x3DADE836B6F5C70D), __ULL(0x1AE062879FE4472F), __ULL(0x3936F5F37FBBE17D),
+  __ULL(0x80918149B8EFDDCB), __ULL(0x50AFADBFE9FA43D7), __ULL(0x84618FBF7CA3D333),
+  __ULL(0x73B8D7448BDC90F1), __ULL(0x08724102F6EB4F8B), __ULL(0x4F4E81909138E6CF),
+  __ULL(0xDC5F1431C37D5587), __ULL(0x63B9C760F42CE3DB), __ULL(0xBAC1DAD4C819FB9F),
+  __ULL(0x0824C3FC790B516D), __ULL(0x4A3FE8C48F954C43), __ULL(0x916F1D8F41B944BB),
+  __ULL(0xD50E20DBEAD009C9), __ULL(0x1F4F4A269A84984D), __ULL(0x8989BC14694925B5),
+  __ULL(0x946F2CFC44100325), __ULL(0x8F23D784312AE473), __ULL(0xF9BC765F28030F3F),
+  __ULL(0x61331ADE9F468C05), __ULL(0x0D5F1BAEC24E1F69), __ULL(0x17C0D2C11A1B5B1F),
+  __ULL(0xE976B293E9027759), __ULL(0xEE849D8DE8814B5D), __ULL(0xD85D68D153817D39),
+  __ULL(0xE1F4CF96008E6DEF), __ULL(0x2B70E49BCC5E911B), __ULL(0x9A395C3D6AF21113),
+  __ULL(0x73EF2A1E9AB596A5), __ULL(0x7017DCDD39623D09), __ULL(0x1335C3F45D732063),
+  __ULL(0xFD17A94958CC93FD), __ULL(0x3A8EC732F1FA1A67), __ULL(0x2D0FC999F628E6D3),
+  __ULL(0x9D026EB377401D8F), __ULL(0xC65D02BD3E2938C9), __ULL(0x845505B6126F9437),
+  __ULL(0x7E48661BDD593E23), __ULL(0xD79624D6218E7F71), __ULL(0x0068F21CF66AE49B),
+  __ULL(0x89EE9AD5E2842CB5), __ULL(0xDDF83DFB3090449D), __ULL(0x68E96DA5A6E10FF7),
+  __ULL(0x081196EED4678879), __ULL(0xD00E3BA6E14B7305), __ULL(0xDB6C97E6E863A221),
+  __ULL(0x767A9FD48BA26F11), __ULL(0xAAE26593527B9DFF), __ULL(0x24C08B0D5A33CC39),
+  __ULL(0xE8C6C1ADF920F5A7), __ULL(0x6F4A2B5BA8CB7035), __ULL(0xE84E824C4993A1E1),
+  __ULL(0xB775AF350CD8ED97), __ULL(0x5C7223C5E44A26F3), __ULL(0x424ECBBCC950ADC1),
+  __ULL(0x2E451446AFC7D763), __ULL(0x115A25D111E426B1), __ULL(0x46DB7F91587E31DB),
+  __ULL(0x8C99A9BC1D3C799F), __ULL(0x40A876F31F8E7F6D), __ULL(0x9369F79319687C2B),
+  __ULL(0x4172D05C0DD73045), __ULL(0x3B73F977A58458BD), __ULL(0x9BFC3A36374FB393),
+  __ULL(0xDE3C01E8025A395F), __ULL(0x33D52397AA70B52D), __ULL(0x9C1E09AB03BD5125),
+  __ULL(0x9031B3530F63C67D), __ULL(0xCF273ECC6E85B0E7), __ULL(0xF08343289D66C953),
+  __ULL(0xCF8A04D5BFEE8575), __ULL(0x804496662C6C9559), __ULL(0xB2DD12EC44D25833),
+  __ULL(0xF81C5D609EB69CFF), __ULL(0x1F4968E603E5F1CD), __ULL(0x493472A5F48D23C5),
+  __ULL(0x472330B69F4504A7), __ULL(0x5FB8006750ED7735), __ULL(0xEE680780514DC3CF),
+  __ULL(0x38B3FB9B73262CC1), __ULL(0x2D29D6C1686BC16B), __ULL(0x3EA73755237ED3AF),
+  __ULL(0x8FF1FDED4D6AB89F), __ULL(0xD6619A73FE450857), __ULL(0xCFE760ED33BA1E65),
+  __ULL(0x1F9B4701B311FD91), __ULL(0x760FD31EAC956647), __ULL(0x0D4EDFA4F9656DD5),
+  __ULL(0x0AE7AAD9D6735C7F), __ULL(0x811407BE4847037B), __ULL(0x44472CD72121AC41),
+  __ULL(0x9F139D7E336B230D), __ULL(0x709C8EFA5243EC69), __ULL(0xC541D962A37CA459),
+  __ULL(0x3EE43F4ABB36ACC3), __ULL(0xF0CA36DB3EDF2B0F), __ULL(0x71942C7587CEF05D),
+  __ULL(0x0A11D1BDE70F9C01), __ULL(0xE9129B9A0D4C66AB), __ULL(0x2F12CDAAEE0E6A39),
+  __ULL(0xAE682CAEEFBE4B3D), __ULL(0xBE346EB282881FE1), __ULL(0xC053B6646316CB97),
+  __ULL(0x9CA30BCF66D13A83), __ULL(0x86BD702E23244A09), __ULL(0xF53F86143F3C086B),
+  __ULL(0x8358701494D0CDF9), __ULL(0xEB183201749C32AF), __ULL(0xF2B2C5436CD08FF5),
+  __ULL(0xB7BB13CA55FE7757), __ULL(0x72C6834295EF4BDD), __ULL(0x271DE50A41B7F44D),
+  __ULL(0x084B5852D2E5FE45), __ULL(0x46B950DD9B84599B), __ULL(0x7634B156ABF3B75F),
+  __ULL(0x1A06386BB6D36F0B), __ULL(0xC0F6095B84C87603), __ULL(0x4C06DE43AB7A2B41),
+  __ULL(0x6400ACBCBB9F1CF7), __ULL(0x1DA09BE55E7CF579), __ULL(0x008E24DD58B0F753),
+  __ULL(0x879D030A971E0C11), __ULL(0xF96C6771236D9CC7), __ULL(0x1540D6DEBBCB1D49),
+  __ULL(0xDDD107A674353EA3), __ULL(0xA38E4AE6B8372BF1), __ULL(0xCBE0DF14E4E55EE1),
+  __ULL(0x59A397FDB50701CF), __ULL(0x7E76BA75D1C8F909), __ULL(0xC219EFD254400ABF),
+  __ULL(0x9F454B46D589FC63), __ULL(0x3F37B9A2A26D5B85), __ULL(0x65817EC5720526DB),
+  __ULL(0xB95B4464C5145667), __ULL(0xFA866AC19B01369F), __ULL(0xD6E1F68445FDBB91),
+  __ULL(0xC361D57E1CF2FBD5), __ULL(0x72F289EBD0246545), __ULL(0x30BB015E6107196F),
+  __ULL(0x8AEED2089AC3809B), __ULL(0x9F25CB5B84ECBE61), __ULL(0x70DAA4F2880FFA2D),
+  __ULL(0x418FB3ADD1344625), __ULL(0x7AC666F75BDE1089), __ULL(0xCDA6A427BCA1D10D),
+  __ULL(0xD5BF47F3D46207CB), __ULL(0xE8393477A0D0BB3B), __ULL(0x211D3B288C06DD33),
+  __ULL(0x95EFE6BE7F5B99FF), __ULL(0x3F5738DED0A39A01), __ULL(0xFAFDD57B637427B7),
+  __ULL(0x8494081BCFEF8C35), __ULL(0xF03386E5628A9619), __ULL(0x7468B49A2E6732D1),
+  __ULL(0xAA201A9B46CF82F3), __ULL(0x0DBB03CDE3B2A9C1), __ULL(0x54D1823E70256377),
+  __ULL(0xF41D0D34C6974285), __ULL(0x215836520C2259D3), __ULL(0xC7338137506ABDA1),
+  __ULL(0x12FC29F8D5E1AEBB), __ULL(0x4E13C4A31A00C2D5), __ULL(0xE4F9A1A6E11CEFB9),
+  __ULL(0xC4A8B5B30E805123), __ULL(0x7B4965197DE634BD), __ULL(0xFF7BBEC4F5857927),
+  __ULL(0xEA7112EAC8660F93), __ULL(0x2D11E7C19BE3D79D), __ULL(0xD80EB82079CDBF89),
+  __ULL(0xDB1F11CC0EFC280D), __ULL(0xFFD827EC0009F605), __ULL(0x2F0B86807B3FB231),
+  __ULL(0x02CA1B140D1A0ECB), __ULL(0x86E4D2B12B9411C3), __ULL(0x1A2596A7B376955D),
+  __ULL(0xD269B75422D4BBAB), __ULL(0xC65F22A51AB57B1B), __ULL(0x7508E00546CC0529),
+  __ULL(0x2C130BAA783054DF), __ULL(0x3576F0CA1BDC9897), __ULL(0xB3C356064C8991D1),
+  __ULL(0x197B17BF2027FE87), __ULL(0x1768FB70264708BF), __ULL(0x6011A99ACEF9138D),
+  __ULL(0xFB6E776B686D41B1), __ULL(0x6FB13437C4C970D3), __ULL(0x1F30686A3198D78F),
+  __ULL(0x20427DB1EE5A52C9), __ULL(0xA6751DC94BF7D881), __ULL(0xB6552E971A17794D),
+  __ULL(0x728B7C4229133971), __ULL(0x03228FF0B86F5B03), __ULL(0x97150628E4308B95),
+  __ULL(0x1444E4CF878FA841), __ULL(0xF39EDA34D9EADD05), __ULL(0x718404F7BAEA141F),
+  __ULL(0xD6E418C181017DED), __ULL(0xD19C6A41DBA382AB), __ULL(0xBA4392C4879BA639),
+  __ULL(0x0FF38BE1C00588F1), __ULL(0xFDD1B68B526B4FA7), __ULL(0xE18842946C1627A5),
+  __ULL(0xDDBA2B322BE30609), __ULL(0x421A7FBC751630F3), __ULL(0x5887E8BF510787BF),
+  __ULL(0xF6DEAC43DCD26A8D), __ULL(0xD5A861A5E3722163), __ULL(0x2A035B0DD0D91085),
+  __ULL(0x3ECDEC5A482B0367), __ULL(0x2F888D9A83285FE9), __ULL(0xD7757BDD8B1EABF5),
+  __ULL(0x26B15247D43D594B), __ULL(0xAB21FDAEA5D3A7D9), __ULL(0xD23196D397890443),
+  __ULL(0x48827243D8BE5891), __ULL(0x37956301F12BDD37), __ULL(0xD5E06E7136FB6BA9),
+  __ULL(0xB523AE5F420EB35F), __ULL(0x12AC86AE7984E051), __ULL(0xF73C3C610AB8D295),
+  __ULL(0xFA633F14D12ED60D), __ULL(0x3B8ACDFAAD28F031), __ULL(0x6EA51BE6529F0AE7),
+  __ULL(0x023168CC0B7ADB21), __ULL(0xB4CDD259435A34E5), __ULL(0x556CEA9FE43FC60F),
+  __ULL(0x7273AE34DBEE96FF), __ULL(0xE9531C7732109701), __ULL(0x73509128DE761AA3),
+  __ULL(0x0D513F15725F8DC5), __ULL(0x934D72B13D235EA7), __ULL(0x0D8341C69EF04319),
+  __ULL(0x7C009207C6E17DCF), __ULL(0x838C5D4A91076B6B), __ULL(0xB9545BAE80407077),
+  __ULL(0xFA67D9EE94A4D8F9), __ULL(0xE6C01A21F9F10DAF), __ULL(0xDFF083EC60E4A06D),
+  __ULL(0x20EAA59B813A7B43), __ULL(0x7DDEF061446D3791), __ULL(0x2AC35570D4C0ED2B),
+  __ULL(0x6445186FF672DCB9), __ULL(0x45D615455F48A627), __ULL(0x501389E5AA1A120B),
+  __ULL(0x6227E7DB24046D7B), __ULL(0x9858788F438DFC9D), __ULL(0x7800D511F11CF373),
+  __ULL(0xDABE62A9BBD2A641), __ULL(0x8307B96E75072D0D), __ULL(0xDAB8A07E188CD65B),
+  __ULL(0xA580CEBDF2AE921F), __ULL(0xB227145A18A623CB), __ULL(0x951511711F3AABED),
+  __ULL(0x62777468127F27C7), __ULL(0x60D7CB1BA4D0E3B7), __ULL(0xD76EA53A8EE30483),
+  __ULL(0x719BFEC1DA356B87), __ULL(0xC4B09F30776DFD15), __ULL(0xD07629FA73058F63),
+  __ULL(0x79BC6D2207FD1157), __ULL(0x95867392594BC5D9), __ULL(0x188DF438793695DD),
+  __ULL(0x45A0B704FCA0E4B3), __ULL(0x61287CBCE8C43B37), __ULL(0xDF0ED686DD826845),
+  __ULL(0x3EBD7F329B609671), __ULL(0x0F7908744699439B), __ULL(0x983089E382C0990B),
+  __ULL(0x724CDE4E41372541), __ULL(0x5353810DB34DCF79), __ULL(0x96974AEF6E0A5921),
+  __ULL(0xD82DB9565E5908D7), __ULL(0x884895BACC34A9CD), __ULL(0xFA56ECA3037723EF),
+  __ULL(0xE2B5B3480085E5F1), __ULL(0xAAB769170B9A1C8B), __ULL(0xB40AF00CFDA85497),
+  __ULL(0x2C99813C7D4A1CA5), __ULL(0xE2FEB4213D3F1309), __ULL(0xA371A56E0C1A24C1),
+  __ULL(0x28EAB19F6D9FB067), __ULL(0x0DF9299340232CE9), __ULL(0x7B9E35543D94B09F),
+  __ULL(0x0C75F6A35BBACCDD), __ULL(0x3FD81F2C68456A37), __ULL(0x1533CE6A8D1B7AB9),
+  __ULL(0x69575A88687C6A9B), __ULL(0xCC2DD81615E187BD), __ULL(0x6388CDD5502DF05F),
+  __ULL(0xF8AF9C59E26DA795), __ULL(0x32E0FDEE2969843F), __ULL(0x7791425B79699853),
+  __ULL(0x7FAE2163A8751821), __ULL(0x5DCA05B9CA48230F), __ULL(0x9E37FBC7126F93FF),
+  __ULL(0x4AC147A4FABB80CD), __ULL(0x704E4CB09E3A3029), __ULL(0x102489D527F7F019),
+  __ULL(0x0563C7AE2098F283), __ULL(0x7A416BCCB8736CD1), __ULL(0x095C974D7410861D),
+  __ULL(0xD51D033D733130FD), __ULL(0x6672AFB64FB01BE9), __ULL(0xCE676B3AFB56E3D3),
+  __ULL(0xAD27B00D6F70EF9F), __ULL(0x67E5F2703CF6656D), __ULL(0xFB60DA2677C1EF57),
+  __ULL(0x9E282F48E8E218BB), __ULL(0x49DE04426AF72D47), __ULL(0x15966BF98C356CD5),
+  __ULL(0xEF4610F031FC422B), __ULL(0x1153B9706413326F), __ULL(0x7434937C5B68D471),
+  __ULL(0x5EEF6A26D7E9D327), __ULL(0xA20B954D479B9993), __ULL(0x02EB0EA0B6587761),
+  __ULL(0x2AE9E29B08A8F799), __ULL(0x0E8745FDFE826A4F), __ULL(0xE610E8B72F34227B),
+  __ULL(0xB38F381AFDAC94F7), __ULL(0x5A2E32A58B3598E3), __ULL(0xBBE26FBC4780DBC3),
+  __ULL(0x20033B0AA7D3DF5D), __ULL(0x4356675E70FC1055), __ULL(0xA44F0BB5CBC929C5),
+  __ULL(0x06EE9B0DE440E1EF), __ULL(0x1BA46A3E93DBE6AD), __ULL(0x64644CD8C2E23297),
+  __ULL(0x4A71E5DB5744E983), __ULL(0xBD3EE3BA81E1CBD1), __ULL(0x3DE904F8B3F67109),
+  __ULL(0xF0856C6CC82C02BF), __ULL(0x851751BDB5EA89AF), __ULL(0x2A4EFC05BE094EF5),
+  __ULL(0xEC65FE7B7AA0F6A1), __ULL(0xA87D3570B80C7FBB), __ULL(0x8DD7B80610A469B3),
+  __ULL(0x913844501CC9527F), __ULL(0x2BC4F8B54894B89B), __ULL(0x5FEA1A0A6B8096A9),
+  __ULL(0xA80FAFE2F5F0B22D), __ULL(0x7569449EA9CDBB51), __ULL(0xFF43003EFFEB0007),
+  __ULL(0x612504E93670A241), __ULL(0x6F77FF0D702DEAEB), __ULL(0x9E550B80ADB24705),
+  __ULL(0x324744FBD1EB792F), __ULL(0xFDFAAA6C863FC653), __ULL(0xEF5966BB9AFC63C7),
+  __ULL(0x36445692959A2CAB), __ULL(0xBD1ABC0F4C34F13D), __ULL(0xFF9E5595AB2DA9A7),
+  __ULL(0x7706D5E37A570E19), __ULL(0x235AA9BF43403CFB), __ULL(0x7321AA73B3FA3AF3),
+  __ULL(0x10F30A74C95C748D), __ULL(0xE24E2143058371DD), __ULL(0x68BAEB508F3FCB47),
+  __ULL(0x2345F0A179FC40B3), __ULL(0x8957F39ECF11D181), __ULL(0x7F8668E3C3BF67B9),
+  __ULL(0xF4E994A6BAC9DF9B), __ULL(0x2336B393BC89ECBD), __ULL(0x96BFB30D7A7B2D5F),
+  __ULL(0x9BD15E16324C7C95), __ULL(0xB844B29B540A013F), __ULL(0xAE141C51333246CB),
+  __ULL(0x62EF996E34D14959), __ULL(0x1A84423A7EC75A3B), __ULL(0x3EEF364AEB5AF349),
+  __ULL(0xED84EEECC7C86C33), __ULL(0x88FDCB369D59F7C5), __ULL(0x3B29AD82416261F1),
+  __ULL(0x573EA49B0279B8A7), __ULL(0x01607AF7071E4CDF), __ULL(0xB8CFBA7E4BAD37CF),
+  __ULL(0x34FC405493406015), __ULL(0x3512890D53026185), __ULL(0x49480D01CE37ACDB),
+  __ULL(0x0897A065FE8274A1), __ULL(0x9EC04584C7C22A6D), __ULL(0x75CBB33EE98BCAC9),
+  __ULL(0xC0F3F8C9D9CEC1D5), __ULL(0x16064B98F18D972B), __ULL(0x829890B1304E314D),
+  __ULL(0xBE5930D82335CF6F), __ULL(0x841DFF9FA91F5E93), __ULL(0x7595A690F2688EB5),
+  __ULL(0x412618C6DBFB3C0B), __ULL(0xADB91145A25C474F), __ULL(0xD0F75C803A70469D),
+  __ULL(0x5AD5ACC82906FD73), __ULL(0xF2059A1BB93B803F), __ULL(0x09EB8D2E3CBCBDE3),
+  __ULL(0x0A26E8930C1A1505), __ULL(0xA4E91DA9A1DEC05B), __ULL(0xF522E1570FDEF3E7),
+  __ULL(0x48ABF5AB0A004DCB), __ULL(0x1DDAB3C4EAB95859), __ULL(0x1D8F633424B2A111),
+  __ULL(0x5681A396EC89845D), __ULL(0xFBB1F0959E4F01C7), __ULL(0x8F6F4544241C6555),
+  __ULL(0x4C4CA37340907EEF), __ULL(0xD6A26053A42FEC29), __ULL(0x4F70DE7947930BDF),
+  __ULL(0x0D049C1BED21FF97), __ULL(0x8E4F32CB28100AFB), __ULL(0xDA30F4CC8EC07E09),
+  __ULL(0x25734C634320A6AF), __ULL(0x93978B8B148ED8B1), __ULL(0x1CD2C0DC794F7B67),
+  __ULL(0x18D33307771D914B), __ULL(0x97E82B2E51E5DFDD), __ULL(0x1AC55D1007D2F9C9),
+  __ULL(0xC45EBB871ADD5537), __ULL(0x058FDAE59146D245), __ULL(0x85B52E93B3115071),
+  __ULL(0x98DECA11BCB9F72D), __ULL(0x4460BE93E2C80A03), __ULL(0x21AE9EBB8B705473),
+  __ULL(0xFA1374FB2F3DBFEB), __ULL(0x6E7727B7260350F7), __ULL(0xE077FDA8E58E962F),
+  __ULL(0xD7C002D5A20DCCED), __ULL(0x948A40063BF36CE5), __ULL(0x7D25342536695149),
+  __ULL(0x165AD13A7D1E8EFF), __ULL(0xFF3AEFCC9C53B3CD), __ULL(0x79489C6ADC48563D),
+  __ULL(0xC4FCD8248F6052E1), __ULL(0x02629ADC1700F1FB), __ULL(0x77D52583B17577B1),
+  __ULL(0x1AB6DA75EB9EC6E9), __ULL(0xF0D3D99329FF6AF5), __ULL(0xD06E38DB86E02A9F),
+  __ULL(0xBBB1A60F5D04984B), __ULL(0x2F57688CBA672ED9), __ULL(0x7888A7CE7457252B),
+  __ULL(0xD2DB5013DF328437), __ULL(0x2292FA3BB5CC51BD), __ULL(0x96F264207A741A25),
+  __ULL(0x6C08674DBB8F06EB), __ULL(0x1A9ECEDD10D47879), __ULL(0xE0349633DDBA2BE3),
+  __ULL(0x112202CB41D58731), __ULL(0x1624612404F42253), __ULL(0x47B52F060CDF9221),
+  __ULL(0x557649C7A242DD0F), __ULL(0x082935613889F25D), __ULL(0x56A7BB017714F133),
+  __ULL(0x8F3CD1994E2A5BB7), __ULL(0x6D83E11B102CBEF1), __ULL(0xFCFE5C669EF1E5A7),
+  __ULL(0xA42F151D0DD6CA29), __ULL(0xF46D4CCE5EB459AD), __ULL(0xD27C4EFEDEC814CF),
+  __ULL(0xD78778C3BE9F96F3), __ULL(0x8F394C5C1AB5EA6B), __ULL(0xA7F54B59C848FAFD),
+  __ULL(0x602B5B12C4608957), __ULL(0x38DBD9BA25CD0E91), __ULL(0x818644AF51F90747),
+  __ULL(0x15540770F9294D7F), __ULL(0x25D7450E6DE66C6F), __ULL(0x1438A87922CBC8BD),
+  __ULL(0x5246081473E92393), __ULL(0xA0B9A13F9E4CD10B), __ULL(0x0CE73F90F6358C7B),
+  __ULL(0x68ECC57ED402AEF7), __ULL(0xA387784FEF69E2E3), __ULL(0x36425BC24B08CA05),
+  __ULL(0xD7C2E7FE1E7EA0E7), __ULL(0x0F244CDDF6AEED69), __ULL(0xFE5F4FAFEBCE62CB),
+  __ULL(0xC7BB93F0068AFC0F), __ULL(0x3A26F424B599295D), __ULL(0x14551F28E1E6BA55),
+  __ULL(0x185AA25DB6520FAB), __ULL(0xB7A874BF9A3393C5), __ULL(0x1080D45A7010D0E1),
+  __ULL(0xA0CA8E6B06BAB383), __ULL(0xEA64813A57097C15), __ULL(0xAEB7ED108D142867),
+  __ULL(0xB6B6A71E435284D3), __ULL(0xF589EFD3C35D70A1), __ULL(0xF9721726FD034C7F),
+  __ULL(0xE44B9963853BCC81), __ULL(0xD2FA31036B598D4D), __ULL(0x1444A52825980745),
+  __ULL(0x5C687CAA1B6DA29B), __ULL(0xC02DF173D5D3E85F), __ULL(0xAD7647389A06EF03),
+  __ULL(0xAE6FC964DFC7DF95), __ULL(0xB80BAE114B999C41), __ULL(0x5F73E0DF96261679),
+  __ULL(0xA98F2219260D081F), __ULL(0xE9290757C73091ED), __ULL(0x985A36C0C406EFD7),
+  __ULL(0xC667E3EB32A25D3B), __ULL(0x45102FD407F5BB3D), __ULL(0x6450600CF4284613),
+  __ULL(0xD3C3EB2B6421FBA5), __ULL(0x27E15E7FE8DF3A09), __ULL(0x60E80F3588717BBF),
+  __ULL(0x1881B75074059BC1), __ULL(0xFAA0FEECFFC8FFF5), __ULL(0x04F068DD10C69843),
+  __ULL(0x13A8F2601A194AB3), __ULL(0x22DFA402B62D41B9), __ULL(0x33FA33301FFC6E45),
+  __ULL(0x1E4C7AE902085193), __ULL(0x576E44900D4DF317), __ULL(0xD482518C3387E603),
+  __ULL(0xEE3C35C86AE15451), __ULL(0x9EAB341E5490A907), __ULL(0x6AA0FAD9DDEB5189),
+  __ULL(0x585C12CA8B5C0375), __ULL(0xC5A3F4BD904FCF21), __ULL(0xA823ED6B9EA75ED7),
+  __ULL(0x05279ADADB677633), __ULL(0x3B21A8A723F2E8B7), __ULL(0x95C8FF41D67CC6DF),
+  __ULL(0x2338B0CEA6949EAD), __ULL(0xCD5B2DEB08629BF3), __ULL(0x5216D7A5730A0A15),
+  __ULL(0xB6CDB5E2023BCB85), __ULL(0xAD24A4FB2295269F), __ULL(0xEBD2FF952B000F43),
+  __ULL(0xCDFC2B47F1E6F447), __ULL(0x54895213DB9E90B9), __ULL(0x54C0822192198A23),
+  __ULL(0xA528608EE5E0EB71), __ULL(0xE5662901C7015A27), __ULL(0xDB8CCF15E074B8B5),
+  __ULL(0x9B4D4D6BE3E0AE61), __ULL(0xEEFBD7FBDA28E217), __ULL(0x24BC3AE458BA909D),
+  __ULL(0x49D14C08DE490089), __ULL(0x6A1D82117B090773), __ULL(0x48E2743B50080331),
+  __ULL(0x3C573283ADB0BA69), __ULL(0x4B4776514F59BFED), __ULL(0x77494BF5A7610AC3),
+  __ULL(0xD7715F2DC102CE5D), __ULL(0x854038F565844D33), __ULL(0x4A804680608864AB),
+  __ULL(0xDC5B4F82E8D9B8EF), __ULL(0x154C7BF75D888DE1), __ULL(0x05296BDD5FA549A5),
+  __ULL(0x32A4B024AF0F74FB), __ULL(0xABBAC0008A915115), __ULL(0x2205B331AF3C79BF),
+  __ULL(0xD541808B8A20D6FD), __ULL(0x0B019D04F101BB4B), __ULL(0x3E9ABBBCBE0479D9),
+  __ULL(0x6CCB8E9EB8CBA88F), __ULL(0xAADDD10B0D181EBB), __ULL(0x1367F521F19B124D),
+  __ULL(0xB5B07C0A16D3C123), __ULL(0x8595C337DDF1255F), __ULL(0xB6FD026AEF7F479D),
+  __ULL(0x70111DDC89704707), __ULL(0x883F632E89DF69EB), __ULL(0x5884EF3FA1C49553),
+  __ULL(0x748E09454288C51F), __ULL(0x2D9E7D63B45DBA11), __ULL(0x9BBDAFEC81912BAB),
+  __ULL(0xE60BD8C7905ABDCD), __ULL(0xC966BDA9F11B0B13), __ULL(0xE6CC0ECF36EA0335),
+  __ULL(0x617B8E23E089CCE1), __ULL(0x5A0D46463B7DF0A5), __ULL(0x2468416EB095631D),
+  __ULL(0xB98527228E7818C1), __ULL(0x0D0D495FBD34DA63), __ULL(0x6A7200C9A12260E9),
+  __ULL(0x4F3A8D6677FC94F5), __ULL(0xBA780BBA66E3A49F), __ULL(0xD9382FC1712F6991),
+  __ULL(0xCCB23CA24DE7C881), __ULL(0x77633661EF08C017), __ULL(0x5F8EE4F7F8500425),
+  __ULL(0x2FC95462F2B10F7B), __ULL(0xBF3BD030831A5E89), __ULL(0xD613EBED9915EF0D),
+  __ULL(0x4A37E7E517252F2F), __ULL(0x6A9DABB2DBD3097D), __ULL(0xC20BBA7F1C920C21),
+  __ULL(0xD24EB57C6281D059), __ULL(0x4AB0FB34A775970F), __ULL(0xDC24A61A8723F93B),
+  __ULL(0x1C5D635075C29A49), __ULL(0xCD82F1F626F975B7), __ULL(0x163D68CC7CAEE3AD),
+  __ULL(0x944CFE02D8948683), __ULL(0x4D510D44CE691A1D), __ULL(0xCB3CF4370EADDF15),
+  __ULL(0xF75B4FC6B02C8BDB), __ULL(0x38E6DD4F10074FE9), __ULL(0xFAC21A90ECFC2BA1),
+  __ULL(0x8F1BE0477ACE5165), __ULL(0x3324BFD2D772E147), __ULL(0xD7C44D43291471C9),
+  __ULL(0x80C47ED36A45962B), __ULL(0x955C973EC518C04D), __ULL(0x233515B5C92A2F23),
+  __ULL(0x2A6934D5DCDA92BD), __ULL(0x76DB811FA71A8727), __ULL(0x04470F97E1076B61),
+  __ULL(0xA73FF2BDC7FFAB25), __ULL(0x81A2BADADB1EF73F), __ULL(0x962D45BAB9CE9F5B),
+  __ULL(0xD7F9724054348769), __ULL(0xD4A96A20D05E1F75), __ULL(0x45A9FDBBCAB284ED),
+  __ULL(0x4183C3DBA9DED233), __ULL(0x1CA6E75910308701), __ULL(0x56DF785C7997A4B7),
+  __ULL(0xBA2C9FD795E0FAAD), __ULL(0x01B9919FD1C87D83), __ULL(0xB2071C62C2AAA509),
+  __ULL(0xD7B5C553711DF6BF), __ULL(0x5A7BBFFD5C9C4863), __ULL(0x73B5448B03B78267),
+  __ULL(0xACE91E47EECBA2F5), __ULL(0x20B9D4103E569257), __ULL(0xCFFD3B868707A6D9),
+  __ULL(0xA538A84D00DD53BB), __ULL(0x3DF53957D8516771), __ULL(0x0EB0CC1F4A1E8C9B),
+  __ULL(0xCF8D6DE8C452820B), __ULL(0x167CC83FFA36B903), __ULL(0x1C3881D84E907D4F),
+  __ULL(0x0DD47F1BC0222F51), __ULL(0xBA88CB8EC8D8B407), __ULL(0x0FA8A20E4DCAF079),
+  __ULL(0xD2A5B261A6B91B05), __ULL(0xEE74C1C788CBED2F), __ULL(0xA41629628558F77D),
+  __ULL(0x9BCD157E7A447669), __ULL(0x7DF00AE3C888C73B), __ULL(0x7C82E3E2A5B417C7),
+  __ULL(0xEC01EF3A9DDB85FF), __ULL(0xF1A65BCE12D542CD), __ULL(0xC01CD6AF0C0D34EF),
+  __ULL(0x8D61CEB2EF75B6F1), __ULL(0xFEF7C8C22A1E853D), __ULL(0x959573E87253D013),
+  __ULL(0xB844D7445769058B), __ULL(0x7F4EE8DF862F5597), __ULL(0x129254847F63E5A5),
+  __ULL(0x57EB864AD200FF63), __ULL(0xCCA0703646691167), __ULL(0xC716A1D9AAA72DE9),
+  __ULL(0x33BA57D09A6A619F), __ULL(0x6D4F78F616E4A76D), __ULL(0xF2DD244BC72CB5D9),
+  __ULL(0xB4A76DA28DE84ED5), __ULL(0xEEFB5345A19BB39B), __ULL(0x588F7C108A75DB93),
+  __ULL(0xA61293DA957C215F), __ULL(0x337B036EE115E961), __ULL(0x8395620801C2DD2D),
+  __ULL(0x1D601D6A8716F2E5), __ULL(0x3BC0A92A2F7AE15D), __ULL(0xF3D184A3A5692749),
+  __ULL(0x0B1F210C38188501), __ULL(0x5B35B56FC38E6CA7), __ULL(0xD356160C2B50B129),
+  __ULL(0x373DE6FFA6961F35), __ULL(0xC5E471B2C9D26B83), __ULL(0xF6E08C82EF203F1D),
+  __ULL(0x07AB665984B82A87), __ULL(0xCAA2F683827AA5F3), __ULL(0x5F8A70F7F697BBAF),
+  __ULL(0xC82ABF13E3AFA9FD), __ULL(0x07D47D2EEC68A09F), __ULL(0x8E3482C0132EE591),
+  __ULL(0xCDAD9046A09CCE47), __ULL(0x60B6172A80E0D423), __ULL(0x21DFB849B7EA7293),
+  __ULL(0xFA143CEC9C802861), __ULL(0x144809404C145899), __ULL(0xC6965E184DCFBB4F),
+  __ULL(0x12179F2F3C4CAB7B), __ULL(0x5C7D1878AB14D5F7), __ULL(0x33B5DCD6560A945B),
+  __ULL(0xDC24B43A34160C59), __ULL(0x3D0C67430949D4C3), __ULL(0xC21A9C6C279A130F),
+  __ULL(0xF18EC4E2239D1511), __ULL(0xCEC0DF814741B955), __ULL(0xF588D94E924631B7),
+  __ULL(0x312FE3C3A0D12029), __ULL(0x4CAF4D7133BCFE13), __ULL(0x32AE09ADB9495CD1),
+  __ULL(0x0BE8235BABFBF987), __ULL(0x66942089BF6C35F9), __ULL(0xF9372F10A5C8DF57),
+  __ULL(0xEF586CDD9F2CD3D9), __ULL(0x8E29933FB25888BB), __ULL(0x3881169C176BC381),
+  __ULL(0x12905A0EA95F0B23), __ULL(0x1AFADABEBEE8019B), __ULL(0x1A3235BD7C98170B),
+  __ULL(0x6F349736108CDC7D), __ULL(0x1587658472FB1F53), __ULL(0xF0F8A865E8F4E0ED),
+  __ULL(0x822636F5EC0940E5), __ULL(0xC1C02043DBED04C7), __ULL(0x62A79DC4EAE3D5AB),
+  __ULL(0x90A9CEE8E9162139), __ULL(0x119BF0BFB5D29513), __ULL(0x8514535935082D35),
+  __ULL(0x061E4591B21FC5FB), __ULL(0xBBBCD2DB3DD16109), __ULL(0x0C9FEDDB81DD53F3),
+  __ULL(0xEAF61F9A0E83F2BF), __ULL(0xE2BA2483658C8D8D), __ULL(0xEB64C1EEEFE30385),
+  __ULL(0x9391B9DCA6D4CEDB), __ULL(0xD71B119750ADFAE9), __ULL(0xEC0DBFDCC7ECEC4B),
+  __ULL(0xC1D7DFECDEB4AADD), __ULL(0xDA1DEBB51C496C47), __ULL(0x41D476BDA4F60D45),
+  __ULL(0xF1F5706EFDF4016F), __ULL(0x9DC8B4ECCEAF5E5F), __ULL(0xA14DCFB37C53EE25),
+  __ULL(0x534AAB42B6E7F007), __ULL(0xE700EE35861CA595), __ULL(0x9C446C70D49E723F),
+  __ULL(0xBB3454FF2E62BFE3), __ULL(0x5F73E06F21DCD37D), __ULL(0x019EC59DFA4C2A59),
+  __ULL(0x8373505F6BD967E5), __ULL(0x282C42C5B2830533), __ULL(0x431DF18A46038201),
+  __ULL(0x90BD4DD23EC49ECD), __ULL(0x6E53F8FE376FFE19), __ULL(0x2D3DC45151F65083),
+  __ULL(0xFB6954A5813F88CF), __ULL(0x6FB698C7DCB1641D), __ULL(0x061F6196CC9E91C1),
+  __ULL(0x99AC40D973FD3E6B), __ULL(0x1AF4DFAA99C5CB77), __ULL(0xBC25A59663B08EFD),
+  __ULL(0x874083293FBCA5A1), __ULL(0x82077BE9F185BD57), __ULL(0x92E6CE48B2033E43),
+  __ULL(0xAF528334FF338291), __ULL(0x27EBD1677AF356BB), __ULL(0x91FFFBF3A2398BC9),
+  __ULL(0xE75F8ADDDAC36AD5), __ULL(0x7B5193E60D9B0271), __ULL(0xE901DF3893CC3793),
+  __ULL(0x874529D1FC61F7B5), __ULL(0xEC021DB40F514917), __ULL(0x89273DEE045F9525),
+  __ULL(0xA2D1F45E48DE2789), __ULL(0xEF9858D183F91673), __ULL(0x01613EAD63BC895B),
+  __ULL(0x1546081E547ABD1F), __ULL(0x4DFAC0A4E4D739C3), __ULL(0x0B29A2254AF4B211),
+  __ULL(0x57DFED99E8A3A2C7), __ULL(0x572DC35041A5DC33), __ULL(0x92F61BAF4281231B),
+  __ULL(0x6EA92A942C08D83D), __ULL(0x463EC54807FE6D29), __ULL(0x61AFFA97409A79D1),
+  __ULL(0x179BCF8A63A393FB), __ULL(0x707CE2279990BF09), __ULL(0x472E70BFC424D015),
+  __ULL(0x36786DD2284F856B), __ULL(0x135D620CA5E29263), __ULL(0xA5450B002E3B98D3),
+  __ULL(0x2C8750157AAE64A1), __ULL(0x9B46746ACAFCFA4B), __ULL(0x1C8AC760F95E6265),
+  __ULL(0x8DF7BB47856EBAC9), __ULL(0x54056D2129591637), __ULL(0x1131726CCDC0DB45),
+  __ULL(0x450BB16642B6374F), __ULL(0xDA7802515BABB69D), __ULL(0xC3450EE91B16E8EB),
+  __ULL(0xD9475CA9D0F7CA79), __ULL(0x0A3410BEABF88505), __ULL(0x23397C017890272F),
+  __ULL(0x942BFE87C827B5E5), __ULL(0x99E064BDA38E2AAB), __ULL(0xB1DCB708454A0BA3),
+  __ULL(0x987A21B00D5E6EEF), __ULL(0x58C36FEFA2AF4F3D), __ULL(0x93D082C25FF64235),
+  __ULL(0xABEDACB9782F03E1), __ULL(0xA4EAE7C4A03C2F8B), __ULL(0xE79C013766BB6FBF),
+  __ULL(0x4F5FB167E93B8FC1), __ULL(0x8A1965E9787F2977), __ULL(0x928028E8080B4963),
+  __ULL(0xC53E5CCAC7FE316D), __ULL(0x856000BF4E255947), __ULL(0xE875EE17B9DD4245),
+  __ULL(0x32F90DC2A0909E6F), __ULL(0x4B801CDE651E4ABD), __ULL(0x1B2EF57793DB672D),
+  __ULL(0x44EFE780BA077A03), __ULL(0xB68352827BA4E325), __ULL(0x9F807C487CF77A95),
+  __ULL(0xBB73A467D4F39979), __ULL(0xFDDF5FBE286BE4E3), __ULL(0x954348FB69B472E7),
+  __ULL(0x0320A623BED77B53), __ULL(0x0CB7A52FA244C321), __ULL(0x2149EC97077092D7),
+  __ULL(0x24C3A18CC8882B5D), __ULL(0x68FADC3D3DFE7EFF), __ULL(0x160F055F0C3123CD),
+  __ULL(0x1A23124B8D3935C5), __ULL(0x0D9827F841014B29), __ULL(0x5DE4F0410F244935),
+  __ULL(0x28A5C791956065CF), __ULL(0xE7A60664C3E537D1), __ULL(0x54F8E38022AAAFF3),
+  __ULL(0x10C7A82D9CE6136B), __ULL(0xCC1F64DAE4476ADB), __ULL(0x8FE82058D09DB6E9),
+  __ULL(0x4B4F7C09DCF41A9F), __ULL(0xB4BFFC8A4C58BFD5), __ULL(0xF3D6647F4B1D3E7F),
+  __ULL(0x5DCA09AE46EA44B9), __ULL(0xCCF1EF2A0EF3FC93), __ULL(0x321A57033F850CB5),
+  __ULL(0xFCC4AE08DEB01617), __ULL(0x3477562BD85D754F), __ULL(0x88B567823B6A157B),
+  __ULL(0x97DC6B252D551B73), __ULL(0x05003934A6D6EFF7), __ULL(0xE52C63E237747A1F),
+  __ULL(0x05EA051F3B5D4BB7), __ULL(0x107503B6E19DAC39), __ULL(0xC22B77026FDA3D3D),
+  __ULL(0x74B0F93EA83279DF), __ULL(0xE6854857B7C5C9AD), __ULL(0x3DA5CF497FDD96D1),
+  __ULL(0xC37C2BD72B9648FB), __ULL(0x5AB6802C39566DBF), __ULL(0x1212416C112A5A6B),
+  __ULL(0x590DC774A87B408D), __ULL(0x8E1C81B728E70FF9), __ULL(0xC2D66614AC8B54AF),
+  __ULL(0x82678F484A0FA1A1), __ULL(0xC6D82FC7733D1C8F), __ULL(0xBD5E8CF0CD650CB3),
+  __ULL(0x3C6977D5E2E5BD81), __ULL(0x4B13AED11665264D), __ULL(0x942F1596D95CEB9B),
+  __ULL(0x99625C89E1CE8651), __ULL(0xB37E36AC00C3DB9D), __ULL(0x99B245AE62F60895),
+  __ULL(0x04A437D1EFDD9EF7), __ULL(0xA4B6C5577E87442F), __ULL(0xB421B8FE3042A67D),
+  __ULL(0xA93659E7BF43B91F), __ULL(0x57AC3CC28F702E11), __ULL(0xA947946F81129F49),
+  __ULL(0xC42B939014E32A55), __ULL(0xDB959F67DDDFB0A3), __ULL(0xFC0E7DFD7BA21F13),
+  __ULL(0xCE04C6202AB4C0E1), __ULL(0x61CBE550A838C919), __ULL(0x8E520AE6C251C4A5),
+  __ULL(0x9906DE0F2AF32FFB), __ULL(0x447CB80B8615F71D), __ULL(0x658EABC0F160ECBF),
+  __ULL(0xB1713D1099F60CC1), __ULL(0xBCFC65C815246D85), __ULL(0x55E44BC18662A5B1),
+  __ULL(0x89A0FBB680A4B8DB), __ULL(0x93FF6BDD7E7D1867), __ULL(0x4CD720EC88EEE8F5),
+  __ULL(0x7F1539E4F3A1F66D), __ULL(0x5C61EC2376243CD9), __ULL(0xCBD44452CF543B8F),
+  __ULL(0xC960C15FB8BB3B6F), __ULL(0xC12EDBB70CDFF417), __ULL(0x9CF918F5B9D9E551),
+  __ULL(0x3530009B7A6A9289), __ULL(0xFF6C5FE0AD9B09E3), __ULL(0xD761502F744E9D7D),
+  __ULL(0x2004204FDABE1FE7), __ULL(0xAB0E535045C4EC75), __ULL(0xC595E807189DDFD7),
+  __ULL(0xB71061E2829E8459), __ULL(0xD468454FCB7C51E5), __ULL(0x3B635BE77BEF7BFF),
+  __ULL(0x58BE93EEC297A8CD), __ULL(0xB73DBBED9D84ECF1), __ULL(0x11C7235610B3E61B),
+  __ULL(0xE72B6EAA6A164B8B), __ULL(0x320F0F2C3B5BF7AD), __ULL(0x786935D29C0BB4F3),
+  __ULL(0x1B91747EE08D8BC1), __ULL(0x85D13C102D99E577), __ULL(0x081E0D0B962812AF),
+  __ULL(0x5A437CF3B1C51FA1), __ULL(0x8B2EB76807AC8D6D), __ULL(0x42EC65117DCE9547),
+  __ULL(0x9C28E6EC47EEEA2B), __ULL(0x07A86BBD17E8C323), __ULL(0x765925D4813BBC71),
+  __ULL(0x184F39F6D03026BD), __ULL(0x505733442E865F99), __ULL(0x69689E07B3D9524F),
+  __ULL(0x84AE10B3A3330805), __ULL(0x16EA0C897870E0CB), __ULL(0xBF6574E872672A0F),
+  __ULL(0x5A2CD115A7F9EC11), __ULL(0x38C078D05B177CC7), __ULL(0x3D2FD457A5609939),
+  __ULL(0xB57CB25E3462D1C5), __ULL(0xC3E44D369FC0DC63), __ULL(0x4028CEBD052371AF),
+  __ULL(0xDB1A5222AB5DE3B1), __ULL(0xEF475C89662DF6F5), __ULL(0xB7B2EE4CB1BD244B),
+  __ULL(0x3532B7A33E8B4C65), __ULL(0x27D521DA1F9C798F), __ULL(0x08C20183699891B3),
+  __ULL(0xFC47257F78D63037), __ULL(0xB14B49440AECD60B), __ULL(0x0419B5C21E92DA2D),
+  __ULL(0xBB34C4A5E225EE99), __ULL(0x118F4C2793A66807), __ULL(0x4685D3694C5FEF05),
+  __ULL(0xCCFE277FE4431A5B), __ULL(0x011D039440C48B7D), __ULL(0x849369A8A319EE53),
+  __ULL(0xF842FC646B4A7E21), __ULL(0x1933B5F465587AC3), __ULL(0xD8708F6EA82B2C49),
+  __ULL(0xB183F96704377F55), __ULL(0x6DC1C638E1DB79FF), __ULL(0xFF3D2F78FD9AE839),
+  __ULL(0x4938C23E50E7A8EF), __ULL(0xEC816F83C8E711A7), __ULL(0x2CAA7E21E48C7DE1),
+  __ULL(0x88244EF7684480CF), __ULL(0x1B90EE4A66158809), __ULL(0xA7AD58880C7469BF),
+  __ULL(0x5B872F245B4289C1), __ULL(0x4BE964DEDF742285), __ULL(0x6CF447B419822B4B),
+  __ULL(0x0CCCB46DEC7099DD), __ULL(0x43A80D43DD59A2D5), __ULL(0xA65869CAE9115F37),
+  __ULL(0xCF063F8D68186DA9), __ULL(0x2E912ADC6ADBF12D), __ULL(0x2E6C5A655010C117),
+  __ULL(0xF39FD0B96BA7987B), __ULL(0x7D5A8A15924D3707), __ULL(0x69F331349303D9EB),
+  __ULL(0xE63CCCD2E0E7080D), __ULL(0x7F8D1C766B74C02F), __ULL(0x453489C1F9939231),
+  __ULL(0x3E66635CC125CCE7), __ULL(0xC4012804EBFAB159), __ULL(0xBC96CCD3A149680F),
+  __ULL(0x38A9983F9AFD755D), __ULL(0xE76A969C628320A7), __ULL(0x7B7F1236DF5A7335),
+  __ULL(0xDFD42FFC90E834DF), __ULL(0xA50FB10BDFC5FF83), __ULL(0x9D116059B70C1FCF),
+  __ULL(0x6516E40CDE80D31D), __ULL(0x92A962A63120F277), __ULL(0xFB273993E0E150E9),
+  __ULL(0xBC1ACDB2070C50D3), __ULL(0x1A334B05039C6D43), __ULL(0x4A0BF9C4BDED5991),
+  __ULL(0xE74CC3EB01708247), __ULL(0x4D74C375A267387F), __ULL(0xB371595671F2594D),
+  __ULL(0x623B07A29442B76F), __ULL(0x21FF470651971C61), __ULL(0x448086ECE69B0C99),
+  __ULL(0x92D8C9CC9B5F7F7B), __ULL(0xAB3E69136D9F2573), __ULL(0xFEDDA02579AB5F0D),
+  __ULL(0xBFB9C472559109F7), __ULL(0x5DB93B024A4DE5E3), __ULL(0x473434F70ADF0875),
+  __ULL(0x326719A5763E69C7), __ULL(0x808E1AFBA3DC62AB), __ULL(0x1D69A6EE7D925429),
+  __ULL(0x4FB99582516C1213), __ULL(0x0F3C86E8C72CF3DF), __ULL(0x87A69D37F810FBE1),
+  __ULL(0x5805D078DE2DAD87), __ULL(0x3EB10EB3C2324F15), __ULL(0xF53641819C62046B),
+  __ULL(0xDFFA99CDCED5C0B1), __ULL(0x13920AA956481BA1), __ULL(0x1C19C6D4B57E1357),
+  __ULL(0x5AC83F994DD216B3), __ULL(0xDA778757E0A6304D), __ULL(0x6696636C95A43871),
+  __ULL(0xB747132D27A9D59B), __ULL(0x37A5E5C9372C1F2D), __ULL(0xE7D5B8D1FC9F7E2F),
+  __ULL(0xC626ED04FA290F5B), __ULL(0x1EB09DE02439DFC3), __ULL(0x9686DC837CBF14E5),
+  __ULL(0x42E4B66743B9D03B), __ULL(0xA40575D79A35D455), __ULL(0xE4C9BAB07735D539),
+  __ULL(0x33071D5399FCFAA3), __ULL(0xB664B21A7BC787F1), __ULL(0x2006C4BD3289A913),
+  __ULL(0xAD924168BFDDEE8B), __ULL(0xF964EABF0B045697), __ULL(0xFCD7ED6568F7AEA5),
+  __ULL(0xE8134C0F12059509), __ULL(0xE3645D55A9E0A18D), __ULL(0x28667D85218DD785),
+  __ULL(0x3312636056EC5FB1), __ULL(0xDD1DA0928E607267), __ULL(0x2B3E2EA0A435404B),
+  __ULL(0xC4EB04CEA079B681), __ULL(0xF51537682D8779BD), __ULL(0x2CFDAE8903D0B493),
+  __ULL(0x08582255F0E14D7B), __ULL(0xBDA811D53B9EAC89), __ULL(0xD00FE95A29B5AEEB),
+  __ULL(0xFF961D2F76E1DD2F), __ULL(0xB127EE1026E46F31), __ULL(0xBC1E080D4A0E4A53),
+  __ULL(0xE59A6DEC265DC50F), __ULL(0x00EF60FE74BF1A5D), __ULL(0xA9131C84BE511933),
+  __ULL(0x20F340D5CD9B75FF), __ULL(0xB2EE06FF713431A3), __ULL(0x521BCABBBC993229),
+  __ULL(0x6F1234E3BED1758B), __ULL(0xD8ED9D526B79F81D), __ULL(0xD20A84525EC485C1),
+  __ULL(0x070B1D5DEA2587F9), __ULL(0xC9E5771305CE4CAF), __ULL(0x01D7D3FF55C595D3),
+  __ULL(0x23BE94EB1B5E519F), __ULL(0x99E3346CDA410F65), __ULL(0xD216E4D67EB06F47),
+  __ULL(0x5007BDD9899BBFC9), __ULL(0x6403C869840BDE4D), __ULL(0x3539B64489F1790B),
+  __ULL(0x04E36606CAAB347B), __ULL(0xEB6C9C36D211939D), __ULL(0xDA11CD2209E70541),
+  __ULL(0x8A6C54F11B0B16F7), __ULL(0x5E3F8FF2BE2B0AE3), __ULL(0x7F5AEDCB46E67205),
+  __ULL(0xC89A6416CAEE0E31), __ULL(0x00C54AC504B408E7), __ULL(0x340ED38E8AC72611),
+  __ULL(0x8D6746CAAABE515D), __ULL(0xB19572072650F2B7), __ULL(0xA12CD0E5950C7339),
+  __ULL(0x278BF4C0976D3BC5), __ULL(0xC6D267D80576F71B), __ULL(0xAC2A011400C6B8E1),
+  __ULL(0xC394522150719067), __ULL(0x00A72905B45B20F5), __ULL(0x8F2106119C979571),
+  __ULL(0x9056C7385D414A9B), __ULL(0xF6B8018BFFBE000B), __ULL(0x5A04BD75BC5D4899),
+  __ULL(0xFA14589254A9AB4F), __ULL(0x7C1143059A888173), __ULL(0x39F48B1C1916557D),
+  __ULL(0x08D115AC70094469), __ULL(0x0AAB0C4A900C7853), __ULL(0x145E1C2725ECF821),
+  __ULL(0x3F37438D7C4BA5C7), __ULL(0xAFE2DACDD4DE2955), __ULL(0xAACE0520F36F73FF),
+  __ULL(0x34050E3B39849FA3), __ULL(0xE475E5512F016BA7), __ULL(0x3B043B7756D29635),
+  __ULL(0x951BF2BA8DDC2397), __ULL(0x3A19B75BBF37A209), __ULL(0x21793525F1D66CF3),
+  __ULL(0x4E301E74366F5D77), __ULL(0x866386D2CFD197DB), __ULL(0xFD01FCD9DCFDA7F5),
+  __ULL(0xF0452840FFAA528F), __ULL(0xD9A72D1FAB7D72B3), __ULL(0x4905DB845BFBB381),
+  __ULL(0xAB56814A9F34A9B9), __ULL(0xBB1505F46E8F126F), __ULL(0x367EF540C60307A9),
+  __ULL(0x31E2C5C3F7618F5F), __ULL(0xBC8AFB213CEC5B17), __ULL(0x4295130F1EE70E03),
+  __ULL(0x3A9DF750384CB725), __ULL(0x46F6BD149AFA3C51), __ULL(0x9EB127A1D4F7120D),
+  __ULL(0x30FF741019C8AB75), __ULL(0x680A8140B62918CB), __ULL(0xB14FC2921F190B59),
+  __ULL(0x3D5017B990336C3B), __ULL(0xDF3311CB38A87301), __ULL(0xBE0E38FD5E9DD6A3),
+  __ULL(0x7269A65F699609C5), __ULL(0xF43222C2B8100A8B), __ULL(0x8135358551105F19),
+  __ULL(0x37E8605D227AB887), __ULL(0x1D9ED3D4D0BB02C1), __ULL(0x88612C67E144DAD3),
+  __ULL(0xD31C6DC0F2330E9F), __ULL(0x7AC58D40B9F89391), __ULL(0x6615552EBAD94CC9),
+  __ULL(0x52335EF9EE1F634D), __ULL(0x1C094BC60C63D371), __ULL(0x31AE27230C4F1093),
+  __ULL(0xA662E0399B174A17), __ULL(0xFDE7568AEC3E5E25), __ULL(0x81FC8ACB1BF3B89D),
+  __ULL(0x79AEF3F596B7690D), __ULL(0xE66D70F5E12E2FE3), __ULL(0x2A7D3D528820525B),
+  __ULL(0xFAF3CBF8EC072269), __ULL(0xAB7E63AE9A276E1F), __ULL(0xBAD12D0C80F7F65D),
+  __ULL(0x0A147848866643C7), __ULL(0xD11EFA5F96C37201), __ULL(0xFB34FD926323D13D),
+  __ULL(0xCEDA0DB14ADF6DDF), __ULL(0xAD2D047ED422DDAD), __ULL(0xAC5CC778955B7AB1),
+  __ULL(0xFB2CD4206402634B), __ULL(0xF4C9318A3DD5E1D9), __ULL(0xFB6FDD4AFB29C6BB),
+  __ULL(0x6A41B0A2BE6A51DD), __ULL(0xF5FA1E405CFC7BC9), __ULL(0x715F1C83580D317F),
+  __ULL(0x7ADC89F8CD74E445), __ULL(0xD13C5F329F3CF271), __ULL(0x34870E0A22AAFC03),
+  __ULL(0x45DA96AB4629884F), __ULL(0xEA7894F6FE9AFA51), __ULL(0xC70025A9D0755C95),
+  __ULL(0x2B4FEBF0D7F1D2F7), __ULL(0xAE6323C2DAEFB82F), __ULL(0xA24FB86A5E56F95B),
+  __ULL(0x2B37F00A312EBD53), __ULL(0xE8A4323028A4A4D7), __ULL(0xF8FB6393192EA9C3),
+  __ULL(0x50C4A2C0D83892C7), __ULL(0x4CF960A0011E70FF), __ULL(0x7E8E889B6120483D),
+  __ULL(0x925879B19D52AB35), __ULL(0xE634DBCA348D188B), __ULL(0x9B804BFD91C598A5),
+  __ULL(0xBCA94D946C42E0BF), __ULL(0xF8EDEDDDC8E6AB8D), __ULL(0x797A7828CFBE0263),
+  __ULL(0xA8E2014C39CC8CDB), __ULL(0xB129E7B59B80C8E9), __ULL(0xF4D3F9801D750A6D),
+  __ULL(0x9EDF7C2061F4F0D9), __ULL(0xE4ABF900290C5191), __ULL(0xA6CD3CD30566772B),
+  __ULL(0x73A8CFB418B74B45), __ULL(0x4F90053CA27B54A9), __ULL(0xEBC5EE3793A8CC5F),
+  __ULL(0xAEA54FCD53DDF303), __ULL(0xCE4A75958D4FAC25), __ULL(0x68DBA01AF1F6B77B),
+  __ULL(0x35BECD2B90C07E07), __ULL(0xDABA111315DAC689), __ULL(0xFAC35545E724BA79),
+  __ULL(0x96941353FE6A317D), __ULL(0x4C523540CC2BF421), __ULL(0x54349B8B40707F0F),
+  __ULL(0xB4253396102F0249), __ULL(0x976FBFE6ABE5DDB7), __ULL(0x979EC1AAF5E63EC5),
+  __ULL(0x5A1A7F52C655A7A7), __ULL(0x132603348DE49F8B), __ULL(0x3AF2A1A83DA90BAD),
+  __ULL(0xB545DF55C824C8D1), __ULL(0x98325056A6042587), __ULL(0xCF9AF08490CBC8F3),
+  __ULL(0x0E09A9DC37437FC1), __ULL(0xA1A30426F4FC3C6B), __ULL(0xAAA4297E91AC86AF),
+  __ULL(0x40F539C409AC33DB), __ULL(0x600CA11B6261F965), __ULL(0x56C1D36E429C94BB),
+  __ULL(0xA3E186CFEE2CE84D), __ULL(0x720C93DBF1075723), __ULL(0x147909DEAD25BABD),
+  __ULL(0x7AAF7F8A45D4D593), __ULL(0xCF46E64166EA75B5), __ULL(0x89DC049DF1D4C64F),
+  __ULL(0xA9C7A86256FE7589), __ULL(0xA89E018FAF6BFF41), __ULL(0x86D94C0F0EF46E0D),
+  __ULL(0x3618AB92BE872B1F), __ULL(0x0EB9F31F80954759), __ULL(0xDED32CF9DE540C55),
+  __ULL(0x1142BB87988F61AB), __ULL(0xB0F1A44F1AB5E11B), __ULL(0xE8F10407BE5BCE97),
+  __ULL(0x28000E1AD17DD1FB), __ULL(0xC9318A0E4EB9CE15), __ULL(0x016235E659E3598D),
+  __ULL(0x200C8D76E60FE5AF), __ULL(0xC4F4D853F46957B1), __ULL(0x13DBC37EFC43D2A1),
+  __ULL(0x780143F4CDB0FA57), __ULL(0xD5D2907916A2A5B3), __ULL(0xAF0024F188DABF4D),
+  __ULL(0x780B0B4C5AB032A9), __ULL(0xA563DFC715057CB5), __ULL(0xE06A0F0E20FA8B73),
+  __ULL(0xFEA5F47C783E3195), __ULL(0xCAEAD910839E7E41), __ULL(0x312B11FA7FAE5879),
+  __ULL(0x7760C3EE335ADE69), __ULL(0x25025D87EC170253), __ULL(0x71290717B7B073E5),
+  __ULL(0x641A10B490CC3F11), __ULL(0x8FEF01FE6C926F3B), __ULL(0xBFC4CF92B8216049),
+  __ULL(0x7430763CB19A28AB), __ULL(0x1C14824F72D1AD3D), __ULL(0xD75496F66D1F71E1),
+  __ULL(0xA8B125A87ADBF4CF), __ULL(0xF3DB52F55E287DC1), __ULL(0x19055DD41FDB7777),
+  __ULL(0xBCA82112DDF67967), __ULL(0xB925E5FA85C48A43), __ULL(0x33E25D132408EE91),
+  __ULL(0xE303F091A0572DDD), __ULL(0x379A0A24E76AF6D5), __ULL(0x1887CC4A738DCC2B),
+  __ULL(0x80D286FA6C9B9337), __ULL(0x6CD44489355A8045), __ULL(0xE8C26FDB6FF5A1A9),
+  __ULL(0x39C20FB31233D161), __ULL(0x4B8EF49EDCBAD803), __ULL(0xC98331B1D3DCA125),
+  __ULL(0x57E84822D75BD389), __ULL(0x6E14CFBBA313DD3F), __ULL(0x5FEC982A3ECF2DEB),
+  __ULL(0xA48970A1E2EF1C0D), __ULL(0xDD85DAED68C0C2E3), __ULL(0x87664CF1EFB2167D),
+  __ULL(0x156401C5487080E7), __ULL(0x4F3E3D16946260D7), __ULL(0xD1EFBC62829DD63B),
+  __ULL(0x2CDB1F9909686D01), __ULL(0x2CF3EDBF306320A3), __ULL(0x6EE53E4E20C2BDF1),
+  __ULL(0x1F490BF542431929), __ULL(0x6E935917021D28DF), __ULL(0xC4648CC247CACDF3),
+  __ULL(0x4B51F1273FD25C15), __ULL(0xD95C7EC47AE9116B), __ULL(0x64D8D7F2968ED1FD),
+  __ULL(0x3AC09F4BA735C9BB), __ULL(0x6974060B49E41FBD), __ULL(0x9BE96C8613031C27),
+  __ULL(0x8F52BA65B63EE417), __ULL(0xF3186BD73DD2537B), __ULL(0x6708F8700F46029D),
+  __ULL(0xA324E2F68BED3DF7), __ULL(0x6B2499B4F5970FE7), __ULL(0xE487575B93ED5C75),
+  __ULL(0x460264C2D08371ED), __ULL(0x7FC29128E3D4FB0F), __ULL(0x24E160BB81061DC7),
+  __ULL(0x4144BF89158F6C01), __ULL(0x1C053708C2ED3A39), __ULL(0x38CD76EB8B46561B),
+  __ULL(0x818E0A74A1615BBF), __ULL(0x1D187D3B3C995E8D), __ULL(0xF81DF0D3CC059563),
+  __ULL(0xD4B483F7D3EE02AF), __ULL(0x132FB4D8539E8D4B), __ULL(0xC0578BB8B5134757),
+  __ULL(0x5F771507911E3BD9), __ULL(0x8BADE287DDAA9565), __ULL(0xB439C90E86F42AB3),
+  __ULL(0x2832A9B72B2C2B27), __ULL(0x447D56C034F7875F), __ULL(0xA9AC59CC51D5332D),
+  __ULL(0xB98857871E36B99D), __ULL(0xEE96F07A812FBBEB), __ULL(0xC01DA9648807AF21),
+  __ULL(0xA9DB35F627953ED7), __ULL(0x536CE0DB3F15EFCD), __ULL(0x0EF6816EBB758939),
+  __ULL(0x795B3A143E29F2A7), __ULL(0x56524040CD912EE1), __ULL(0xA3260C6069578A97),
+  __ULL(0xFC47910B2CBB82A5), __ULL(0xFE1026ECFFE2D51D), __ULL(0x65A900A2FA59C909),
+  __ULL(0x3B64AE6535DC4C63), __ULL(0x8CE9DB1AB28F2667), __ULL(0xAD1D65EB56C666F5),
+  __ULL(0x3636C6BD6BBD069F), __ULL(0xCCDFFBEE93B1D2DD), __ULL(0xF9B4B29734EDAA81),
+  __ULL(0x23BCC741EAE870B9), __ULL(0x36CD1FA57E60E96F), __ULL(0xE4A5E72CB96BC893),
+  __ULL(0x7BD37CD0B6C1465F), __ULL(0x5939E7B889F39625), __ULL(0x7404C87E129C9351),
+  __ULL(0xEB6331FB4FA35807), __ULL(0x523B6735F91EE089), __ULL(0x4C368594698B4D95),
+  __ULL(0x0F45D7AB2522512F), __ULL(0x484D1FFA3C5357CB), __ULL(0x81D9E2431EC59259),
+  __ULL(0x215F6C8F4E5E1C49), __ULL(0xBB4BA391655D65DF), __ULL(0x204619D25CCE70CF),
+  __ULL(0x48C980BC58A902D1), __ULL(0x9943055527E28C1D), __ULL(0x5024BE58F84FD2F3),
+  __ULL(0x1DC2678E351A3115), __ULL(0xEC93E78122392B6D), __ULL(0x0778E0641B71C86F),
+  __ULL(0x61C0F015C7129FB5), __ULL(0x91B06D4D3E28CD61), __ULL(0x5ADF18AF9C0FB117),
+  __ULL(0x11A62462F3806D99), __ULL(0xEB717D563338F941), __ULL(0xC9E99FFCD11B9EE3),
+  __ULL(0x706367D76BBD8231), __ULL(0x58247094D5E4315B), __ULL(0x61F14D0DC72036ED),
+  __ULL(0xC26AA7FB2D3B580F), __ULL(0x5AC95D2199B20433), __ULL(0x00160A9C2F2EB655),
+  __ULL(0xB2B0314144FA0FC5), __ULL(0x992709AF5B1577EF), __ULL(0x92C134CFF76C003D),
+  __ULL(0x39268D70D6C9ACAD), __ULL(0x6AD918A436F56F83), __ULL(0xC12EA5A625213BFB),
+  __ULL(0x83857FB1470ECE87), __ULL(0xA64A8D64E7792709), __ULL(0xF703FC892A8E2D6B),
+  __ULL(0x139E5B48D9640AF9), __ULL(0xFE4EE4F0001B11B1), __ULL(0xE07556F4492DC0D3),
+  __ULL(0xA4D7820D25AD74F5), __ULL(0xE5EDDDDC103EA78F), __ULL(0xF31D7C648477287F),
+  __ULL(0xAEFC23A9DD1D7E37), __ULL(0x788595B0653B1E9B), __ULL(0x02049394FC90782D),
+  __ULL(0x53B23CA2E2215151), __ULL(0xFAF6D83C0F5EF607), __ULL(0x61F4C8F9131D90EB),
+  __ULL(0xCB4CA22230862D05), __ULL(0x8190768EE390D85B), __ULL(0xB799367814B47869),
+  __ULL(0x3D9B09A1549AD8C3), __ULL(0xB26074DE7FB359C7), __ULL(0xF171522AC55474CD),
+  __ULL(0xB731C8D779FA7639), __ULL(0x1E7DCB1B681F33A3), __ULL(0x8B496355A502773D),
+  __ULL(0x089DAD0C451C8419), __ULL(0xD2A3EBA13EFBAECF), __ULL(0xC52B0BEC36D680F3),
+  __ULL(0xB97FD51FCF0777C1), __ULL(0xDEB6CA61A02FB0B1), __ULL(0x3188EB67C2BF5443),
+  __ULL(0x70B46EC3530BC68F), __ULL(0x4BC3120698B7A781), __ULL(0xEF94E30D28DE762B),
+  __ULL(0xAAA1B71BAFD4AD37), __ULL(0xDC62143DF88B8F17), __ULL(0xB1DE59B5D9B6B051),
+  __ULL(0x31A6EFC49923ED89), __ULL(0xDE0751C002EED73F), __ULL(0xC5FEA01451B8D7EB),
+  __ULL(0xB60A3937B4A70179), __ULL(0x0FE54CC846D56E2F), __ULL(0x4178637CD2EEFF75),
+  __ULL(0xF2A31D3E6E8D6CCB), __ULL(0x184EB704CACD535D), __ULL(0x7712D55BBF98A949),
+  __ULL(0x30306CAADF19B233), __ULL(0xA57473987A92DDC5), __ULL(0x202D5BE678F62EA7),
+  __ULL(0x86D3F32C6DCBA2DF), __ULL(0xE97E8066CB5B1319), __ULL(0x4097A7463ED61FD1),
+  __ULL(0x98B461C2E05AD7F3), __ULL(0x955CB639DB8C0615), __ULL(0xE8D0F5DDD248F6C1),
+  __ULL(0x5EB0EBCECEE14077), __ULL(0x0ED5C8D90F3BA8F9), __ULL(0x26C7D32E10D712DB),
+  __ULL(0xEC86B5150CEB67D5), __ULL(0x9ED8A30DDE31774D), __ULL(0x6135715358554771),
+  __ULL(0xA68CA78BAF2EE9BD), __ULL(0xBDAE45695E0A2493), __ULL(0x77E1DBCE923E3225),
+  __ULL(0xD750008542C45D4F), __ULL(0x49CC07FCB8CC563F), __ULL(0x0A2854BEF38F57F7),
+  __ULL(0xAF4CF4401CB6C3E3), __ULL(0xAF40B00518F5FB05), __ULL(0xEA6B4B1C4F0469E7),
+  __ULL(0x0C1E626B0576FBED), __ULL(0xCA25F9B992133711), __ULL(0x79CD18F1D94E8933),
+  __ULL(0xF0475977492914EF), __ULL(0x566EAFD9AE49401B), __ULL(0xF6E6FF658226B013),
+  __ULL(0x56699384741FF1AD), __ULL(0x5544303EF1F7DF63), __ULL(0x636C94C44ED43CAF),
+  __ULL(0x7563C743E2D792FD), __ULL(0x040E54FE877AF167), __ULL(0x34EBF70256A189A1),
+  __ULL(0x0987B878D610E5DD), __ULL(0xFAE7F0EE8121257F), __ULL(0xB242D79DCCFF7D23),
+  __ULL(0xE24DD4A3D6C66671), __ULL(0xBC4BAC342E8ABBB5), __ULL(0x71654D7072116307),
+  __ULL(0xBDC9DD7B7FE165EB), __ULL(0xA358255EABE606F7), __ULL(0x244BE32378382C2F),
+  __ULL(0x825DA2FBA7E03DC3), __ULL(0xA0561E586DD10E3B), __ULL(0x13F73FE7A21846C7),
+  __ULL(0x80027A3C3F2664FF), __ULL(0xA049A91874F04CA7), __ULL(0xE670232C9E76FF35),
+  __ULL(0x421A4F4397752497), __ULL(0x97F641B738C08BCF), __ULL(0x3FC4357A19F71F1D),
+  __ULL(0xB7ECE285B0AABF8D), __ULL(0xB00F596C85398DB1), __ULL(0x752323FA34DFFCE9),
+  __ULL(0x65B1D56F6B35BE4B), __ULL(0xFDB5AA7F4BA7238F), __ULL(0xE72F212F31A6AE47),
+  __ULL(0x184CFDADE1001F45), __ULL(0x805CF8C180A3BA9B), __ULL(0x3C83C366D897D7BD),
+  __ULL(0x4E6A319EDA91C05F), __ULL(0xA366CA1551E80861), __ULL(0x49E53C37B02E5C17),
+  __ULL(0x475A499EB7C2CD51), __ULL(0x811504E9AEFE3207), __ULL(0x8286D429E40AF795),
+  __ULL(0x298C6E8C45762B0D), __ULL(0xCEEC0B45786C31E3), __ULL(0x661E6F4DA0968B2F),
+  __ULL(0x4730CAF274C19475), __ULL(0x4DDC1BED8F953649), __ULL(0x5A30A7129F0F6401),
+  __ULL(0x19F00B95B63FD4F1), __ULL(0x1F4FF2FC5B12F38B), __ULL(0x2BAF093056C74283),
+  __ULL(0xD007E35DF5BE2ACF), __ULL(0x00AC144E6F32D61D), __ULL(0xDC8A079D41E615F9),
+  __ULL(0x704893F89A9FFC85), __ULL(0xB22A79D3598CBF9F), __ULL(0xC558D88780E2B56D),
+  __ULL(0x9AE04E5CABD6BF57), __ULL(0x2DB85154C333237F), __ULL(0x72DAAC55E7ECA327),
+  __ULL(0x14EAF2B9AAE2C9B5), __ULL(0x4C1982E1E948F70B), __ULL(0x45B02EDF1CB03A4F),
+  __ULL(0x2EEBDB6D7B1F4873), __ULL(0xC0181704A358D33F), __ULL(0x05506660854DF341),
+  __ULL(0x4EEBD87EA6C816E7), __ULL(0xCB8DE063C3FE2369), __ULL(0x757C6D675E1988CB),
+  __ULL(0x31937DF6BBC9FB59), __ULL(0x28816C91B5DED411), __ULL(0x5D962BA242B16055),
+  __ULL(0xBE4B6CC49B486301), __ULL(0x71A0E7377E48CA3D), __ULL(0x106ACD02E1EF0297),
+  __ULL(0xE72137B3B408BAA5), __ULL(0x144990FD24C39BD1), __ULL(0xE149E4EB8A652215),
+  __ULL(0xC4680263CD3A77FD), __ULL(0xA0DD75DAABA64AD3), __ULL(0xD22C9E518C64C6A1),
+  __ULL(0x63A1CE5D64F3B227), __ULL(0x0CFCA193CDC73E5F), __ULL(0xD66CEA7A15B5022D),
+  __ULL(0x3D8CD40692335699), __ULL(0xABFCBAAFC57B3AEB), __ULL(0x4F8FD453D2EF25D7),
+  __ULL(0x341F3B3D578BA2C3), __ULL(0xB3A76D3F5D7E47E5), __ULL(0x4685131D5BE6B311),
+  __ULL(0xBF234CEF4D507DA3), __ULL(0x7150B84CDE2079A7), __ULL(0xDBA6D62E8784018B),
+  __ULL(0xADA96326B740F197), __ULL(0x7DD8EAB9E83761A5), __ULL(0xB197B040A09B8CFB),
+  __ULL(0x9A8A57AEA67A8AF3), __ULL(0xE570642DB79BAB77), __ULL(0xFB2AFBC973756AB1),
+  __ULL(0x20DE87DC469D55DB), __ULL(0x94DD94B1EFBF3D9F), __ULL(0x7881370B8E90808F),
+  __ULL(0xB6649A6B3D81A181), __ULL(0x19DB532F3405C737), __ULL(0xFE3BED685230C06F),
+  __ULL(0x5F940B12B8E03CBD), __ULL(0xED21CEF7A272C561), __ULL(0xB08C3D798B5D407B),
+  __ULL(0x5215B56CA689CC95), __ULL(0x972DB3B08081D13F), __ULL(0xA8C4D543E2E29D5D),
+  __ULL(0xC38B061EDC53C349), __ULL(0x8537B6143760BC33), __ULL(0x763FE773162455CD),
+  __ULL(0x14AAF28561D5888B), __ULL(0x47CA93D115EB07CF), __ULL(0x859637E970754687),
+  __ULL(0x0755D4E14F02E1F3), __ULL(0xBCCF07C128F8656B), __ULL(0x5F53DF7CD896FCDB),
+  __ULL(0xC4F88A2FB90644A1), __ULL(0x08B1965BBDE34265), __ULL(0x78C8D76436B69DBB),
+  __ULL(0xE4B2389A10B7EA47), __ULL(0x300C2389E5B411D5), __ULL(0xB6A3094215F386B9),
+  __ULL(0xD8CC504BE8CF9F6F), __ULL(0xCB51DA62B47A0171), __ULL(0xDFA8C5AA96E1B3BD),
+  __ULL(0x7022C76A4F648C0B), __ULL(0x507A57891D6A174F), __ULL(0x2213996EA3A5277B),
+  __ULL(0x3AA7183186B37041), __ULL(0xC32BEE0CCE2971F7), __ULL(0x395A3A9C1697DC1F),
+  __ULL(0x65678311515285ED), __ULL(0x316815A93E3690C3), __ULL(0x4B16C32A37B3D45D),
+  __ULL(0x270FC18063FF6001), __ULL(0xCC2103B7B2ACAEC5), __ULL(0xAA69A7025AB6E3E1),
+  __ULL(0x3D3C7B1F27AB5AFB), __ULL(0x95A11835C6714E09), __ULL(0xFE2D847A3CAB4FBF),
+  __ULL(0xB629420765F276AF), __ULL(0x43635B9301AA4B67), __ULL(0x07F84465E60B8FD3),
+  __ULL(0x0FE98D9BBFFA03A1), __ULL(0x44F3FA641A002FDD), __ULL(0x56FB055D8ADBC9C9),
+  __ULL(0x35E7A7480983B3A9), __ULL(0xE6EBCF0344CAE5B5), __ULL(0x7A8B6E2F0A865A03),
+  __ULL(0x160F0BC7798B4D9D), __ULL(0x3AD7E5DDE3D03D07), __ULL(0x13A3FFE025A05A95),
+  __ULL(0x7CF6377D7D8D7979), __ULL(0xB4D2C228AC09DF69), __ULL(0x0B1F2D538F3A5B53),
+  __ULL(0x7E7E19D8C6AB1B1F), __ULL(0xC0282CE6236A1CED), __ULL(0xDAB03365C84A5011),
+  __ULL(0x182E796ACC33783B), __ULL(0x9D291706CA107C55), __ULL(0x6878C7C6E9EC03CD),
+  __ULL(0xB885ADB94C6222A3), __ULL(0xF4E469EC97462DEF), __ULL(0xDFD0843800726FF1),
+  __ULL(0xAA4607563917D113), __ULL(0x2A399EA4B7D78B19), __ULL(0x42E15873B1B445CF),
+  __ULL(0xBEA171CF6773691D), __ULL(0x180AF6CDA69CEEC1), __ULL(0x0F134264ED5C4ADB),
+  __ULL(0x9F7119EEBEA066DD), __ULL(0x8B0CE2EA0F719FD5), __ULL(0x4D19FBB4197B5437),
+  __ULL(0x278C458D06E08945), __ULL(0x3993B35CDA155E2D), __ULL(0x194AE6826D855103),
+  __ULL(0xD69BC7E995B36A25), __ULL(0xD9865DBB9ED10C07), __ULL(0x642F348A4D5C56EB),
+  __ULL(0xE69B18E18E32350D), __ULL(0x49B31E7BF9BFABCB), __ULL(0x03CAB7615C02E3E5),
+  __ULL(0xB91BD631470D4133), __ULL(0xB6DA13057FC32BB7), __ULL(0xD10716DF4AF2781B),
+  __ULL(0x3AF01B23392E1D8B), __ULL(0x4A068C9092B81A19), __ULL(0xF52C3A4795E5E4CF),
+  __ULL(0xAA984090D10976D1), __ULL(0x4215A807F0133A6B), __ULL(0x13F0F07A29466777),
+  __ULL(0xDC7AC27DA1856685), __ULL(0x5EB1A71B1BEBFA43), __ULL(0x15860C136CC027C9),
+  __ULL(0x952FA715339766D5), __ULL(0xE5DDD2F1DD9A3C2B), __ULL(0x1606A8328C8F73B9),
+  __ULL(0xB8F5D7BA42293523), __ULL(0x34A6358119175E71), __ULL(0x7B84E94F56A218BD),
+  __ULL(0xAD62029EADB57393), __ULL(0xDE13963BC4CF2199), __ULL(0xF8E9A1A522F1F44F),
+  __ULL(0x317273512CA0DC7B), __ULL(0x38AD31C1D2D55273), __ULL(0x27580E98EA648C0D),
+  __ULL(0xC7DE89FBCFACF631), __ULL(0x3CBC099AC26970E7), __ULL(0xAF30EFDAFC62BEC7),
+  __ULL(0x19B606BC6CC85D01), __ULL(0x634779B29B0BDB39), __ULL(0x96BDA364D9F918DF),
+  __ULL(0x0D1CC1A365FCA0E1), __ULL(0xCA28E71323C90383), __ULL(0x270D63A1A823D5D1),
+  __ULL(0xD506AE7AE3A9BEF9), __ULL(0x02DA759995D685B1), __ULL(0x8CF09D39CA4E41FD),
+  __ULL(0x72254260174C39BB), __ULL(0x212C7A778AFD56C9), __ULL(0x5E7B73B9F2E5C3B3),
+  __ULL(0x284C8FE70CCFB237), __ULL(0xE718A411A1240C27), __ULL(0x7D569EF0BD37B85F),
+  __ULL(0xBC92C8147BC18C2D), __ULL(0xE83B3222668AB099), __ULL(0x708A50CD5F30934F),
+  __ULL(0x9AF87E382EDCAA07), __ULL(0x7D10EE7858A82DF7), __ULL(0x2C3BFCFF366D7D7D),
+  __ULL(0x88281587FAC6A053), __ULL(0x84D14D06C146E021), __ULL(0x7BC65429F42CE1ED),
+  __ULL(0x661C0DA46BCBBFD7), __ULL(0xA077431A6E1FED11), __ULL(0xCD423199E208D155),
+  __ULL(0x77BD9BB156EF5BFF), __ULL(0x82821CAF53DDCAEF), __ULL(0xB3330B44406B3E35),
+  __ULL(0x9F5CCFAA8197DFE1), __ULL(0x096375B35E672B8B), __ULL(0x2E0AE78D9E528B97),
+  __ULL(0x0FB8C873343694F3), __ULL(0x8E0B5B72B8F73485), __ULL(0xCF4A3AF6930C8767),
+  __ULL(0xF81BB287B33C63E9), __ULL(0x28A9041E4B5EFD4B), __ULL(0x96A11F163E3F2BD9),
+  __ULL(0x1985354296BD0BDD), __ULL(0x8D96F0E6828E199B), __ULL(0xA61E509DF414A193),
+  __ULL(0x5846C810DB7C5F25), __ULL(0xFD3CDF3C5FCC2189), __ULL(0x1150DFD6A1942BEB),
+  __ULL(0xE47EB2BC08473A0D), __ULL(0xBF137C2C8A6DA0E3), __ULL(0xA955788A49863431),
+  __ULL(0x8159905BEC83747D), __ULL(0xF2CA517426E39F21), __ULL(0x67A588FA0D4758E5),
+  __ULL(0x3F3FEC35D0CB0A0F), __ULL(0xC47453A34AED143B), __ULL(0x9E13938338A65AFF),
+  __ULL(0x6F83400D91FEEBF1), __ULL(0x8075069B0FC5C719), __ULL(0x31E37BCB918AF183),
+  __ULL(0x51F9D689708E451D), __ULL(0x9E482D8F83C2EBF3), __ULL(0x69A05B968B040F6B),
+  __ULL(0x66FF639AB22EE6DB), __ULL(0x1454FB05D91702D3), __ULL(0xEC82EC70591ABEA1),
+  __ULL(0xC77C38066E902C65), __ULL(0xFD05407A9CB5C447), __ULL(0xBB4874EAADE38B4D),
+  __ULL(0x94CB9290F0F3DA23), __ULL(0x5AE7C3F2B0A42A27), __ULL(0xDD1AFF22F47608B5),
+  __ULL(0x797A08390A5DB60B), __ULL(0x76A0C2243B85B217), __ULL(0x94C1A014AB37CE99),
+  __ULL(0xFA0D2A0210346A41), __ULL(0x52E5F21CFDF7910D), __ULL(0x38908480AA9F57E3),
+  __ULL(0x728B00AB5CB7FA5B), __ULL(0x848FB8E60ADD8A69), __ULL(0x8D9182EBCBEEDA75),
+  __ULL(0x96CC3E31602D561F), __ULL(0x3EA52930D5A3C7CB), __ULL(0x5BB7E380AD968259),
+  __ULL(0xF10245854FB5ABC7), __ULL(0xFE049119F5FC9D33), __ULL(0x1532822BE99DB4AB),
+  __ULL(0xAD0994D70AEB18C5), __ULL(0x47E08EB817BD05AD), __ULL(0x55261BA2915EA115),
+  __ULL(0x119D441807F02BF9), __ULL(0x5B7BADE767A47363), __ULL(0xFDC1DD8C2F4262B1),
+  __ULL(0xDA19DBEC1DA55DF5), __ULL(0xB3321F96D6BB6EBB), __ULL(0xD2549D6A296FDA71),
+  __ULL(0x1C3A47C388D2679B), __ULL(0x9D2B48AF20E64DA9), __ULL(0xE52C98FFB1AA2403),
+  __ULL(0xD404C65C2651979D), __ULL(0x1E8EECDF9206AE73), __ULL(0xEB55B68FFC10E941),
+  __ULL(0x394A0DA885AE5379), __ULL(0xC19406E1E903B605), __ULL(0x26985AB0D660A02F),
+  __ULL(0x58F83FEBAB0D627D), __ULL(0xB01376D0F6B4951F), __ULL(0x2AB8372B84370CD7),
+  __ULL(0x735A12D22B678A11), __ULL(0x296767AE35D7FAC7), __ULL(0xF669B70D5C0E58FF),
+  __ULL(0xEC376DFDC90367EF), __ULL(0xF0C1889F1B83703D), __ULL(0xF08D33A6FEB9C08B),
+  __ULL(0x37CBFA606C28E519), __ULL(0x4AAE8F0C0A8D40A5), __ULL(0x84705E9A100ED38D),
+  __ULL(0xB0B4A81ABAF4E985), __ULL(0x51982CE403D93467), __ULL(0x76A0967D365F30E9),
+  __ULL(0x3FC0EA5E53FB326D), __ULL(0xDEDC83932BAB4D43), __ULL(0x9B384150C120978F),
+  __ULL(0x19AF23EB1D1D8E9B), __ULL(0x15EC707E81556BBD), __ULL(0x6B162E451FED1B03),
+  __ULL(0xB65129366D674151), __ULL(0x6D04EE46391B2E89), __ULL(0x136A8F52E197483F),
+  __ULL(0x5784453522282279), __ULL(0x72AC458742CB1131), __ULL(0x75A4544B6DD63BE7),
+  __ULL(0xD4DA135BB8F9D5CB), __ULL(0x0ECF63A52C95CDE5), __ULL(0xA57BC84163784B33),
+  __ULL(0xD7BB1A6E7391E4CD), __ULL(0x5A602D831D82A3A3), __ULL(0xA9014D7D4A5F5A35),
+  __ULL(0x2B232FCB31757419), __ULL(0xDB4965984842D683), __ULL(0x8BB2441D82878D87),
+  __ULL(0x7A6A579B236BF0F3), __ULL(0x3FF4F963586714FD), __ULL(0x06A86CF32743B39F),
+  __ULL(0x1DC081938C75A165), __ULL(0x41756415885C10D5), __ULL(0x8B6038C37E2B766F),
+  __ULL(0xF36CD384EE9D5727), __ULL(0x722100537B427B99), __ULL(0xE8F139103C39059D),
+  __ULL(0x171F576C544FE741), __ULL(0x5B3B8D44DAA198F7), __ULL(0x5C8C9B4B8B82CAE7),
+  __ULL(0xA7EBDE7CEB0ED4ED), __ULL(0xEEA9595971AEB455), __ULL(0x1624F3DDA99074B7),
+  __ULL(0xB1653D53FE21891B), __ULL(0x1328DE345B9C8913), __ULL(0x4AF968EAAB4C0FD1),
+  __ULL(0x7275425C03615C87), __ULL(0x1A476BB2C6BB7509), __ULL(0xEB09D33499592B6B),
+  __ULL(0xCA4E3857EE65167F), __ULL(0x99F3E831085EE74D), __ULL(0x6776D18F221CCC37),
+  __ULL(0xB067562DC220B623), __ULL(0x40D53D6E2A05DC9B), __ULL(0xE1876CB876FBD20B),
+  __ULL(0xF51C118FB0B3FF51), __ULL(0xA0866CC5BFB2B373), __ULL(0xD81FE7AEB4B26641),
+  __ULL(0x6D3124DFCCF14669), __ULL(0x693891010ABE521F), __ULL(0x967477CC8A3536C3),
+  __ULL(0x2B0FD198C7F77B55), __ULL(0x1EC47B4E2204D53D), __ULL(0xF6045CC6458D2DA7),
+  __ULL(0xD7E85BB33910D81D), __ULL(0x73E53024905A2409), __ULL(0x92B4FD6BD00A9EF3),
+  __ULL(0x2AFE9BAFEB3BDF77), __ULL(0xC440B5839EBC9E85), __ULL(0x4964FB010D03E167),
+  __ULL(0x3835658D1803FDE9), __ULL(0x67DF451AF2C379F5), __ULL(0xC40620490B3FB243),
+  __ULL(0x8ECB3FAD03F5D691), __ULL(0xC92E1DC243ED9581), __ULL(0x3CEC28E380E0742B),
+  __ULL(0x17AD1D97A4DC2845), __ULL(0xF3E97723A005D0BD), __ULL(0xFFE8000BFFFA0003),
+  __ULL(0xDDF78E0194CFC53F), __ULL(0x0EC937F3DDDF440D), __ULL(0xF6DAA02489818F79),
+  __ULL(0x70D4CA481EA8CD59), __ULL(0x79FBA8BCF059C40F), __ULL(0x7BF949655F385501),
+  __ULL(0xD577833E08AA69CD), __ULL(0x98837CDCF276D2B7), __ULL(0xE1F8F2FAD96848A3),
+  __ULL(0x3ACD1ED0BEBA1BC5), __ULL(0xCCFC16D84D4DA5F1), __ULL(0x5086F0C359B58129),
+  __ULL(0x83B5B8A6DD488585), __ULL(0xC4EE0810AAC78CD3), __ULL(0x7C95B802A8E8B591),
+  __ULL(0x79B2A5CC619771BB), __ULL(0xD3659B2266AF3AB9), __ULL(0xFC0C9C185B6A32B5),
+  __ULL(0xDF113114EE8D4C17), __ULL(0x2403908FFC5D8B4F), __ULL(0x9E1C0E8EF095EA89),
+  __ULL(0xA09B3850A3536173), __ULL(0x0FFB6F71BFFD6441), __ULL(0x733AE01A448B9B0D),
+  __ULL(0xCC0BB5AB1079E45B), __ULL(0x494FFCBDBC1C77E7), __ULL(0xD78F95C6A9EA0475),
+  __ULL(0x73265239C686E511), __ULL(0xC809D0FFF88E685D), __ULL(0x2FB9F20E7A77A733),
+  __ULL(0xCC8F79927E170955), __ULL(0x71BD067B321CA239), __ULL(0x3A93A38E4377C33D),
+  __ULL(0xFF830DA904B94E13), __ULL(0xC393A773557A0397), __ULL(0x9BFAC622E002C987),
+  __ULL(0xC927037176AD8209), __ULL(0xFEA4440E5F71868D), __ULL(0x644EF38D28D6EAAF),
+  __ULL(0xECC83B76C270FF67), __ULL(0xA700F21AB35CA3D3), __ULL(0x7BE25239D082F7A1),
+  __ULL(0x87EA53EA7D7F354B), __ULL(0x0C7CBBB6E2A3137F), __ULL(0x3BA1AB7CDB195B23),
+  __ULL(0xF7669AE9BE2F519B), __ULL(0xA8E8CC3F9C4339B5), __ULL(0xA7E27C41724CB799),
+  __ULL(0x94A054B1C065EE03), __ULL(0x5CD428248D6A2A4F), __ULL(0xCE13238719AFAE95),
+  __ULL(0x7CA733029EED1369), __ULL(0x6A100BC0FF119721), __ULL(0x28B774C6E307A6D7),
+  __ULL(0xE05ADD2829DE9BC3), __ULL(0x736CDC9A72A090E5), __ULL(0xE682F81E644CC411),
+  __ULL(0x877EE901C36BD4C7), __ULL(0xC15AB0CD71605549), __ULL(0x57E8BE15246217CD),
+  __ULL(0x46642584D58BC2BF), __ULL(0xE9414D89C49CDD8D), __ULL(0x2523742B68F41EDB),
+  __ULL(0x21AE439D806B0EF5), __ULL(0x0307373A755AEE9F), __ULL(0x319EF61028E0BC6D),
+  __ULL(0xCB47DDA631359281), __ULL(0x70024DC377F67661), __ULL(0xF92715E99EF6722D),
+  __ULL(0x961B9CCE833FAAEB), __ULL(0x55C4CAA7A8C50FE3), __ULL(0x7A32A9A385EACB31),
+  __ULL(0xCF8B90D5D0CB237D), __ULL(0x48C0058596858653), __ULL(0x91674837FC4615D7),
+  __ULL(0xBA35A2E763ADB33B), __ULL(0xFF69E4DAF93ED65D), __ULL(0xA0B29A4FC56A8449),
+  __ULL(0xBD360D8D51BB51FF), __ULL(0xB2AB6AE3EABCEECD), __ULL(0x2733A09D8AC04C1B),
+  __ULL(0x0370986E946C718B), __ULL(0x4A42FB379E64A083), __ULL(0xF91316E3456EA3F9),
+  __ULL(0xC72F36245CC83A85), __ULL(0xDFB66228C44BA8AF), __ULL(0x0118737E4E1BB9E9),
+  __ULL(0x6B6A5F2EFBE075A1), __ULL(0xB353A3D284DA8D57), __ULL(0x7913B49E2BF98E43),
+  __ULL(0xEA170E73AC0D5291), __ULL(0x1FC92EBBC537C923), __ULL(0x370D9B12362EB06F),
+  __ULL(0x3D409BC79F188793), __ULL(0x3E407951CC4347B5), __ULL(0xB17ED72E884E1917),
+  __ULL(0x75458588187EF789), __ULL(0x2B506E7FF38CA00D), __ULL(0xA4F1C8FB76BC6A31),
+  __ULL(0xC58A0F9079F406CB), __ULL(0xC336FCC7EA2E5EED), __ULL(0xE5C7E4254C950959),
+  __ULL(0xF033AB79F4A60D5D), __ULL(0xAB33358A6D295E55), __ULL(0xE9EF9497CF3B8F39),
+  __ULL(0x3955EF5B0A98731B), __ULL(0x3370E0FE220FD097), __ULL(0x0C230D547EFC9783),
+  __ULL(0x9C22F459B41EE3FB), __ULL(0x4CC26DE1A24CD56B), __ULL(0xEF04BD7E923307AF),
+  __ULL(0xD4E3B1E9618DAC67), __ULL(0xAA17B5F59C321CF5), __ULL(0x4BAF36B4F725B265),
+  __ULL(0x0234A6AC5C7D68DD), __ULL(0xDD065D6473CF107F), __ULL(0x9E004EBFFCB80023),
+  __ULL(0xF8C01EFADB8934A9), __ULL(0x23C6A0611E40AC5F), __ULL(0xCE42CEF041DCFC0B),
+  __ULL(0xC3EEA056299CD303), __ULL(0xFDDDA907903A5E07), __ULL(0xB8DFC072B89CBD73),
+  __ULL(0xF49417C69E91F72F), __ULL(0xCF0CC492EF89117D), __ULL(0x22FDAFF5E88E2555),
+  __ULL(0x636472F6EA709CCD), __ULL(0x5B40BF8C0DD59F3D), __ULL(0x5398FE58FB13AA13),
+  __ULL(0x4D44578964A33FBF), __ULL(0x787F228059535FC1), __ULL(0x7BA9BFE2977FF977),
+  __ULL(0x670FB7D8EDBD9963), __ULL(0xCAA718EA59F698B1), __ULL(0xEE6B3343760113DB),
+  __ULL(0xC26EE9779FE7DFD9), __ULL(0x1DFDF2E35863AEB3), __ULL(0x44A683EB091248D5),
+  __ULL(0x65BD98C0A6691537), __ULL(0x94779A5D0FA09245), __ULL(0x68786404248F9851),
+  __ULL(0x065C01F80B8ABF3F), __ULL(0x03508A60652E34E3), __ULL(0xCA3AE0920E66562F),
+  __ULL(0xD31C4BD36D589321), __ULL(0x3F2AEB8B14F72759), __ULL(0x4BF6CC640ABD2CE5),
+  __ULL(0xB709827028C5DA33), __ULL(0x0F3687DC57C973CD), __ULL(0x36D839FAD079ECB7),
+  __ULL(0x2EA0673163645FF1), __ULL(0x9B29B905AFA61B29), __ULL(0x9E8975C5A7359935),
+  __ULL(0x42F44607FBB58ADF), __ULL(0x227FD9B6B64707D1), __ULL(0x702C23DBB0C4DEC1),
+  __ULL(0xBAF134B7E411EF85), __ULL(0x5ADB6997179016D3), __ULL(0xB6FB62179317186D),
+  __ULL(0xE48E3720294BDBBB), __ULL(0xE926C2CA62D7E8C9), __ULL(0x1E738D454D8D0E7F),
+  __ULL(0x60EBC6A7912E8299), __ULL(0xCB53A42E92B5657B), __ULL(0x33DC98B5B8AA0489),
+  __ULL(0x9902A93DCD383E3F), __ULL(0x755B83000A13CE5B), __ULL(0x15AC88097D8D2E75),
+  __ULL(0xA566C07C1E5523ED), __ULL(0xDFF4ABA128E81F11), __ULL(0x7746A6E20B17B25D),
+  __ULL(0xF08E780233C34E01), __ULL(0x6D65F0CDD8C4E81B), __ULL(0xB5F499CB56C08D3D),
+  __ULL(0xC0F3F807242649DF), __ULL(0x2DA27C50C0706DA5), __ULL(0xC103989D667E3DBF),
+  __ULL(0x5A64FED9A3DDDFF9), __ULL(0x16E758D406A92DD3), __ULL(0xBAAF2E6352D35F4B),
+  __ULL(0xFB283FFCC57FFDD9), __ULL(0x2CB5298357D72765), __ULL(0xCAA0910BF36D5CB3),
+  __ULL(0xF608A92F18D58D81), __ULL(0x13CB2664E4FCA523), __ULL(0xFC3D1967E0F81199),
+  __ULL(0xC38EAE080BDCCB07), __ULL(0x398683DE68B35895), __ULL(0x089BF638BC180DEB),
+  __ULL(0x95F24045176E6EF7), __ULL(0xA3EE93379A22755B), __ULL(0xE208D6DEED8B6F49),
+  __ULL(0x898FE460C9D87A55), __ULL(0x250034EAD7D64CFF), __ULL(0xD80387CE8743CFAB),
+  __ULL(0xA737F32CFAE0CB39), __ULL(0x0B65E3BB2D269DF1), __ULL(0xD6263E73BC9FA735),
+  __ULL(0xE35A9F06D39B8C97), __ULL(0x7CB2E2C2B3E114A5), __ULL(0x705208500628BCBF),
+  __ULL(0x297ABCAA6712E78D), __ULL(0x5315FE40172E1647), __ULL(0xF812686B48639DD5),
+  __ULL(0x2A331B869EFB8C81), __ULL(0x079A71C6CB52A237), __ULL(0x870EF0DEA8F7629B),
+  __ULL(0x41248D6618937A93), __ULL(0x74188F42BCC2FC2D), __ULL(0x5E0C568873D6530D),
+  __ULL(0xC3D342788CBD59E3), __ULL(0x2C9E709EC602D021), __ULL(0x5C6CC1E0A87629CB),
+  __ULL(0x0F224EFFCE33A1E5), __ULL(0xF1B138AB72C19E49), __ULL(0x48058DE1FEFD37A3),
+  __ULL(0xE0D0797A1234BAC5), __ULL(0x8D76C1AFD26B361B), __ULL(0x861C5FEE0DABC3A7),
+  __ULL(0xB2EC074D7E83FE1D), __ULL(0x8C28ADF28FEE8315), __ULL(0x721B374AB542386B),
+  __ULL(0x735F6EA15B017DF9), __ULL(0x5A53C1BEC31D5BD3), __ULL(0xDEED944AA898DD6D),
+  __ULL(0xF1486BE465212757), __ULL(0x6107BE3DD8645843), __ULL(0x453737F059FD6547),
+  __ULL(0xE7492120BAA31323), __ULL(0x5234D71ABDC676BD), __ULL(0x033616831EB371B5),
+  __ULL(0x8F96042C28ED999D), __ULL(0x85FBC8BD7B34BB3F), __ULL(0xF74F020A9C71DB41),
+  __ULL(0x07AAB94CBDA5CCF7), __ULL(0xF84DB7565E7DC375), __ULL(0x9E3B4BF9C94230CB),
+  __ULL(0xAD3A5EFBC835E8ED), __ULL(0x4EE638B507964CC7), __ULL(0x347F00B672F84B01),
+  __ULL(0x3F1A956D7D1621C5), __ULL(0xB05E4A3814CF99EF), __ULL(0x7440721960F062A5),
+  __ULL(0x6336927C64F7BABF), __ULL(0xEDABA94FC4132C63), __ULL(0x02F02F301BC89657),
+  __ULL(0x0840844C012B2AD9), __ULL(0xD4CB4AC12F02498F), __ULL(0x96EC7C22479177BB),
+  __ULL(0x77D8E5CF08B0A4C9), __ULL(0x37B046C6F79F0037), __ULL(0x288E5F966BB49545),
+  __ULL(0xE6B0F9411AFFCEA9), __ULL(0x899EF0292316260B), __ULL(0x00358C5975BC9D03),
+  __ULL(0x7A75CC56B8E1C14F), __ULL(0x54FA3D1CCB9EC773), __ULL(0xA012206A1EB2DB7D),
+  __ULL(0x8E08DFD9D1B1461F), __ULL(0x3A2B27AFA6318DD7), __ULL(0xB5AAE09BAAF9EFE5),
+  __ULL(0x810928F133CCCF55), __ULL(0x546454F2669B49FF), __ULL(0xDFB003F48D39B839),
+  __ULL(0x8B7EFF72042F3413), __ULL(0x6D9B5A309B074619), __ULL(0xF98CEB14DFE250CF),
+  __ULL(0xC9F46B55438934FB), __ULL(0x04735A775C065809), __ULL(0xB299F9623ABC1377),
+  __ULL(0xC33A96A17D5A9567), __ULL(0x603D3EE2A7AB31E9), __ULL(0xF341BA86B9AD259F),
+  __ULL(0x774A5D2CF7037B4B), __ULL(0x3955FF9828D3688F), __ULL(0xCEE6DB3D9F99C82B),
+  __ULL(0x4FC7A2C68E7A2F37), __ULL(0xBC3C86200EE53F93), __ULL(0xB88BC96527A0E55F),
+  __ULL(0x7E5534295380412D), __ULL(0xB3CE5212A4B9D251), __ULL(0xD49599E03892E87B),
+  __ULL(0x5C3EA25121909CE7), __ULL(0x780E7B3BE38A5553), __ULL(0x899D9B65DD7F0D21),
+  __ULL(0xCF07A0AF258C3ECB), __ULL(0x7E7E71D975B416E5), __ULL(0x4EF68C695F1F380F),
+  __ULL(0xB38F60CDCAD07DCD), __ULL(0x6626E840A346EFC5), __ULL(0xDFBECD69F931AB1B),
+  __ULL(0x71E15CFC74ABC335), __ULL(0x0E591CFF1961D519), __ULL(0x33B644EAA443231D),
+  __ULL(0x572588851681C277), __ULL(0x6F916CB71F0D8DFD), __ULL(0x378AFB8E8986EA65),
+  __ULL(0xBD8E2D6C18DCE971), __ULL(0xA9733C0E0DBCDBBD), __ULL(0x143A4280D5F5DC99),
+  __ULL(0xF351EB5A52675841), __ULL(0x7D7902DB41F035E3), __ULL(0xA22C3507FB150131),
+  __ULL(0x0EBB41463985B85B), __ULL(0xFD3E5AA16ABD570F), __ULL(0x94BAFA7B7F08FC5D),
+  __ULL(0x003A6D14E4C535B7), __ULL(0x929F2D75566F36EF), __ULL(0xC4DAFA157AFFD21B),
+  __ULL(0xE173747CB1D72429), __ULL(0x8248A24711DCCBE1), __ULL(0x10915BA00EC53797),
+  __ULL(0xE32AE9732ED24683), __ULL(0xBCBCF8BD99FA57A5), __ULL(0xEC0D22E31B09B609),
+  __ULL(0xE2F03535554684FD), __ULL(0xE0BE04EF5312E357), __ULL(0x38C707027FCD57DD),
+  __ULL(0xF44B3E7B2F4E804D), __ULL(0x3221B0376471259B), __ULL(0x802E722D17906F2D),
+  __ULL(0x236AD6370BA59E4F), __ULL(0x8EA0101C7F7BA507), __ULL(0x8B8DDEF8305F0295),
+  __ULL(0xC7BB0591CF67D741), __ULL(0xBD46C58BBDBC88F7), __ULL(0x3DA249CC633DF405),
+  __ULL(0x09793514A3EEC07D), __ULL(0x1062B99038802FC3), __ULL(0xDAED975215FB88C7),
+  __ULL(0x759883B1F4BE8949), __ULL(0xF34DB2A1C60679AB), __ULL(0xD54A0995BE91CE3D),
+  __ULL(0x8EE860295125F913), __ULL(0xA1924304B74DD135), __ULL(0x3B4F07990DB32DCF),
+  __ULL(0xADA522EA2C166509), __ULL(0x564F069FCA45B7F3), __ULL(0x9DB7047C33F72077),
+  __ULL(0x1E812C75875A2FB1), __ULL(0xD80A50468316904B), __ULL(0xD9727A5A7C1F1D2B),
+  __ULL(0x63A17670F02B8CB9), __ULL(0x8C89D11489F23145), __ULL(0xAFCB7E2200A84C9B),
+  __ULL(0xD6806AE5DCE18AA9), __ULL(0x1FB1381B47BD6A61), __ULL(0xAD782A5BD69C5E17),
+  __ULL(0x0835360637131225), __ULL(0xC1676EC9C2CC7407), __ULL(0xA19C285E154DA3E3),
+  __ULL(0x810A95F196823F31), __ULL(0x2D1FE3978EC16675), __ULL(0x53A2A39FA07749D7),
+  __ULL(0x46487CFDA913950F), __ULL(0x459743A0D320B849), __ULL(0x48581DB74FCF93B7),
+  __ULL(0xE7D5A55E6BA324C5), __ULL(0x8C95275CDA5E1DA7), __ULL(0xBC6588B4A242D1AD),
+  __ULL(0xA3AFE01D0CDD8219), __ULL(0x110F532AB5703483), __ULL(0x1A8E1E29C29C55C1),
+  __ULL(0x79DFA316314799DB), __ULL(0x28DE2F1C051672FD), __ULL(0x229FDD25123A219F),
+  __ULL(0xEAE47855E3B969A1), __ULL(0xC72880078DCA676D), __ULL(0xF339DBBCC0648FC9),
+  __ULL(0x636A9B73BE9A0ED5), __ULL(0x5E9CFD68FE81057F), __ULL(0x963A85C60365A961),
+  __ULL(0xD4A75CD111BAC90B), __ULL(0x2DAE7B7E0C28DC4F), __ULL(0x4926EC044E63E39D),
+  __ULL(0x498197D39377B53F), __ULL(0x524D02AC05EED541), __ULL(0x08E30837B82D5AE3),
+  __ULL(0x7798700A049CED75), __ULL(0x720AD73E20E85ACB), __ULL(0x8D1E7C48F150F611),
+  __ULL(0x0757BB96DC16B255), __ULL(0xCC5F935B798B4339), __ULL(0xB9B56816720300DF),
+  __ULL(0xE788866F99530497), __ULL(0xB027BFACE98E4CA5), __ULL(0xF9609EC55D0D7415),
+  __ULL(0x2B5469492A3C296B), __ULL(0x0476AE2D23497663), __ULL(0x534A54F61E2F7BAF),
+  __ULL(0xF2692E039E68FCD3), __ULL(0x08873670C42328A1), __ULL(0x415940E10BE784D9),
+  __ULL(0x40883EF550278665), __ULL(0x080CEC65725D6571), __ULL(0x36807B80E4957427),
+  __ULL(0x3D00CE0A752AA2B5), __ULL(0xE336A07CA14EAD51), __ULL(0x9E8C575AEAF04E79),
+  __ULL(0x0EF7A54FDA426B2F), __ULL(0x660A8CF85700C853), __ULL(0x79CF08AB16BCD9E5),
+  __ULL(0x67F34633052A75C7), __ULL(0xB99486E4577B1649), __ULL(0x5D37B437AD68CEAB),
+  __ULL(0x38E013E72483E635), __ULL(0x548769838163D38B), __ULL(0x73F0E36B28609EFB),
+  __ULL(0x8743D9015816BCF3), __ULL(0x0E280AAA9C2953C1), __ULL(0x089D84D355D6F68D),
+  __ULL(0xC63FF8DD66E6F7F5), __ULL(0xC9B47B90EA70228F), __ULL(0x4EC7538866EFDD47),
+  __ULL(0xD2C448EDDCFA722B), __ULL(0x1B864C3B1F48E26F), __ULL(0xD1AF39912677D7A9),
+  __ULL(0xE726F10162255E03), __ULL(0xC7E232CBD4D2E107), __ULL(0xC93F6917397C8989),
+  __ULL(0xC179415ED1251C31), __ULL(0xD982C1A49B4A9C7D), __ULL(0xED653EA8C0ED8721),
+  __ULL(0xD69790853326BC3B), __ULL(0x7049BCAA4F7642FF), __ULL(0x0457BE5DE94959C5),
+  __ULL(0x0FD8255B9F844AA7), __ULL(0xC91629C44B9F4F29), __ULL(0xB424054F19C9ED35),
+  __ULL(0xE4196EB59C4F6D1D), __ULL(0x8690B47F8DB2D2C1), __ULL(0xF88274236F2839AF),
+  __ULL(0x6DC83D7966A9BAE9), __ULL(0x8596ED06D3EEDE9F), __ULL(0xF062C3D4623CA6A1),
+  __ULL(0xE1D37DD7DCFC0E57), __ULL(0xBE750589BB818743), __ULL(0x2E1127DBFA726391),
+  __ULL(0x27B20B479EA10223), __ULL(0xF2C6481D6A6BC16F), __ULL(0x4CCB95AE9177A5BD),
+  __ULL(0x90C8EC274D7B6093), __ULL(0x842C9DFC1636B0B5), __ULL(0xC8A6332FB0F8397B),
+  __ULL(0xFB00E15486717F73), __ULL(0x18981E0D74CA7705), __ULL(0xE3AAD8126AF4BB31),
+  __ULL(0x8C60E0F9EADC6FCB), __ULL(0x0D1C657F177A82C3), __ULL(0x6674F4E81A28110F),
+  __ULL(0x35313D831F8C4FB7), __ULL(0xEC8BB351C7943039), __ULL(0xD5A90EFFB08A213D),
+  __ULL(0xE6D7E7F964DA45E1), __ULL(0x871E46E769D72DAD), __ULL(0xE305F2A71E5ED197),
+  __ULL(0x250684F6368A41D3), __ULL(0x9C4BBFF99CBA05F5), __ULL(0x5C06DE586094608F),
+  __ULL(0xB2F6D92C1EC4A1DD), __ULL(0xDEB4319FB9454BC9), __ULL(0xD49FB035559D017F),
+  __ULL(0xB3A4FF35208B3923), __ULL(0x5E32034E63783445), __ULL(0x08716236B5560F9B),
+  __ULL(0x0A6878121696DD5F), __ULL(0x5CE9FCACB9E6C599), __ULL(0x0E072476490CCA51),
+  __ULL(0x0824B49CB37ABF9D), __ULL(0x3C0AE2A70B927F07), __ULL(0x31BC572FD551882F),
+  __ULL(0x421AE6AA687DE169), __ULL(0xDEABCE2EA4830D53), __ULL(0x2A96C63C30B7CEED),
+  __ULL(0xFAEF40D2DF4974D7), __ULL(0x7E894856AEC78A3B), __ULL(0x7DAACDF776F9A349),
+  __ULL(0x9DBFF648EFBC94A3), __ULL(0x34C456F7859D53FB), __ULL(0x219AD4798DFC7F09),
+  __ULL(0x1BB9D943E34A9185), __ULL(0x0089CA4FC10A8CF5), __ULL(0xDE72880A131D5C9F),
+  __ULL(0x1B7EABA287767543), __ULL(0x46A5F3996E462191), __ULL(0x1AE6A26DD96D47B3),
+  __ULL(0x499FBB54B964D637), __ULL(0x1A19827A33BD66B9), __ULL(0x15878FDCD59A9B45),
+  __ULL(0x851B90FBA431369B), __ULL(0xBDA5D60DE98CE461), __ULL(0x23E62F81DECEFC25),
+  __ULL(0x94001005ECDB9689), __ULL(0x8648EFF291E7E72F), __ULL(0x8A62FE2B9718817D),
+  __ULL(0xA3F9E43844EC9075), __ULL(0x89A6398148DFC421), __ULL(0x5F4663F719527DCB),
+  __ULL(0xC779818F7060F13B), __ULL(0x6792A2D917AE0CCD), __ULL(0x9410393AEEC830F1),
+  __ULL(0xEEB0613661490A1B), __ULL(0x567F676933A29C29), __ULL(0x13FFBAB975BADC19),
+  __ULL(0x40A42D24F2F486CF), __ULL(0x5D0597E7E62698D1), __ULL(0x579992ACA68AF587),
+  __ULL(0x6558DB5C978C18F3), __ULL(0xCDB7ED51932AE977), __ULL(0xDBC464B05DE3F16D),
+  __ULL(0x8C9C2CABF9094965), __ULL(0x8F32C59CADFEB8D5), __ULL(0x824C7ABECF1EFF7F),
+  __ULL(0x196F7528DA7B0071), __ULL(0xC3068EB4CB612593), __ULL(0xA92CF218F60FEE7B),
+  __ULL(0x1EDC3DB5D3422D9D), __ULL(0xD6F1524BD8CB8473), __ULL(0x051E5FF3E2A5975B),
+  __ULL(0xCCD2A420369832E7), __ULL(0x9A05EBF94CE7BF69), __ULL(0xDFA2F3D327D26E0F),
+  __ULL(0x1BF4E896B8263011), __ULL(0x4890344F50803F01), __ULL(0xE8BB6338D204B1AB),
+  __ULL(0xE3B0688512FF1D39), __ULL(0xC36F60A5E5FD863D), __ULL(0x078A4C430DDD0B29),
+  __ULL(0xCE500B58FEBDF583), __ULL(0x08CC98DB963921FB), __ULL(0xD510371177B4C487),
+  __ULL(0xC00054C5D673A98D), __ULL(0xFAC6498F492400F9), __ULL(0x364C8859937186D3),
+  __ULL(0x90EFF05E34A24BBB), __ULL(0xBC4CEE46CCFAD8C9), __ULL(0x5829F7D2CE8AF5B3),
+  __ULL(0xDEA194008EE17E81), __ULL(0x259E9B090C0DDE23), __ULL(0x138253DA9D4D6945),
+  __ULL(0xD29C3784FA1DCE27), __ULL(0x36786B915B1B8195), __ULL(0x77ECF76041E536EB),
+  __ULL(0x6050BE2226021305), __ULL(0xD5FA9FF6EBCB5253), __ULL(0x7F5F91E9214B4221),
+  __ULL(0x6246B9F05FA2C1D7), __ULL(0x8E15D88664FB3DFF), __ULL(0x616024C8022F78AB),
+  __ULL(0xDB7510C6D349BACD), __ULL(0xF67CDFF1A7866EF1), __ULL(0x9D234A7DE2AB41E1),
+  __ULL(0x05FE8C3A65F9C4CF), __ULL(0x183CBF681C362DBF), __ULL(0xFABC18EE71AC7763),
+  __ULL(0x4B32A5F58D624685), __ULL(0x6804529AADFCD1DB), __ULL(0x305115D48B9821F5),
+  __ULL(0x9F1A726AA431B747), __ULL(0xFC0E6073AC1ACCB3), __ULL(0xAA582E1C59F046D5),
+  __ULL(0x0F518DAA791953B9), __ULL(0xB73EDD89915C1C6F), __ULL(0x40BF1ABD8D66AB9B),
+  __ULL(0x39BCE28D93E1D95F), __ULL(0xA26701103D3CC517), __ULL(0x01DD4A40C43DBC7B),
+  __ULL(0x4BFD3A1FC947C895), __ULL(0x7225DF81AE5F042F), __ULL(0xB2B3E0C5EA00667D),
+  __ULL(0xC7C46FEBE2C092CB), __ULL(0x95672A8A10763CFF), __ULL(0xB2768D2D39883D01),
+  __ULL(0xEF22BD1CA8533AB7), __ULL(0x948CA64826588DF1), __ULL(0xAE66794C23E77F1B),
+  __ULL(0xE9F428C7FD6AA4A7), __ULL(0xFB1DCF055AE1A0AD), __ULL(0xD4F80976A589F677),
+  __ULL(0x441DA38275E39EF9), __ULL(0xCC1CE5DA04E273AF), __ULL(0x1FE7991C5907B66D),
+  __ULL(0x7C515EDDA52EA857), __ULL(0x59062CFEDE859D91), __ULL(0x55F4A78D9FD2FC7F),
+  __ULL(0x768120B821D6E32B), __ULL(0x9C9921673F7CBD4D), __ULL(0xF2774E31379A6FBD),
+  __ULL(0x8DE1C98E4BCADAB5), __ULL(0x1A60E03C065BB417), __ULL(0x28D297DFA9299825),
+  __ULL(0x9E9430DE7478529D), __ULL(0xBC88F92E10952C3F), __ULL(0x54BD3706DC1E0DF7),
+  __ULL(0xF9D09CFB6DC8C9E3), __ULL(0x8A74CB06E39C7531), __ULL(0xF10C3D95F9F18C5B),
+  __ULL(0x9CE1A939B10699CB), __ULL(0x2334752D18E24459), __ULL(0x57E84715D6CACB0F),
+  __ULL(0x7C324E1C560F3C01), __ULL(0x97B3C2EA507DB7DF), __ULL(0x0AE212A04B862BA5),
+  __ULL(0x73B965F672CFD6FB), __ULL(0x89DE8963E5463187), __ULL(0x617279751F7E18FD),
+  __ULL(0xC872C7D3B59E6767), __ULL(0x3A9208B528F4DFA1), __ULL(0xC25877B1C3D11A8F),
+  __ULL(0xF1EE21FE572D80BB), __ULL(0x69FAEBFCCDF4C137), __ULL(0x1FC53B2686C37C71),
+  __ULL(0x8F804EC7BA4B4FA9), __ULL(0x2BFD6A8F3713E1B5), __ULL(0xD8BC7B7380B9832D),
+  __ULL(0x78A976ACA0215907), __ULL(0xC9F243F6044CE073), __ULL(0x7D3CF46DD34A9579),
+  __ULL(0xD2B7A9224599C22F), __ULL(0x9EBD99C442EC335B), __ULL(0xDB0A5AC4CD81C3C3),
+  __ULL(0xAED4225861B1AC11), __ULL(0x168C1364F26B3CC7), __ULL(0x67CF1320E9B45939),
+  __ULL(0xC934FDEF63BD0D13), __ULL(0x32D188CA13A22535), __ULL(0x597A84687446CAC1),
+  __ULL(0x826A566D324F5477), __ULL(0x237F0CBC6345A3B1), __ULL(0xAFA23506EA78D69F),
+  __ULL(0x49CED0A4C4653F43), __ULL(0x0B0BF7F4F024398F), __ULL(0x30967926812C22DD),
+  __ULL(0x8C82D6A69F3FA447), __ULL(0x84F51A6F414B5DBD), __ULL(0xF02292EDDB981893),
+  __ULL(0xF93EA144A965165F), __ULL(0xEF9728339CA45E61), __ULL(0xFCBC980117C39217),
+  __ULL(0x2DC4672CB72652EB), __ULL(0x4EB5CB239978FDE7), __ULL(0x2D2777DC375FAE53),
+  __ULL(0x784EDACF8DF1090F), __ULL(0xCFA2FB10AEF77D33), __ULL(0x0E5014C2887BF41B),
+  __ULL(0xB072E91A0709198B), __ULL(0x67C006C7E1C4DC1D), __ULL(0xFD4A960F626249C1),
+  __ULL(0x07185218225490AF), __ULL(0x8E0F4C2E2A3E06FD), __ULL(0x685E0449104A21E9),
+  __ULL(0xA9D4097F08E57B6D), __ULL(0xFC96FA43351E424D), __ULL(0xB460C0E718B3BA71),
+  __ULL(0x4B1073743C0B1927), __ULL(0x67D25DFE8F649D61), __ULL(0x2816AC00957B3D99),
+  __ULL(0x8AC9A43688E1587B), __ULL(0x80F18AEC190F5F89), __ULL(0xAD86FAC8949DEEE3),
+  __ULL(0x8694FBBAB9809605), __ULL(0x56C0C924A9D34175), __ULL(0x45BA2C16A9A0B1C3),
+  __ULL(0xC22480D264C36A11), __ULL(0x3E25B17CF907F6B7), __ULL(0x25C78079896D5FC5),
+  __ULL(0x221BE0324E95A529), __ULL(0xDBA997F1D10A3B13), __ULL(0xB8A2CA76E14220A5),
+  __ULL(0xA467994E07CD31D1), __ULL(0x7010C90574C9F709), __ULL(0x0610A51ADFAB1467),
+  __ULL(0xC70E2DB0AAAEF24B), __ULL(0xBDD7A11DD0686457), __ULL(0xC1EDD709856EB5BB),
+  __ULL(0x94097215B05A90DD), __ULL(0xD19E3E631EA6F87F), __ULL(0x94742FBEAF14C82D),
+  __ULL(0xDD33FEBD0134E573), __ULL(0x4ED2B9CB0A6B2B95), __ULL(0xFB84FD17675F4841),
+  __ULL(0x0749771E76D2DF2F), __ULL(0xB7ECA9EC36A0397D), __ULL(0x99448E775CBDBC21),
+  __ULL(0x4D22B3226E014A49), __ULL(0xA90CC6977578CD55), __ULL(0x242175ED63BF37FF),
+  __ULL(0x558E13A0FC4E22AB), __ULL(0x82B4E3D308F128F1), __ULL(0xB71B35A794803A35),
+  __ULL(0x361E682692142797), __ULL(0x0B46A5FF40275419), __ULL(0xBF032956C744A609),
+  __ULL(0x77FE0ADB4CD727BF), __ULL(0xE8D294213F00BBDB), __ULL(0xD5AD4A60ECE0A367),
+  __ULL(0x4CDC000F53F5A443), __ULL(0x4379993FB6E77781), __ULL(0xDD27ECD016423A45),
+  __ULL(0xB94D6DC229A7566F), __ULL(0xAE7BEA0B04B3959B), __ULL(0xA4FFF4836FFFC2BD),
+  __ULL(0x2A2FF58D87AB1B61), __ULL(0x342237BB16189507), __ULL(0x3E4D98A5D9773E2F),
+  __ULL(0x40D2019F8D1E307D), __ULL(0x6097830DEF75F353), __ULL(0x3F129FE659C84F75),
+  __ULL(0x9CA7CBCA9DDEBCCB), __ULL(0x973019163987CAD7), __ULL(0x85B6084AA788D4E5),
+  __ULL(0xAF12A0C78C6B660F), __ULL(0x4C28DC7CDA517949), __ULL(0x9C4229A85B559BCD),
+  __ULL(0x1D44D910078F47F1), __ULL(0x8F2662C592C8FEA7), __ULL(0x3091857667B88329),
+  __ULL(0x68DDFEE0551F72DF), __ULL(0xB19FB32CB5DD1DCF), __ULL(0xC95DEA1F757B3C87),
+  __ULL(0x411A17EC00F95615), __ULL(0xA64996B0B3C0C6C1), __ULL(0xEB3E1066C27662DB),
+  __ULL(0x2EF174682F8DD29F), __ULL(0xD6C46FF241E71B43), __ULL(0x22BAB1FFD4CC50C9),
+  __ULL(0xFAA14519CD90B7D5), __ULL(0xC8551129CB507CB9), __ULL(0x1BFF2FB40832356F),
+  __ULL(0x14134E78A18E4627), __ULL(0x977E34FB8D0704B5), __ULL(0x95F7B32AB2122D4F),
+  __ULL(0x52C605162A729C9D), __ULL(0xFF312A6F3D24263F), __ULL(0xDE050663429913E3),
+  __ULL(0x97AF072DBE0F2669), __ULL(0x761C2A9F0AC6321F), __ULL(0x66F42AA85788C3CB),
+  __ULL(0x2CAFBC175B2416C3), __ULL(0x887A414BB7633601), __ULL(0xCB6B02A0DC0283B7),
+  __ULL(0x05D4A6AF118BE439), __ULL(0x9D5A4E82185441AD), __ULL(0xBA051D0609C30B87),
+  __ULL(0xF8FF70F323500409), __ULL(0xD282F2DD96EA2F63), __ULL(0x5AD5F99AC535E2FD),
+  __ULL(0x57029FC4B2CB55D3), __ULL(0xEB78ED7F7A9165D9), __ULL(0xD574BC463D65EABB),
+  __ULL(0x42E730968CEB35DD), __ULL(0x3F73FCC7BA30F57F), __ULL(0x2DC6B366E4890845),
+  __ULL(0x6B2BAC4202A7E39B), __ULL(0x53D1DCE386EC0BB5), __ULL(0x1E1AFF071A17D15F),
+  __ULL(0x4F8EE415367F539D), __ULL(0xED15506334A2EA73), __ULL(0x0C47C9E82DCEB5EB),
+  __ULL(0x593E02EDE09B6F79), __ULL(0xAEF942CDC7B11569), __ULL(0xE16EB1670B2EE2ED),
+  __ULL(0x4EC488EFCFD322E5), __ULL(0xD7A70F2FB25E77AB), __ULL(0x8DB7265DA2E549CD),
+  __ULL(0xB9643BDF14603339), __ULL(0xD1B85143B8031CA7), __ULL(0x0C4E39580B390119),
+  __ULL(0xE9B2975CE5396F1D), __ULL(0x5330F6D03A05D5F3), __ULL(0x7361D9410633B0DB),
+  __ULL(0x66876247AB9CCCE9), __ULL(0x7146DD70B2570E4B), __ULL(0x35E2AAF7DCF46E6D),
+  __ULL(0x1948F09EA1649591), __ULL(0xC347E8240B570A37), __ULL(0xB45384856B8558A9),
+  __ULL(0xD7E05F6492F5905F), __ULL(0x426BE4F5CB34DB7B), __ULL(0x84BC002D3CEBCA89),
+  __ULL(0x2333F028707BFCEB), __ULL(0x6CF0F13C99416D31), __ULL(0x8387A5605954157D),
+  __ULL(0xE8909F9385CE57E7), __ULL(0x3E2A09B8E23AE475), __ULL(0x3797D6236FEABC59),
+  __ULL(0x5D38ED749D6F33FF), __ULL(0x5A18605436DE62C5), __ULL(0x7747F86F5BC3D029),
+  __ULL(0x06FB3E2A9D145635), __ULL(0xAF92D17A2D8C438B), __ULL(0x1F0C477372F59283),
+  __ULL(0x4FF1D25251B143C1), __ULL(0x1E5CEE072850E06B), __ULL(0xADFBD1E43A2B4C85),
+  __ULL(0xD83841CF35E9BBE9), __ULL(0x5F84C723D21AD7A1), __ULL(0xA9F3835DBD4869B9),
+  __ULL(0xBA6BA515CA403B23), __ULL(0x0A738D3D7DB47471), __ULL(0xF112DED6AFB43993),
+  __ULL(0x4B6FA5898952470B), __ULL(0x4AF3957555E81B17), __ULL(0xB26ED73A160F0C31),
+  __ULL(0xBA6EB86AB56410ED), __ULL(0x57C3EA45FDDCCB59), __ULL(0x6FD321307E7ED139),
+  __ULL(0x2DD497CD7BCF1A3D), __ULL(0xF4BA8622A9966EDF), __ULL(0xA8BAD589898486AD),
+  __ULL(0xB433D5A3B9A56BD1), __ULL(0x23FB8971F3527215), __ULL(0xABDCAAB3D03BA2BF),
+  __ULL(0x949922220CD9B4F9), __ULL(0x5A8ECB5340829BB1), __ULL(0xDDB722AB5ADE6E67),
+  __ULL(0x3F0BF96F8ECA9AD3), __ULL(0xE4FB9080C58F1C4B), __ULL(0x8298EB5CC9E2FE57),
+  __ULL(0xDA36FF1C08957281), __ULL(0x88356E4A8363589B), __ULL(0xC2D6E25807968227),
+  __ULL(0xE1616D411D6B0E5F), __ULL(0x532C038EDC96EF73), __ULL(0xDB178237FAC04241),
+  __ULL(0xFFD9715D1D0A125B), __ULL(0xD832DF60F842E269), __ULL(0x9210A8B52E1DA7ED),
+  __ULL(0x0EC2699CF8F3F5D7), __ULL(0x41F0EB04AF908311), __ULL(0xC58B1DB0853A03C7),
+  __ULL(0xCF093A8ACB577755), __ULL(0x59D0F399843ACDA3), __ULL(0xB4A305C00901913D),
+  __ULL(0x9C41AFE294DE35E1), __ULL(0x88AF1B27C8F138CF), __ULL(0x02B343752D5C7B77),
+  __ULL(0xB5FDD68E3FA51A85), __ULL(0xA943A880D9C33AB1), __ULL(0xB92DE83FD6C2336D),
+  __ULL(0x18853E1CC70CE0B3), __ULL(0xFEFE203489219AD5), __ULL(0xB80A2F9BD82A906F),
+  __ULL(0x6714E36C9FD87F9B), __ULL(0x60B47285A927A5A9), __ULL(0x0DB5A3F2BD92692D),
+  __ULL(0x2FBCB7C9744BF917), __ULL(0x148424B5236F6F07), __ULL(0x98AA6B1DB28EAB79),
+  __ULL(0xA341BA28950604E7), __ULL(0x6B82B81CA8177975), __ULL(0x5121A0898154E6CB),
+  __ULL(0x6B739FE58D8064D7), __ULL(0x3186669DD31FBEE5), __ULL(0x48543AE4362CED5D),
+  __ULL(0xAFD13E2E21116EB7), __ULL(0x41342FEE9CC004A3), __ULL(0xC8F1A0091DD11D29),
+  __ULL(0x2FEBD8D53A5C1687), __ULL(0xF0C4086F5FA331F3), __ULL(0x7B7DF77B21590185),
+  __ULL(0x5F80FA08A22CB5FD), __ULL(0x3D50B0EB67714C9F), __ULL(0xB4A3EE8B458A14A1),
+  __ULL(0xB8835807C0DACA6D), __ULL(0x2E26C53F17AA9265), __ULL(0x34AFBBE77EDD6AC9),
+  __ULL(0xE17914DF9B9961D5), __ULL(0x765C54D2FDA256B9), __ULL(0xCC1806BE59F7FE93),
+  __ULL(0x06F48A8BC9EB2EB5), __ULL(0x1C4A9A47EA634499), __ULL(0x677EEDC1DCB0777B),
+  __ULL(0x315CE04217D4E69D), __ULL(0xDB5E397F140BD70D), __ULL(0x3585BD197150B505),
+  __ULL(0xB8D12569AF43E931), __ULL(0x3F6A1B2237B83F0F), __ULL(0xED087A7523864111),
+  __ULL(0x6DFD5FE2EB0CA1C7), __ULL(0x3BBA8B44825B7A1B), __ULL(0xE19F5FE8C7447F3D),
+  __ULL(0x008FEA8D0AFAABDF), __ULL(0xFA284FC21D82B3E1), __ULL(0x232D874C5D46AAFB),
+  __ULL(0x6939C18603C64715), __ULL(0xB00B995B2A347963), __ULL(0xFCE88F0E96C446AF),
+  __ULL(0xCD16026D8B29BFD9), __ULL(0x18E8DC592DF28E8F), __ULL(0x86DD96929DAF6F81),
+  __ULL(0xD2D7F3745462A84D), __ULL(0x6DD69713557883A9), __ULL(0x5D428E5A90EC4B5F),
+  __ULL(0x2A1B4F856018630B), __ULL(0xF1BCF4A81844AA03), __ULL(0x98C7A336C59DAA95),
+  __ULL(0x3A5D89359BCBBF41), __ULL(0xAE5916F6E7BB9C05), __ULL(0x6BE342615B4342D7),
+  __ULL(0xA8A62A70E45E2EFF), __ULL(0x353DB465868121AB), __ULL(0xF2DA402C620176A7),
+  __ULL(0x4A37105100EEA6A5), __ULL(0xEEE539775D3215CF), __ULL(0x31D939614B14BEC1),
+  __ULL(0x9DE43EFF7F98AA67), __ULL(0x7BF74E6B779866E9), __ULL(0x40DD0351D0920AF5),
+  __ULL(0xFE93B358BAECCED9), __ULL(0x72EB232DAF0AD343), __ULL(0x70725C80D19FCF91),
+  __ULL(0xE38F9486AFA35847), __ULL(0xBB9E7C771716EFD5), __ULL(0x69175397BC116E81),
+  __ULL(0x6967663E91C42437), __ULL(0x452A8E5E7BB8F1BD), __ULL(0xB779AF7E4DCBF2A9),
+  __ULL(0x81B4736D4042D751), __ULL(0xB42FBC55B00FF195), __ULL(0xF41D7645B529A6EB),
+  __ULL(0x571F3FB19D0DDF7D), __ULL(0x4D890AE8879BB1E7), __ULL(0x484BCFF47D30FBCB),
+  __ULL(0xDC42E09F8BBB2DFF), __ULL(0x591685EB84ECCCC5), __ULL(0x41D4E15B78985EF1),
+  __ULL(0x487F5FC387D785A7), __ULL(0x5191375D021E29DF), __ULL(0xA598092C024D701D),
+  __ULL(0x933482506AA036F3), __ULL(0xB4ACF8B819873777), __ULL(0xE79551C89D9155E9),
+  __ULL(0x03B046F52ACB51A1), __ULL(0xFFC1F1F5AFA08F6D), __ULL(0x575021118488F7C9),
+  __ULL(0x4C19E6957748ED7F), __ULL(0xF2A804E6FFBF8C2B), __ULL(0xBB7849E82A5E43B9),
+  __ULL(0xA0491B310CA38523), __ULL(0xC5B5551481BC43B5), __ULL(0x51E3CA50ADDF710B),
+  __ULL(0x859E46667DBBB517), __ULL(0x63890653990C2C7B), __ULL(0x82B8A6139DB39D3F),
+  __ULL(0xCD2193620D244EF7), __ULL(0x3261EB7C92F102CB), __ULL(0xEAB618B3D4832559),
+  __ULL(0xBBD58AEF2F55DE11), __ULL(0x22C4290BE4606833), __ULL(0x7412A2D7D9D15A55),
+  __ULL(0xCEA510548453E43D), __ULL(0x1CFA4133ADE870E1), __ULL(0x91265CE226D75383),
+  __ULL(0xF0A5070C523AD16B), __ULL(0x5BEDE20AA6129E63), __ULL(0xD8DCCF16218C91FD),
+  __ULL(0x5EA8DB4A1428ECD9), __ULL(0x4519FC828AB924DD), __ULL(0x40CF4CEB6D0E13B3),
+  __ULL(0x63131D05B2588237), __ULL(0xDADFA0DD93BC429B), __ULL(0x6C9EDAC0DF86DC27),
+  __ULL(0x63E26C0EFCC5DC2D), __ULL(0xCFD37B7C81B79551), __ULL(0xF19BA9977833B679),
+  __ULL(0x4628C2D481BABCC3), __ULL(0xDC1A0EDBFBDE2155), __ULL(0xA9155EE4674AD8CD),
+  __ULL(0xCCD486B2D8C79AEF), __ULL(0xEE6D3663AB425B3D), __ULL(0xA795187F1DBF5B97),
+  __ULL(0x8F6EB11EC540F2CF), __ULL(0x33C0D53BCC2E46FB), __ULL(0xF78C034C5D76E4F3),
+  __ULL(0x33DDF3E4E2F35563), __ULL(0x4DDBB10DD25933E9), __ULL(0x9DE720E19142879F),
+  __ULL(0x05E518A396A04D4B), __ULL(0x4ABE0015B1A1FBD9), __ULL(0x0513DA8F89436B81),
+  __ULL(0x31D78A828FED1A2B), __ULL(0x7301C147ED4AE1B9), __ULL(0xD54B7F4BF0830E45),
+  __ULL(0x79D0F78E4ED5699B), __ULL(0x999DB1C578D556BD), __ULL(0x727904D4645AF32D),
+  __ULL(0x74FB0068BA048603), __ULL(0x3935AB579644F451), __ULL(0xD725F6154A678A0D),
+  __ULL(0xC41DD26BE40EA375), __ULL(0x546B3C138F776F21), __ULL(0xEEFC7B507D2310CB),
+  __ULL(0x61AC8405E170FED7), __ULL(0x3E92413E42EA375D), __ULL(0xDBF79AC42F4FAD49),
+  __ULL(0x0947A228E70D4EA3), __ULL(0x74496DB264E301C5), __ULL(0xB4CD048C36CC3D1B),
+  __ULL(0x7F6CDA860E2466DF), __ULL(0xCF3E18A69DB6028B), __ULL(0xABF8E396C2E063D1),
+  __ULL(0x48D23CA9FE90951D), __ULL(0x621B8CB79BB4F087), __ULL(0x736FDFAAEE482CF9),
+  __ULL(0x87927848552822E9), __ULL(0xBA53F4FEE60CC69F), __ULL(0xD28DBCCA8920546D),
+  __ULL(0x9FF72721F5967657), __ULL(0x389E43D2E5849447), __ULL(0x4E3453A2F5CE2A23),
+  __ULL(0x724D3B330AEC8B71), __ULL(0xFD54D24A7846FA27), __ULL(0xD62D27C02C9F309D),
+  __ULL(0xBE1EC73886CAA089), __ULL(0x0145C1FE7E5C3A41), __ULL(0xD353CD59632C5BF7),
+  __ULL(0xA25D3970EEB9261F), __ULL(0x24E89D3EBC02F90F), __ULL(0x6BE0760147D76E5D),
+  __ULL(0x0C8C417B8C74ED33), __ULL(0x6C18CD68C8B304AB), __ULL(0x28FF84D19B2D58EF),
+  __ULL(0xCE27312DE203E9A5), __ULL(0x0D1883F4ED00C2D1), __ULL(0x01AE20CF727DA66B),
+  __ULL(0xE66D726F41DD76FD), __ULL(0xA5145F38B64EADF5), __ULL(0x83F1A6CD83BE4DA1),
+  __ULL(0xA00C15C3A3E398B3), __ULL(0x11D5D00D0D6BB24D), __ULL(0xA95CEF3E02C00F37),
+  __ULL(0xE885435101945FB5), __ULL(0xBAFA99B22B43212D), __ULL(0x2B8D6E6FDB8E404F),
+  __ULL(0xAA0B50EBF8915495), __ULL(0x6C00E0197ABA09EB), __ULL(0xE96B212A21CB0AF7),
+  __ULL(0x404993E53F044969), __ULL(0x37E1F48615B6ED21), __ULL(0xD51405576498F6E5),
+  __ULL(0xE3711EFC524FE739), __ULL(0x2EB037482F81BCA3), __ULL(0x7F2200E229A6F9F1),
+  __ULL(0x41A76DDC43C9C03D), __ULL(0x65F8AEF701616CE1), __ULL(0x8F597EA658E52897),
+  __ULL(0x237D571ADDEE98BF), __ULL(0xBB27F45E39DF238D), __ULL(0x4BCAA9217E203985),
+  __ULL(0xE79EB3DFB2940467), __ULL(0xD577FEA03CC19D43), __ULL(0xF015037517816FB3),
+  __ULL(0x22F7CAA83DCE6F2B), __ULL(0x6AD159B47D9ACC61), __ULL(0x3CFCAF39FA426017),
+  __ULL(0x064AB6C89B4EA425), __ULL(0xA9D112645B391151), __ULL(0x2CC2EB6940C7AF7B),
+  __ULL(0x63B312CE211F9B95), __ULL(0xB448AE47350715E3), __ULL(0xA6856B40D1A8E131),
+  __ULL(0xC48C55AB1E7F4C53), __ULL(0x1102C39E9A309B33), __ULL(0xF926770BF6C318F1),
+  __ULL(0xD0C1BAAEC99A978B), __ULL(0x633E6845D79783AD), __ULL(0x7BE030B462804419),
+  __ULL(0xB871CCE69DF12683), __ULL(0xCF4BC8662C236ECF), __ULL(0xA4EDB540120E5D87),
+  __ULL(0xD5365D36799E2085), __ULL(0x6D4468A2AD0564FD), __ULL(0xEC109E008220C357),
+  __ULL(0x04672329B9318CBB), __ULL(0xA18B91D26C65466F), __ULL(0x146C5D2E7C0DE871),
+  __ULL(0x96C03A336EFF0B61), __ULL(0x4D46D908B0BE4B25), __ULL(0xDA9D80943A8E973F),
+  __ULL(0x95E1291EE63AD405), __ULL(0x84C5534AB92D9AE7), __ULL(0x152A5A9BE3B17F59),
+  __ULL(0xB3F186EF3EDB135D), __ULL(0xD2BA886D518F7233), __ULL(0x51B74EA5FE38D913),
+  __ULL(0x6083026FA8899AAD), __ULL(0x30CA10372CD6C9FB), __ULL(0x05C252440CCC4509),
+  __ULL(0xB1B9CA2CEE967B6B), __ULL(0x97C06928E27BD18D), __ULL(0x0F6364A9CDFA9DAF),
+  __ULL(0x68DB3832FC4E0FB1), __ULL(0xF436464235AD2267), __ULL(0x61C1EB4693681865),
+  __ULL(0x4A1061CB9DBEA58F), __ULL(0x1F96C7B020E3F3BB), __ULL(0x6855BFAB89EF40C9),
+  __ULL(0x5D4A4FB1F3696681), __ULL(0xC54DB572FF7B0623), __ULL(0x3444E3A9F05D0771),
+  __ULL(0xD1E215EB3884025F), __ULL(0xE9FA548846FA662D), __ULL(0x51B237DB9384DA99),
+  __ULL(0xEABDF88CB3EE0C9D), __ULL(0x2E108DFC6DA5E65B), __ULL(0x30C1C2CFD49B86C3),
+  __ULL(0x15D3B4250E4AF711), __ULL(0xA90953C2DEF1B7C7), __ULL(0x0ED950D99E5B25FF),
+  __ULL(0x31F7CEDDE5C5E2CD), __ULL(0xB98D7A28C140D439), __ULL(0xD254819B83E561A3),
+  __ULL(0x352445232B60D4EF), __ULL(0xF85D818FB3EB253D), __ULL(0x38937BA591E6B835),
+  __ULL(0x4725E5F3BDDBA58B), __ULL(0x83C65600440F6219), __ULL(0xEDF84B08D90A15BF),
+  __ULL(0x393CEF3B1326AEB1), __ULL(0x91D036BD0760CDE9), __ULL(0xD3A23169BEECC9F5),
+  __ULL(0x0EA18CF9C222019F), __ULL(0x56BB8E57194FA691), __ULL(0x0A3D58A429E91F47),
+  __ULL(0x33DCDDCE025EF4B3), __ULL(0xE0F3458972F2EED5), __ULL(0x88DFD6903B5F7845),
+  __ULL(0xCD5AF4DA5503C15F), __ULL(0x6C9665F9C5B3647B), __ULL(0x4436C4C622E67095),
+  __ULL(0xDE499AEE5E7325EB), __ULL(0x3707F9D207285F79), __ULL(0x227EAD70255998D7),
+  __ULL(0x8FEF8E0DBFFB9D59), __ULL(0x3CF75F6BA90F815D), __ULL(0xF1D70459ABE375F1),
+  __ULL(0xECB73666FFB40CA7), __ULL(0xAE4FC903C638BF35), __ULL(0xAA8038A8A0152C8B),
+  __ULL(0x677BF593E12BC8AD), __ULL(0x7CC5B0B30EE09DD1), __ULL(0xB6AE0DE4E0BB45F3),
+  __ULL(0x9E51517F07E5096B), __ULL(0x1723707DD62C49FD), __ULL(0x2E0E93722DA91057),
+  __ULL(0x4B2E4367D5737943), __ULL(0xEC0DFAFF1EDAC1BB), __ULL(0xBF1263E1BBE0E54D),
+  __ULL(0x0503BD441F7FE36F), __ULL(0xFD1F21292AE14571), __ULL(0x132325B24B694025),
+  __ULL(0xBA114E8478EB5B4F), __ULL(0xE6689D1B6E16BA89), __ULL(0x227FA1114B7675F7),
+  __ULL(0x1534D160FC99F1E3), __ULL(0x1DCB8FC566C78905), __ULL(0x64098C8C409674C3),
+  __ULL(0xB6B3B13DF11455C7), __ULL(0x3CE774A67D24D2C5), __ULL(0x0B9B0896E9E6D397),
+  __ULL(0xCC55FAD0484CFCD1), __ULL(0x69E936C6C0DE5209), __ULL(0xE2E696678C3D13BF),
+  __ULL(0x0123B1D41ED9D5F9), __ULL(0x5E44DB03253DECB1), __ULL(0x75C0722175E6C7A1),
+  __ULL(0x1DAB366A5CF4028F), __ULL(0x8BF90D013AB113DD), __ULL(0x69B372F1C5A0A2B3),
+  __ULL(0x21C40601065CBC4D), __ULL(0xC52D1F85B376A19B), __ULL(0xC069E4E6A0C5B7A9),
+  __ULL(0xA64954FA0C6489B5), __ULL(0x8D2EE89218BD3F5F), __ULL(0x62CB61707E878799),
+  __ULL(0x9159DEC9DE92319D), __ULL(0x267AC174070CC107), __ULL(0x46FE5B03442CFE95),
+  __ULL(0xC1B97E9C99E924F7), __ULL(0x683661C6E8EAAA2F), __ULL(0xADC58E29B073DB5B),
+  __ULL(0x9784936C9CA97C7D), __ULL(0xC0F696575161DF1F), __ULL(0x2A94763907992549),
+  __ULL(0x6C8A9672E48271EF), __ULL(0xFEF483FCB9A68A3D), __ULL(0x69396498DC662AA7),
+  __ULL(0x7AA5EA5B76BA3A8B), __ULL(0x774BA4E1B9A64D1D), __ULL(0xB4CF0CA012F30109),
+  __ULL(0xEBCC828AA1136EDB), __ULL(0xB8F80D8DC7075E67), __ULL(0x1BA7A8DECB16BE9F),
+  __ULL(0xC8E85D793C8D82D9), __ULL(0x346D3290E217218F), __ULL(0xAC9E5D731B9043D5),
+  __ULL(0x7EB4EAAE09865837), __ULL(0xEF444AA92C8EA8B9), __ULL(0xB75A561266EE4093),
+  __ULL(0xD251EE03D5D24661), __ULL(0x27216ED1A34B3503), __ULL(0xC7606E1BA04E123F),
+  __ULL(0x71AE5B4F9E62990D), __ULL(0x977BCDFD49275FE3), __ULL(0xDCD106EDED05092F),
+  __ULL(0x74F17E5DCC4AE5D7), __ULL(0x800409A4BF31CA59), __ULL(0xD3C16709F8C807E5),
+  __ULL(0x4C591DC8F8A9265D), __ULL(0xBBF66542DB73A533), __ULL(0x10E37CCCD7DE3DA3),
+  __ULL(0x36B81BB314319E29), __ULL(0x23E49D4620059E19), __ULL(0x25B43FF39DD04AF3),
+  __ULL(0x55BEECFAD90E2915), __ULL(0xF64CA45EDD4E31C1), __ULL(0x4FF4697F28138A85),
+  __ULL(0x76E4AE9F43DD78AF), __ULL(0x8E90A5B8F2F889E9), __ULL(0xE22A3631480D21D3),
+  __ULL(0x17D4259C8A0445A1), __ULL(0x9FC401C7C645DB65), __ULL(0x38499C93DA425B47),
+  __ULL(0xC173F04E06CE0AD5), __ULL(0xBA3F122245B8E02B), __ULL(0x13C34748986C8127),
+  __ULL(0x6F879CA2862497B5), __ULL(0x83DA091516C28561), __ULL(0x509667A67F4AE917),
+  __ULL(0x403803A0661E3E05), __ULL(0x777D0EE0B23A3A31), __ULL(0x6650CD6BCB7EF4E7),
+  __ULL(0x82F32E8C5E0556CB), __ULL(0xEB54B556D1085211), __ULL(0xBC1F175865F05D5D),
+  __ULL(0x8FCA8C4B23402101), __ULL(0xDE3877683D3A5F39), __ULL(0xEF98EE60C8AFC31B),
+  __ULL(0x6F4455C873A1DCDF), __ULL(0x5DFF18483B8AE783), __ULL(0xC9301F783A9A33FB),
+  __ULL(0x50783501D9A90687), __ULL(0x8802F9724B7F7015), __ULL(0xAB45D2B48B073263),
+  __ULL(0x2D5173E50B6C25FD), __ULL(0x3FA372AEC30438D3), __ULL(0x9EBB46C60E22CC57),
+  __ULL(0xFA02D1E6A379A0D9), __ULL(0x34C1350BAD105DBB), __ULL(0xF3522E44D5CC414D),
+  __ULL(0x70380BFD556AB637), __ULL(0x732CF5D1081E04A9), __ULL(0x42DE0C307D464C0B),
+  __ULL(0x7BBB8603FF3B2303), __ULL(0xBCA3BB647510569D), __ULL(0x7405CF9BA8712E07),
+  __ULL(0x05CF4BE13C3188EB), __ULL(0x33BE4F48BF1531F7), __ULL(0x44D65B6F4437617D),
+  __ULL(0xDDAB6A55FA543111), __ULL(0xC39EC81277EDD13B), __ULL(0x54E5B85A1A38CAAB),
+  __ULL(0xAF465F927028ECCD), __ULL(0x34385A36BCAA57A7), __ULL(0x81FBBE43F058E235),
+  __ULL(0x914347B6F14A8F97), __ULL(0x9A4A25AD00AC6FA5), __ULL(0x444346F05BB3721D),
+  __ULL(0x75A9785E59CB328D), __ULL(0x666E9DDEA58063DB), __ULL(0x810EE50EBBFEE091),
+  __ULL(0x7D0EC22E842BFEB3), __ULL(0x1FAF3394C9043E6F), __ULL(0x147142606B4AEABD),
+  __ULL(0x54D3C9AB23183B5F), __ULL(0xCC0279683E43FD07), __ULL(0x9BD1989C3EF52589),
+  __ULL(0x55425B3025A5587D), __ULL(0xDC1DDEC2310A12E7), __ULL(0x6A8D2A167DC764CB),
+  __ULL(0xA9A12010A4CD383B), __ULL(0xEF8DB5E6F06DE149), __ULL(0xEE568CB324C01F01),
+  __ULL(0xCFC04118910252AD), __ULL(0x896C1420BDBB4B19), __ULL(0x0D6EDA349AA8D7D1),
+  __ULL(0xFF88A4A60421291D), __ULL(0xE1F6BD5A6360B36B), __ULL(0xBDB2049FF0CD95AF),
+  __ULL(0x077EBDF0089756E9), __ULL(0x4904EDF22A5F82A1), __ULL(0x9C6ED001A1E95065),
+  __ULL(0xFD2EECFBE59DBF91), __ULL(0x565651C718684847), __ULL(0x5EF35D9A3DFCDE7F),
+  __ULL(0xDDFE2E91D40E352B), __ULL(0xE94EABB07DC7E4B9), __ULL(0x533684F0BCDFAE27),
+  __ULL(0x5D817DB73B5D2A25), __ULL(0x39D05AAA8C6BC49D), __ULL(0x6DC139DC6D35BB73),
+  __ULL(0x58446E4D08900E3F), __ULL(0x0BEB890558B62E41), __ULL(0x84BA4FF0C3CA3BE3),
+  __ULL(0xE3A2E14E929B1731), __ULL(0x9F3078329B9173ED), __ULL(0x95A0C6FF1C406D0F),
+  __ULL(0xE12E591123CC2FC7), __ULL(0xAD6F0BAB32FB0355), __ULL(0x133E0BA2F5E858AB),
+  __ULL(0xFC1F035DA5375A29), __ULL(0x28F83474E2F6CC83), __ULL(0xA782E4CDE91FBDA5),
+  __ULL(0xF22DA4637CEF4515), __ULL(0x7DA6A4AF75E4FA6B), __ULL(0xE0AAA56372A32967),
+  __ULL(0x2197DAA4906D7DD3), __ULL(0xCD26C8CE6A185DDD), __ULL(0x56A32C0945CBE7C9),
+  __ULL(0x6A53BE1E4ACA4337), __ULL(0xCEE613248ADCB3B5), __ULL(0x3128F6872AB80803),
+  __ULL(0xEE2C634AE6D9B44F), __ULL(0x2BDF18F58AEB1273), __ULL(0x125407884B0AAD41),
+  __ULL(0xD4E140B9F92ED779), __ULL(0x0F92B936043DDA05), __ULL(0xE3DF5BA4C671C55B),
+  __ULL(0x1BB813384E777D69), __ULL(0x164CD629961E063B), __ULL(0xBA91B0BA28CDCA55),
+  __ULL(0x710743B27BB61CFF), __ULL(0x953F412EFEBC6DF1), __ULL(0x65C57429DC39648B),
+  __ULL(0x3EFBF2092A685C97), __ULL(0x8497FB1AD28E6919), __ULL(0x6237688043091B09),
+  __ULL(0x000C64884455FDF3), __ULL(0xDA8F84E2B67B0D85), __ULL(0x5DFCE96B4CBE45B1),
+  __ULL(0x999264A6ACF2B867), __ULL(0x101335FC940A389F), __ULL(0xBA1337E67E27B64B),
+  __ULL(0x7AEB3B3A5029DCD9), __ULL(0xC01A2AE6814C94DD), __ULL(0x3FE6656318BCE647),
+  __ULL(0x2A78F6E7AFC8EDD5), __ULL(0x2AF15E2744AFC32B), __ULL(0xDAD0BDDC0067785F),
+  __ULL(0x9008140E2C16A30D), __ULL(0x632683AD3CE0A679), __ULL(0x589A1FC56D305531),
+  __ULL(0xD99FD5BB6036A021), __ULL(0x9E652864D0CEAF33), __ULL(0xF088EA24F4EF1BFF),
+  __ULL(0x52ADAC268B0F1C01), __ULL(0x8A86CA56CCA787A3), __ULL(0x394E6DFBA45E93A7),
+  __ULL(0x93B20D09CC663829), __ULL(0x8E7C179E0F08EB8B), __ULL(0x54DBC913574CBA83),
+  __ULL(0x869E93D08377F4D1), __ULL(0x6B9B2C0E6C8C54F3), __ULL(0xA15C59231E9B8577),
+  __ULL(0x7431411276B84DF9), __ULL(0xB5FA629AFB3AFFDB), __ULL(0xDE802351263CF8FD),
+  __ULL(0x520494445896C565), __ULL(0xED1C7305DEC65C91), __ULL(0xC8A8530F4623BA6F),
+  __ULL(0x2BB2B28FDAFBFF99), __ULL(0xA4A7CB8F8C34F24F), __ULL(0x054FFE4043FFE99D),
+  __ULL(0xCEE301BA00769CF7), __ULL(0xEBEE1D8DD929A805), __ULL(0x1E34E34422A1135B),
+  __ULL(0xEBE5630E6BA63359), __ULL(0x40B3355324B0A3C3), __ULL(0x4FB238A1766DA75D),
+  __ULL(0x88CCDDCA44B778B7), __ULL(0xCEFAC4632404DEE1), __ULL(0xE69E5F252B2EAEAD),
+  __ULL(0x114248651C41E087), __ULL(0x4BAECFE856FF8ABF), __ULL(0x7767C28D7BEFE58D),
+  __ULL(0x5D6317710E657C63), __ULL(0x95F83661D65BD667), __ULL(0x8A0BB0F5B77D6657),
+  __ULL(0x3262FC7B8699EC65), __ULL(0x360EDC75A6D302DD), __ULL(0xCAB3A2D950994B4D),
+  __ULL(0xA377E2D438C19A23), __ULL(0x35CCB242ABD7009B), __ULL(0x55666D4FD13F760B),
+  __ULL(0xB12EBA8ED21B7A2D), __ULL(0x11560EFEBE10012F), __ULL(0x0D91471D7ED88839),
+  __ULL(0xD776C0AEF9BECAF1), __ULL(0xA96AF758B874B93D), __ULL(0xE3999843D46B8413),
+  __ULL(0x53BA739F0E730C35), __ULL(0x91ABA7ED78A41DE1), __ULL(0x5056F72CFB521619),
+  __ULL(0xC4C9AA6793F72809), __ULL(0xE11A459A91C409BF), __ULL(0x4CA4E5E277BC4DDB),
+  __ULL(0x6FB693FB39756567), __ULL(0xB92E10E6EA84CB4B), __ULL(0xCC765E3F97D9388F),
+  __ULL(0xC8E57DE6E92539DD), __ULL(0x4B8B0E63E4E95981), __ULL(0x54FF72F5103F182B),
+  __ULL(0xAD9008893C904C45), __ULL(0xE155D9183067786F), __ULL(0xF4D0B4E61421B4BD),
+  __ULL(0xC1DCF1FE2BA7E403), __ULL(0x85651FE6E4236D25), __ULL(0x3DAFC0F60D7AD707),
+  __ULL(0x762597A5E3A5C495), __ULL(0xE3B99C0346A7A80D), __ULL(0x66A2137464F4CEE3),
+  __ULL(0xEFFD04FC7ECB227D), __ULL(0x0096CAE5629D8ECB), __ULL(0x4EE22CAF1DA05159),
+  __ULL(0x4E4A78BC6AF5080F), __ULL(0x619E6DC3AF07A23B), __ULL(0x0A32C1F2EFA8CDCD),
+  __ULL(0x45A8F67DC3BA3FC5), __ULL(0x54C494E08DA8C0A7), __ULL(0xA304B870AB0FD4DF),
+  __ULL(0x46BD8536E787BFCF), __ULL(0xA9A7FA6E13B1A815), __ULL(0xA7EDA1E7B9E29277),
+  __ULL(0xCB2D81B03A74BAF9), __ULL(0xDAE9DCBBC565F4DB), __ULL(0xF5380DBAABCBDDFD),
+  __ULL(0x2F746285BA8BFCA1), __ULL(0xB989CEBE69B64457), __ULL(0x0C069EBC03C90D43),
+  __ULL(0x6B550F4BD0C6D87F), __ULL(0x3B3C2D361639BEB9), __ULL(0xD53E4D41A722B971),
+  __ULL(0x6E0C89CF2F2BFF0D), __ULL(0x185C871948DE5D05), __ULL(0xCC3A292CCB39FBE7),
+  __ULL(0x7ACBE796CCD1A875), __ULL(0x0BE3E5EF0D09941F), __ULL(0xF80B5966A7F86059),
+  __ULL(0x787507910A7B2911), __ULL(0xDDE2933A586E0B33), __ULL(0xD62C5176D23F1801),
+  __ULL(0x914B107E661E05B7), __ULL(0x9E0F28F36BD906EF), __ULL(0x857B8C10E81BF429),
+  __ULL(0x40C6CE615C64B213), __ULL(0xB3041F21263D70D1), __ULL(0xCA7E854A6C5452FB),
+  __ULL(0x1DD8EC92F33B4D87), __ULL(0x9C738DC1594CEF15), __ULL(0x99A69AB14D4DA163),
+  __ULL(0xCF2E6AAD546D2EAF), __ULL(0x9D06F80CB4F160B1), __ULL(0x3A7095DF7ADB27D9),
+  __ULL(0x963ADBB24EE7A7DD), __ULL(0x1E99F8861B2901C9), __ULL(0xE57307AA9738759B),
+  __ULL(0x12E0EB1231F4BF2D), __ULL(0x053595A7F2E63B99), __ULL(0xA7E0441345536E4F),
+  __ULL(0xD3F00897E55C5295), __ULL(0xA7581A1385D8D353), __ULL(0xD94129A18E5A5B21),
+  __ULL(0x6740B3FEE23494ED), __ULL(0x10E2C208B2C67FC3), __ULL(0xD46C83E798EDB4E5),
+  __ULL(0x8AB499B11C7BC9AB), __ULL(0x344CA362DC919AA3), __ULL(0x8A24276C6E94E5EF),
+  __ULL(0xEDB3A3FF80981E3D), __ULL(0xD118682A74AADEA7), __ULL(0x32DE011278964EA5),
+  __ULL(0x41F190E4AE1539FB), __ULL(0x6B8648926E2607F3), __ULL(0xD7057FE0B9DC5863),
+  __ULL(0x11F9C03FE9C7FFB1), __ULL(0x64472EC9C3B5B29F), __ULL(0xF083D52B77F7E04B),
+  __ULL(0x7B3658AD304E36D9), __ULL(0x399B45A7970C8DB3), __ULL(0x8051ACB942246D2B),
+  __ULL(0x301EE558DF6E156F), __ULL(0x1A520D738D7419BD), __ULL(0xC75F29EABA193A61),
+  __ULL(0x34188F1C1B204C89), __ULL(0x2F46A472258119E7), __ULL(0xA6F21C0DEFFC19D7),
+  __ULL(0x78F748AA79C9650F), __ULL(0xC5AFFF3F81F346F1), __ULL(0xE6DD7D1F7CA2D229),
+  __ULL(0x99DA889E8AD29CCF), __ULL(0xA5CF81234C3E981D), __ULL(0x931E14ECE15F326B),
+  __ULL(0x585C5C2352765E85), __ULL(0xAFD626DEB715F19F), __ULL(0x166BB5C24F0FAF65),
+  __ULL(0xCF19CD3FE46D9691), __ULL(0x5BCA970F941F5ED5), __ULL(0x433A103A9ADC7E4D),
+  __ULL(0x4E8689D8DE05ABB9), __ULL(0x7AF1AFC757D60925), __ULL(0xE52DAE03A381D47B),
+  __ULL(0x9B2CB42DB8D7FB89), __ULL(0xD67E296692ADCA73), __ULL(0x6AABAA8DF3B5040D),
+  __ULL(0x10B25903122CB6F7), __ULL(0x2C9C090BD82FAAE3), __ULL(0xB6CB3C217FCD511F),
+  __ULL(0x59BCF7357541C2ED), __ULL(0xC4069FA382156DC3), __ULL(0x5B55FA386052F15D),
+  __ULL(0x8E8D02AB04B81501), __ULL(0x8096DBEA32C292B7), __ULL(0x0FA2CE30C00A1339),
+  __ULL(0xDC18EA76DF968DD1), __ULL(0x6F4FC22B52169309), __ULL(0x068BDCAF0CFC84BF),
+  __ULL(0x4EBD8F60FD4D4CD3), __ULL(0xA564951F0B26F8A1), __ULL(0xD03C6D9FB517EE4B),
+  __ULL(0x9AD55E36A190D38F), __ULL(0x7BC5DC5FCFC35481), __ULL(0x85DFCEADE34E554D),
+  __ULL(0x890F30AD5E6BF2B5), __ULL(0x559851FAD092B703), __ULL(0xA7A26B859EA07D51),
+  __ULL(0x9AA728DBD32EE207), __ULL(0x3744FDCE99DD2441), __ULL(0x429E94373572F57D),
+  __ULL(0x35CCF25A4B8A901F), __ULL(0xE6C022FE7A7429E5), __ULL(0xDBE0154A0888C955),
+  __ULL(0x410264C510D93FA3), __ULL(0xC5ADB9244F5F0E13), __ULL(0x5DD6ACD44EC997E1),
+  __ULL(0x07F3C560F6BF7019), __ULL(0xDDF7941A86882C85), __ULL(0x2FD361C12917DCB1),
+  __ULL(0x7E1E92535AD047F5), __ULL(0x46E4CC1A581363D9), __ULL(0xF6A71BB52335F28F),
+  __ULL(0xFF490CE9000E12B3), __ULL(0x8DD91A58140B5725), __ULL(0x6AEA054C1E5D5989),
+  __ULL(0x3F18DDC60160833F), __ULL(0xD8F3CA16D99823EB), __ULL(0xFA43CCC3808AED79),
+  __ULL(0x01CC861990A09A2F), __ULL(0x13BC1F76DC64C6E7), __ULL(0xBFDEC400DC7B4B75),
+  __ULL(0xAC1226A3F0E366D7), __ULL(0x49266C81593EAB59), __ULL(0x323C01218C1A0C3B),
+  __ULL(0xF7D017B353EF5F5D), __ULL(0xE45ECA6EADE0F0B7), __ULL(0x8E6A7158013FA3F1),
+  __ULL(0x0BBFD03A18CE4EDF), __ULL(0x8369B8443BEB79CF), __ULL(0x71A5E561FDC85887),
+  __ULL(0xBDAB8951509B5215), __ULL(0xF7A78DFEDCAAA2C1), __ULL(0x28754532CB37A7FD),
+  __ULL(0xEB2EB421E4268AE9), __ULL(0xD08C476FE98D7AD3), __ULL(0x5E95CD1F67467C6D),
+  __ULL(0xCF3F0EBCDB57D743), __ULL(0xA6070C9A82AAECC9), __ULL(0xEF2C6F1EF67B5223),
+  __ULL(0xAEC5F83245EDF5BD), __ULL(0x0814A0DF0AE1CF73), __ULL(0x5D92E4F3EAB8090D),
+  __ULL(0x903A30BF413755E7), __ULL(0xB3497AD4AA60C269), __ULL(0xFF4185D525CDBFCB),
+  __ULL(0xD321A1EEDFF087ED), __ULL(0xDF7F06EE26AC6311), __ULL(0x71BB09B861CC965D),
+  __ULL(0x62386B8B98A3E3C7), __ULL(0x117D23F939F11533), __ULL(0x839D7170F4330039),
+  __ULL(0x3E5F06EB208240EF), __ULL(0x011CECD3C3088E29), __ULL(0x5B485166BAE615E1),
+  __ULL(0x3FBE324D136263F9), __ULL(0x266CCAADAA6368AF), __ULL(0xE99B99A0E705034B),
+  __ULL(0x45686A79B7F64D57), __ULL(0x32341C99FA7066BB), __ULL(0x85570E2B3B67C0B3),
+  __ULL(0x80EED2741D915181), __ULL(0xF96BC42D461A350B), __ULL(0x424C105737A79C03),
+  __ULL(0x6C2FCC54EC9CA141), __ULL(0xA2C2E95F7AA88B79), __ULL(0xF4E9A75C3C82DA7D),
+  __ULL(0xA327AA6E4B364D1F), __ULL(0x4DFB1E6DFD20D521), __ULL(0x54BC7B3A13B64211),
+  __ULL(0xA80C140EDF41D313), __ULL(0xC7677EA4A3CB9097), __ULL(0xFAA4EFA1BEFCB7CF),
+  __ULL(0x507B825E1C874B8D), __ULL(0x79A788AF8B75E185), __ULL(0x398C0B9CEE200A4B),
+  __ULL(0xEDAE3A084B8CC543), __ULL(0xB97A3F3D257FF191), __ULL(0x3688C483EAD8869B),
+  __ULL(0x3DB1E7D97FE6E3BD), __ULL(0x8E0117ED44EADE93), __ULL(0x4390A40F1B706C5F),
+  __ULL(0x74E86E3FBA4E4C25), __ULL(0x1745552D760D577B), __ULL(0xD24682FD06B5F8EB),
+  __ULL(0x4799115CCD36B70D), __ULL(0x8EA3DB6505F97453), __ULL(0x673910F897939421),
+  __ULL(0x54CC64A78340D859), __ULL(0xD5C02D10E0FF1001), __ULL(0x00F20AF004BB47A7),
+  __ULL(0xA9A0D62A63695235), __ULL(0x37EBFA0D91728BDF), __ULL(0x8B2A44291F084E83),
+  __ULL(0xE39AE4DDD8D256CF), __ULL(0x319EA46EE33EE21D), __ULL(0x4DBA4D0EC136DC6B),
+  __ULL(0x977996B25A2BB977), __ULL(0x101891834D5026AF), __ULL(0xED25F50B1A2B2B57),
+  __ULL(0xAF66116D90383C43), __ULL(0xE5053C77CBDCD091), __ULL(0x1A90B1DB0367E947),
+  __ULL(0x9C8CCE57F7EA79C9), __ULL(0xB957F751F8C22E6F), __ULL(0x4F2F8D91FBC9430B),
+  __ULL(0x3165BFD1761AB399), __ULL(0x452C0158A12DF325), __ULL(0x363071B8759BD473),
+  __ULL(0x0C4C9CA1372A7F3F), __ULL(0x07FCA4E352350E0D), __ULL(0x6D6D0B3BD4DBF4E3),
+  __ULL(0x5BE9DBFFA6B4E75B), __ULL(0x0329F07AD5348F69), __ULL(0x63C5E5E35D37D4CB),
+  __ULL(0xA2F71F0515BAE759), __ULL(0xF00010FFFEF00011), __ULL(0x9B50282BFD64D0C7),
+  __ULL(0x91791E7945C5ACB7), __ULL(0x6D5722E59703D63D), __ULL(0xE3187BA9E9C70113),
+  __ULL(0xA40638825A7FD2E1), __ULL(0x2F0533ECB6DB9487), __ULL(0xFE3BEEB4B5946E15),
+  __ULL(0xC4FF909E414783FD), __ULL(0x33AB6E1A374196DD), __ULL(0x8839F14C8C7345B3),
+  __ULL(0x8F97CE7C91F0B945), __ULL(0x0D29E5620720D49B), __ULL(0xE1A320C790DC8E2D),
+  __ULL(0x4D0171AC6513054F), __ULL(0xD7F718D18941BC07), __ULL(0x96E1AF8190ACBF7D),
+  __ULL(0xB0A876F5042791D7), __ULL(0xA8928636F79F13E5), __ULL(0xD376FC2F8E577355),
+  __ULL(0x328F0B9B12903C39), __ULL(0xC00C6D3F0BF5BCEF), __ULL(0x8239679CA36A9813),
+  __ULL(0xBDD635AB499F6035), __ULL(0xC554A688B5384D8B), __ULL(0xE8445A89BD5F5D97),
+  __ULL(0xE27878984DEB58FB), __ULL(0x5393D270A94B16F3), __ULL(0xAA22B2FA3DD81DC1),
+  __ULL(0x69B6078D272C1967), __ULL(0x11E1B525D8CFE99F), __ULL(0x6EB7588125136F6D),
+  __ULL(0x4083BE602D03BDD9), __ULL(0x2AFCD84B97208747), __ULL(0xCC961DFED2154D81),
+  __ULL(0x75C527F9B36DFB9B), __ULL(0xF43AE62A28B99517), __ULL(0x2A880867DE581651),
+  __ULL(0x03DB4BCF54A90C7B), __ULL(0x7507DB50EF9D7389), __ULL(0x4614603807051895),
+  __ULL(0x02D3749C8F037D3F), __ULL(0x1494842D68E3B953), __ULL(0xDD80FD7193F13AE5),
+  __ULL(0xCD225E0F021A7C0F), __ULL(0xE6E3E2BEE4D72F49), __ULL(0xC647667BAE560CFF),
+  __ULL(0xCEE9D5433FEEE1CD), __ULL(0x7C942BDC4D77C0A3), __ULL(0xAF0746E3A30CB929),
+  __ULL(0xC7147E34A0CD9CC1), __ULL(0x1DE86774F8FA24E9), __ULL(0xCB2D10D5E05E04D3),
+  __ULL(0x2E2F42DB53DE289F), __ULL(0xEC6F8915F5A37857), __ULL(0xAE53F3A921BC69BB),
+  __ULL(0xFE24BA647541D647), __ULL(0xB6E7711399229C23), __ULL(0x391530A2104CCB6F),
+  __ULL(0xEE641F238472434F), __ULL(0x5AA831B8E7591C41), __ULL(0xCB09BB9464FA4531),
+  __ULL(0xD37BAAD01CACAFE7), __ULL(0x5102B5904F8C1F33), __ULL(0xE9BC13B869CC56AB),
+  __ULL(0x10B1BEB092AADA39), __ULL(0x14F570D32B4E7AC5), __ULL(0xE4CA831DA8B4F61B),
+  __ULL(0x502FE8BBCD6B8FE1), __ULL(0xA32A67BBCF9607AD), __ULL(0x071A06F4485C2A83),
+  __ULL(0x002295B1FEF9FE8D), __ULL(0x925F992C326A3563), __ULL(0x380AE737D89C68FD),
+  __ULL(0x5F15397C9C212D4B), __ULL(0xB642D575F8BE3BDD), __ULL(0x8DEDBBDE375ACB7F),
+  __ULL(0x6469CA882930E44D), __ULL(0x9B4704A85CF0D323), __ULL(0x2B058C4247C01FA9),
+  __ULL(0x90A7C24ACBEF5F0B), __ULL(0xC8603B3FE164EF99), __ULL(0xD2D7FE4463EEE24F),
+  __ULL(0x8DEF6F74292BA695), __ULL(0x375C269DFD8A5BEB), __ULL(0x4739C6E59CEDE753),
+  __ULL(0xEA28F1A96E97C71F), __ULL(0x58415BCB8F4388E5), __ULL(0x99E937A897891DAB),
+  __ULL(0xF638DD0E1B942EA3), __ULL(0x1759C248AACF92A7), __ULL(0x9CD5FA2A94E8CEE1),
+  __ULL(0x3286B2145AA27719), __ULL(0xB8330F13B9E7751D), __ULL(0x4E0AD20602702477),
+  __ULL(0x8C9B2DDF123373B1), __ULL(0xBAE6A1C2D0A0344B), __ULL(0x9B4A4917753B8F43),
+  __ULL(0x6AFD20E1E115C12B), __ULL(0x6FCC32B5E28E5545), __ULL(0x3FBF1BF864C1ADBD),
+  __ULL(0x1627746C101B8EA9), __ULL(0x37268620AAC03351), __ULL(0x50A36059FD90F807),
+  __ULL(0x0ACC4CE57C273479), __ULL(0x769374C936A5F12F), __ULL(0xEF8637D278578331),
+  __ULL(0x20E8DA2D4D93FE53), __ULL(0xDA5657CA4D8FBC49), __ULL(0x1F00A150496FCD33),
+  __ULL(0xFFBE71B9017166CD), __ULL(0x766088B343BE97B7), __ULL(0xCF9B23BAC29365A3),
+  __ULL(0x892EDD43658B48C5), __ULL(0x490F7A9575A72C1D), __ULL(0x71DD2D3FC4FE9F87),
+  __ULL(0x21C6D0B14326BDDB), __ULL(0x0B6E3E3E4EEF49D3), __ULL(0x096CAC903FD62DA1),
+  __ULL(0x871CC30BFE19C557), __ULL(0x9C10E4F55DAF93C9), __ULL(0xD8D9EF3A9C04C97F),
+  __ULL(0x601460E0F1095FB9), __ULL(0x47190AA52C4DE927), __ULL(0xA0E8A9C2D34AFF93),
+  __ULL(0x6F785F6158ADDD25), __ULL(0x5D419D1B7E203EE3), __ULL(0x0130E19D60EC9175),
+  __ULL(0x3EDDE7C0A5A8451F), __ULL(0x5DD5313801A701C3), __ULL(0x7313A51D38F9C739),
+  __ULL(0xDB360E5630A917EF), __ULL(0x52102471965170A5), __ULL(0x4A856D4DD06F01D1),
+  __ULL(0x008FE98BCA88CD6B), __ULL(0x1F5B8A9FD73DBFAF), __ULL(0xB93E967CC576B1B1),
+  __ULL(0x02D48838C40B4DFD), __ULL(0x129A3A691B50424B), __ULL(0xDF1A6BF5587B08D9),
+  __ULL(0x875956EC423205BB), __ULL(0x6DDEE7CA9054C2C9), __ULL(0xA98F9B16A5674881),
+  __ULL(0x88F45E74472F1E37), __ULL(0x5E2D3F9B6FE4A971), __ULL(0xC5298B6C4D4C46B5),
+  __ULL(0x6E54718B60D6645F), __ULL(0x754C129F9B99182D), __ULL(0x24E16CF863C4F151),
+  __ULL(0x88746AB676E53573), __ULL(0xF2659D845C887B95), __ULL(0x1863C964B1D4AF2F),
+  __ULL(0x8D0E3D6C2D6F785B), __ULL(0x0663BDAADC942BD7), __ULL(0xD4FC5B9002E778C3),
+  __ULL(0x5758E56074491911), __ULL(0xCF0707410FBF07FF), __ULL(0xDA01CC59D0C514CD),
+  __ULL(0x17252ABD1273D3A3), __ULL(0x46CA317B7AEC8BE1), __ULL(0xB6FF17E27000F797),
+  __ULL(0x5B60F7B205E417A5), __ULL(0x4990475C1AC49A1D), __ULL(0x03A20E820A413177),
+  __ULL(0x4557A1957EFECFE9), __ULL(0xE4912506E581494B), __ULL(0x2E8AFB03104CF96D),
+  __ULL(0xFAC2587F9D97668F), __ULL(0x582D7FE9D88BC891), __ULL(0x6AE0545BA69A6147),
+  __ULL(0x9A547D525C5026B3), __ULL(0xB4E2F12DE7174781), __ULL(0x63E73342DB058A45),
+  __ULL(0xAB9A3D1CF29A235F), __ULL(0x0BF523F403A6EB61), __ULL(0x15093CBA41A34203),
+  __ULL(0x3054DB86B682767B), __ULL(0xF2901BDAEDEF6507), __ULL(0x889CA2156874A179),
+  __ULL(0x1E8B20B2A791ACE3), __ULL(0x145407A2DAE26031), __ULL(0x41FC78BC7D9F7AE7),
+  __ULL(0x7022448F4AA19F75), __ULL(0xEEF401E1586C9AD7), __ULL(0xBFCC52D55581360F),
+  __ULL(0xFCE218DCB70A4949), __ULL(0x67AA0E0C64CE06FF), __ULL(0x37F1E63B556517F1),
+  __ULL(0x12082E57220F9135), __ULL(0x46386499A96C7AAD), __ULL(0xC47EDBBA0799BFD1),
+  __ULL(0x792B25C339A20C87), __ULL(0xFBED6E4BA61B77F3), __ULL(0x3F0315D0273896C1),
+  __ULL(0x6634E80486467DAF), __ULL(0x9FE800EE2AC9A29F), __ULL(0x24099B9D56C16AA1),
+  __ULL(0x7E9E6B7CA46CF865), __ULL(0x7C014C84DB5AA791), __ULL(0xCE0D96CE8BCFB047),
+  __ULL(0xAA4993EBBA8854B5), __ULL(0x1073B027EE16020B), __ULL(0xAE0C70DF9996BA99),
+  __ULL(0xE908D67A5A0B3C89), __ULL(0x597DC6B6DFAC9B05), __ULL(0x7908101A0EAF6E59),
+  __ULL(0x5C396D3BADC5AB55), __ULL(0xB4E46832549B53B7), __ULL(0x91A16320BBBCE4C5),
+  __ULL(0x2D9934DE4937E01B), __ULL(0x7D0E3671A53909E1), __ULL(0x6F43803FF68891AD),
+  __ULL(0x1AF416753879F5BF), __ULL(0xA4A6D13EB4D3A26B), __ULL(0xF03D6D1F345A8EB1),
+  __ULL(0x9BC74BEF9F8FA5D3), __ULL(0x1FA66CAFD8321F65), __ULL(0xC3EE732177B9D4B3),
+  __ULL(0x826160D4DFAE2527), __ULL(0x0C9703D5B792B9A9), __ULL(0x1A4A9FFBC94D5BB5),
+  __ULL(0x8F76F549E2F73003), __ULL(0xDC066DE102B33A73), __ULL(0xFF1A4745000F5095),
+  __ULL(0xF30A39AF35BDE569), __ULL(0x232A5C4334B1411F), __ULL(0x27AB37CF80C778D7),
+  __ULL(0xE6971088E6AA72E5), __ULL(0x7B94A99A125493EF), __ULL(0xB7CF8A0CD915ECA7),
+  __ULL(0xDEB302299588E713), __ULL(0x882EFAA320F80CA5), __ULL(0x32FB8D94EA3C2BCF),
+  __ULL(0x5B19122F739474BF), __ULL(0x9341700A1FD03E77), __ULL(0xCBA2EEA77D10B585),
+  __ULL(0x5C0D2FE8A5E9BCDD), __ULL(0xBBC52A8F033B95D5), __ULL(0x2EE64CDB5A3BC36F),
+  __ULL(0xFA94010892F25A9B), __ULL(0xD345477F0C666D51), __ULL(0x23C959D1E46BD207),
+  __ULL(0x668FAEF893894CEB), __ULL(0x41A0A28FB5F6CB0D), __ULL(0xF03D2B9C624021CB),
+  __ULL(0xE6D719BA389D8C59), __ULL(0xCF2519476639153B), __ULL(0x7B620CD1380F0401),
+  __ULL(0x0E5300B7C1986019), __ULL(0xAF7216D879637987), __ULL(0x5A75DF907E4913C1),
+  __ULL(0xE26A67C5EEEE306B), __ULL(0x826C725200B49AAF), __ULL(0xF6E5C1246C068BE9),
+  __ULL(0xF5A2774E037EA7A1), __ULL(0x9F4C584236BB556D), __ULL(0x34245DFBEB6A6D65),
+  __ULL(0x5BDD3064D60C08BB), __ULL(0x2AA15F36DA7CADC9), __ULL(0xAB017E1A02E7EEBD),
+  __ULL(0xBF21CA3AA1F24327), __ULL(0x3A4CE70C4CC08993), __ULL(0x06749C5F7BA4EB17),
+  __ULL(0x2846A092C349119D), __ULL(0x18ED87542CED220D), __ULL(0xF56B25C9E4E75005),
+  __ULL(0x872586A803D3CBC3), __ULL(0x3143C1978EA1AE33), __ULL(0x012B732494E319C5),
+  __ULL(0x9215B1D004DE51EF), __ULL(0x0A081D8DC67B0F29), __ULL(0x5FF3BD470A2FD983),
+  __ULL(0xC9587F8E40873BD1), __ULL(0x60EA142C22706BB1), __ULL(0x28F9512B8F3717FD),
+  __ULL(0x7A54C636E497CE57), __ULL(0xF9D8276D7EDD9465), __ULL(0x81B8EB94985B018F),
+  __ULL(0xF42E38743CDD59B3), __ULL(0x583EE3FF8ADD734D), __ULL(0xC1093F4988395227),
+  __ULL(0x39780F6D0EFF06A9), __ULL(0x69EBFA5E9B0EDE5F), __ULL(0x1BF468E16768F699),
+  __ULL(0x24A5BEC0E6CF7007), __ULL(0x2F06269F8B5DAC79), __ULL(0x99A57F7357D9F7ED),
+  __ULL(0x7EFC637B1F5842C3), __ULL(0x1850DDD6F1CDE33B), __ULL(0x932FA5BC87DA1CAB),
+  __ULL(0x11F99952A6B01ECD), __ULL(0x2EAFBB48FC67F039), __ULL(0x328A5B09C36BB435),
+  __ULL(0x4C48F2C8949A9197), __ULL(0xC0DD5201F58F08CF), __ULL(0xB671904AF2DE11C1),
+  __ULL(0x243FE10B280B5B63), __ULL(0x1F0BC0F8E6F06A85), __ULL(0x7AF6229F7AC2CD67),
+  __ULL(0xB018D8789C76DD9F), __ULL(0x648F3B124C85734B), __ULL(0x50F1B03F347C71D9),
+  __ULL(0xECCD60E4809261DD), __ULL(0x979E63AD769530B3), __ULL(0xE24C2FD0EC24606F),
+  __ULL(0xAD8262E7035FCF9B), __ULL(0x0C80BA887F8CDCBD), __ULL(0x40C3505F1497B793),
+  __ULL(0x24906B23BC469D5F), __ULL(0x529D76D39133E07B), __ULL(0x62B185FC0D046C95),
+  __ULL(0x11DAB6BE0270D4E7), __ULL(0xBEC4E8997F49B959), __ULL(0x47DD83C374614A3B),
+  __ULL(0x1D8CD1DEE3773D5D), __ULL(0x7490606DCACA3EB7), __ULL(0x567713070FB3E7C5),
+  __ULL(0x00AB9827EB65BB35), __ULL(0xF4FFD8DF71E9C783), __ULL(0x206774761466A7CF),
+  __ULL(0xA80A1F3C542022F9), __ULL(0x8BA8A6ECB7845185), __ULL(0xDDC8F2844F4718D3),
+  __ULL(0x0662DDDC54671A6D), __ULL(0x6F241527D13DE191), __ULL(0xF66F2E06311EC07F),
+  __ULL(0x4284F5E223A7214D), __ULL(0xD96B5E11FE393023), __ULL(0xCAB178561E033F6F),
+  __ULL(0x7D4270B194AC7EB5), __ULL(0x94CBBAD3F3AFB817), __ULL(0x681D61FC4CBE1499),
+  __ULL(0x9E934ECC8B8B11F7), __ULL(0xFA7728271DF59069), __ULL(0x202722994C2E0F0F),
+  __ULL(0x58862FDCCDF01111), __ULL(0xFFFF0000FFFF0001), __ULL(0x0000000000000000)
+  };
+
+uint64_t ullPrime16Lim[6545]=
+  {
+  __ULL(0), __ULL(0),
+  __ULL(0x5555555555555555), __ULL(0x3333333333333333), __ULL(0x2492492492492492),
+  __ULL(0x1745D1745D1745D1), __ULL(0x13B13B13B13B13B1), __ULL(0x0F0F0F0F0F0F0F0F),
+  __ULL(0x0D79435E50D79435), __ULL(0x0B21642C8590B216), __ULL(0x08D3DCB08D3DCB08),
+  __ULL(0x0842108421084210), __ULL(0x06EB3E45306EB3E4), __ULL(0x063E7063E7063E70),
+  __ULL(0x05F417D05F417D05), __ULL(0x0572620AE4C415C9), __ULL(0x04D4873ECADE304D),
+  __ULL(0x0456C797DD49C341), __ULL(0x04325C53EF368EB0), __ULL(0x03D226357E16ECE5),
+  __ULL(0x039B0AD12073615A), __ULL(0x0381C0E070381C0E), __ULL(0x033D91D2A2067B23),
+  __ULL(0x03159721ED7E7534), __ULL(0x02E05C0B81702E05), __ULL(0x02A3A0FD5C5F02A3),
+  __ULL(0x0288DF0CAC5B3F5D), __ULL(0x027C45979C95204F), __ULL(0x02647C69456217EC),
+  __ULL(0x02593F69B02593F6), __ULL(0x0243F6F0243F6F02), __ULL(0x0204081020408102),
+  __ULL(0x01F44659E4A42715), __ULL(0x01DE5D6E3F8868A4), __ULL(0x01D77B654B82C339),
+  __ULL(0x01B7D6C3DDA338B2), __ULL(0x01B2036406C80D90), __ULL(0x01A16D3F97A4B01A),
+  __ULL(0x01920FB49D0E228D), __ULL(0x01886E5F0ABB0499), __ULL(0x017AD2208E0ECC35),
+  __ULL(0x016E1F76B4337C6C), __ULL(0x016A13CD15372904), __ULL(0x01571ED3C506B39A),
+  __ULL(0x015390948F40FEAC), __ULL(0x014CAB88725AF6E7), __ULL(0x0149539E3B2D066E),
+  __ULL(0x013698DF3DE07479), __ULL(0x0125E22708092F11), __ULL(0x0120B470C67C0D88),
+  __ULL(0x011E2EF3B3FB8744), __ULL(0x0119453808CA29C0), __ULL(0x0112358E75D30336),
+  __ULL(0x010FEF010FEF010F), __ULL(0x0105197F7D734041), __ULL(0x00FF00FF00FF00FF),
+  __ULL(0x00F92FB2211855A8), __ULL(0x00F3A0D52CBA8723), __ULL(0x00F1D48BCEE0D399),
+  __ULL(0x00EC979118F3FC4D), __ULL(0x00E939651FE2D8D3), __ULL(0x00E79372E225FE30),
+  __ULL(0x00DFAC1F74346C57), __ULL(0x00D578E97C3F5FE5), __ULL(0x00D2BA083B445250),
+  __ULL(0x00D161543E28E502), __ULL(0x00CEBCF8BB5B4169), __ULL(0x00C5FE740317F9D0),
+  __ULL(0x00C2780613C0309E), __ULL(0x00BCDD535DB1CC5B), __ULL(0x00BBC8408CD63069),
+  __ULL(0x00B9A7862A0FF465), __ULL(0x00B68D31340E4307), __ULL(0x00B2927C29DA5519),
+  __ULL(0x00AFB321A1496FDF), __ULL(0x00ACEB0F891E6551), __ULL(0x00AB1CBDD3E2970F),
+  __ULL(0x00A87917088E262B), __ULL(0x00A513FD6BB00A51), __ULL(0x00A36E71A2CB0331),
+  __ULL(0x00A03C1688732B30), __ULL(0x009C69169B30446D), __ULL(0x009BAADE8E4A2F6E),
+  __ULL(0x00980E4156201301), __ULL(0x00975A750FF68A58), __ULL(0x009548E4979E0829),
+  __ULL(0x0093EFD1C50E726B), __ULL(0x0091F5BCB8BB02D9), __ULL(0x008F67A1E3FDC261),
+  __ULL(0x008E2917E0E702C6), __ULL(0x008D8BE33F95D715), __ULL(0x008C55841C815ED5),
+  __ULL(0x0088D180CD3A4133), __ULL(0x00869222B1ACF1CE), __ULL(0x0085797B917765AB),
+  __ULL(0x008355ACE3C897DB), __ULL(0x00824A4E60B3262B), __ULL(0x0080C121B28BD1BA),
+  __ULL(0x007DC9F3397D4C29), __ULL(0x007D4ECE8FE88139), __ULL(0x0079237D65BCCE50),
+  __ULL(0x0077CF53C5F7936C), __ULL(0x0075A8ACCFBDD11E), __ULL(0x007467AC557C228E),
+  __ULL(0x00732D70ED8DB8E9), __ULL(0x0072C62A24C3797F), __ULL(0x007194A17F55A10D),
+  __ULL(0x006FA549B41DA7E7), __ULL(0x006E8419E6F61221), __ULL(0x006D68B5356C207B),
+  __ULL(0x006D0B803685C01B), __ULL(0x006BF790A8B2D207), __ULL(0x006AE907EF4B96C2),
+  __ULL(0x006A37991A23AEAD), __ULL(0x0069DFBDD4295B66), __ULL(0x0067DC4C45C8033E),
+  __ULL(0x00663D80FF99C27F), __ULL(0x0065EC17E3559948), __ULL(0x00654AC835CFBA5C),
+  __ULL(0x00645C854AE10772), __ULL(0x006372990E5F901F), __ULL(0x006325913C07BEEF),
+  __ULL(0x006160FF9E9F0061), __ULL(0x0060CDB520E5E88E), __ULL(0x005FF4017FD005FF),
+  __ULL(0x005ED79E31A4DCCD), __ULL(0x005D7D42D48AC5EF), __ULL(0x005C6F35CCBA5028),
+  __ULL(0x005B2618EC6AD0A5), __ULL(0x005A2553748E42E7), __ULL(0x0059686CF744CD5B),
+  __ULL(0x0058AE97BAB79976), __ULL(0x0058345F1876865F), __ULL(0x005743D5BB24795A),
+  __ULL(0x005692C4D1AB74AB), __ULL(0x00561E46A4D5F337), __ULL(0x005538ED06533997),
+  __ULL(0x0054C807F2C0BEC2), __ULL(0x005345EFBC572D36), __ULL(0x00523A758F941345),
+  __ULL(0x005102370F816C89), __ULL(0x0050CF129FB94ACF), __ULL(0x004FD31941CAFDD1),
+  __ULL(0x004FA1704AA75945), __ULL(0x004F3ED6D45A63AD), __ULL(0x004F0DE57154EBED),
+  __ULL(0x004E1CAE8815F811), __ULL(0x004CD47BA5F6FF19), __ULL(0x004C78AE734DF709),
+  __ULL(0x004C4B19ED85CFB8), __ULL(0x004BF093221D1218), __ULL(0x004ABA3C21DC633F),
+  __ULL(0x004A6360C344DE00), __ULL(0x004A383E9F74D68A), __ULL(0x0049E28FBABB9940),
+  __ULL(0x0048417B57C78CD7), __ULL(0x0047F043713F3A2B), __ULL(0x00474FF2A10281CF),
+  __ULL(0x00468B6F9A978F91), __ULL(0x0045F13F1CAFF2E2), __ULL(0x0045A5228CEC23E9),
+  __ULL(0x0045342C556C66B9), __ULL(0x0044C4A23FEECED7), __ULL(0x0043C5C20D3C9FE6),
+  __ULL(0x00437E494B239798), __ULL(0x0043142D118E47CB), __ULL(0x0042AB5C73A13458),
+  __ULL(0x004221950DB0F3DB), __ULL(0x0041BBB2F80A4553), __ULL(0x0040F391612C6680),
+  __ULL(0x0040B1E94173FEFD), __ULL(0x004050647D9D0445), __ULL(0x004030241B144F3B),
+  __ULL(0x003F90C2AB542CB1), __ULL(0x003F71412D59F597), __ULL(0x003F137701B98841),
+  __ULL(0x003E79886B60E278), __ULL(0x003E5B1916A7181D), __ULL(0x003DC4A50968F524),
+  __ULL(0x003DA6E4C9550321), __ULL(0x003D4E4F06F1DEF3), __ULL(0x003C4A6BDD24F9A4),
+  __ULL(0x003C11D54B525C73), __ULL(0x003BF5B1C5721065), __ULL(0x003BBDB9862F23B4),
+  __ULL(0x003B6A8801DB5440), __ULL(0x003B183CF0FED886), __ULL(0x003AABE394BDC3F4),
+  __ULL(0x003A5BA3E76156DA), __ULL(0x003A0C3E953378DB), __ULL(0x0038F03561320B1E),
+  __ULL(0x0038D6ECAEF5908A), __ULL(0x003859CF221E6069), __ULL(0x0037F7415DC9588A),
+  __ULL(0x00377DF0D3902626), __ULL(0x00373622136907FA), __ULL(0x0036EF0C3B39B92F),
+  __ULL(0x0036915F47D55E6D), __ULL(0x0036072CF3F866FD), __ULL(0x0035D9B737BE5EA8),
+  __ULL(0x0035961559CC81C7), __ULL(0x0035531C897A4592), __ULL(0x00353CEEBD3E98A4),
+  __ULL(0x0034FAD381585E5E), __ULL(0x00347884D1103130), __ULL(0x00340DD3AC39BF56),
+  __ULL(0x003351FDFECC140C), __ULL(0x00333D72B089B524), __ULL(0x0033148D44D6B261),
+  __ULL(0x0032D7AEF8412458), __ULL(0x0032C3850E79C0F1), __ULL(0x00328766D59048A2),
+  __ULL(0x00325FA18CB11833), __ULL(0x00324BD659327E22), __ULL(0x0032246E784360F4),
+  __ULL(0x0031AFA5F1A33A08), __ULL(0x00319C63FF398E70), __ULL(0x003162F7519A86A7),
+  __ULL(0x0030271FC9D3FC3C), __ULL(0x002FF104AE89750B), __ULL(0x002FBB62A236D133),
+  __ULL(0x002F74997D2070B4), __ULL(0x002ED84AA8B6FCE3), __ULL(0x002E832DF7A46DBD),
+  __ULL(0x002E0E0846857CAB), __ULL(0x002DECFBDFB55EE6), __ULL(0x002DDC876F3FF488),
+  __ULL(0x002DBBC1D4C482C4), __ULL(0x002D8AF0E0DE0556), __ULL(0x002D4A7B7D14B30A),
+  __ULL(0x002D2A85073BCF4E), __ULL(0x002D1A9AB13E8BE4), __ULL(0x002CEB1EB4B9FD8B),
+  __ULL(0x002C8D503A79794C), __ULL(0x002C404D708784ED), __ULL(0x002C31066315EC52),
+  __ULL(0x002C1297D80F2664), __ULL(0x002C037044C55F6B), __ULL(0x002BE5404CD13086),
+  __ULL(0x002BB845ADAF0CCE), __ULL(0x002B5F62C639F16D), __ULL(0x002B07E6734F2B88),
+  __ULL(0x002ACE569D8342B7), __ULL(0x002A791D5DBD4DCF), __ULL(0x002A4EFF8113017C),
+  __ULL(0x002A3319E156DF32), __ULL(0x002A0986286526EA), __ULL(0x0029D29551D91E39),
+  __ULL(0x0029B7529E109F0A), __ULL(0x00298137491EA465), __ULL(0x0029665E1EB9F9DA),
+  __ULL(0x002909752E019A5E), __ULL(0x0028EF35E2E5EFB0), __ULL(0x0028C815AA4B8278),
+  __ULL(0x0028BB1B867199DA), __ULL(0x0028A13FF5D7B002), __ULL(0x00287AB3F173E755),
+  __ULL(0x00286DEAD67713BD), __ULL(0x002847BFCDA6503E), __ULL(0x002808C1EA6B4777),
+  __ULL(0x00278D0E0F23FF61), __ULL(0x002768863C093C7F), __ULL(0x0027505115A73CA8),
+  __ULL(0x00274441A61DC1B9), __ULL(0x0026B5C166113CF0), __ULL(0x00269E65AD07B18E),
+  __ULL(0x002692C25F877560), __ULL(0x002658FA7523CD11), __ULL(0x0026148710CF0F9E),
+  __ULL(0x002609363B22524F), __ULL(0x0025D1065A1C1122), __ULL(0x0025A48A382B863F),
+  __ULL(0x0025837190ECCDBC), __ULL(0x00256292E95D510C), __ULL(0x002541EDA98D068C),
+  __ULL(0x0024E15087FED8F5), __ULL(0x0024C18B20979E5D), __ULL(0x0024AC7B336DE0C5),
+  __ULL(0x0024A1FC478C60BB), __ULL(0x002463801231C009), __ULL(0x0024300FD506ED33),
+  __ULL(0x0023F314A494DA81), __ULL(0x0023CADEDD2FAD3A), __ULL(0x00237B7ED2664A03),
+  __ULL(0x0023372967DBAF1D), __ULL(0x00231A308A371F20), __ULL(0x002306FA63E1E600),
+  __ULL(0x0022FD6731575684), __ULL(0x0022EA507805749C), __ULL(0x0022E0CCE8B3D720),
+  __ULL(0x0022B1887857D161), __ULL(0x00227977FCC49CC0), __ULL(0x00225DB37B5E5F4F),
+  __ULL(0x0022421B91322ED6), __ULL(0x0021F05B35F52102), __ULL(0x0021E75DE5C70D60),
+  __ULL(0x0021A01D6C19BE96), __ULL(0x0021974A6615C81A), __ULL(0x00213767697CF36A),
+  __ULL(0x00211D9F7FAD35F1), __ULL(0x0020FB7D9DD36C18), __ULL(0x0020E2123D661E0E),
+  __ULL(0x0020D135B66AE990), __ULL(0x0020C8CDED4D7A8E), __ULL(0x0020B80B3F43DDBF),
+  __ULL(0x002096B9180F46A6), __ULL(0x00207DE7E28DE5DA), __ULL(0x002054DEC8CF1FB3),
+  __ULL(0x00204CB630B3AAB5), __ULL(0x00202428ADC37BEB), __ULL(0x001FEC0C7834DEF4),
+  __ULL(0x001FC46FAE98A1D0), __ULL(0x001FACDA430FF619), __ULL(0x001F7E17DD8E15E5),
+  __ULL(0x001F765A3556A4EE), __ULL(0x001F66EA49D802F1), __ULL(0x001F5F3800FAF9C0),
+  __ULL(0x001F38F4E6C0F1F9), __ULL(0x001F0B8546752578), __ULL(0x001F03FF83F001F0),
+  __ULL(0x001EC853B0A3883C), __ULL(0x001EC0EE573723EB), __ULL(0x001EAAD38E6F6894),
+  __ULL(0x001E9C28A765FE53), __ULL(0x001E94D8758C2003), __ULL(0x001E707BA8F65E68),
+  __ULL(0x001E53A2A68F574E), __ULL(0x001E1380A56B438D), __ULL(0x001DBF9F513A3802),
+  __ULL(0x001DB1D1D58BC600), __ULL(0x001D9D358F53DE38), __ULL(0x001D81E6DF6165C7),
+  __ULL(0x001D4BDF7FD40E30), __ULL(0x001D452C7A1C958D), __ULL(0x001D37CF9B902659),
+  __ULL(0x001D1D3A5791E97B), __ULL(0x001CE89FE6B47416), __ULL(0x001CE219F3235071),
+  __ULL(0x001CD516DCF92139), __ULL(0x001CBB33BD1C2B8B), __ULL(0x001CA7E7D2546688),
+  __ULL(0x001C94B5C1B3DBD3), __ULL(0x001C87F7F9C241C1), __ULL(0x001C6202706C35A9),
+  __ULL(0x001C5BB8A9437632), __ULL(0x001C174343B4111E), __ULL(0x001C04D0D3E46B42),
+  __ULL(0x001BFEB00FBF4308), __ULL(0x001BEC5DCE0B202D), __ULL(0x001BE03444620037),
+  __ULL(0x001BCE09C66F6FC3), __ULL(0x001BA40228D02B30), __ULL(0x001B9225B1CF8919),
+  __ULL(0x001B864A2FF3F53F), __ULL(0x001B80604150E49B), __ULL(0x001B6EB1AAEAACF3),
+  __ULL(0x001B62F48DA3C8CC), __ULL(0x001B516BABE96092), __ULL(0x001B2E9CEF1E0C87),
+  __ULL(0x001B1D56BEDC849B), __ULL(0x001B0C267546AEC0), __ULL(0x001AE45F62024FA0),
+  __ULL(0x001AD917631B5F54), __ULL(0x001AC83D18CB608F), __ULL(0x001AA6C7AD8C063F),
+  __ULL(0x001A90A7B1228E2A), __ULL(0x001A8027C03BA059), __ULL(0x001A7533289DEB89),
+  __ULL(0x001A2ED7CE16B49F), __ULL(0x0019FEFC0A279A73), __ULL(0x0019E4B0CD873B5F),
+  __ULL(0x0019CFCDFD60E514), __ULL(0x0019C56932D66C85), __ULL(0x0019B5E1AB6FC7C2),
+  __ULL(0x0019B0B8A62F2A73), __ULL(0x0019A149FC98942C), __ULL(0x001969517EC25B85),
+  __ULL(0x00194B3083360BA8), __ULL(0x00194631F4BEBDC1), __ULL(0x00191E84127268FD),
+  __ULL(0x00190ADBB543984F), __ULL(0x001901130BD18200), __ULL(0x0018E3E6B889AC94),
+  __ULL(0x0018C233420E1EC1), __ULL(0x0018AA5872D92BD6), __ULL(0x0018A5989945CCF9),
+  __ULL(0x00189C1E60B57F60), __ULL(0x0018893FBC8690B9), __ULL(0x00187B2BB3E1041C),
+  __ULL(0x00186D27C9CDCFB8), __ULL(0x001863D8BF4F2C1C), __ULL(0x00185F33E2AD7593),
+  __ULL(0x001855EF75973E13), __ULL(0x001848160153F134), __ULL(0x001835B72E6F0656),
+  __ULL(0x00182C922D83EB39), __ULL(0x0018280243C0365A), __ULL(0x00181A5CD5898E73),
+  __ULL(0x001803C0961773AA), __ULL(0x0017FF4005FFD001), __ULL(0x0017E8D670433EDB),
+  __ULL(0x0017D7066CF4BB5D), __ULL(0x0017CE285B806B1F), __ULL(0x0017AF52CDF27E02),
+  __ULL(0x0017997D47D01039), __ULL(0x00177F7EC2C6D0BA), __ULL(0x00177B2F3CD00756),
+  __ULL(0x00176E4A22F692A0), __ULL(0x001765B94271E11B), __ULL(0x001761732B044AE4),
+  __ULL(0x00173F7A5300A2BC), __ULL(0x001722112B48BE1F), __ULL(0x001719B7A16EB843),
+  __ULL(0x00170D3C99CC5052), __ULL(0x0016FCAD7AED3BB6), __ULL(0x0016F051B8231FFD),
+  __ULL(0x0016E81BEAE20643), __ULL(0x0016C3721584C1D8), __ULL(0x0016B34C2BA09663),
+  __ULL(0x00169F3CE292DDCD), __ULL(0x00169344B2220A0D), __ULL(0x001687592593C1B1),
+  __ULL(0x00167787F1418EC9), __ULL(0x001663E190395FF2), __ULL(0x00164C7A4B6EB5B3),
+  __ULL(0x0016316A061182FD), __ULL(0x001629BA914584E4), __ULL(0x00161E3D57DE21B2),
+  __ULL(0x001612CC01B977F0), __ULL(0x00160EFE30C525FF), __ULL(0x0015DA45249EC5DE),
+  __ULL(0x0015D68AB4ACFF92), __ULL(0x0015C3F989D1EB15), __ULL(0x0015B535AD11B8F0),
+  __ULL(0x0015ADDB3F424EC1), __ULL(0x00159445CB91BE6B), __ULL(0x00158D0199771E63),
+  __ULL(0x00157E87D9B69E04), __ULL(0x001568F58BC01AC3), __ULL(0x00155E3C993FDA9B),
+  __ULL(0x001548EACC5E1E6E), __ULL(0x001541D8F91BA6A7), __ULL(0x00153747060CC340),
+  __ULL(0x001514569F93F7C4), __ULL(0x00150309705D3D79), __ULL(0x0014FF97020CF5BF),
+  __ULL(0x0014E42C114CF47E), __ULL(0x0014B835BDCB6447), __ULL(0x0014B182B53A9AB7),
+  __ULL(0x0014AE2AD094A3D3), __ULL(0x00149A320EA59F96), __ULL(0x001490441DE1A2FB),
+  __ULL(0x001489AACCE57200), __ULL(0x001475F82AD6FF99), __ULL(0x00146C2CFE53204F),
+  __ULL(0x00145F2CA490D4A1), __ULL(0x001458B2AAE0EC87), __ULL(0x00144BCB0A3A3150),
+  __ULL(0x001428A1E65441D4), __ULL(0x00142575A6C210D7), __ULL(0x00141F2025BA5C46),
+  __ULL(0x00141BF6E35420FD), __ULL(0x001409141D1D313A), __ULL(0x0013DD8BC19C3513),
+  __ULL(0x0013DA76F714DC8F), __ULL(0x0013D13E50F8F49E), __ULL(0x0013C80E37CA3819),
+  __ULL(0x0013BEE69FA99CCF), __ULL(0x0013B8D0EDE55835), __ULL(0x0013AFB7680BB054),
+  __ULL(0x0013ACB0C3841C96), __ULL(0x00139A9C5F434FDE), __ULL(0x0013949CF33A0D9D),
+  __ULL(0x001382B4A00C31B0), __ULL(0x00137FBBC0EEDCBB), __ULL(0x001370ECF047B069),
+  __ULL(0x00136DF9790E3155), __ULL(0x0013567DD8DEFD5B), __ULL(0x0013539261FDBC34),
+  __ULL(0x00133C564292D28A), __ULL(0x001333AE178D6388), __ULL(0x0013170AD00D1FD7),
+  __ULL(0x0013005F01DB0947), __ULL(0x0012F51D40342210), __ULL(0x0012EF815E4ED950),
+  __ULL(0x0012ECB4ABCCD827), __ULL(0x0012E71DC1D3D820), __ULL(0x0012E45389A16495),
+  __ULL(0x0012C5D9226476CC), __ULL(0x0012BADC391156FD), __ULL(0x0012AA78E412F522),
+  __ULL(0x0012A251F5F47FD1), __ULL(0x001294CB85C53534), __ULL(0x0012921963BEB65E),
+  __ULL(0x00128CB777C69CA8), __ULL(0x001284AA6CF07294), __ULL(0x001281FCF6AC7F87),
+  __ULL(0x001279F937367DB9), __ULL(0x00126CAD0488BE94), __ULL(0x00126A06794646A2),
+  __ULL(0x00125A2F2BCD3E95), __ULL(0x00124D108389E6B1), __ULL(0x00124A73083771AC),
+  __ULL(0x00123D6ACDA0620A), __ULL(0x00122B4B2917EAFD), __ULL(0x00122391BFCE1E2F),
+  __ULL(0x00121E6F1EA579F2), __ULL(0x001216C09E471568), __ULL(0x00120C8CB9D93909),
+  __ULL(0x001204ED58E64EF9), __ULL(0x0011FD546578F00C), __ULL(0x0011E9310B8B4C9C),
+  __ULL(0x0011DA3405DB9911), __ULL(0x0011D7B6F4EB055D), __ULL(0x0011D2BEE748C145),
+  __ULL(0x0011C1706DDCE7A7), __ULL(0x0011BA0FED2A4F14), __ULL(0x0011B528538ED64A),
+  __ULL(0x0011AB61404242AC), __ULL(0x00119F378CE81D2F), __ULL(0x001195889ECE79DA),
+  __ULL(0x00118E4C65387077), __ULL(0x001187161D70E725), __ULL(0x00116CD6D1C85239),
+  __ULL(0x001165BBE7CE86B1), __ULL(0x0011635EE344CE36), __ULL(0x0011579767B6D679),
+  __ULL(0x00114734711E2B54), __ULL(0x0011428B90147F05), __ULL(0x00113B92F3021636),
+  __ULL(0x001126CABC886884), __ULL(0x0011247EB1B85976), __ULL(0x0011190BB01EFD65),
+  __ULL(0x0011091DE0FD679C), __ULL(0x001104963C7E4E0B), __ULL(0x00110253516420B0),
+  __ULL(0x0010F70DB7C41797), __ULL(0x0010E75EE2BF9ECD), __ULL(0x0010E2E91C6E0676),
+  __ULL(0x0010DA049B9D428D), __ULL(0x0010C6248FE3B1A2), __ULL(0x0010C1C03ED690EB),
+  __ULL(0x0010BB2E1379E3A2), __ULL(0x0010B8FE7F61228E), __ULL(0x0010B4A10D60A4F7),
+  __ULL(0x0010AE192681EC0F), __ULL(0x0010ABECFBE5B0AE), __ULL(0x00109EEFD568B96D),
+  __ULL(0x00109A9FF178B40C), __ULL(0x00108531E22F9FF9), __ULL(0x00106DDEC1AF4417),
+  __ULL(0x0010614174A4911D), __ULL(0x00105F291F0448E7), __ULL(0x00105AFA0EF32891),
+  __ULL(0x001054B777BD2530), __ULL(0x00104E79A97FB69E), __ULL(0x00104C661EAFD845),
+  __ULL(0x0010462EA939C933), __ULL(0x00102F8BAA442836), __ULL(0x00102D7FF7E94004),
+  __ULL(0x0010275FF9F13C02), __ULL(0x001017213FCBB4D3), __ULL(0x00101112234579D1),
+  __ULL(0x00100501907D271C), __ULL(0x00100300901B0510), __ULL(0x000FFD008FE5050F),
+  __ULL(0x000FF10E02DD5084), __ULL(0x000FE13B9C80C67F), __ULL(0x000FDF4384BE37AD),
+  __ULL(0x000FDB54CBE8766E), __ULL(0x000FD5725CA6FF32), __ULL(0x000FC7C84684C6FB),
+  __ULL(0x000FC3E5265DBAA8), __ULL(0x000FC1F44E0CAE12), __ULL(0x000FB0921C50A7AF),
+  __ULL(0x000F999FD70CBC6B), __ULL(0x000F9023FD5339D0), __ULL(0x000F8A78CE671475),
+  __ULL(0x000F8895FEE86574), __ULL(0x000F7F2ECB084B10), __ULL(0x000F7D4EB7D10C29),
+  __ULL(0x000F73F52277A3C3), __ULL(0x000F7217C598961C), __ULL(0x000F68CBB1448F42),
+  __ULL(0x000F633D0276E4C5), __ULL(0x000F6163AC20EC79), __ULL(0x000F582BA2BC16C6),
+  __ULL(0x000F5654F43290A0), __ULL(0x000F4D2A23810BC6), __ULL(0x000F47AF4D6A2F27),
+  __ULL(0x000F4066F2B6E652), __ULL(0x000F2555048E3A92), __ULL(0x000F1C64588A5BF6),
+  __ULL(0x000F1A9BE09CB411), __ULL(0x000F11B7D5259D39), __ULL(0x000F0AA284E7F802),
+  __ULL(0x000F0556E5E3B7F2), __ULL(0x000EFC8BCBC808E5), __ULL(0x000EECD1A690EFBB),
+  __ULL(0x000EE79AED6D65F2), __ULL(0x000EDD386114D83A), __ULL(0x000ED2E44366E5E2),
+  __ULL(0x000ED12CF8E17F64), __ULL(0x000EC1CD284B2B2D), __ULL(0x000EBCB44CADDA1E),
+  __ULL(0x000EB9505943771D), __ULL(0x000EB43D57EFEADC), __ULL(0x000EAF2DD4C00B03),
+  __ULL(0x000EA0141C1BA6A6), __ULL(0x000E9E68805F05A7), __ULL(0x000E96142B87E431),
+  __ULL(0x000E8A7ACD811B8C), __ULL(0x000E8587DB3E001D), __ULL(0x000E823D186D44DC),
+  __ULL(0x000E8098463EE194), __ULL(0x000E7D4FBFB3EE1D), __ULL(0x000E69BBA6981FFA),
+  __ULL(0x000E681C5CF7D707), __ULL(0x000E5E684930E334), __ULL(0x000E5993247DC92D),
+  __ULL(0x000E4CBFEE201016), __ULL(0x000E465EE7DAF979), __ULL(0x000E4199DE07AF5C),
+  __ULL(0x000E3CD8031D4F40), __ULL(0x000E2EA56C157EB2), __ULL(0x000E221E5D4D3C73),
+  __ULL(0x000E208F09A841C7), __ULL(0x000E1D716A945161), __ULL(0x000E18C78EC8FD4D),
+  __ULL(0x000E173A4A162079), __ULL(0x000E1294881BB494), __ULL(0x000E0DF1D5F24661),
+  __ULL(0x000E063EC7F50B1E), __ULL(0x000E01A4313DC53D), __ULL(0x000DF8780F47C350),
+  __ULL(0x000DEF57E8EB9666), __ULL(0x000DE1BDF3F63D46), __ULL(0x000DE03CB5099809),
+  __ULL(0x000DDBBAECC84BC9), __ULL(0x000DD8BB5CA73DB6), __ULL(0x000DCB4D529A6E07),
+  __ULL(0x000DC55DA73DEA60), __ULL(0x000DB3AD2585011F), __ULL(0x000DB0BECF636A79),
+  __ULL(0x000DAF481CA6FEFB), __ULL(0x000DAC5BA7565DAE), __ULL(0x000DA7FB4E419D19),
+  __ULL(0x000DA6867A88D327), __ULL(0x000D9DD005F50B02), __ULL(0x000D9AEB01F763F7),
+  __ULL(0x000D90D31DD5804A), __ULL(0x000D7B6453358F31), __ULL(0x000D744E69D900E4),
+  __ULL(0x000D7011A317260E), __ULL(0x000D67A0126E7C19), __ULL(0x000D5DD39E775BD7),
+  __ULL(0x000D59A4F2990168), __ULL(0x000D52B24CB6269D), __ULL(0x000D4A6571DA4F04),
+  __ULL(0x000D49044EAC6581), __ULL(0x000D4642E40D1129), __ULL(0x000D4222E81FE723),
+  __ULL(0x000D3CA6E8C89F41), __ULL(0x000D388CE29D4EDC), __ULL(0x000D31BC7B7D8013),
+  __ULL(0x000D306071C13FD5), __ULL(0x000D2DA935479B1A), __ULL(0x000D2430AA043597),
+  __ULL(0x000D2025BC6C7DB7), __ULL(0x000D1C1D4AD1732B), __ULL(0x000D196E5F46F8C8),
+  __ULL(0x000D156A0C9293E8), __ULL(0x000D1413D26E0AEE), __ULL(0x000D0D68C6A4128F),
+  __ULL(0x000D0C142EAF3837), __ULL(0x000D01792AB9D70D), __ULL(0x000CF990317775BC),
+  __ULL(0x000CF44F8C38790A), __ULL(0x000CE88D96D10E45), __ULL(0x000CE5F39B07E906),
+  __ULL(0x000CE20E98148847), __ULL(0x000CDA4B9C30CCD7), __ULL(0x000CD9015AE32495),
+  __ULL(0x000CD524244ACA36), __ULL(0x000CD14940099CF6), __ULL(0x000CCD70AC089A07),
+  __ULL(0x000CBB9C535C4371), __ULL(0x000CB7D0B46FE0FF), __ULL(0x000CAEFE5D7135F4),
+  __ULL(0x000CAC7B5F00F0CD), __ULL(0x000CA7785CEDDBEA), __ULL(0x000CA13A2A86E1DB),
+  __ULL(0x000C9C4009753007), __ULL(0x000C94D02E64BFAB), __ULL(0x000C89B8C9C875EF),
+  __ULL(0x000C87447737277E), __ULL(0x000C860AAA2514E3), __ULL(0x000C8397C813F1B9),
+  __ULL(0x000C74FA805D6D56), __ULL(0x000C6DB8A1F5CDFE), __ULL(0x000C6A1ADD9E2398),
+  __ULL(0x000C68E6BE826648), __ULL(0x000C5F4E25FC9DF0), __ULL(0x000C5BB8BF2AD1CD),
+  __ULL(0x000C58256B316CED), __ULL(0x000C4FD5AD917B5B), __ULL(0x000C49ECB3EA4D7A),
+  __ULL(0x000C41B00B7D950A), __ULL(0x000C3F57990B87A1), __ULL(0x000C2DDCB31250F8),
+  __ULL(0x000C2A63B3651432), __ULL(0x000C26ECAE1DB72E), __ULL(0x000C2377A18C051E),
+  __ULL(0x000C1EDE9EFCEC29), __ULL(0x000C1B6E258D13A0), __ULL(0x000C19243F5399BB),
+  __ULL(0x000C17FF9F400305), __ULL(0x000C112865703B94), __ULL(0x000C0DBFAEA33225),
+  __ULL(0x000C0B7AF12DDFB9), __ULL(0x000C0A58E464462C), __ULL(0x000C06F40512EEF2),
+  __ULL(0x000BFA9275A2B247), __ULL(0x000BF7367402CDF0), __ULL(0x000BF61833F4F921),
+  __ULL(0x000BF3DC543A74A1), __ULL(0x000BE9D9302A7115), __ULL(0x000BE8BD6E051E01),
+  __ULL(0x000BE6868804D5A6), __ULL(0x000BDFE6C4359F0E), __ULL(0x000BDECCDB0B5C3A),
+  __ULL(0x000BDB8058EE429A), __ULL(0x000BD94E5C1B371F), __ULL(0x000BCB1D293B1AF3),
+  __ULL(0x000BC7DB8DB0C1A5), __ULL(0x000BC49BBDFD2662), __ULL(0x000BC2723240F402),
+  __ULL(0x000BBE217C2B7C13), __ULL(0x000BB8C10AAB27B2), __ULL(0x000BA7AD528A7E79),
+  __ULL(0x000B9F3611B48C5E), __ULL(0x000B9E2806E5E7C4), __ULL(0x000B9AFF0C4913FE),
+  __ULL(0x000B98E4AEDD581C), __ULL(0x000B97D7C94B7DC2), __ULL(0x000B95BE902D9D9E),
+  __ULL(0x000B94B23C872B90), __ULL(0x000B8F77714D15A1), __ULL(0x000B882D0BEFF6A1),
+  __ULL(0x000B850FF9852703), __ULL(0x000B82FD86DB8806), __ULL(0x000B7EDADD32F76C),
+  __ULL(0x000B79B3B4DF3B7B), __ULL(0x000B769E6D59833F), __ULL(0x000B6C636B5141FF),
+  __ULL(0x000B6A59CEAE8801), __ULL(0x000B6955461E38F7), __ULL(0x000B6648C2DC6BC2),
+  __ULL(0x000B572282260209), __ULL(0x000B552072BDE889), __ULL(0x000B511E7552F9C4),
+  __ULL(0x000B4C1FF34A5C0E), __ULL(0x000B4922F58D4AA2), __ULL(0x000B46278C16B967),
+  __ULL(0x000B42301CD99B49), __ULL(0x000B3F385DD77E4E), __ULL(0x000B394D8EF8F0F6),
+  __ULL(0x000B375601507C14), __ULL(0x000B3463F76BE376), __ULL(0x000B3368F6C4A07C),
+  __ULL(0x000B3078FC1C25F0), __ULL(0x000B2E84854E93E5), __ULL(0x000B2B971AA909A4),
+  __ULL(0x000B2A9DA39D6BC8), __ULL(0x000B25C0DC29A0FC), __ULL(0x000B24C8698449A7),
+  __ULL(0x000B1D0AE579AEFE), __ULL(0x000B1A2698EA2F9E), __ULL(0x000B108DC4186078),
+  __ULL(0x000B0EA463B00212), __ULL(0x000B08EC37007962), __ULL(0x000B024778CC023C),
+  __ULL(0x000AF515DF36A88E), __ULL(0x000AF24635F6561E), __ULL(0x000AE8F1B92BAEAF),
+  __ULL(0x000AE715EEE11F8E), __ULL(0x000ADEC0B0A3BB36), __ULL(0x000ADB10AA4C956F),
+  __ULL(0x000AD84E49752245), __ULL(0x000AD6782597F0C2), __ULL(0x000AD3B81A0D72FE),
+  __ULL(0x000ACD52BECED79E), __ULL(0x000ACA9755063254), __ULL(0x000AC7DD4CAFB12A),
+  __ULL(0x000AC354F80DCA44), __ULL(0x000AC26D5C2B8AD2), __ULL(0x000ABDE997DABD3D),
+  __ULL(0x000AB883AA1100A0), __ULL(0x000AB4ED637F5A0B), __ULL(0x000AB074E9FEBF52),
+  __ULL(0x000AAF90778C2039), __ULL(0x000AAB1C7684F034), __ULL(0x000AA78F20EBBB3E),
+  __ULL(0x000AA23F8DAFD4CC), __ULL(0x000A9DD69CAD5934), __ULL(0x000A935004A07302),
+  __ULL(0x000A9270690F3D14), __ULL(0x000A90B1A0AA5D30), __ULL(0x000A8D35C9D731E9),
+  __ULL(0x000A8A9A6A51F16C), __ULL(0x000A88DE370F596B), __ULL(0x000A856786ADAE36),
+  __ULL(0x000A7DA4C77D3161), __ULL(0x000A7959F863D4A1), __ULL(0x000A76C85E80C195),
+  __ULL(0x000A743806DC44C4), __ULL(0x000A735D866DFA0A), __ULL(0x000A70CEDB02531E),
+  __ULL(0x000A6C8E842C770F), __ULL(0x000A67791215DD74), __ULL(0x000A66A0A51D363D),
+  __ULL(0x000A626893011861), __ULL(0x000A5FE22C55C089), __ULL(0x000A5D5CFFB77275),
+  __ULL(0x000A5AD90C4186E5), __ULL(0x000A578057E7C2EB), __ULL(0x000A54FF3BB10E91),
+  __ULL(0x000A50D5683EDC94), __ULL(0x000A4E57854B3DF4), __ULL(0x000A4D8328C4B800),
+  __ULL(0x000A4B06E01D97B3), __ULL(0x000A488BCA2C4449), __ULL(0x000A4611E6132ED5),
+  __ULL(0x000A41F40F39E646), __ULL(0x000A3EAB5C3E44E9), __ULL(0x000A34DDD50561E0),
+  __ULL(0x000A326D60E94186), __ULL(0x000A2985A81CE614), __ULL(0x000A28B72E26F82E),
+  __ULL(0x000A217AA3479693), __ULL(0x000A1FE05C62DF4B), __ULL(0x000A1CAD538AEBF9),
+  __ULL(0x000A18B05F490083), __ULL(0x000A0CCC4C28FC31), __ULL(0x000A09A544D01FFE),
+  __ULL(0x000A0294AA53E9A2), __ULL(0x000A01041A6AAED5), __ULL(0x000A003C01680870),
+  __ULL(0x0009FC5558A971C8), __ULL(0x0009F9FF9C3C03E5), __ULL(0x0009F9389B864AB9),
+  __ULL(0x0009F6E4534BDCA8), __ULL(0x0009F557687235C2), __ULL(0x0009EE633C0391AB),
+  __ULL(0x0009EB4F28E0BB39), __ULL(0x0009E6B49E92E4BB), __ULL(0x0009DFD4CCBD0045),
+  __ULL(0x0009D9C0828536C1), __ULL(0x0009D77AD449F777), __ULL(0x0009D6B92B28EE48),
+  __ULL(0x0009D231A476ED51), __ULL(0x0009CFEF711BF120), __ULL(0x0009CC2E1448B765),
+  __ULL(0x0009CB6E26CBC64D), __ULL(0x0009C7B03B4A9C67), __ULL(0x0009C6F0FD980AB1),
+  __ULL(0x0009C4B3F3A30C3F), __ULL(0x0009C0FB29436687), __ULL(0x0009BBCA025B7AEC),
+  __ULL(0x0009BA4F4421E52C), __ULL(0x0009B1783809FF03), __ULL(0x0009B0BC5B4D2EAC),
+  __ULL(0x0009AAE172FD8B9C), __ULL(0x0009AA26954607ED), __ULL(0x0009A681E758A022),
+  __ULL(0x0009A5C7B284942E), __ULL(0x0009A2264ECC5558), __ULL(0x00099AEBB39BE56F),
+  __ULL(0x0009997AE1A9FAAC), __ULL(0x000998C2A22B6900), __ULL(0x000997527603F8A8),
+  __ULL(0x00099473685E4D50), __ULL(0x00098EBA72512A13), __ULL(0x00098C96D8DEE9E1),
+  __ULL(0x00098A743453554E), __ULL(0x000989BE33C9E6BD), __ULL(0x0009857C692E9A59),
+  __ULL(0x00097FD540C05C9E), __ULL(0x00097D04302ED944), __ULL(0x00097B9C48289935),
+  __ULL(0x0009798133ECE717), __ULL(0x00096F07C683689E), __ULL(0x00096E55D6393FC5),
+  __ULL(0x00096ADDAD861696), __ULL(0x00096A2C5A2CF0CF), __ULL(0x00096818FC825EBA),
+  __ULL(0x000966B74027F48A), __ULL(0x000964A56850B8ED), __ULL(0x000962947990EB36),
+  __ULL(0x00095FD4A4C885E0), __ULL(0x00095DC5D3954FDE), __ULL(0x00095C671DDFE516),
+  __ULL(0x0009584D6340DDF1), __ULL(0x00095641DE84AFCC), __ULL(0x000953893C386521),
+  __ULL(0x00094F7740D87794), __ULL(0x00094E1CB70C9CE0), __ULL(0x00094962ECBCC7CE),
+  __ULL(0x00094559C69059CF), __ULL(0x000941FF7E640716), __ULL(0x000939FD7A24B099),
+  __ULL(0x000937FF22C014BD), __ULL(0x000934050872C09E), __ULL(0x00093209446D56F6),
+  __ULL(0x0009316033B5BD22), __ULL(0x00092A22B9A79374), __ULL(0x000927838EDBA206),
+  __ULL(0x000921A2E7112833), __ULL(0x00091E623D5660D0), __ULL(0x00091C6FC0CAB8B6),
+  __ULL(0x000917E7D88028EB), __ULL(0x0009169D455585CD), __ULL(0x000915F81EF2D529),
+  __ULL(0x0009140938595D3A), __ULL(0x000910D2360A450E), __ULL(0x00090E417104EABD),
+  __ULL(0x00090C55D0FDEA28), __ULL(0x00090B0E84C04F20), __ULL(0x000909243FAC6B70),
+  __ULL(0x0008FF9D0440D137), __ULL(0x0008FB3192789D73), __ULL(0x0008F80C0D5031E3),
+  __ULL(0x0008F76B3664F164), __ULL(0x0008F3A80550ABC3), __ULL(0x0008F087C50E00C4),
+  __ULL(0x0008EFE7FB408CC2), __ULL(0x0008EAECCE5C4FD7), __ULL(0x0008EA4DCCAAEC0B),
+  __ULL(0x0008E4BA9FBC2FF0), __ULL(0x0008DD5688A3B7D6), __ULL(0x0008D7D3821FD94F),
+  __ULL(0x0008D5FEB03C31D7), __ULL(0x0008D12033CC9D30), __ULL(0x0008CBAC4DEC6A82),
+  __ULL(0x0008C9DC80AB604B), __ULL(0x0008C942115DCC96), __ULL(0x0008C3D7DF67B539),
+  __ULL(0x0008C2A4BC35CB3B), __ULL(0x0008C0D8A4F1F264), __ULL(0x0008C03F71CBF906),
+  __ULL(0x0008BD42ABD9A107), __ULL(0x0008BAE051D7F6FF), __ULL(0x0008B7E735068135),
+  __ULL(0x0008B61F82C5FB08), __ULL(0x0008B4588A74A05A), __ULL(0x0008B1FB0A7ED403),
+  __ULL(0x0008B0CCC5D8F5C8), __ULL(0x0008AF07F8AC5146), __ULL(0x0008AE71328FFD49),
+  __ULL(0x0008AB8086624822), __ULL(0x0008AAEA3AB5AE89), __ULL(0x0008A7661F7020FE),
+  __ULL(0x0008A63AB88AA8DD), __ULL(0x0008A47A35D020F3), __ULL(0x0008A2BA68A3CEBF),
+  __ULL(0x0008A2254C852497), __ULL(0x00089EA849898BB3), __ULL(0x00089D7F3E285109),
+  __ULL(0x000899720AF36739), __ULL(0x00089442160D11DC), __ULL(0x0008931BD5875A22),
+  __ULL(0x000891630877AEDF), __ULL(0x00088BAAAD83E38F), __ULL(0x00088A86B9090AA4),
+  __ULL(0x0008883FB99BF244), __ULL(0x0008868B45E727EE), __ULL(0x00088568AEF30D47),
+  __ULL(0x0008832468F0BCDD), __ULL(0x00088202B9A4DF76), __ULL(0x00087E0F31872E9B),
+  __ULL(0x00087C5ECD731F42), __ULL(0x00087B3EEA3BB388), __ULL(0x00087751A6C67D78),
+  __ULL(0x000873F6E2F9D34A), __ULL(0x000872D938DCFC01), __ULL(0x0008724A80151DBA),
+  __ULL(0x000869F677F6CC1A), __ULL(0x000868DB701DF58D), __ULL(0x0008623F563A7D6D),
+  __ULL(0x00086099EF0C8886), __ULL(0x00085EF52D38FE87), __ULL(0x00085BAD981C7847),
+  __ULL(0x0008586893DE7CFC), __ULL(0x0008549B491E9EFE), __ULL(0x000852FB3859BEA4),
+  __ULL(0x000851E631FC08F8), __ULL(0x0008515BC9CDE5F1), __ULL(0x000850472F6185B3),
+  __ULL(0x00084B6DEFBC166B), __ULL(0x000849D17159854B), __ULL(0x0008469A54A20645),
+  __ULL(0x00084476F9401ADE), __ULL(0x000842DD2E2DC25D), __ULL(0x000841CC543F58CB),
+  __ULL(0x00083E9B6C3DF688), __ULL(0x00083E1382F22FF9), __ULL(0x00083AE57A327933),
+  __ULL(0x000832FD15E00939), __ULL(0x00082ECB9C6669AC), __ULL(0x00082E45BA6652C4),
+  __ULL(0x00082CB47B00ABAA), __ULL(0x000826FA5D0CE5AA), __ULL(0x000823598CFC6865),
+  __ULL(0x000821CC79DA73F1), __ULL(0x00081F37FF3D12C0), __ULL(0x00081C21947B0ACD),
+  __ULL(0x00081A97404AF5F7), __ULL(0x00081A13F02D110E), __ULL(0x0008190D81C9877B),
+  __ULL(0x000817016C0B3FFD), __ULL(0x00081473C50AC33E), __ULL(0x000812EC59F2D11A),
+  __ULL(0x0008116582E237C8), __ULL(0x00080B4FE85EC545), __ULL(0x000807C7894D029A),
+  __ULL(0x00080644E5D38D46), __ULL(0x0008054374444CD2), __ULL(0x00080341528987DF),
+  __ULL(0x0008004002001000), __ULL(0x0007FBC240CD92CA), __ULL(0x0007F945AD35DA8F),
+  __ULL(0x0007F8C68C111089), __ULL(0x0007F64BD3962107), __ULL(0x0007F5CD1141E394),
+  __ULL(0x0007F4CFBBDFCD47), __ULL(0x0007F35431D09B88), __ULL(0x0007EE670B5EC5B9),
+  __ULL(0x0007ECEDE39462F1), __ULL(0x0007EBF2C1862473), __ULL(0x0007E885B3145B90),
+  __ULL(0x0007E78BA7F07025), __ULL(0x0007E70EB9866FAF), __ULL(0x0007E6150AF40F2E),
+  __ULL(0x0007E2AD0C799BC4), __ULL(0x0007E1383C54568D), __ULL(0x0007DE50388DE096),
+  __ULL(0x0007D8869AC54F49), __ULL(0x0007D61FC634D5AA), __ULL(0x0007D4AF94D0DCBB),
+  __ULL(0x0007D2C57A54C5E7), __ULL(0x0007D06229D12D53), __ULL(0x0007CFE8134944EF),
+  __ULL(0x0007C8C7B743F5E7), __ULL(0x0007C7D57328B239), __ULL(0x0007C66A7B5E4D91),
+  __ULL(0x0007C5F19B7EA617), __ULL(0x0007C31D901D97E0), __ULL(0x0007C22CAC053676),
+  __ULL(0x0007BEE358DCFE46), __ULL(0x0007BD7BA18BB750), __ULL(0x0007B58ED4C9485D),
+  __ULL(0x0007B2C6A742300D), __ULL(0x0007B0ECFB860611), __ULL(0x0007AF8A500A1665),
+  __ULL(0x0007AD3C4DD8B785), __ULL(0x0007ACC677DC4383), __ULL(0x0007ABDAF642D305),
+  __ULL(0x0007A744BB263CB0), __ULL(0x0007A4FBAB8D73D4), __ULL(0x0007A3289A6ADCF2),
+  __ULL(0x00079F8513BE21A6), __ULL(0x00079F10E14E6304), __ULL(0x00079CCCB470A424),
+  __ULL(0x000799A2B85CDD3C), __ULL(0x000798BBC761A875), __ULL(0x000798486371F3D6),
+  __ULL(0x000795952AFCD47A), __ULL(0x0007943C46EF6427), __ULL(0x000790A6E76250E9),
+  __ULL(0x00078F4FC30C8CEB), __ULL(0x00078D86FA3F322F), __ULL(0x00078CA2E6AB1963),
+  __ULL(0x00078ADB60C8D110), __ULL(0x000789F7EE54A2E9), __ULL(0x000788A3270D45B7),
+  __ULL(0x000786DD830B068E), __ULL(0x00078589D3FC977D), __ULL(0x000784369C9CC9E3),
+  __ULL(0x0007819193EC69E8), __ULL(0x0007803FC21DF1FE), __ULL(0x00077F5ECD89BCEE),
+  __ULL(0x00077E0DC16D411E), __ULL(0x00077CBD2B9B81C4), __ULL(0x00077AFD1B701E63),
+  __ULL(0x0007770FF3671515), __ULL(0x000776312467A5C2), __ULL(0x000771DA22F49238),
+  __ULL(0x000770FC8A7A9BA1), __ULL(0x00076E64F5CFA392), __ULL(0x00076DF689F80C4E),
+  __ULL(0x00076BCF2ED12008), __ULL(0x00076A84F7DC140B), __ULL(0x00076A16FF0B5309),
+  __ULL(0x000767F1E1DAE976), __ULL(0x0007656094D837B3), __ULL(0x000764F3344F247B),
+  __ULL(0x000764189921DDA4), __ULL(0x00075FD684E9545F), __ULL(0x00075E90739B7A15),
+  __ULL(0x00075838B0F595E7), __ULL(0x000756F53F9EBFCE), __ULL(0x0007561DDC858B97),
+  __ULL(0x0007546FAA5526E9), __ULL(0x00075257006DD319), __ULL(0x00074FD49601C555),
+  __ULL(0x00074E9405D29DF4), __ULL(0x00074E29437D1334), __ULL(0x000748579E5E295C),
+  __ULL(0x000747ED91EEA69B), __ULL(0x000746AFB4F70C05), __ULL(0x000745DC0885DDD9),
+  __ULL(0x000745724456AFEE), __ULL(0x00074225D2B117E6), __ULL(0x00073FAE73956BAF),
+  __ULL(0x00073F4562C550A7), __ULL(0x00073E0A77AB20F5), __ULL(0x00073BFE87D04C69),
+  __ULL(0x00073A5C368C6FEB), __ULL(0x00073579AD9ACB41), __ULL(0x0007330AE22973E4),
+  __ULL(0x000731D419F7D98D), __ULL(0x00072E3235030EAB), __ULL(0x00072CFD0E8C3508),
+  __ULL(0x00072C2F2EA65EDE), __ULL(0x0007296009D8E40D), __ULL(0x0007282C81D4C763),
+  __ULL(0x0007275FB5C77F02), __ULL(0x000724FA63F76782), __ULL(0x0007236266C77AD3),
+  __ULL(0x00072230E042E08A), __ULL(0x00071FCF0550BB74), __ULL(0x00071F0416CF5919),
+  __ULL(0x00071DD405ABC4F4), __ULL(0x00071B75134B8AD7), __ULL(0x00071A4631A9B6CF),
+  __ULL(0x000717E99C86A9F6), __ULL(0x000717850015468F), __ULL(0x00071461AD33A1A4),
+  __ULL(0x000710796B26E1AC), __ULL(0x00070FB1E26027B8), __ULL(0x00070F4E2E7ECCE6),
+  __ULL(0x00070D5C4FE359B8), __ULL(0x000709DED78034CA), __ULL(0x00070852DA10190D),
+  __ULL(0x0007078D1C95B4D1), __ULL(0x000704DA5AF8E617), __ULL(0x00070415607121D8),
+  __ULL(0x000703B2F35E56BF), __ULL(0x0007028BECD50964), __ULL(0x0006FE5565A6C742),
+  __ULL(0x0006FD3021A277A1), __ULL(0x0006FA854D564742), __ULL(0x0006F96148A8087F),
+  __ULL(0x0006F83DA3611CE2), __ULL(0x0006F658636E1E4B), __ULL(0x0006F535BBABF653),
+  __ULL(0x0006F4D4EE25A988), __ULL(0x0006F2F1882F1F75), __ULL(0x0006F290F9AD3A0C),
+  __ULL(0x0006F1CFFC17FB02), __ULL(0x0006F16F8D013870), __ULL(0x0006ED4D77E55FDE),
+  __ULL(0x0006ECED85E24BCD), __ULL(0x0006EC2DC0FE6791), __ULL(0x0006EB0E6764FD45),
+  __ULL(0x0006E9EF6AEBC58E), __ULL(0x0006E7B288A51304), __ULL(0x0006E694A27D73E2),
+  __ULL(0x0006E3FAF093B753), __ULL(0x0006E220A456CB53), __ULL(0x0006DFE8CC4E4E77),
+  __ULL(0x0006DECD69717E97), __ULL(0x0006DD541E23C554), __ULL(0x0006DC97B52A2970),
+  __ULL(0x0006D5FF17941EDE), __ULL(0x0006D371D4012C57), __ULL(0x0006D14366ED629C),
+  __ULL(0x0006D02CB6256B55), __ULL(0x0006CF731C62A4C7), __ULL(0x0006CE5CFFC2BEBB),
+  __ULL(0x0006CE005F440535), __ULL(0x0006CBD56ADACE7D), __ULL(0x0006CAC0752977E5),
+  __ULL(0x0006C89791FAA5B8), __ULL(0x0006C5B8851E72F8), __ULL(0x0006C55CCF4124D7),
+  __ULL(0x0006C392D3522526), __ULL(0x0006C2251E47DC4E), __ULL(0x0006BE3A872000D7),
+  __ULL(0x0006BDDF9BB7A1D3), __ULL(0x0006BBBEE025E011), __ULL(0x0006BAAF033BB216),
+  __ULL(0x0006B9F9F4E96DF6), __ULL(0x0006B8EAA6BECC74), __ULL(0x0006B5BEBC3ECD05),
+  __ULL(0x0006B564B506C984), __ULL(0x0006B3494FA5206D), __ULL(0x0006B23C1BEF92C4),
+  __ULL(0x0006B188D30DE23E), __ULL(0x0006AF6FD92445E1), __ULL(0x0006AE0A9804CD17),
+  __ULL(0x0006ACFF08FF23B3), __ULL(0x0006AAE8E5D30BB1), __ULL(0x0006AA372444360C),
+  __ULL(0x0006A92CC74E07DB), __ULL(0x0006A719069323BB), __ULL(0x0006A60FA280C422),
+  __ULL(0x0006A5B73E305952), __ULL(0x0006A3A5A4DDB046), __ULL(0x0006A19554C7DE38),
+  __ULL(0x0006A0E5830AD957), __ULL(0x00069E7F435AD500), __ULL(0x00069D788B89A6BF),
+  __ULL(0x00069ABD84523F00), __ULL(0x000699B7F64E39CE), __ULL(0x00069960D8F24FDC),
+  __ULL(0x000697ADCCC0EEFA), __ULL(0x0006965264328940), __ULL(0x00069346C2F283F7),
+  __ULL(0x0006924382A19007), __ULL(0x00068C8C4ACD5266), __ULL(0x00068C3687B62238),
+  __ULL(0x0006878973286D2A), __ULL(0x00068734331A64A0), __ULL(0x0006838CAF297316),
+  __ULL(0x0006828E40D874F9), __ULL(0x0006823982A82879), __ULL(0x000680924CDBC150),
+  __ULL(0x00067E978E24AF0C), __ULL(0x00067E433703C77D), __ULL(0x00067D4664F09CF6),
+  __ULL(0x00067C9E03991FA5), __ULL(0x00067B4DA73B5283), __ULL(0x000677B3664B3C74),
+  __ULL(0x000676B8920A5A23), __ULL(0x0006766506D754F2), __ULL(0x000674C3CD424D1E),
+  __ULL(0x000673769CFDE890), __ULL(0x000672D0373716D8), __ULL(0x000671D6DD628EF0),
+  __ULL(0x0006708ADAB20B9F), __ULL(0x00066FE50B70E017), __ULL(0x00066DF46590F0B4),
+  __ULL(0x00066B0D9D11E028), __ULL(0x0006691FE0BF8498), __ULL(0x000665EB8E555333),
+  __ULL(0x00066547E038C2DD), __ULL(0x00066452985B48BB), __ULL(0x0006635D99F07A92),
+  __ULL(0x000662176369B241), __ULL(0x0006617478EF1384), __ULL(0x000661230FDFB43E),
+  __ULL(0x00065E98EB133BA3), __ULL(0x00065CB2A2C7C290), __ULL(0x00065C61B2EC9829),
+  __ULL(0x00065ACD7C308DCA), __ULL(0x0006598AAD93B4E4), __ULL(0x000657F7DF4A69E8),
+  __ULL(0x000657A76795910E), __ULL(0x000657069015CB26), __ULL(0x00065615888D2E0F),
+  __ULL(0x000653E437A9FB99), __ULL(0x000652044BBEEB7B), __ULL(0x00064E9751927718),
+  __ULL(0x00064D59567B6EF3), __ULL(0x000649043F57DECE), __ULL(0x000648B5412C0FCE),
+  __ULL(0x000648175C16DE75), __ULL(0x00064503B2B52E68), __ULL(0x0006446686FD4857),
+  __ULL(0x00064417FCABD341), __ULL(0x0006437AFF183F39), __ULL(0x00064156793E6E1A),
+  __ULL(0x00063FCF917758A3), __ULL(0x00063DFB76F74B90), __ULL(0x00063DAD8D2D38EC),
+  __ULL(0x00063BDAB1CF3FEB), __ULL(0x0006396DDFC288E2), __ULL(0x000639206775BAB8),
+  __ULL(0x000634E6E81E738C), __ULL(0x000633B2F5CCFAB1), __ULL(0x0006306681A1C307),
+  __ULL(0x00062F344D3550F3), __ULL(0x00062E9B5F5CF2BE), __ULL(0x00062DB631F59F37),
+  __ULL(0x00062CD146E48698), __ULL(0x00062ABC23BFBA9F), __ULL(0x00062A24129714C8),
+  __ULL(0x000628F448174ADB), __ULL(0x0006272D7364BB61), __ULL(0x0006264A6B60976E),
+  __ULL(0x00062567A4C4C58A), __ULL(0x000624D099FAAC13), __ULL(0x000621DF1634A6D1),
+  __ULL(0x00062148B8DBB906), __ULL(0x00061EA578A6303D), __ULL(0x00061E5A95610F82),
+  __ULL(0x00061C99D7F0879A), __ULL(0x00061BB9D995A12D), __ULL(0x00061B24A8F71A73),
+  __ULL(0x00061A4515620C0F), __ULL(0x0006183C601617DA), __ULL(0x000615A0E1E2F4C2),
+  __ULL(0x0006142F041BA3C5), __ULL(0x000613079DDC8CF1), __ULL(0x00061196FB9D49E4),
+  __ULL(0x00060CFFEDD90036), __ULL(0x00060C24610AD7C5), __ULL(0x00060AB7008AF671),
+  __ULL(0x000609DC1961711A), __ULL(0x00060901702557B8), __ULL(0x000608B89ACFC043),
+  __ULL(0x000607DE43FCB3B2), __ULL(0x00060599346EBEF5), __ULL(0x000604BFBF4CF2B7),
+  __ULL(0x00060477508DC93B), __ULL(0x000602C546EEB206), __ULL(0x000601EC9DCA8AE0),
+  __ULL(0x0005FDFCAD1DD7F9), __ULL(0x0005FDB4E0C1F5BF), __ULL(0x0005FC4E47AFC186),
+  __ULL(0x0005FB2FDF7A2BB0), __ULL(0x0005F8F44FC9DFD9), __ULL(0x0005F81E67DAE102),
+  __ULL(0x0005F7018FA56898), __ULL(0x0005F62C3323B326), __ULL(0x0005F4C91D56C2A5),
+  __ULL(0x0005F17789B14C73), __ULL(0x0005EEB6608AABE7), __ULL(0x0005ED56C0DCC8DF),
+  __ULL(0x0005ED108142F803), __ULL(0x0005EBB1A4BCFFCA), __ULL(0x0005EB6B8C1AEA6D),
+  __ULL(0x0005E9C7804FD405), __ULL(0x0005E93BB01BB547), __ULL(0x0005E86A2833825D),
+  __ULL(0x0005E5B15AD4CEAE), __ULL(0x0005E5264B93C4F4), __ULL(0x0005E4E0CD8E2000),
+  __ULL(0x0005E3405FACD612), __ULL(0x0005E0D1692441AB), __ULL(0x0005DF783044A3CC),
+  __ULL(0x0005DF3337E5C293), __ULL(0x0005DDDABCE0AC54), __ULL(0x0005DD95EA6AA25B),
+  __ULL(0x0005DD0C5868FE25), __ULL(0x0005DA5DF7D0A097), __ULL(0x0005D83AA10C1F81),
+  __ULL(0x0005D4C486EF93C2), __ULL(0x0005D43C91455574), __ULL(0x0005D32CF02FB0FF),
+  __ULL(0x0005D261783BDAFA), __ULL(0x0005D1D9F1C4D90E), __ULL(0x0005D043F21A1D91),
+  __ULL(0x0005CF7945340B59), __ULL(0x0005CE6B5F258978), __ULL(0x0005CCD73D836EB9),
+  __ULL(0x0005CB43F766471C), __ULL(0x0005CA7AA671B13B), __ULL(0x0005C9F48ED29DB3),
+  __ULL(0x0005C8E8A84D30E0), __ULL(0x0005C609E0D4E6AC), __ULL(0x0005C5C738AA78A3),
+  __ULL(0x0005C3B2CF799DC7), __ULL(0x0005C1E22DBE770F), __ULL(0x0005C096FF7BB26F),
+  __ULL(0x0005BFD091874F63), __ULL(0x0005BE4455E115D4), __ULL(0x0005BCB8EF594341),
+  __ULL(0x0005BAECAEDC1E87), __ULL(0x0005BA27C6E84379), __ULL(0x0005B9A49EF67ECD),
+  __ULL(0x0005B716369B563D), __ULL(0x0005B6939B098788), __ULL(0x0005B50C5417A1A7),
+  __ULL(0x0005B448FF16204F), __ULL(0x0005B407EE5B0776), __ULL(0x0005B344DEEF197E),
+  __ULL(0x0005B282039AF646), __ULL(0x0005B07B6373FCE3), __ULL(0x0005AF789D97D750),
+  __ULL(0x0005ACB2D6B43687), __ULL(0x0005AC7272949F4D), __ULL(0x0005A8EF4EC63AAD),
+  __ULL(0x0005A7EF3571D956), __ULL(0x0005A72F5DD3E12C), __ULL(0x0005A6AF94FB62EA),
+  __ULL(0x0005A431FAAAC8C1), __ULL(0x0005A3B2B8D2F355), __ULL(0x0005A23579B7995C),
+  __ULL(0x00059F3D565432DC), __ULL(0x00059CC6468CB462), __ULL(0x00059C485294487F),
+  __ULL(0x00059B4CACD797C0), __ULL(0x00059A129991C1E5), __ULL(0x000599D3D9680839),
+  __ULL(0x000597DE9D8743C0), __ULL(0x000597A00EAE0426), __ULL(0x000596292843369F),
+  __ULL(0x000594B305FEBC4F), __ULL(0x000590931E316E3A), __ULL(0x0005905532188F18),
+  __ULL(0x00058FD96A0BB04E), __ULL(0x00058F1FE64A0C76), __ULL(0x00058DAD6FA77E03),
+  __ULL(0x00058CF47CA0E17E), __ULL(0x00058C3BB9B2FB2A), __ULL(0x00058B45AB267BBE),
+  __ULL(0x00058A8D582962CF), __ULL(0x00058A1290C2392A), __ULL(0x000589D53506A44A),
+  __ULL(0x0005891D41ABA014), __ULL(0x0005863F5099A5C0), __ULL(0x000585C547A45C3E),
+  __ULL(0x00058364563B0D54), __ULL(0x00058234A212E490), __ULL(0x0005817EA7E29403),
+  __ULL(0x000580C8DCA3754E), __ULL(0x00057F216337CDAB), __ULL(0x00057EA893D7E7C9),
+  __ULL(0x00057DF383A862AF), __ULL(0x00057D3EA20FA724), __ULL(0x00057D0261340825),
+  __ULL(0x00057B994874569C), __ULL(0x00057AE501A5F6E1), __ULL(0x000579B8F27605B0),
+  __ULL(0x0005797CFED2E625), __ULL(0x00057851897F6993), __ULL(0x0005779E1A18FCB0),
+  __ULL(0x0005754947A8D715), __ULL(0x000574D2276E36B0), __ULL(0x000571CDC3FB7DC1),
+  __ULL(0x000571573B8D1B72), __ULL(0x0005711BFEE50650), __ULL(0x0005706A6721817F),
+  __ULL(0x00056DE0BD57FDCB), __ULL(0x00056DA5CBF6ECAE), __ULL(0x00056AE40097B0F0),
+  __ULL(0x00056A6EA4606229), __ULL(0x000569BEBF469A3A), __ULL(0x00056984277DF050),
+  __ULL(0x0005690F06C8BBD7), __ULL(0x0005685F7AD5D0CF), __ULL(0x000565A3072596E2),
+  __ULL(0x000564F458EC2BE9), __ULL(0x0005640BB5496DBB), __ULL(0x0005639780DA4177),
+  __ULL(0x0005635D6DF90DE9), __ULL(0x00055F8516FB9245), __ULL(0x00055ED7F3BFA35B),
+  __ULL(0x00055DF15DDBE616), __ULL(0x00055C2519D0CEB1), __ULL(0x00055ACCB0F4A467),
+  __ULL(0x00055A935AF3B950), __ULL(0x00055974F4D20C94), __ULL(0x0005593BBB8E179B),
+  __ULL(0x0005581DE4E7386D), __ULL(0x000557729D5E4AA8), __ULL(0x0005568E80A82688),
+  __ULL(0x0005561C8ED4D45E), __ULL(0x00055538E425E9E0), __ULL(0x000553E3F243B853),
+  __ULL(0x000551749AF9A9F4), __ULL(0x000550CAFD47A820), __ULL(0x00054F3FDC2910F1),
+  __ULL(0x00054ECF2166F177), __ULL(0x00054BF42A4A7181), __ULL(0x00054B83FB48BE74),
+  __ULL(0x00054B4BEABDA325), __ULL(0x000549FBE8C729F5), __ULL(0x000548E4664F25AC),
+  __ULL(0x000548051DC4F4D6), __ULL(0x000547959520FA1F), __ULL(0x000546B6BB0478F0),
+  __ULL(0x00054568FD823160), __ULL(0x000544F9E2FA17AB), __ULL(0x000543759607DAA9),
+  __ULL(0x000542CF704F3E54), __ULL(0x00054115291C3890), __ULL(0x0005406F994378D9),
+  __ULL(0x00053F9318D3BCD6), __ULL(0x00053F24F3B94089), __ULL(0x00053E7FDDE9C0DD),
+  __ULL(0x00053DDAF0AA066D), __ULL(0x00053CFF48A91910), __ULL(0x00053C5AB9D41C0F),
+  __ULL(0x00053B48D01E6897), __ULL(0x00053A00B1B41799), __ULL(0x000539CA11989667),
+  __ULL(0x000539264C05CB66), __ULL(0x00053882AE8720A6), __ULL(0x000536CF2360E377),
+  __ULL(0x000535F5C8300971), __ULL(0x00053552F239FBA5), __ULL(0x000534B044003E78),
+  __ULL(0x0005336B5E879685), __ULL(0x0005325D1837B3D5), __ULL(0x0005322717521973),
+  __ULL(0x000531852EEC6C54), __ULL(0x00052FA061E2F337), __ULL(0x00052F34D61979F9),
+  __ULL(0x00052E93A512B94B), __ULL(0x00052DF29B2EA2B5), __ULL(0x00052D51B85EF753),
+  __ULL(0x00052C1067C40921), __ULL(0x00052A2F9292300E), __ULL(0x0005295A4E8303A6),
+  __ULL(0x000528BA88985AC4), __ULL(0x000527B094878FB7), __ULL(0x000526DC1E58E8A2),
+  __ULL(0x000524FF0E352C64), __ULL(0x000524953979D7B3), __ULL(0x0005232356B6177A),
+  __ULL(0x00052285108C3ED2), __ULL(0x000520AB224F9920), __ULL(0x00051FA46A651231),
+  __ULL(0x00051ED28954AAA7), __ULL(0x00051DCC8E61406A), __ULL(0x00051C92B8234D55),
+  __ULL(0x00051C5E78623937), __ULL(0x00051BC1D224D627), __ULL(0x00051A88F6177C1A),
+  __ULL(0x00051950AF97CA9E), __ULL(0x000515AB593D504D), __ULL(0x00051543F757C83E),
+  __ULL(0x000514A9034650EF), __ULL(0x000513DAA1E3009D), __ULL(0x0005137389BED852),
+  __ULL(0x000512D9042E88DE), __ULL(0x000512A58A7E1165), __ULL(0x0005123EA359ADA1),
+  __ULL(0x000510705CBD09A2), __ULL(0x00050F3CE463D8B5), __ULL(0x00050EA35EE1A31D),
+  __ULL(0x00050DD6E57249F4), __ULL(0x00050D3DB4BCBAAD), __ULL(0x00050CA4A8495FB8),
+  __ULL(0x00050C3EB41AE53E), __ULL(0x00050A74B00922F3), __ULL(0x00050A41E011029E),
+  __ULL(0x000509DC4C20FC8E), __ULL(0x000509A9882824FE), __ULL(0x000507498F9B1DCC),
+  __ULL(0x000506E47339FC81), __ULL(0x0005064CE66CEE97), __ULL(0x000505B57D4D6F05),
+  __ULL(0x00050454BD274AEB), __ULL(0x0005016362905607), __ULL(0x000500CD20DA42F4),
+  __ULL(0x00050069089DB4EF), __ULL(0x0004FFD30194F1C3), __ULL(0x0004FEA75CE3F68E),
+  __ULL(0x0004FE11BF23156E), __ULL(0x0004FC20031D9401), __ULL(0x0004FBBCA59E5190),
+  __ULL(0x0004FAF61904B041), __ULL(0x0004FA92E9E3197F), __ULL(0x0004F9CCB9E45C70),
+  __ULL(0x0004F9383E5308CD), __ULL(0x0004F8A3E55B719E), __ULL(0x0004F84112940B42),
+  __ULL(0x0004F55DCDD594F7), __ULL(0x0004F52CA386EC61), __ULL(0x0004F437091368D3),
+  __ULL(0x0004F310CD180832), __ULL(0x0004F24CF0E8CB45), __ULL(0x0004F15872C3BDA8),
+  __ULL(0x0004F0951E958B42), __ULL(0x0004EE4C8B38392A), __ULL(0x0004EDBABAC992C2),
+  __ULL(0x0004EC977EE4DBF8), __ULL(0x0004EC3688CC2375), __ULL(0x0004EAE3A0CCB143),
+  __ULL(0x0004EA82EDB2FE99), __ULL(0x0004E9F1FCE3F4DD), __ULL(0x0004E9C1B409E72A),
+  __ULL(0x0004E71F3C800273), __ULL(0x0004E5CF0FB5010D), __ULL(0x0004E44FB8C3370D),
+  __ULL(0x0004E41FDE5FA4E7), __ULL(0x0004E3010CC539BE), __ULL(0x0004E271D538D712),
+  __ULL(0x0004E2126D118790), __ULL(0x0004E0363E5B75B9), __ULL(0x0004DF48AEF149C9),
+  __ULL(0x0004DEBA511411E1), __ULL(0x0004DE2C13B31A5F), __ULL(0x0004DD9DF6C3461D),
+  __ULL(0x0004DCE0AD3CC41B), __ULL(0x0004DBF4622BC54F), __ULL(0x0004DAD94B319781),
+  __ULL(0x0004D98FA8664D2E), __ULL(0x0004D8A49F17FC36), __ULL(0x0004D75C27692A30),
+  __ULL(0x0004D5E597EC345C), __ULL(0x0004D49E93E5CF34), __ULL(0x0004D3B56870AE12),
+  __ULL(0x0004D26F8BF863E7), __ULL(0x0004D1E418ED87B0), __ULL(0x0004D070D55487ED),
+  __ULL(0x0004CFE5D58E46CA), __ULL(0x0004CF2CB1445355), __ULL(0x0004CEA1FA8DEC82),
+  __ULL(0x0004CD30ABF45F0E), __ULL(0x0004CB6440F3521F), __ULL(0x0004CA7E8CB2B067),
+  __ULL(0x0004CA50A629CD83), __ULL(0x0004C9C70729E0C3), __ULL(0x0004C96B58FC5A93),
+  __ULL(0x0004C93D8709F6FD), __ULL(0x0004C8E1ED6C02C4), __ULL(0x0004C7CF72AD1B51),
+  __ULL(0x0004C7A1BF8287AA), __ULL(0x0004C6BD72D64CE8), __ULL(0x0004C68FD41FB693),
+  __ULL(0x0004C6070C66684F), __ULL(0x0004C4128AD82430), __ULL(0x0004C38A518B199F),
+  __ULL(0x0004C35CEFDE5C3F), __ULL(0x0004C30236A60767), __ULL(0x0004C16A9C00F749),
+  __ULL(0x0004C0B5CB299AF7), __ULL(0x0004BFD411965D51), __ULL(0x0004BF1FB965081A),
+  __ULL(0x0004BD30DA4A9A47), __ULL(0x0004BD03F14447BD), __ULL(0x0004BC2395FB7335),
+  __ULL(0x0004BA908F573DF9), __ULL(0x0004B957D17F8789), __ULL(0x0004B8FE945B6D60),
+  __ULL(0x0004B8D1FAB98569), __ULL(0x0004B878D1542D82), __ULL(0x0004B6E8399AE57F),
+  __ULL(0x0004B6BBC75C57B8), __ULL(0x0004B662ECB0A4A4), __ULL(0x0004B5DDBD3531CF),
+  __ULL(0x0004B52C5648909D), __ULL(0x0004B44EDEFA525C), __ULL(0x0004B4229DAEC072),
+  __ULL(0x0004B18C4FB78B19), __ULL(0x0004B1343816242E), __ULL(0x0004AEA121B53205),
+  __ULL(0x0004AE754AFEBCFA), __ULL(0x0004AD9A497F75FE), __ULL(0x0004AD6E86008C52),
+  __ULL(0x0004ABE536499CB1), __ULL(0x0004AB8DF2516624), __ULL(0x0004AA05DDDB610D),
+  __ULL(0x0004A983657E3970), __ULL(0x0004A85366155BEE), __ULL(0x0004A77AA0ADF387),
+  __ULL(0x0004A74F4F74AF29), __ULL(0x0004A6F8B6746A33), __ULL(0x0004A548760738F6),
+  __ULL(0x0004A2417D218A74), __ULL(0x0004A1C0B5CCCBDF), __ULL(0x0004A16AEB1BBA9D),
+  __ULL(0x0004A0EA5256885C), __ULL(0x00049FBEAF9A8F98), __ULL(0x00049F692F385B71),
+  __ULL(0x00049DBE66503E07), __ULL(0x00049CE975372833), __ULL(0x00049BBFD7AD3160),
+  __ULL(0x000499ED57DFA5B3), __ULL(0x0004996E5DBF5B92), __ULL(0x000499441074678A),
+  __ULL(0x000496CAF50C1999), __ULL(0x000495CE756347A9), __ULL(0x000494FC5DDBE192),
+  __ULL(0x00049382F0C9A3B9), __ULL(0x00049359101A9875), __ULL(0x0004930557B73D73),
+  __ULL(0x000491E0B08286A1), __ULL(0x000491637109CBCA), __ULL(0x00048F991811D0EE),
+  __ULL(0x00048E232002D8D5), __ULL(0x00048DF9A174E836), __ULL(0x00048D00E8172E3C),
+  __ULL(0x00048C84B32F1B22), __ULL(0x00048C31F3F4B3B3), __ULL(0x00048B8C98C2295E),
+  __ULL(0x00048B39FCC504C6), __ULL(0x00048A94E7F67DD8), __ULL(0x00048A1937181007),
+  __ULL(0x0004894B4AC2ABD9), __ULL(0x00048922243FFEDD), __ULL(0x0004882B7A611E13),
+  __ULL(0x000486BA3FD3DE68), __ULL(0x000485ED84C78378), __ULL(0x000484CF5EBC577B),
+  __ULL(0x0004838904D0451E), __ULL(0x0004826C0D090055), __ULL(0x0004821ABB7A83B0),
+  __ULL(0x000481A0D69D8BED), __ULL(0x000481270B7D7098), __ULL(0x000480FE78298529),
+  __ULL(0x00048084CF4DE379), __ULL(0x00048033C2533ABD), __ULL(0x0004800B401C2046),
+  __ULL(0x00047DD54B9A0731), __ULL(0x00047DACF3FBB837), __ULL(0x00047B7951FEB44E),
+  __ULL(0x00047B00D29526A9), __ULL(0x00047AD8ADBC2311), __ULL(0x00047A886C779802),
+  __ULL(0x00047A101F9E11DF), __ULL(0x000478F7CE6202E6), __ULL(0x000478A7D05A43BB),
+  __ULL(0x000477B81945294E), __ULL(0x000476A0ED1E2534), __ULL(0x0004756285EE218B),
+  __ULL(0x0004744C7D1173A7), __ULL(0x000473FD25B1D3DA), __ULL(0x000473863753EE43),
+  __ULL(0x000472E7CAC0B9BD), __ULL(0x000472711637C2FE), __ULL(0x0004722200F0132C),
+  __ULL(0x000471AB759C40A5), __ULL(0x0004713502F79E68), __ULL(0x000470BEA8FA7782),
+  __ULL(0x0004702101F57E91), __ULL(0x00046FD23ED7D7EE), __ULL(0x00046F34D95ADA6D),
+  __ULL(0x00046EE636F6FA4D), __ULL(0x00046DD3544E8BAF), __ULL(0x00046C99CF93547E),
+  __ULL(0x00046BFD4E31A459), __ULL(0x00046B880987DD54), __ULL(0x00046B39E93FF3D9),
+  __ULL(0x00046A4FC915BFAB), __ULL(0x000469B3E973ECC3), __ULL(0x0004687CAB05C4BB),
+  __ULL(0x00046855CF469B66), __ULL(0x00046793ACA821B9), __ULL(0x000466F88DD59819),
+  __ULL(0x000466AB0E6C7A9C), __ULL(0x00046636E348CFBA), __ULL(0x00046440920562F7),
+  __ULL(0x000463CCE642D79D), __ULL(0x0004630C522F9AD3), __ULL(0x00046272719F29B4),
+  __ULL(0x000462259125F5F7), __ULL(0x000461B2542CD7DD), __ULL(0x000460CC212D8AEB),
+  __ULL(0x00045FC007A7900D), __ULL(0x00045D8336DB1DE4), __ULL(0x00045D3703047309),
+  __ULL(0x00045C2C9F58AECF), __ULL(0x00045A8B03029A1D), __ULL(0x000459F374B0299C),
+  __ULL(0x000459106C6D098F), __ULL(0x000458C4D3908BE9), __ULL(0x000458538184E131),
+  __ULL(0x000457BC8D578CC8), __ULL(0x0004570015B3006C), __ULL(0x0004568F1FC5FA45),
+  __ULL(0x00045587E5DC245D), __ULL(0x000454CC2D690CAC), __ULL(0x0004545BAA04B39B),
+  __ULL(0x000454362DF6173B), __ULL(0x0004537AE7AEC023), __ULL(0x0004529A806E3A63),
+  __ULL(0x000451BA740BCF79), __ULL(0x000450B582D2CEC3), __ULL(0x00045045D36A4E48),
+  __ULL(0x00044FD63A94A87F), __ULL(0x00044E87F7407BD1), __ULL(0x00044DCE9B0AE0A5),
+  __ULL(0x00044D5F819F2A80), __ULL(0x00044CCB828FBF3B), __ULL(0x00044B7F15ED71D4),
+  __ULL(0x00044B3551EF2074), __ULL(0x00044AC6BE7EC8D2), __ULL(0x00044AA1E7A01C6E),
+  __ULL(0x00044A3371D4EF17), __ULL(0x0004497B8980E55B), __ULL(0x00044956C8D40BFD),
+  __ULL(0x0004489F2A59FD9F), __ULL(0x0004480C7164298B), __ULL(0x0004479E806D2249),
+  __ULL(0x00044730A5822A03), __ULL(0x00044679BEE6E63B), __ULL(0x0004465531B5E4B7),
+  __ULL(0x0004450CA8B8883B), __ULL(0x0004445678E86A46), __ULL(0x00044432103B7679),
+  __ULL(0x00044357CF1BA8F0), __ULL(0x0004430F221CBC20), __ULL(0x000442A230C2A452),
+  __ULL(0x0004421110C86543), __ULL(0x0004415BDF167D6E), __ULL(0x00044082BFB486EF),
+  __ULL(0x00043F85DDB759A8), __ULL(0x00043EAD797569AC), __ULL(0x00043E656B2BBF37),
+  __ULL(0x00043DD56B3F7954), __ULL(0x00043D21A0FDCC3D), __ULL(0x00043CB5DDCE0C47),
+  __ULL(0x00043C4A300370FC), __ULL(0x00043AE3DC3E31DE), __ULL(0x00043A9C4E4D3619),
+  __ULL(0x000439A227E85D9C), __ULL(0x00043884D293C299), __ULL(0x0004378BA34ADE26),
+  __ULL(0x000436D9EC6906FF), __ULL(0x0004364BEA9C467C), __ULL(0x0004359A9CE600F4),
+  __ULL(0x000434C62626AD46), __ULL(0x000434A2C52BB71F), __ULL(0x00043364C4D845F8),
+  __ULL(0x000432FAEE771E2A), __ULL(0x000432278027DC77), __ULL(0x000431778E63C0C6),
+  __ULL(0x000430A4B84B8D1A), __ULL(0x000430819CA9DEC7), __ULL(0x0004303B6C4B1068),
+  __ULL(0x00043018578D7CE6), __ULL(0x00042F460B476ACA), __ULL(0x00042EDD041194F8),
+  __ULL(0x00042E970AB33474), __ULL(0x00042E0B336203B0), __ULL(0x00042DC5556B9EC7),
+  __ULL(0x00042AC72450CD7D), __ULL(0x00042A81B359F1B6), __ULL(0x00042A5EFE424A4B),
+  __ULL(0x00042A199AD96E14), __ULL(0x000429F6EC87C870), __ULL(0x00042949A6C29285),
+  __ULL(0x0004287A03BC5D9F), __ULL(0x000428125090B2FD), __ULL(0x000427AAB19771D2),
+  __ULL(0x000426B937BBE4B1), __ULL(0x000426744D9F373B), __ULL(0x0004260CFF34B783),
+  __ULL(0x000425A5C4DF3A7F), __ULL(0x0004253E9E98E5AF), __ULL(0x000424B535650B2F),
+  __ULL(0x0004244E3DD6081F), __ULL(0x000421E61356A2AE), __ULL(0x000420B30A55E04C),
+  __ULL(0x0004206EE7A49166), __ULL(0x00042008C412A0A7), __ULL(0x00041FE6BC9ABCCC),
+  __ULL(0x00041F1ABDD08191), __ULL(0x00041EB4DBF77030), __ULL(0x00041E4F0DC976A5),
+  __ULL(0x00041DE95340E374), __ULL(0x00041DA58C77CEFF), __ULL(0x00041CB8994EC213),
+  __ULL(0x00041B4516CB5E7F), __ULL(0x00041A7AE0F3A43F), __ULL(0x00041A5934DF8B94),
+  __ULL(0x0004192A893279F4), __ULL(0x00041882AE0980DF), __ULL(0x0004181E111CCDAB),
+  __ULL(0x0004166AF28A2DD3), __ULL(0x000414DA8CA6A36A), __ULL(0x00041497EEC91F08),
+  __ULL(0x00041476A309BCD7), __ULL(0x0004143411E8B49E), __ULL(0x00041412CC86A6BC),
+  __ULL(0x000413D0481E73FB), __ULL(0x000412E7BB6190C3), __ULL(0x000412A55D0E042B),
+  __ULL(0x00041241DF65CC81), __ULL(0x000411DE74B879F7), __ULL(0x0004115A03F8F1E7),
+  __ULL(0x000410518763AC3F), __ULL(0x00040F8B820DDD12), __ULL(0x00040F6A887E3F58),
+  __ULL(0x00040CB7F1B31672), __ULL(0x00040C765C54332D), __ULL(0x00040C5594C13CC5),
+  __ULL(0x00040C140BD34A92), __ULL(0x00040A8B840C90C9), __ULL(0x00040A29908FA966),
+  __ULL(0x000409C7AF9D5100), __ULL(0x000409A7136A6A66), __ULL(0x00040881F21AB04B),
+  __ULL(0x00040840E4D462BA), __ULL(0x0004075D76DD4C8F), __ULL(0x000406FC1D42BFC4),
+  __ULL(0x00040536C304EA5F), __ULL(0x00040414247506DA), __ULL(0x000403328C47C934),
+  __ULL(0x000402D1FBA4EFF8), __ULL(0x0004023132E7D6C9), __ULL(0x00040170846F981A),
+  __ULL(0x000401506E6438E2), __ULL(0x000400F0384D3217), __ULL(0x0004003002401B01),
+  __ULL(0x0003FE50B5F33D62), __ULL(0x0003FDF10FB3E73C), __ULL(0x0003FDB1557A9521),
+  __ULL(0x0003FD51CD0A3D1E), __ULL(0x0003FCF25675CDCE), __ULL(0x0003FC13DC72FECD),
+  __ULL(0x0003FBD45DADEDEA), __ULL(0x0003FBB4A14224B0), __ULL(0x0003FA38660BB6FA),
+  __ULL(0x0003F9F92267DA98), __ULL(0x0003F99A4BAE33A4), __ULL(0x0003F93B869EB9AB),
+  __ULL(0x0003F7A1A703B42F), __ULL(0x0003F7045A23C6F1), __ULL(0x0003F5E9B0D1AA03),
+  __ULL(0x0003F58B9B59C6EE), __ULL(0x0003F50E448A711F), __ULL(0x0003F4B057C5089B),
+  __ULL(0x0003F4527C689B16), __ULL(0x0003F27E38180DB1), __ULL(0x0003F23FE94F1082),
+  __ULL(0x0003F1852B0605E2), __ULL(0x0003F0CAB1BA15D3), __ULL(0x0003F0ABA435214A),
+  __ULL(0x0003EFB37CCF3604), __ULL(0x0003EF9480780B31), __ULL(0x0003EF3796E06AB8),
+  __ULL(0x0003EEF9AF552382), __ULL(0x0003EE402652F175), __ULL(0x0003ED2A58DDB86F),
+  __ULL(0x0003ED0B8464C963), __ULL(0x0003ECAF1251D53A), __ULL(0x0003EC717A61FF8A),
+  __ULL(0x0003EAE1D69738D1), __ULL(0x0003EA29CECA7E76), __ULL(0x0003E9CDE4359FD9),
+  __ULL(0x0003E9164197AB50), __ULL(0x0003E8D91A57FEE6), __ULL(0x0003E76ACB866D86),
+  __ULL(0x0003E5FD88758FA5), __ULL(0x0003E5474AF9B71B), __ULL(0x0003E4EC452EF57D),
+  __ULL(0x0003E4CDF19C7EF9), __ULL(0x0003E41822E5B878), __ULL(0x0003E270ECB6C158),
+  __ULL(0x0003E1F843D368E0), __ULL(0x0003E1BBFA5BFAD8), __ULL(0x0003E16199DDE51C),
+  __ULL(0x0003E0AD0A29E58D), __ULL(0x0003E08EF8980EE7), __ULL(0x0003DF80AC59DDF5),
+  __ULL(0x0003DF26B3A3DDB3), __ULL(0x0003DEEAC19197A3), __ULL(0x0003DE90E40D7B80),
+  __ULL(0x0003DE3716D49727), __ULL(0x0003DD0C358B9536), __ULL(0x0003DC1D9CB32E2E),
+  __ULL(0x0003DBFFD1B0022B), __ULL(0x0003DBA67B6D1820), __ULL(0x0003DB4D3550AC58),
+  __ULL(0x0003DA41C3B69EE3), __ULL(0x0003D9AD6DD6C278), __ULL(0x0003D95482EC9EB5),
+  __ULL(0x0003D936E2D9C547), __ULL(0x0003D8FBA80BE74A), __ULL(0x0003D88547CB0013),
+  __ULL(0x0003D82C9244BFCD), __ULL(0x0003D7D3ECB97D10), __ULL(0x0003D671F6041B85),
+  __ULL(0x0003D5868993E594), __ULL(0x0003D52E5DFDEF15), __ULL(0x0003D4B8E72C75BD),
+  __ULL(0x0003D4263A2DACE0), __ULL(0x0003D3CE4DD54562), __ULL(0x0003D30163A78133),
+  __ULL(0x0003D1C00E529035), __ULL(0x0003D14B6962ACC6), __ULL(0x0003D06272ED368B),
+  __ULL(0x0003D00B3320E630), __ULL(0x0003CFEE2153C3C7), __ULL(0x0003CF3FDADB516A),
+  __ULL(0x0003CF05D131E283), __ULL(0x0003CEE8CEF43BAE), __ULL(0x0003CDAA2815834A),
+  __ULL(0x0003CD367C1DE0D8), __ULL(0x0003CC329D929C26), __ULL(0x0003CA493A3AC703),
+  __ULL(0x0003CA2C7FF68690), __ULL(0x0003C9D65B5DBFAF), __ULL(0x0003C8D44943EDBA),
+  __ULL(0x0003C89B028E90C0), __ULL(0x0003C84525300FD6), __ULL(0x0003C7EF5709687E),
+  __ULL(0x0003C77D067B1766), __ULL(0x0003C6EE47BC2176), __ULL(0x0003C67C33DA11D8),
+  __ULL(0x0003C57BE96E2E77), __ULL(0x0003C526997C316C), __ULL(0x0003C4EDC1E54A93),
+  __ULL(0x0003C4D1589C8616), __ULL(0x0003C4988B0F9DCC), __ULL(0x0003C42704042D9B),
+  __ULL(0x0003C3444605CA87), __ULL(0x0003C327F5C56B5B), __ULL(0x0003C27E373118CE),
+  __ULL(0x0003C1D4B466E926), __ULL(0x0003C1800963C017), __ULL(0x0003C08261B2C303),
+  __ULL(0x0003C04A15B72CE1), __ULL(0x0003BFF5B01C5BB2), __ULL(0x0003BFA15955F046),
+  __ULL(0x0003BF4D11600257), __ULL(0x0003BF30FCAD778F), __ULL(0x0003BEDCC8721F56),
+  __ULL(0x0003BE348C4DB9BB), __ULL(0x0003BDA88741555A), __ULL(0x0003BC90F7C84D2F),
+  __ULL(0x0003BBE98997204E), __ULL(0x0003BAEED2161E74), __ULL(0x0003BAB72CF11168),
+  __ULL(0x0003BA63C1613C6B), __ULL(0x0003BA47F61930DA), __ULL(0x0003B969D612A684),
+  __ULL(0x0003B94E1956F170), __ULL(0x0003B8C381DE3E22), __ULL(0x0003B801BE40D12E),
+  __ULL(0x0003B7CA70439EB1), __ULL(0x0003B62C73D0630D), __ULL(0x0003B610E740FD4A),
+  __ULL(0x0003B5874066ED69), __ULL(0x0003B4E246656174), __ULL(0x0003B4C6CCF7CA9B),
+  __ULL(0x0003B37D97C2D0CB), __ULL(0x0003B32B6E24CBE5), __ULL(0x0003B2509A198018),
+  __ULL(0x0003B1E355FA5EFF), __ULL(0x0003B15AE44A24F4), __ULL(0x0003B13F9F1339F0),
+  __ULL(0x0003B09C20CE2C13), __ULL(0x0003AF70F6AF9980), __ULL(0x0003AF1F80705D40),
+  __ULL(0x0003AF045C262911), __ULL(0x0003AE2B7204DBF5), __ULL(0x0003AD1CD9876717),
+  __ULL(0x0003AC95C789DA4F), __ULL(0x0003AC7AC897A82C), __ULL(0x0003ABD8EF6FAC3F),
+  __ULL(0x0003AB374DF2AC01), __ULL(0x0003AA4543D90036), __ULL(0x0003A9BF0255149E),
+  __ULL(0x0003A91E19988076), __ULL(0x0003A8CDB9EDACA9), __ULL(0x0003A8B2F26FA0A3),
+  __ULL(0x0003A82D23ED3377), __ULL(0x0003A812659C8F3B), __ULL(0x0003A7C233D4C3BA),
+  __ULL(0x0003A73CAA0C5BBB), __ULL(0x0003A64CAB96ACB3), __ULL(0x0003A63208B20338),
+  __ULL(0x0003A59257357D99), __ULL(0x0003A54292EEC13E), __ULL(0x0003A50D6CFC7475),
+  __ULL(0x0003A4BDBF69B46C), __ULL(0x0003A4A3333EDBA3), __ULL(0x0003A36516F3CABB),
+  __ULL(0x0003A1F307CA4E2F), __ULL(0x0003A1D8A43E7C42), __ULL(0x0003A1A3E1A4CA0D),
+  __ULL(0x0003A1898296A887), __ULL(0x0003A105BDBE152D), __ULL(0x0003A0EB67A7E4AC),
+  __ULL(0x0003A018ECAB5B1A), __ULL(0x00039F7B4EFBD338), __ULL(0x00039F1258EBF483),
+  __ULL(0x00039DF22E98C9FC), __ULL(0x00039DD80515F7C7), __ULL(0x00039D89916B925A),
+  __ULL(0x00039D554BB1C736), __ULL(0x00039D3B2B0BA5B3), __ULL(0x00039CB89DEBA738),
+  __ULL(0x00039C6A5AEC7DFD), __ULL(0x00039B65DB2B3DF4), __ULL(0x00039AC9D4F1010E),
+  __ULL(0x00039A47F801B051), __ULL(0x000399E02E5D2654), __ULL(0x00039944ABAB5FCD),
+  __ULL(0x000398F6FDFD8E08), __ULL(0x000398A95D6806DB), __ULL(0x0003985BC9E77ADD),
+  __ULL(0x00039828197F5C74), __ULL(0x0003973FC771D37A), __ULL(0x00039725FE750DAC),
+  __ULL(0x000396F270D237D5), __ULL(0x00039657EA96A33F), __ULL(0x0003957082953396),
+  __ULL(0x00039556D38ED826), __ULL(0x000394BCD79678E3), __ULL(0x0003946FECFB6D65),
+  __ULL(0x0003943CAD14A642), __ULL(0x000394230F4779B0), __ULL(0x0003935654636383),
+  __ULL(0x000392BD043AADB8), __ULL(0x00039223E7650099), __ULL(0x00039171867CF7EE),
+  __ULL(0x0003913E9C27DAA7), __ULL(0x000390D8D882EE9A), __ULL(0x00038FF43327168E),
+  __ULL(0x00038FC1734A8733), __ULL(0x00038F29559306CC), __ULL(0x00038E781DACBA37),
+  __ULL(0x00038E2C3F62ACDA), __ULL(0x00038DE06DBC713C), __ULL(0x00038DADE8FC67A9),
+  __ULL(0x00038D48F04ECEC2), __ULL(0x00038CFD44811A48), __ULL(0x00038CCAD8F6D578),
+  __ULL(0x00038BCF131304D5), __ULL(0x00038B3845A88A19), __ULL(0x00038ABAC0BAD5FB),
+  __ULL(0x00038A0B40EFC87A), __ULL(0x000389D928E6550F), __ULL(0x000389C01EF5510E),
+  __ULL(0x000388F801371540), __ULL(0x000388DF03B6D256), __ULL(0x000388492FAC53BA),
+  __ULL(0x000386D3764B7710), __ULL(0x000386A1B92DCBA2), __ULL(0x0003865727C70D8F),
+  __ULL(0x0003852D5D379843), __ULL(0x00038435CA66D41C), __ULL(0x0003830D672626A8),
+  __ULL(0x000382922207ECCD), __ULL(0x0003822F9CAA1BFC), __ULL(0x0003819BFD18AAD2),
+  __ULL(0x000381211D2BE6A5), __ULL(0x0003808DD6706CC9), __ULL(0x0003804445334567),
+  __ULL(0x00037FB146EB4452), __ULL(0x00037F1E78D28EF2), __ULL(0x00037ED523D089D9),
+  __ULL(0x00037E736FD1EC6D), __ULL(0x00037DB047C878C4), __ULL(0x00037D05CA8E9D46),
+  __ULL(0x00037CBCCD5DDEAE), __ULL(0x00037C8C2B3338C7), __ULL(0x00037C4341E1DB52),
+  __ULL(0x00037A8EC3A6E95F), __ULL(0x0003799CFCF9103F), __ULL(0x000379244AD639FC),
+  __ULL(0x000377BAF89E1AF4), __ULL(0x0003772AC380B279), __ULL(0x00037712BF346C72),
+  __ULL(0x000376E2BA825224), __ULL(0x000376CABA1C47D3), __ULL(0x0003757B3CBBCEDF),
+  __ULL(0x000374EBC25F84DA), __ULL(0x0003744499024EA9), __ULL(0x000373FD08528CD9),
+  __ULL(0x000372F7037669FA), __ULL(0x00037297E25F36BE), __ULL(0x00037268598305D4),
+  __ULL(0x00037192B0F1B367), __ULL(0x0003714B8FBD83FC), __ULL(0x000370A5C433DE83),
+  __ULL(0x00036FD0F583DF82), __ULL(0x00036FA1B91AB932), __ULL(0x00036F5AE7FED1B8),
+  __ULL(0x00036F434F7E20DE), __ULL(0x00036EFC8D9475DD), __ULL(0x00036D6C6ECD756E),
+  __ULL(0x00036C992E146959), __ULL(0x00036C81BB63A04A), __ULL(0x00036BC652FC60E9),
+  __ULL(0x00036B80207D4134), __ULL(0x00036AADCC74A615), __ULL(0x00036A967405D188),
+  __ULL(0x0003697EAFE8C150), __ULL(0x00036950209F0E37), __ULL(0x00036938DAD6A797),
+  __ULL(0x000368F310EE0EC9), __ULL(0x000368679E8EAD22), __ULL(0x00036821F6128D08),
+  __ULL(0x00036796C6741A8B), __ULL(0x00036722EB5B552A), __ULL(0x000366C6523F0F58),
+  __ULL(0x00036680EC540028), __ULL(0x000365C812949E25), __ULL(0x0003653DA2C1D56C),
+  __ULL(0x000364E170AE286F), __ULL(0x0003646E4D929251), __ULL(0x000363CD4FA5F502),
+  __ULL(0x000362029DCE060D), __ULL(0x000361BDF9BD063F), __ULL(0x000361A71ACCF96F),
+  __ULL(0x00036162853C5517), __ULL(0x00036134D23A89A4), __ULL(0x000360ABD6262ED6),
+  __ULL(0x0003600C3C2C5A20), __ULL(0x00035FDEAD4910CE), __ULL(0x00035FC7E7A494EF),
+  __ULL(0x00035F9A5FF5753D), __ULL(0x00035F839DEAA0D4), __ULL(0x00035F561D6DF57C),
+  __ULL(0x00035EFB2AD5ED97), __ULL(0x00035EB701761159), __ULL(0x00035E457F15E821),
+  __ULL(0x00035E0172649F27), __ULL(0x00035DBD707022B6), __ULL(0x00035DA6C7810B95),
+  __ULL(0x00035D62D3D9AC46), __ULL(0x00035D1EEAE92D29), __ULL(0x00035CDB0CAD05B6),
+  __ULL(0x00035C5370479FB2), __ULL(0x00035C0FB219540E), __ULL(0x00035B0123ED6335),
+  __ULL(0x00035A909AE6F6F2), __ULL(0x00035A7A1CA296B8), __ULL(0x00035A09B6F82853),
+  __ULL(0x000359C654E486EA), __ULL(0x0003593FB0785760), __ULL(0x000358FC6E1ACE95),
+  __ULL(0x000358B9364A54A1), __ULL(0x0003581C87B365B2), __ULL(0x000357D972FC8A0F),
+  __ULL(0x0003579668C80191), __ULL(0x000355531C73425D), __ULL(0x000354751E874DBE),
+  __ULL(0x000354329C116CB8), __ULL(0x000353C3D9AF64A9), __ULL(0x000353ADB64357D6),
+  __ULL(0x0003533F1667F019), __ULL(0x000352E6AB340D3E), __ULL(0x000352783F0458EB),
+  __ULL(0x000351F3E30031CD), __ULL(0x0003516FB0287081), __ULL(0x00035159ABAE8F1A),
+  __ULL(0x00035117A5198FFB), __ULL(0x000350EBA669E1C4), __ULL(0x00035051CEE3A393),
+  __ULL(0x00034FA2415E2546), __ULL(0x00034F4A95D7CABB), __ULL(0x00034EC73689EAAE),
+  __ULL(0x00034E859628B02F), __ULL(0x00034D954BB30C8D), __ULL(0x00034D7F7A3D5529),
+  __ULL(0x00034D1273D2256B), __ULL(0x00034CBB4FB8D979), __ULL(0x00034C7A00702834),
+  __ULL(0x00034B8ADEB39BA7), __ULL(0x00034B75282AEF4E), __ULL(0x00034A8699FCFDE0),
+  __ULL(0x00034A45A1E5B467), __ULL(0x000349EF115B2CA4), __ULL(0x00034982F5B06A37),
+  __ULL(0x000349015F8392EB), __ULL(0x0003487FF139C042), __ULL(0x0003486A62B78F0C),
+  __ULL(0x000347FEAAC08AA1), __ULL(0x000347BE166C6D6D), __ULL(0x0003473D0B89B9D9),
+  __ULL(0x000347278D94435A), __ULL(0x000346FC94F690A2), __ULL(0x000346665170A45D),
+  __ULL(0x000345FB1D9349DE), __ULL(0x000345E5B0178662), __ULL(0x000345A56E36EF4B),
+  __ULL(0x000344E4E3A9D3FE), __ULL(0x000344BA2639C913), __ULL(0x0003443A0816F7B8),
+  __ULL(0x000343E4B4742B84), __ULL(0x00034324F7E1ED03), __ULL(0x000342A555AC468E),
+  __ULL(0x0003426593317D24), __ULL(0x00034225DA73BFCC), __ULL(0x000341FB64B2839B),
+  __ULL(0x000341BBBC2AE5D4), __ULL(0x0003417C1D5A62F8), __ULL(0x000340E7D084C8F4),
+  __ULL(0x000340BD7B1D4368), __ULL(0x000340A8520694D4), __ULL(0x0003402972106E51),
+  __ULL(0x00033FAAB8BE8E75), __ULL(0x00033F80838BD4CF), __ULL(0x00033F413BC787F5),
+  __ULL(0x00033E839E37C8F3), __ULL(0x00033DC65715B6D7), __ULL(0x00033D4857908B7E),
+  __ULL(0x00033D335B5D49A0), __ULL(0x00033C8B9FF78111), __ULL(0x00033C0DFFEC97AC),
+  __ULL(0x00033BBA550D1F69), __ULL(0x00033AFE5259DF37), __ULL(0x00033A9603F5DC00),
+  __ULL(0x000339874CB9C62E), __ULL(0x0003395DB66CE372), __ULL(0x0003391F5CD42C44),
+  __ULL(0x000338CC49590AB5), __ULL(0x0003388E05B64BDE), __ULL(0x0003384FCB796A58),
+  __ULL(0x0003382654885E77), __ULL(0x000338119AA0459C), __ULL(0x000337AA08B8E6F3),
+  __ULL(0x000336DB32F057CA), __ULL(0x000336B1E171F8BE), __ULL(0x00033673EEFB91EA),
+  __ULL(0x0003362164DF3EE9), __ULL(0x000335F826073302), __ULL(0x0003352A29D337C5),
+  __ULL(0x000334C3526B6125), __ULL(0x000334AEC40776A6), __ULL(0x00033351ECAC1340),
+  __ULL(0x0003333D70C49C0E), __ULL(0x000333147C082618), __ULL(0x0003321F15825735),
+  __ULL(0x0003320AA8EF8F8F), __ULL(0x0003319032E5EA2B), __ULL(0x00033115E18100EF),
+  __ULL(0x000330B00EF43946), __ULL(0x000330730333A376), __ULL(0x0003305EABFA919E),
+  __ULL(0x00032FE4B5E9AA5F), __ULL(0x00032EB46DF18146), __ULL(0x00032E77ADFA0282),
+  __ULL(0x00032DFE4934EC89), __ULL(0x00032D5CA5C29D98), __ULL(0x00032CE395474F12),
+  __ULL(0x00032CCF6B5E522D), __ULL(0x00032BF1E04EE520), __ULL(0x00032B3CF6D3D889),
+  __ULL(0x00032AC487EFAB7A), __ULL(0x00032A3833BA068D), __ULL(0x000329D4154DB03F),
+  __ULL(0x000329C012301068), __ULL(0x00032948144075C1), __ULL(0x000328D039DB6523),
+  __ULL(0x000328A84E478AD3), __ULL(0x0003289459F7E1B2), __ULL(0x0003286C744CBA2B),
+  __ULL(0x00032830A32D51F2), __ULL(0x000327B91B78DEBC), __ULL(0x000327A532F55D5A),
+  __ULL(0x000327061226B0F4), __ULL(0x0003265358215E02), __ULL(0x0003263F813C83EE),
+  __ULL(0x000324B383FC058C), __ULL(0x000324647FFE6DCD), __ULL(0x000323C6A687863C),
+  __ULL(0x0003238B84F28668), __ULL(0x0003233CBB08781C), __ULL(0x000322DA545B7CB9),
+  __ULL(0x000322C6A91D75B4), __ULL(0x0003229F55856835), __ULL(0x000321EE8CFD32A5),
+  __ULL(0x000321A013F65C7F), __ULL(0x0003213E1244003E), __ULL(0x000320EFBBC192D0),
+  __ULL(0x0003207A56B28007), __ULL(0x000320533CA82EFD), __ULL(0x00031FA376B56342),
+  __ULL(0x00031F8FF3B3B930), __ULL(0x00031EE08374B1A1), __ULL(0x00031E7F2D757783),
+  __ULL(0x00031E6BB8B4998D), __ULL(0x00031E44D20AE3B4), __ULL(0x00031E316021E858),
+  __ULL(0x00031E0A7F275826), __ULL(0x00031DBCC88DE1FB), __ULL(0x00031CAD407D423D),
+  __ULL(0x00031C99E26A10E5), __ULL(0x00031C5FCDD67728), __ULL(0x00031B8B201B9472),
+  __ULL(0x00031B174E49E278), __ULL(0x00031ADD72058E10), __ULL(0x00031A5690CB0B80),
+  __ULL(0x000319A9694665B3), __ULL(0x00031982F8F719C0), __ULL(0x00031949577AD978),
+  __ULL(0x000318FC8D2ED6D2), __ULL(0x000318C2FF36B67D), __ULL(0x000318897998BFA6),
+  __ULL(0x00031829AD71580E), __ULL(0x000317DD1AC9A9CC), __ULL(0x000317B6D702B1A8),
+  __ULL(0x000317A3B6823142), __ULL(0x000316F7BB8B1F2C), __ULL(0x0003169850642CEC),
+  __ULL(0x0003165F1B25B643), __ULL(0x000315A0A567C6A5), __ULL(0x000314CF8DCCB388),
+  __ULL(0x00031483A0A905B7), __ULL(0x0003144AB8652276), __ULL(0x0003132EAA1B2B7E),
+  __ULL(0x00031308D9CC7B05), __ULL(0x000312F5F301DC7A), __ULL(0x000312D02825BF0C),
+  __ULL(0x000312264428D554), __ULL(0x000311EDB3211638), __ULL(0x000310D357E97C6F),
+  __ULL(0x000310C08C3E6910), __ULL(0x0003109AF79B87A7), __ULL(0x0003104FD9210AED),
+  __ULL(0x000310178BB501FF), __ULL(0x00030FF2073FBEED), __ULL(0x00030FB9C74AB4BE),
+  __ULL(0x00030F495F94870E), __ULL(0x00030EC664A44DEC), __ULL(0x00030D890271D6B6),
+  __ULL(0x00030D069D3D56E3), __ULL(0x00030CCEC8533569), __ULL(0x00030CA994262A7A),
+  __ULL(0x00030C96FB63F7C1), __ULL(0x00030C5F366DE810), __ULL(0x00030C3A0CE1AD5A),
+  __ULL(0x00030BB81751B972), __ULL(0x00030B92FDAE2F08), __ULL(0x00030B80722F50B9),
+  __ULL(0x00030B48D4FD8FF6), __ULL(0x00030A45B58A68AB), __ULL(0x00030A3339E33D7F),
+  __ULL(0x00030A0E453700FC), __ULL(0x000309D6DCC8F6C7), __ULL(0x0003098D087BACE6),
+  __ULL(0x00030930D2CE2E2D), __ULL(0x0003091E644B461D), __ULL(0x000308C248D84858),
+  __ULL(0x000308AFDF93285A), __ULL(0x00030853DE4F7C46), __ULL(0x000308417A45E855),
+  __ULL(0x0003081CB4CFD00F), __ULL(0x000307095ABDE760), __ULL(0x000306F706599C2C),
+  __ULL(0x000306891E323A80), __ULL(0x0003061B5533101F), __ULL(0x000305BFF021D053),
+  __ULL(0x0003051BA3BFF7B1), __ULL(0x000304AE423CB829), __ULL(0x0003042ECCE62322),
+  __ULL(0x000303D3DBF63F9E), __ULL(0x000303C1AE583FF7), __ULL(0x00030354AE9D0797),
+  __ULL(0x0003031E3A4A56F4), __ULL(0x000302C3897F37C8), __ULL(0x0003028D29A84FAB),
+  __ULL(0x0003020E67D8FD55), __ULL(0x000301A1E2E632FD), __ULL(0x0003017DBD60F318),
+  __ULL(0x000300FF54C7261F), __ULL(0x000300DB3E84D3E0), __ULL(0x00030039043B5066),
+  __ULL(0x0003002701FB19C0), __ULL(0x0002FFCD0362C670), __ULL(0x0002FF8513AFD8D6),
+  __ULL(0x0002FF6120E430C1), __ULL(0x0002FF1945662048), __ULL(0x0002FEBF85F3036D),
+  __ULL(0x0002FE53EF1D6E8F), __ULL(0x0002FDB2C56E124B), __ULL(0x0002FD11DF79E37D),
+  __ULL(0x0002FCCA7286F902), __ULL(0x0002FC94E990AD69), __ULL(0x0002FBF47B9C72F0),
+  __ULL(0x0002FB661976B5D5), __ULL(0x0002FAE9AF181BD8), __ULL(0x0002FAB46958C33C),
+  __ULL(0x0002FA7F2B097B7A), __ULL(0x0002FA267E5DB5DF), __ULL(0x0002F9AA7C0DE668),
+  __ULL(0x0002F98715171CB6), __ULL(0x0002F95200D02C6C), __ULL(0x0002F940510818A0),
+  __ULL(0x0002F8D6439718D5), __ULL(0x0002F86C53AE8BC5), __ULL(0x0002F8490A445480),
+  __ULL(0x0002F8142248887B), __ULL(0x0002F7DF41A933AD), __ULL(0x0002F7759679CB5D),
+  __ULL(0x0002F763FCCD4833), __ULL(0x0002F6D74CC1D516), __ULL(0x0002F6C5BA6AA205),
+  __ULL(0x0002F65C5D73E9D4), __ULL(0x0002F627B9F0E439), __ULL(0x0002F604A6534D2E),
+  __ULL(0x0002F589FB36EADB), __ULL(0x0002F55574E38F89), __ULL(0x0002F53274B7B509),
+  __ULL(0x0002F520F5D853D3), __ULL(0x0002F4B80D942D7E), __ULL(0x0002F41AE7A51623),
+  __ULL(0x0002F3F8048593C6), __ULL(0x0002F2BE990DDAB5), __ULL(0x0002F22244B2A326),
+  __ULL(0x0002F1BA306B47F0), __ULL(0x0002F15238DA668E), __ULL(0x0002F140E7B6B747),
+  __ULL(0x0002F11E47D2AD45), __ULL(0x0002F10CF9123671), __ULL(0x0002F0EA5DF41EED),
+  __ULL(0x0002F0A53141BF9E), __ULL(0x0002F03D8608264A), __ULL(0x0002F01AFDF7FD56),
+  __ULL(0x0002EEE4C3D5E1A3), __ULL(0x0002EEB1285ACFFE), __ULL(0x0002EE168070CE62),
+  __ULL(0x0002EE055545B538), __ULL(0x0002ED9E62C20FCE), __ULL(0x0002ED48AE3DCEC4),
+  __ULL(0x0002ED154B55F73E), __ULL(0x0002ECAE9AA8698E), __ULL(0x0002EBE18DAD4F75),
+  __ULL(0x0002EB9D4CF7BABB), __ULL(0x0002EB6A249BE0EF), __ULL(0x0002EB37033FDC3E),
+  __ULL(0x0002EAAECC77A1A9), __ULL(0x0002EA48C3F44B33), __ULL(0x0002EA37C53F0BE0),
+  __ULL(0x0002E99EF3ADAC8F), __ULL(0x0002E94A288201D7), __ULL(0x0002E8A0CBF90BDF),
+  __ULL(0x0002E84C3A8E9F4B), __ULL(0x0002E83B52FA9549), __ULL(0x0002E808A0D99D86),
+  __ULL(0x0002E770B3DED484), __ULL(0x0002E74EF96909C3), __ULL(0x0002E73E1D53E974),
+  __ULL(0x0002E5ED8C017E8E), __ULL(0x0002E5BB2A176200), __ULL(0x0002E5AA604E95AD),
+  __ULL(0x0002E5242D5F12F7), __ULL(0x0002E5136A6B38C1), __ULL(0x0002E4F1E6C9ACCF),
+  __ULL(0x0002E4AEE89DC661), __ULL(0x0002E41858FD0D73), __ULL(0x0002E3C4CE4C8E17),
+  __ULL(0x0002E360A72779CA), __ULL(0x0002E32E9DBF98C6), __ULL(0x0002E31DF1738B1D),
+  __ULL(0x0002E2CA9F3E489E), __ULL(0x0002E288049908C7), __ULL(0x0002E266BBC7141C),
+  __ULL(0x0002E234D42BD70B), __ULL(0x0002E1D1192F4029), __ULL(0x0002E1C07CA3C50E),
+  __ULL(0x0002E16D7921686E), __ULL(0x0002E0D83B74728C), __ULL(0x0002E095FA89A346),
+  __ULL(0x0002E06451AAA01E), __ULL(0x0002E0433A236EFC), __ULL(0x0002DF9DF1123D71),
+  __ULL(0x0002DF7CEB5C8DA1), __ULL(0x0002DF4B685ABEB6), __ULL(0x0002DE22E214520B),
+  __ULL(0x0002DDF18D9CCC67), __ULL(0x0002DDE11D98BB24), __ULL(0x0002DD8EF88E779C),
+  __ULL(0x0002DD5DB7F4FD1F), __ULL(0x0002DC98F7A09473), __ULL(0x0002DC67D809356E),
+  __ULL(0x0002DBF55297DF90), __ULL(0x0002DB729CC47A75), __ULL(0x0002DB41A49D81EF),
+  __ULL(0x0002DAAEE37805CC), __ULL(0x0002DA9E98C144A3), __ULL(0x0002DA4D2E1414A3),
+  __ULL(0x0002D9AA8F1D39ED), __ULL(0x0002D9595AC77421), __ULL(0x0002D918711EC2CC),
+  __ULL(0x0002D8E7C974E7D4), __ULL(0x0002D8C75D49BD14), __ULL(0x0002D896C0712168),
+  __ULL(0x0002D8868D99D711), __ULL(0x0002D8359A32119F), __ULL(0x0002D8256BAC5093),
+  __ULL(0x0002D7C463A1F6D3), __ULL(0x0002D7A4115D6E5A), __ULL(0x0002D793E94EBF05),
+  __ULL(0x0002D7739B584CFD), __ULL(0x0002D7330805C51F), __ULL(0x0002D6E25FFC1888),
+  __ULL(0x0002D6B203BF7708), __ULL(0x0002D6515E91A635), __ULL(0x0002D5C096F64F66),
+  __ULL(0x0002D5502397BEBF), __ULL(0x0002D4EFDC6CFABE), __ULL(0x0002D46FA544C45D),
+  __ULL(0x0002D42F9AB1172C), __ULL(0x0002D3FF9A300E51), __ULL(0x0002D37FB7EEC72D),
+  __ULL(0x0002D33FD7BDB23D), __ULL(0x0002D31FEBDFBC8F), __ULL(0x0002D30FF6FF3D1C),
+  __ULL(0x0002D2E01C971D21), __ULL(0x0002D250B3582987), __ULL(0x0002D191D4C60D8A),
+  __ULL(0x0002D102EFFE104D), __ULL(0x0002D0B3A5C7C2DB), __ULL(0x0002D05496EEF970),
+  __ULL(0x0002D044C1903A34), __ULL(0x0002D02518E93883), __ULL(0x0002CFB660880016),
+  __ULL(0x0002CF675F61939C), __ULL(0x0002CF38009D5440), __ULL(0x0002CF08A815AE0A),
+  __ULL(0x0002CED955C965C1), __ULL(0x0002CE4B843C7503), __ULL(0x0002CDED179B7AD5),
+  __ULL(0x0002CDDD5D3FCE39), __ULL(0x0002CD017481C187), __ULL(0x0002CC745CD623F7),
+  __ULL(0x0002CC06C62067D6), __ULL(0x0002CB89B09FD7D2), __ULL(0x0002CB2BFD29A752),
+  __ULL(0x0002CABECAC9F5C5), __ULL(0x0002CA03E6817459), __ULL(0x0002C9A698FF2958),
+  __ULL(0x0002C8FBCA2B5D60), __ULL(0x0002C8CD42DB98AC), __ULL(0x0002C8BDC1C51EA2),
+  __ULL(0x0002C870467199F7), __ULL(0x0002C832564EC9A1), __ULL(0x0002C813624714DF),
+  __ULL(0x0002C803E9458009), __ULL(0x0002C7E4F946A959), __ULL(0x0002C778C673881A),
+  __ULL(0x0002C71C22C3FC23), __ULL(0x0002C6EDD9F79A8C), __ULL(0x0002C6CF021D6FAE),
+  __ULL(0x0002C6A0C35A71B3), __ULL(0x0002C634F2F6952E), __ULL(0x0002C6162B252CD3),
+  __ULL(0x0002C606C83C95A4), __ULL(0x0002C5E8046B69C7), __ULL(0x0002C5019CA9F02E),
+  __ULL(0x0002C4D399DAF1E8), __ULL(0x0002C4C444E9A543), __ULL(0x0002C4964A103D69),
+  __ULL(0x0002C449B53BA028), __ULL(0x0002C43A6640C67F), __ULL(0x0002C35514DCE96E),
+  __ULL(0x0002C2AD4889976D), __ULL(0x0002C29E0B5D46B2), __ULL(0x0002C27F92FD50D1),
+  __ULL(0x0002C251E35A69C5), __ULL(0x0002C215025C07F9), __ULL(0x0002C1E7607FE04A),
+  __ULL(0x0002C1B9C48946EE), __ULL(0x0002C140416DB611), __ULL(0x0002C0E53A8B49CB),
+  __ULL(0x0002C08A4B25400F), __ULL(0x0002C05CDC3E092D), __ULL(0x0002C020517BBD6D),
+  __ULL(0x0002C00210018C01), __ULL(0x0002BFF2F03E0AD9), __ULL(0x0002BF3DA5B673D3),
+  __ULL(0x0002BEE323726264), __ULL(0x0002BEC4FD338129), __ULL(0x0002BE97C8AE5C9B),
+  __ULL(0x0002BE5B8BB29F52), __ULL(0x0002BE2E64BCB3DF), __ULL(0x0002BE0143949526),
+  __ULL(0x0002BDB619347473), __ULL(0x0002BDA712A94488), __ULL(0x0002BD7A02E3D6AF),
+  __ULL(0x0002BD1FF4B3DC2E), __ULL(0x0002BC4E2D6A29DD), __ULL(0x0002BBE578D167B0),
+  __ULL(0x0002BBB8A2B74796), __ULL(0x0002BB9AC1D6BAE0), __ULL(0x0002BB412E8272DE),
+  __ULL(0x0002BB0583B222F6), __ULL(0x0002BAD8CA442ECA), __ULL(0x0002BA7F689160D4),
+  __ULL(0x0002BA61A26A3EAE), __ULL(0x0002BA34FDF19E0C), __ULL(0x0002B9CCE9B17C13),
+  __ULL(0x0002B9A05839A728), __ULL(0x0002B947465C1E2C), __ULL(0x0002B8FD1E2C0D0F),
+  __ULL(0x0002B8D0A73A9322), __ULL(0x0002B8A435F517FD), __ULL(0x0002B868FD13E738),
+  __ULL(0x0002B83C99063192), __ULL(0x0002B8103AA0DDF0), __ULL(0x0002B7F2A981705C),
+  __ULL(0x0002B7E3E1E2D77D), __ULL(0x0002B7C65487AE61), __ULL(0x0002B78B41586032),
+  __ULL(0x0002B732B75E2A89), __ULL(0x0002B715390CE2ED), __ULL(0x0002B6AE12A27F63),
+  __ULL(0x0002B629A07B09A0), __ULL(0x0002B5E0218AB59F), __ULL(0x0002B5D1706BE6A2),
+  __ULL(0x0002B55BFDD77AB1), __ULL(0x0002B52FFD1F7D03), __ULL(0x0002B49D785D4193),
+  __ULL(0x0002B4718FCFD1D9), __ULL(0x0002B4286DEC8BB5), __ULL(0x0002B3EDF788507E),
+  __ULL(0x0002B3D0C00A224E), __ULL(0x0002B2F5EE648FAE), __ULL(0x0002B1F00FAA435B),
+  __ULL(0x0002B198F182B854), __ULL(0x0002B15EE9A04C68), __ULL(0x0002B0BF86422584),
+  __ULL(0x0002B068B4ED04CC), __ULL(0x0002B05A3ED4DCC8), __ULL(0x0002B02EE031655D),
+  __ULL(0x0002AFD8334D8813), __ULL(0x0002AF64C40E797B), __ULL(0x0002AF398453582D),
+  __ULL(0x0002AF0E4A09142E), __ULL(0x0002AEFFE27B0144), __ULL(0x0002AE7E59A543D8),
+  __ULL(0x0002AE6197342594), __ULL(0x0002ADA6E2013C0A), __ULL(0x0002AD8A319A8DD2),
+  __ULL(0x0002AD50D8006B14), __ULL(0x0002ACCFF174554F), __ULL(0x0002AC8869DF391F),
+  __ULL(0x0002AC4F3B5C7B81), __ULL(0x0002AC07CEA6CFCF), __ULL(0x0002ABDCFAFB15CC),
+  __ULL(0x0002AB7921ECEA3C), __ULL(0x0002AB5CA01F0814), __ULL(0x0002AACE3ABDB9E1),
+  __ULL(0x0002AA31DC80F3D4), __ULL(0x0002A9B221B909DF), __ULL(0x0002A95D151856C0),
+  __ULL(0x0002A9246DCBC342), __ULL(0x0002A85E6E5B411A), __ULL(0x0002A809B66382DB),
+  __ULL(0x0002A7DF62509092), __ULL(0x0002A7B51382417C), __ULL(0x0002A77CB29F5BC4),
+  __ULL(0x0002A75270180C5B), __ULL(0x0002A6FDFACC89F6), __ULL(0x0002A6554F268E47),
+  __ULL(0x0002A5E50B3E678A), __ULL(0x0002A582EE4A7EE3), __ULL(0x0002A566EB3BFB53),
+  __ULL(0x0002A504F2C4423D), __ULL(0x0002A4B10FC45C25), __ULL(0x0002A487260F9675),
+  __ULL(0x0002A44156C01DB7), __ULL(0x0002A3EDA42FA664), __ULL(0x0002A362533F889E),
+  __ULL(0x0002A33892F6783C), __ULL(0x0002A31CC04E7497), __ULL(0x0002A2E521DED1D0),
+  __ULL(0x0002A2681EDF3429), __ULL(0x0002A214E1419235), __ULL(0x0002A1982B554209),
+  __ULL(0x0002A152F6A3E9C4), __ULL(0x0002A1452102109F), __ULL(0x0002A1297772E8A7),
+  __ULL(0x0002A09F49B8D565), __ULL(0x0002A05A481F6F38), __ULL(0x00029FF9C40ECE5C),
+  __ULL(0x00029FDE35B30C9E), __ULL(0x00029FB4E465F619), __ULL(0x00029FA71FC2AC1D),
+  __ULL(0x00029F625108B7D3), __ULL(0x00029EBD6727C300), __ULL(0x00029E41ECDFFA6F),
+  __ULL(0x00029E34376D7985), __ULL(0x00029E18CE371235), __ULL(0x00029D8FE1C2305D),
+  __ULL(0x00029D22800E603D), __ULL(0x00029CC2E7DDCB67), __ULL(0x00029C7EB072686E),
+  __ULL(0x00029C1F4706D735), __ULL(0x00029BF66B532DEA), __ULL(0x00029BDB30F7591E),
+  __ULL(0x00029BB25D96D642), __ULL(0x00029B2A6BAF7ED5), __ULL(0x00029B01ADE81516),
+  __ULL(0x00029ABDD1FEA300), __ULL(0x00029A9521793B25), __ULL(0x00029A8792674545),
+  __ULL(0x00029A36438F7CBD), __ULL(0x00029A0DA3937F7F), __ULL(0x00029942CDE256AB),
+  __ULL(0x000298FF4CC3304F), __ULL(0x000298C955B9BE68), __ULL(0x000298A0E231C0FB),
+  __ULL(0x00029885ED3DC82B), __ULL(0x0002985D81E930DA), __ULL(0x00029827A51DD32F),
+  __ULL(0x0002971AD7F12FDE), __ULL(0x0002970D6CFE97FB), __ULL(0x000296F298BA5F83),
+  __ULL(0x000296E52F68AE0E), __ULL(0x00029694C2E24942), __ULL(0x0002961C44A8F66E),
+  __ULL(0x0002960183E4E348), __ULL(0x000295D966CC4342), __ULL(0x000295A3F23AB279),
+  __ULL(0x000295612CA80CAC), __ULL(0x0002953922FAECCC), __ULL(0x000294C12304102C),
+  __ULL(0x000294494E938548), __ULL(0x0002943C00C401D0), __ULL(0x000293EC3927B983),
+  __ULL(0x00029381F7A5C09F), __ULL(0x0002934CE3B892B7), __ULL(0x000293251A61A929),
+  __ULL(0x0002930A96D28E60), __ULL(0x000292E2D57B82CF), __ULL(0x000292BB18F0073C),
+  __ULL(0x000292ADDB278253), __ULL(0x000291564F422622), __ULL(0x000290FA0E2CC52A),
+  __ULL(0x000290DFB7313411), __ULL(0x0002905C23EF4B67), __ULL(0x00028FF30741AB43),
+  __ULL(0x00028FE5E609E87B), __ULL(0x00028FCBA52E0023), __ULL(0x00028FA447D4B38E),
+  __ULL(0x00028F559B4DCE94), __ULL(0x00028F4880628C67), __ULL(0x00028F2132C5ABA6),
+  __ULL(0x00028ED2A5AF2057), __ULL(0x00028E842B6C8CD1), __ULL(0x00028E5CF558A28D),
+  __ULL(0x00028E42D3E770F5), __ULL(0x00028DE76F483FC7), __ULL(0x00028DA6370934B6),
+  __ULL(0x00028D7F1B880FDF), __ULL(0x00028D5804B49A48), __ULL(0x00028CFCE19ED024),
+  __ULL(0x00028CBBD81ED5FF), __ULL(0x00028C60E092D94E), __ULL(0x00028BF909430AAC),
+  __ULL(0x00028BC529FFA96F), __ULL(0x00028B9E47F77D26), __ULL(0x00028B5091D079A4),
+  __ULL(0x00028B36AE8C721D), __ULL(0x00028B02EE306079), __ULL(0x00028A74C7934CAC),
+  __ULL(0x00028A4E0DA24EED), __ULL(0x00028A412602F4EF), __ULL(0x000289CD1870DFD8),
+  __ULL(0x0002893F78F38C17), __ULL(0x00028918E3CD5432), __ULL(0x0002890C08701C0C),
+  __ULL(0x0002889869107044), __ULL(0x00028871E7C22DE3), __ULL(0x0002880B4FF28D43),
+  __ULL(0x000287B1A5BA7B98), __ULL(0x00028771A90B0E09), __ULL(0x0002874B4AB2FD57),
+  __ULL(0x000286FE9BA5C445), __ULL(0x000286F1D59267D4), __ULL(0x000286CB865EE22F),
+  __ULL(0x000286B1FEC1B464), __ULL(0x0002867EF592ADCC), __ULL(0x0002860C3E576674),
+  __ULL(0x000285BFDACB3224), __ULL(0x0002855A1CD02BF5), __ULL(0x0002854D6751D5A3),
+  __ULL(0x00028533FDD58751), __ULL(0x000284DB1C633946), __ULL(0x000284C1BBE6619D),
+  __ULL(0x0002848F00EA27F3), __ULL(0x00028442F765EF1C), __ULL(0x000283F6FFD034AB),
+  __ULL(0x000283396323B754), __ULL(0x000282D47068ADF8), __ULL(0x000282A202EC1097),
+  __ULL(0x00028288CF252B07), __ULL(0x0002827C35FF7879), __ULL(0x000282566D850870),
+  __ULL(0x000281CC09C0FDD5), __ULL(0x00028180A6A3EB49), __ULL(0x0002814E6E66927D),
+  __ULL(0x0002810FB3276E36), __ULL(0x000280EA157ED9D4), __ULL(0x000280C47C4019A7),
+  __ULL(0x0002809EE76A66E4), __ULL(0x0002804747EF8229), __ULL(0x00028021C1C7B808),
+  __ULL(0x00027FB149AF6EE9), __ULL(0x00027F72DF25C02B), __ULL(0x00027F2808F8F7E0),
+  __ULL(0x00027F1B91A5715D), __ULL(0x00027EDD444E6A50), __ULL(0x00027ED0CFE554A8),
+  __ULL(0x00027EB7E8880E1C), __ULL(0x00027E1637F20EB3), __ULL(0x00027DFD5F1EC5AD),
+  __ULL(0x00027DB2E03FD507), __ULL(0x00027D813FFF609F), __ULL(0x00027D6872C4866A),
+  __ULL(0x00027CF8EF1910FF), __ULL(0x00027CC76BC3F3C1), __ULL(0x00027C89926B9929),
+  __ULL(0x00027C330FE92AEA), __ULL(0x00027BD04E63DEAA), __ULL(0x00027BAB4DB8F0EF),
+  __ULL(0x00027B86515C540E), __ULL(0x00027B5507924268), __ULL(0x00027B177614DFB3),
+  __ULL(0x00027AF28AEA0448), __ULL(0x00027AC158084A76), __ULL(0x00027A9C76DF96F4),
+  __ULL(0x00027A52C167E774), __ULL(0x00027A1561EC975C), __ULL(0x0002799AC68FEB1D),
+  __ULL(0x0002795D8AA7AD59), __ULL(0x0002792C9672CC2F), __ULL(0x000279141F2EB9B9),
+  __ULL(0x000278CAC4B95984), __ULL(0x0002782C1052433B), __ULL(0x000277BE5F914280),
+  __ULL(0x000277A604918964), __ULL(0x0002775CFED5950B), __ULL(0x000276EF95DE52DA),
+  __ULL(0x000276CB25F8A08C), __ULL(0x00027615358AC361), __ULL(0x000275F0DED905D5),
+  __ULL(0x000275C071C6048E), __ULL(0x0002759C24DA4FB8), __ULL(0x000275172E95B076),
+  __ULL(0x000274CEBFEA81EE), __ULL(0x000274C2AF17BED6), __ULL(0x000274AA8ED5C857),
+  __ULL(0x0002748661EB578D), __ULL(0x00027462392A7787), __ULL(0x000274562C818293),
+  __ULL(0x00027419F4228A7D), __ULL(0x0002740DEA3EEC9C), __ULL(0x000273F5D7DA0E3D),
+  __ULL(0x000273D1BFB84448), __ULL(0x000273ADABBC756B), __ULL(0x000273A1A5FF0FBC),
+  __ULL(0x0002737D978A1D9F), __ULL(0x000272F985F220C6), __ULL(0x0002728DA0DFA34D),
+  __ULL(0x00027269B2198F14), __ULL(0x000271FDFE7DA53C), __ULL(0x000271B645FBE4FF),
+  __ULL(0x000271867EC603FD), __ULL(0x0002713EE1A1F328), __ULL(0x0002711B1935BAC5),
+  __ULL(0x000270DF7EEFD6A8), __ULL(0x00027098080172DA), __ULL(0x0002708C2070873F),
+  __ULL(0x0002702CF43CD721), __ULL(0x0002702110C07332), __ULL(0x00026FE5A61CEBE7),
+  __ULL(0x00026FD9C557B82F), __ULL(0x00026F9E6845CE93), __ULL(0x00026F33A9FF72CE),
+  __ULL(0x00026F101D5BB262), __ULL(0x00026E99BB297CB0), __ULL(0x00026E821352057D),
+  __ULL(0x00026E764012D814), __ULL(0x00026E52C90739F4), __ULL(0x00026DD0E1BE04F3),
+  __ULL(0x00026DAD7D8764F5), __ULL(0x00026D8A1D57E33E), __ULL(0x00026D2014ED34B4),
+  __ULL(0x00026CFCC4D34DD2), __ULL(0x00026CAA6EDCE951), __ULL(0x00026C63ED68715E),
+  __ULL(0x00026C06045EF2DB), __ULL(0x00026BFA493D7B32), __ULL(0x00026BD71A82C437),
+  __ULL(0x00026BB3EFC60DDC), __ULL(0x00026B9C802A5B32), __ULL(0x00026B4A877D2438),
+  __ULL(0x00026B0455E0C5FA), __ULL(0x00026AECF38B1525), __ULL(0x00026AE14309D49E),
+  __ULL(0x00026A782259DC28), __ULL(0x00026A1ACDED921F), __ULL(0x0002694936D405C3),
+  __ULL(0x00026903795E01F0), __ULL(0x000268E0A08B75C8), __ULL(0x0002688F60976E36),
+  __ULL(0x000267ED20D40680), __ULL(0x000267E18D415C3C), __ULL(0x0002679C20F3C773),
+  __ULL(0x0002677970AB2615), __ULL(0x000267341BD2E752), __ULL(0x000267117741F7F2),
+  __ULL(0x000266FA610C26EC), __ULL(0x000266EED6979CD6), __ULL(0x000266929288EEA4),
+  __ULL(0x000265E5DD78D44D), __ULL(0x000265B7DFB5FB72), __ULL(0x0002652E0FBCC8A3),
+  __ULL(0x0002650BA569A372), __ULL(0x0002645FCBAC5078), __ULL(0x00026426987EF561),
+  __ULL(0x0002641B2924875A), __ULL(0x000263B4522CE55A), __ULL(0x0002639D7C6E2931),
+  __ULL(0x0002637B3F023619), __ULL(0x00026336CFA94D49), __ULL(0x00026309389A9FAD),
+  __ULL(0x0002628BFC3C7B15), __ULL(0x000262809C33E7F7), __ULL(0x0002625E7EA5174B),
+  __ULL(0x000261E18831A834), __ULL(0x0002617B7038FD7A), __ULL(0x000261701A55E823),
+  __ULL(0x00026137733907C7), __ULL(0x0002612C1FDD32DA), __ULL(0x000260F385627740),
+  __ULL(0x00026049F4FDE95E), __ULL(0x0002603EAA74CFC8), __ULL(0x00025FA0C2ED7288),
+  __ULL(0x00025F7EF768333E), __ULL(0x00025F302B233C10), __ULL(0x00025ED63621AFB8),
+  __ULL(0x00025EB4811FF2AB), __ULL(0x00025E4440CB135C), __ULL(0x00025DEA919E0D7A),
+  __ULL(0x00025DDF5D95FF89), __ULL(0x00025DBDC3FA0C2E), __ULL(0x00025DA75FA40735),
+  __ULL(0x00025CF4787B402E), __ULL(0x00025CDE23045422), __ULL(0x00025CD2F8E72A42),
+  __ULL(0x00025CBCA5E95194), __ULL(0x00025C9B2C8368A9), __ULL(0x00025C9004DEE90A),
+  __ULL(0x00025C4D1FA7C63D), __ULL(0x00025C36D68A20B1), __ULL(0x00025C156BF277F5),
+  __ULL(0x00025BF4050CD65A), __ULL(0x00025BB14255351A), __ULL(0x00025BA62350962C),
+  __ULL(0x00025B84C8B7F551), __ULL(0x00025B6E8E5E576A), __ULL(0x00025B4D39E9AAC6),
+  __ULL(0x00025B20CF07E310), __ULL(0x00025AFF832919D8), __ULL(0x00025AE9529F5B6F),
+  __ULL(0x00025A7A78693E14), __ULL(0x00025A6451A8E161), __ULL(0x000259B3563889B7),
+  __ULL(0x0002597C1CF72E15), __ULL(0x0002594FF6752B26), __ULL(0x000258F7BCE0143F),
+  __ULL(0x000258ECB77F6898), __ULL(0x000258739700698C), __ULL(0x000258689677F5F5),
+  __ULL(0x00025852969CA85D), __ULL(0x0002583199D95EDE), __ULL(0x00025805A3CD9226),
+  __ULL(0x000257E4AF7E6266), __ULL(0x0002578CE05B0B84), __ULL(0x00025740202FB1BA),
+  __ULL(0x0002572A3608487B), __ULL(0x000256C7AC297AFD), __ULL(0x0002569BEB10940B),
+  __ULL(0x000256860CE9E86B), __ULL(0x00025618CE1B5C46), __ULL(0x000255F80FD6FA2B),
+  __ULL(0x000255B69E0E6457), __ULL(0x000255753A977615), __ULL(0x000255548E3925EC),
+  __ULL(0x0002551E218C3B5E), __ULL(0x000255134033E4EC), __ULL(0x000254DCDF6C3DD2),
+  __ULL(0x000254D200749104), __ULL(0x00025490CEF67CCC), __ULL(0x000253F8E8259CAD),
+  __ULL(0x000253B7E60A0461), __ULL(0x000253567D73AFBB), __ULL(0x0002534BACAFACB8),
+  __ULL(0x000252EA6777B07A), __ULL(0x000252B46B300CA1), __ULL(0x00025289420427A9),
+  __ULL(0x00025253575BD20A), __ULL(0x00025151127EF1FE), __ULL(0x00025146547F5A4C),
+  __ULL(0x00025130D9AADCDF), __ULL(0x00025110A4568C89), __ULL(0x000250E5B8013AFA),
+  __ULL(0x000250B019528614), __ULL(0x000250A561264C1F), __ULL(0x0002506FCE199533),
+  __ULL(0x00024FCF4F018FEF), __ULL(0x00024FC49EF54CC2), __ULL(0x00024F048005C58B),
+  __ULL(0x00024EE486FDFD46), __ULL(0x00024EAF44F5A039), __ULL(0x00024E8F5525A86D),
+  __ULL(0x00024E84B0A4C927), __ULL(0x00024E24F95D078E), __ULL(0x00024E0FB86737AF),
+  __ULL(0x00024DEFD9D52B78), __ULL(0x00024DC561179F74), __ULL(0x00024D7081F27DA5),
+  __ULL(0x00024D2652B92B89), __ULL(0x00024CD1A151D2C5), __ULL(0x00024CB1E511D4AF),
+  __ULL(0x00024C67E5C87EEB), __ULL(0x00024C52C4D4F906), __ULL(0x00024BE936D21413),
+  __ULL(0x00024BD41EF68051), __ULL(0x00024BB47E037F54), __ULL(0x00024BA9F3C971CC),
+  __ULL(0x00024B75465260D3), __ULL(0x00024B361C3973CF), __ULL(0x00024B2B968757A2),
+  __ULL(0x00024B0C07B41C69), __ULL(0x00024ACCF439C535), __ULL(0x00024AAD6F91917A),
+  __ULL(0x00024A8DEE4BF35C), __ULL(0x00024A78EF5409EA), __ULL(0x00024A39FB70207D),
+  __ULL(0x00024A2F7EC5277D), __ULL(0x00024A100B046D35), __ULL(0x000249FB150E90C2),
+  __ULL(0x000249BC3C2B01FE), __ULL(0x0002499CD4C71FBF), __ULL(0x00024972FAD3E0F2),
+  __ULL(0x0002495E1018701D), __ULL(0x000249539B4A3163), __ULL(0x000249343F1D1E7E),
+  __ULL(0x000248D63EBC2B5E), __ULL(0x000248A212AE1DB4), __ULL(0x00024882C983A6FD),
+  __ULL(0x0002485917D56A41), __ULL(0x0002481A9876011F), __ULL(0x000247FB5DC9697E),
+  __ULL(0x00024788F8878E19), __ULL(0x0002477E9474A281), __ULL(0x0002475F6A742A55),
+  __ULL(0x00024721206EC2AA), __ULL(0x000246C3CA537FA1), __ULL(0x000246AF1094F15F),
+  __ULL(0x0002466692147E27), __ULL(0x0002464785F51254), __ULL(0x00024632D50C2DF2),
+  __ULL(0x000245CB768A81AA), __ULL(0x000245AC7AF200CC), __ULL(0x00024559EC25B7E1),
+  __ULL(0x00024530AD88B8D0), __ULL(0x0002451C106BF706), __ULL(0x000244F2DA9527C1),
+  __ULL(0x00024481A4A3F0CC), __ULL(0x0002445884B05D16), __ULL(0x0002441ADFAEB4BB),
+  __ULL(0x000243FC1216D0A0), __ULL(0x000243DD47C42FF4), __ULL(0x0002438B3C368254),
+  __ULL(0x0002434DC2C71E34), __ULL(0x000242F1A5101F3C), __ULL(0x000242585F3CDD6E),
+  __ULL(0x0002422F8D8535AA), __ULL(0x0002421B26D274C6), __ULL(0x00024210F4034800),
+  __ULL(0x000241FC8F793D6D), __ULL(0x000241DDFB5CA9E5), __ULL(0x000241599EE65F68),
+  __ULL(0x0002414547496B1E), __ULL(0x000240FE1FEC8F70), __ULL(0x000240844E5CFBD6),
+  __ULL(0x00024014D0C08AF5), __ULL(0x00023FF67028A353), __ULL(0x00023FEC50AC3E1C),
+  __ULL(0x00023FCDF4598338), __ULL(0x00023F9B6196B0E8), __ULL(0x00023F7D0DCB9C6B),
+  __ULL(0x00023F3656B31AB5), __ULL(0x00023F180D8C8911), __ULL(0x00023EF9C7963A3C),
+  __ULL(0x00023EBD45386197), __ULL(0x00023E8AE24E887F), __ULL(0x00023E6CAB32CB15),
+  __ULL(0x00023E629988FF26), __ULL(0x00023E2636F7248F), __ULL(0x00023DF3EE84F618),
+  __ULL(0x00023DB7A3348442), __ULL(0x00023D8F78080D3B), __ULL(0x00023D352B71929D),
+  __ULL(0x00023CDAFB45653A), __ULL(0x00023CA8ECC477A4), __ULL(0x00023C8AE84371BC),
+  __ULL(0x00023C62E726E8DD), __ULL(0x00023C12F5B0DC88), __ULL(0x00023BF500E61F93),
+  __ULL(0x00023BD70F3E5C9D), __ULL(0x00023BAF273EE72E), __ULL(0x00023B5F67F33C76),
+  __ULL(0x00023AFBD818BE59), __ULL(0x00023AE7F2B0678F), __ULL(0x00023ADE0081564C),
+  __ULL(0x00023AAC4AC84BDC), __ULL(0x00023AA25AAD3884), __ULL(0x00023A70AF5682E4),
+  __ULL(0x00023A352057255E), __ULL(0x00023A175D812711), __ULL(0x000239EFB3E34D2A),
+  __ULL(0x000239D1F84BE34E), __ULL(0x000239A07133C27F), __ULL(0x0002393D7CD346B6),
+  __ULL(0x0002390C0F86703C), __ULL(0x000238B32D33B5D2), __ULL(0x00023832FAD2F11D),
+  __ULL(0x0002381F46F8D042), __ULL(0x00023801BBC15AAF), __ULL(0x0002376E31B7499F),
+  __ULL(0x000237645E7038A7), __ULL(0x00023750B8E75F43), __ULL(0x0002372971EA5004),
+  __ULL(0x0002370C003E0550), __ULL(0x000236D12610618F), __ULL(0x000236965818D466),
+  __ULL(0x0002363E3A029BFD), __ULL(0x0002362AA8D2DC73), __ULL(0x000236038A81ABD3),
+  __ULL(0x0002359812FC92E3), __ULL(0x0002357ACAED069E), __ULL(0x0002357108E9A51C),
+  __ULL(0x0002353683E70EDC), __ULL(0x00023490F769476C), __ULL(0x00023473CA90D9DE),
+  __ULL(0x0002341C561C6355), __ULL(0x000233E217861897), __ULL(0x000233C4FCBD5B5D),
+  __ULL(0x000233BB49D004D1), __ULL(0x00023333A3D720C4), __ULL(0x000232EFE952B5E9),
+  __ULL(0x000232A295CF7E77), __ULL(0x0002325EFE27B238), __ULL(0x0002324BB13C6DB8),
+  __ULL(0x000232082E727D16), __ULL(0x000231CE5D8698B5), __ULL(0x000231BB1A873D0D),
+  __ULL(0x0002319E38820D6B), __ULL(0x0002318159751489), __ULL(0x00023177BA6EF25E),
+  __ULL(0x000230CAC4509B65), __ULL(0x000230B79319D8E6), __ULL(0x0002309ACBBE2210),
+  __ULL(0x0002303AF333F747), __ULL(0x00023001810108B0), __ULL(0x00022F8EBFEBC817),
+  __ULL(0x00022F7216FF4A9E), __ULL(0x00022F091A0AEF8B), __ULL(0x00022EFF90A3162F),
+  __ULL(0x00022EB351196570), __ULL(0x00022E5DA277B4AE), __ULL(0x00022E2491F9687D),
+  __ULL(0x00022DEB8D23DDB5), __ULL(0x00022D961BB8285C), __ULL(0x00022D8C9EF46321),
+  __ULL(0x00022D702A98E241), __ULL(0x00022D53B924BF12), __ULL(0x00022D374A9787CF),
+  __ULL(0x00022D2457D5E6C8), __ULL(0x00022D07EE1DE6D2), __ULL(0x00022CC5AD5F01CF),
+  __ULL(0x00022CB2C2568F33), __ULL(0x00022CA94D4DBED1), __ULL(0x00022C415B1DC89B),
+  __ULL(0x00022C1B984E8AC5), __ULL(0x00022BE2FDB38AB5), __ULL(0x00022BC6B4B806B7),
+  __ULL(0x00022B9796CF24AA), __ULL(0x00022B7B557F48A5), __ULL(0x00022B55AD8CF191),
+  __ULL(0x00022B1D3B330D09), __ULL(0x00022AC8A52CECED), __ULL(0x00022A904F798E63),
+  __ULL(0x00022A7428E9FA54), __ULL(0x00022A454453FFF7), __ULL(0x00022A3BE45CDB70),
+  __ULL(0x000229D4D9A8A2BA), __ULL(0x000229935B268267), __ULL(0x000229774E3EB6D6),
+  __ULL(0x0002295B442E81CF), __ULL(0x0002294894625F0B), __ULL(0x000228F48CE7B117),
+  __ULL(0x000228D8901530CD), __ULL(0x0002287B59CA4410), __ULL(0x00022814F58BB265),
+  __ULL(0x0002280BA87F06EE), __ULL(0x000227D3E0C71F14), __ULL(0x000227647321A55A),
+  __ULL(0x00022751E53B4410), __ULL(0x000226FE7620198F), __ULL(0x000226AB2041E038),
+  __ULL(0x000226A1DF622D5A), __ULL(0x0002263C2A48278F), __ULL(0x00022632ED22B700),
+  __ULL(0x0002262073C6145D), __ULL(0x000225E90F21006D), __ULL(0x000225C4278FB988),
+  __ULL(0x0002258CD57E7A60), __ULL(0x0002255EC445E973), __ULL(0x0002251E52BBAB93),
+  __ULL(0x0002250BEBED446B), __ULL(0x00022502B8FC74D8), __ULL(0x000224AFFC621706),
+  __ULL(0x00022466861ABA27), __ULL(0x000223B85BEED9AE), __ULL(0x0002239CE61F2AE4),
+  __ULL(0x0002238173103B7B), __ULL(0x0002236602C1A17F), __ULL(0x0002232F2A63C663),
+  __ULL(0x000223017E7A0B6F), __ULL(0x000222E61AFCDEE0), __ULL(0x000222AF5C3C180E),
+  __ULL(0x0002228AE3274564), __ULL(0x0002226F8B8919D2), __ULL(0x0002225D52A4AFB5),
+  __ULL(0x00022241FF954F1C), __ULL(0x000222024866717D), __ULL(0x00022179F1DDF529),
+  __ULL(0x0002215EB5877C40), __ULL(0x0002213157021ACD), __ULL(0x0002210D10D32E3F),
+  __ULL(0x000220A968B1301C), __ULL(0x0002208E412945A8), __ULL(0x0002206A10A9FF1E),
+  __ULL(0x00022033D0EF04C2), __ULL(0x00022006A414C0C0), __ULL(0x00021FFD9C02B07C),
+  __ULL(0x00021FD078277F8C), __ULL(0x00021FC771E1C7E4), __ULL(0x00021FAC60DC9A11),
+  __ULL(0x00021F7F4A7AFC9F), __ULL(0x00021F7646E6C843), __ULL(0x00021F49397D88A4),
+  __ULL(0x00021F133340C6E1), __ULL(0x00021EC23E07EF1A), __ULL(0x00021E68664C208B),
+  __ULL(0x00021E4D782D14E0), __ULL(0x00021E3B8594A7D3), __ULL(0x00021E17A3F3EC61),
+  __ULL(0x00021DB50FF1D955), __ULL(0x00021D9A339E4047), __ULL(0x00021D7F59F472EA),
+  __ULL(0x00021CF9418885DB), __ULL(0x00021CDE77D1305E), __ULL(0x00021CA000CABC00),
+  __ULL(0x00021C853FE94D67), __ULL(0x00021C4FC6173334), __ULL(0x00021C1A56D8D43A),
+  __ULL(0x00021BFFA3300FF3), __ULL(0x00021BD328499B42), __ULL(0x00021BCA43C9687F),
+  __ULL(0x00021B9DD1AD15AE), __ULL(0x00021B18A7379D9E), __ULL(0x00021B0FC8DB52A4),
+  __ULL(0x00021AC8E078C0C5), __ULL(0x00021AA57345D238), __ULL(0x00021A93BE6B8A8C),
+  __ULL(0x00021A8AE46E25C0), __ULL(0x00021A705834C773), __ULL(0x00021A20C33AA2D3),
+  __ULL(0x00021A0F171857D0), __ULL(0x00021A0641769EDB), __ULL(0x000219EBC24EFA43),
+  __ULL(0x000219DA19A7AD35), __ULL(0x000219676DA4DD1B), __ULL(0x00021955CDAC8CBA),
+  __ULL(0x0002193291338D03), __ULL(0x0002191826E10790), __ULL(0x000218EC261CE344),
+  __ULL(0x000218E35A06573F), __ULL(0x000218D1C2B69D6B), __ULL(0x000218B761E83BD1),
+  __ULL(0x000218943A32739F), __ULL(0x00021882A8119E0A), __ULL(0x000218684F089E65),
+  __ULL(0x000217E4B8A379ED), __ULL(0x000217B028268402), __ULL(0x000217A76667A7CA),
+  __ULL(0x0002178D22E2BC8E), __ULL(0x00021772E1F10402), __ULL(0x0002176162BDE70D),
+  __ULL(0x00021709F7E28B4B), __ULL(0x000216A9F0175D8D), __ULL(0x000216870D130FA6),
+  __ULL(0x000216759D45EA20), __ULL(0x0002166CE5CC8B3F), __ULL(0x0002165B77B42373),
+  __ULL(0x000215227BF6029E), __ULL(0x000214FFCBF30515), __ULL(0x000214EE75A2CAD3),
+  __ULL(0x000214CBCC64526F), __ULL(0x0002146C9233C035), __ULL(0x00021463EBB0E036),
+  __ULL(0x000214529F82FA18), __ULL(0x000214161DBB545D), __ULL(0x000213EAEE05AA4E),
+  __ULL(0x000213E24BB8AD6B), __ULL(0x000213D107F5F003), __ULL(0x0002137AC5F5689F),
+  __ULL(0x00021360EAD033C3), __ULL(0x00021335D87E40D4), __ULL(0x000212E862B3E419),
+  __ULL(0x000212CE95CAA829), __ULL(0x00021278A7854A26), __ULL(0x00021233FCECFAD4),
+  __ULL(0x0002121A4188EAF6), __ULL(0x000211F7F63B35EE), __ULL(0x000211DE40AA3DA8),
+  __ULL(0x000211CD1E56F811), __ULL(0x000211778353139B), __ULL(0x000211443396D9D7),
+  __ULL(0x000210E63B38675D), __ULL(0x000210DDB1EEA65A), __ULL(0x000210CCA02EBC15),
+  __ULL(0x000210C417B88C00), __ULL(0x00021090EABB5B3E), __ULL(0x000210664CCE3EAE),
+  __ULL(0x00021019A83F1C90), __ULL(0x00021011258E8830), __ULL(0x00020FB39A0F8221),
+  __ULL(0x00020F9A1CAD1653), __ULL(0x00020F4DB34A1044), __ULL(0x00020ECE8A1DCA59),
+  __ULL(0x00020EC61215D8DA), __ULL(0x00020E9BBE036414), __ULL(0x00020E6086EF7E97),
+  __ULL(0x00020E36432C7147), __ULL(0x00020E14783FE5CC), __ULL(0x00020DD0EF6A7202),
+  __ULL(0x00020CFE53645DEB), __ULL(0x00020CE518CDFF89), __ULL(0x00020CBB11E10BBE),
+  __ULL(0x00020C9977953FA5), __ULL(0x00020C6F7CC359D7), __ULL(0x00020C3D2571CA11),
+  __ULL(0x00020C23FD68A273), __ULL(0x00020BD893C780F0), __ULL(0x00020BD0340C802B),
+  __ULL(0x00020B7428ABD278), __ULL(0x00020B5B13E895F0), __ULL(0x00020B52B8303B27),
+  __ULL(0x00020B42018C8805), __ULL(0x00020B28F1975050), __ULL(0x00020B078AB6D70C),
+  __ULL(0x00020AEE805AE675), __ULL(0x00020AD57864A5E8), __ULL(0x00020AABC5C7B5CC),
+  __ULL(0x00020A60C83A58BF), __ULL(0x00020A58747EAA3B), __ULL(0x000209FCECF0A2BD),
+  __ULL(0x000209F49C639E6B), __ULL(0x000209B22183736B), __ULL(0x0002097803E20CC7),
+  __ULL(0x0002094E88EDCEDB), __ULL(0x00020935A8B935C9), __ULL(0x0002092D5E840F4C),
+  __ULL(0x000208FBA6CE4A95), __ULL(0x000208D23F9FDF31), __ULL(0x0002087F84FDDD12),
+  __ULL(0x0002086EFC6B2479), __ULL(0x0002083526AE3BBD), __ULL(0x0002081C614C6F23),
+  __ULL(0x0002080BDF055F47), __ULL(0x0002077779A19081), __ULL(0x0002076F3D97ADC2),
+  __ULL(0x0002075EC64C617A), __ULL(0x0002074615506E6B), __ULL(0x00020714BA62E55C),
+  __ULL(0x0002070C817A229C), __ULL(0x000206FC1070A415), __ULL(0x000206C28D026600),
+  __ULL(0x000206914B11625C), __ULL(0x00020678AD9AB861), __ULL(0x0002066845ED40AE),
+  __ULL(0x0002064FAC5B447F), __ULL(0x0002064779AF6A0E), __ULL(0x0002062EE33A1B80),
+  __ULL(0x0002061E8037A846), __ULL(0x000205CCA0B4C650), __ULL(0x000205A3BAA6949A),
+  __ULL(0x0002059B8D6A348D), __ULL(0x00020572AF1BF966), __ULL(0x0002055A2CD2B60E),
+  __ULL(0x000205292F369D86), __ULL(0x0002052105D8D895), __ULL(0x000204BF2987A903),
+  __ULL(0x0002048E494165A7), __ULL(0x0002045D72392FC1), __ULL(0x000204450A2B882A),
+  __ULL(0x0002042CA46C6870), __ULL(0x0002041C61DF91DF), __ULL(0x000203BAE811B0C1),
+  __ULL(0x000203B2CA3F503D), __ULL(0x000203A28F5EBCF9), __ULL(0x00020341438B3B29),
+  __ULL(0x00020339298C8B16), __ULL(0x00020320DD17BAE4), __ULL(0x00020310AB651C08),
+  __ULL(0x000202F862C1D230), __ULL(0x000202D80577BB4E), __ULL(0x00020297571642B1),
+  __ULL(0x0002027F19E226EC), __ULL(0x0002027705FD58BE), __ULL(0x0002024EA6530355),
+  __ULL(0x0002021E3BE32995), __ULL(0x000201E5CB3A1CEF), __ULL(0x000201CD9EBC9D75),
+  __ULL(0x00020144CD8A115E), __ULL(0x0002012CB02F3BAC), __ULL(0x000200F4747F84C5),
+  __ULL(0x000200DC5EB0AFEB), __ULL(0x000200CC51686F9C), __ULL(0x000200C44B24C413),
+  __ULL(0x0002004C0B49ACEF), __ULL(0x0001FFF40047FE50), __ULL(0x0001FFD403C7ACD7),
+  __ULL(0x0001FFC407072D28), __ULL(0x0001FFAC0DC5BD8E), __ULL(0x0001FF8C1A420D09),
+  __ULL(0x0001FF7C21FF3C32), __ULL(0x0001FF74263D8B2B), __ULL(0x0001FF047BCB120D),
+  __ULL(0x0001FEFC83C515EA), __ULL(0x0001FEE49D30CEED), __ULL(0x0001FED4AF613D06),
+  __ULL(0x0001FE6D3DCD3C0E), __ULL(0x0001FE25B8EE12AA), __ULL(0x0001FDCE6A9E8D58),
+  __ULL(0x0001FDC67C412F2D), __ULL(0x0001FDAEB2A40D08), __ULL(0x0001FD6F4E84C8D5),
+  __ULL(0x0001FD578D099532), __ULL(0x0001FD4FA25E8C36), __ULL(0x0001FD1055E1317C),
+  __ULL(0x0001FCE0E6D584B5), __ULL(0x0001FCD8FFDA3BE5), __ULL(0x0001FCA99B1D7486),
+  __ULL(0x0001FC99D0D4B413), __ULL(0x0001FC82233E0CED), __ULL(0x0001FC6A77DBB185),
+  __ULL(0x0001FC3345DC485D), __ULL(0x0001FC0BE0571289), __ULL(0x0001FBF43FF5953D),
+  __ULL(0x0001FBD4C2DE7876), __ULL(0x0001FBA58E8D0E56), __ULL(0x0001FB95D46516EA),
+  __ULL(0x0001FB4F1ABEB099), __ULL(0x0001FB474038F840), __ULL(0x0001FB1FFF41D400),
+  __ULL(0x0001FB009C753048), __ULL(0x0001FAC1E2821B6B), __ULL(0x0001FAAA60C72738),
+  __ULL(0x0001FA92E13A61E7), __ULL(0x0001FA1D8424AADB), __ULL(0x0001FA15B3122F95),
+  __ULL(0x0001F9EEA154AA0D), __ULL(0x0001F9A85D64207F), __ULL(0x0001F9A08FEF94F9),
+  __ULL(0x0001F97990453B36), __ULL(0x0001F95A61AB21C4), __ULL(0x0001F94ACBCF5D48),
+  __ULL(0x0001F92BA2F9F2F1), __ULL(0x0001F8FCECEDCAB9), __ULL(0x0001F89F9ABAF852),
+  __ULL(0x0001F8045E49B133), __ULL(0x0001F7FC9DC5D0D4), __ULL(0x0001F7CE1FB00CEA),
+  __ULL(0x0001F7A767D58439), __ULL(0x0001F7902F93EF7E), __ULL(0x0001F761C57C7489),
+  __ULL(0x0001F75A09F82686), __ULL(0x0001F72BA9DAFA4F), __ULL(0x0001F71C366200B0),
+  __ULL(0x0001F7147D009B3F), __ULL(0x0001F7050AF3F11C), __ULL(0x0001F6EDE1A819D8),
+  __ULL(0x0001F6A8728EF3DB), __ULL(0x0001F6727EBB2CFB), __ULL(0x0001F644493CACFD),
+  __ULL(0x0001F62D31AD3A81), __ULL(0x0001F61DCDD0E170), __ULL(0x0001F5E7F7BA9562),
+  __ULL(0x0001F574C1864B1F), __ULL(0x0001F56568F5BD8B), __ULL(0x0001F546BAA5CFEB),
+  __ULL(0x0001F520660938C6), __ULL(0x0001F501C02A90E6), __ULL(0x0001F4EAC6393FBC),
+  __ULL(0x0001F4C47FAAE89C), __ULL(0x0001F47FA8FFCF1F), __ULL(0x0001F46116C69750),
+  __ULL(0x0001F451CF107795), __ULL(0x0001F41C5B6B9F06), __ULL(0x0001F3DF52F2CFE8),
+  __ULL(0x0001F3C8739C867E), __ULL(0x0001F3A9F7C0239E), __ULL(0x0001F39ABB36E553),
+  __ULL(0x0001F383E226FA98), __ULL(0x0001F37C44EDE233), __ULL(0x0001F356364B81CB),
+  __ULL(0x0001F34E9A76C704), __ULL(0x0001F320F8588791), __ULL(0x0001F311C428E8A8),
+  __ULL(0x0001F30A2A6A032E), __ULL(0x0001F2FAF79DFEA5), __ULL(0x0001F2E42D283F46),
+  __ULL(0x0001F2C5CD1D75FC), __ULL(0x0001F2B69E7B1C58), __ULL(0x0001F29FDA4326DB),
+  __ULL(0x0001F22691806FE3), __ULL(0x0001F1CBC19FA3E0), __ULL(0x0001F1A5F4C6DBDC),
+  __ULL(0x0001F187BB6E8333), __ULL(0x0001F143C7D22BA8), __ULL(0x0001F11E0F9C5BA9),
+  __ULL(0x0001F116850E2D21), __ULL(0x0001F0FFE6C30148), __ULL(0x0001F0DA38D85784),
+  __ULL(0x0001F0D2B058E8B4), __ULL(0x0001F0C3A00975B9), __ULL(0x0001F07FE1F041D1),
+  __ULL(0x0001F069515811FF), __ULL(0x0001F03C364E56E1), __ULL(0x0001F034B298B797),
+  __ULL(0x0001EFF89D1C2904), __ULL(0x0001EFF11B727CFF), __ULL(0x0001EF9E9824B948),
+  __ULL(0x0001EF881C01B955), __ULL(0x0001EF71A1E8E982), __ULL(0x0001EF53ACF3A47C),
+  __ULL(0x0001EF105308CCED), __ULL(0x0001EF015DFBF773), __ULL(0x0001EEBE1A6FEC8D),
+  __ULL(0x0001EE914CE42D11), __ULL(0x0001EE737308CE00), __ULL(0x0001EE5D12018DCE),
+  __ULL(0x0001EE4E27C7761F), __ULL(0x0001EE03A222D745), __ULL(0x0001EDED4B395CAD),
+  __ULL(0x0001ED7DB6F1759C), __ULL(0x0001ED2C03D2A357), __ULL(0x0001ECFF7EF921C4),
+  __ULL(0x0001ECF814479495), __ULL(0x0001ECE1D589A34C), __ULL(0x0001EC9F2559DD0B),
+  __ULL(0x0001EC9055FB7202), __ULL(0x0001EBAB396E0D02), __ULL(0x0001EB9C78B65FB3),
+  __ULL(0x0001EB9518AF85B4), __ULL(0x0001EB68DD2B9A4A), __ULL(0x0001EB52C265AC9E),
+  __ULL(0x0001EB2DEF86C399), __ULL(0x0001EB2692D089C6), __ULL(0x0001EAFA6B2D3E19),
+  __ULL(0x0001EACE4B79A53F), __ULL(0x0001EA6775A7A047), __ULL(0x0001EA601EE34DF2),
+  __ULL(0x0001EA5172035639), __ULL(0x0001EA1E1BDD8239), __ULL(0x0001E9CD859FC09F),
+  __ULL(0x0001E9B78FCB08F5), __ULL(0x0001E9B03E497AEC), __ULL(0x0001E99A4B14BB37),
+  __ULL(0x0001E98459D7A66D), __ULL(0x0001E95FCC25B97E), __ULL(0x0001E92CA88AB701),
+  __ULL(0x0001E91E0E0BC6F3), __ULL(0x0001E916C1200226), __ULL(0x0001E8F243C9C681),
+  __ULL(0x0001E8DC61995F8C), __ULL(0x0001E8BF370F629C), __ULL(0x0001E89AC6C767BA),
+  __ULL(0x0001E867CC4F43B8), __ULL(0x0001E843690E8919), __ULL(0x0001E82D9681D60F),
+  __ULL(0x0001E82650C1E6B8), __ULL(0x0001E7FAB2CEBEB0), __ULL(0x0001E7AAD02174A7),
+  __ULL(0x0001E7698733FABC), __ULL(0x0001E74C88D83A1D), __ULL(0x0001E7284FBEF14D),
+  __ULL(0x0001E6E729BB560A), __ULL(0x0001E6BBC4BB9AE7), __ULL(0x0001E6B489FC272E),
+  __ULL(0x0001E6892E0196B6), __ULL(0x0001E67ABBBAD8B5), __ULL(0x0001E64F6A0BE33C),
+  __ULL(0x0001E64832840FFF), __ULL(0x0001E62420133A2D), __ULL(0x0001E61CE9D44069),
+  __ULL(0x0001E607485FEFA0), __ULL(0x0001E5C66F8E43DA), __ULL(0x0001E5B0D5CB471B),
+  __ULL(0x0001E59B3DF3FB3A), __ULL(0x0001E52105C0713A), __ULL(0x0001E50B7AB08C53),
+  __ULL(0x0001E5044CC2C236), __ULL(0x0001E4D93DA6335B), __ULL(0x0001E4CAE4FA3CCA),
+  __ULL(0x0001E4B5618FBE16), __ULL(0x0001E474E2C38634), __ULL(0x0001E434751EE044),
+  __ULL(0x0001E42D4D8D2598), __ULL(0x0001E3F4189AF510), __ULL(0x0001E3DEA83C303A),
+  __ULL(0x0001E3C939C399BE), __ULL(0x0001E3ACA96BFEE8), __ULL(0x0001E3973F60D979),
+  __ULL(0x0001E37392DA0434), __ULL(0x0001E333698F6246), __ULL(0x0001E316EAE552B3),
+  __ULL(0x0001E2F3514A4283), __ULL(0x0001E2D6DA2EB20B), __ULL(0x0001E2B34A03DFCC),
+  __ULL(0x0001E2AC2DCF6F69), __ULL(0x0001E29DF6076888), __ULL(0x0001E25E055F801B),
+  __ULL(0x0001E201C7A5AEBA), __ULL(0x0001E1D740E6190A), __ULL(0x0001E1895D565F2E),
+  __ULL(0x0001E18249E608EB), __ULL(0x0001E17423A50D33), __ULL(0x0001E16D10D4630D),
+  __ULL(0x0001E11F4F92A4B2), __ULL(0x0001E10A1F398632), __ULL(0x0001E0F4F0BE1AD0),
+  __ULL(0x0001E0C38B892126), __ULL(0x0001E08B2449E1E4), __ULL(0x0001E07600FB7DC4),
+  __ULL(0x0001E02F98B7C336), __ULL(0x0001E00C6C524DA1), __ULL(0x0001DFE23DD86A34),
+  __ULL(0x0001DFDB36D1EC28), __ULL(0x0001DF9C00D952B0), __ULL(0x0001DF08C39A0C1E),
+  __ULL(0x0001DEFAC27BAD4B), __ULL(0x0001DEA6CCF47036), __ULL(0x0001DE9FCF27F0FC),
+  __ULL(0x0001DE8AD6FC1BA8), __ULL(0x0001DE67E81D5FF1), __ULL(0x0001DE3E03668CE2),
+  __ULL(0x0001DE3708A9592D), __ULL(0x0001DE2219AA989C), __ULL(0x0001DDFF3A1451F3),
+  __ULL(0x0001DDE357ABF01A), __ULL(0x0001DDD567B007D0), __ULL(0x0001DDC0813C52F5),
+  __ULL(0x0001DD96B9D09687), __ULL(0x0001DD6CF9B2D2C8), __ULL(0x0001DD51285792FB),
+  __ULL(0x0001DD4340E11D78), __ULL(0x0001DD2E67342F36), __ULL(0x0001DD04B950F9CE),
+  __ULL(0x0001DC9CA66CA30C), __ULL(0x0001DC575DB61C0A), __ULL(0x0001DC42989FEF7D),
+  __ULL(0x0001DBEF9660E470), __ULL(0x0001DBDADA565CAA), __ULL(0x0001DBB84F9DA093),
+  __ULL(0x0001DB8EE2F78BD6), __ULL(0x0001DB87FC3A13C7), __ULL(0x0001DB657D87AF82),
+  __ULL(0x0001DB208F242F1F), __ULL(0x0001DB0BE51F3FB5), __ULL(0x0001DAF73CE66163),
+  __ULL(0x0001DAE9786A9C99), __ULL(0x0001DAC02FC0D4CD), __ULL(0x0001DA900EB6D774),
+  __ULL(0x0001DA6DB3F1E5E5), __ULL(0x0001DA2FE9E36407), __ULL(0x0001DA06C174A5CF),
+  __ULL(0x0001D9EB5522BB8A), __ULL(0x0001D9D6C5FA425B), __ULL(0x0001D9ADAD02C85E),
+  __ULL(0x0001D99FFB9B240A), __ULL(0x0001D97014EBC3EC), __ULL(0x0001D94DE3CA6992),
+  __ULL(0x0001D9470DC1D9BD), __ULL(0x0001D91E0DB3B8D1), __ULL(0x0001D8B7AC9DD9F5),
+  __ULL(0x0001D881248BF520), __ULL(0x0001D87A546C2BA1), __ULL(0x0001D85177CD5202),
+  __ULL(0x0001D83D0C2449D0), __ULL(0x0001D82F700408E7), __ULL(0x0001D828A23F3680),
+  __ULL(0x0001D81B074C22F3), __ULL(0x0001D806A057D03B), __ULL(0x0001D7AE4BE70A32),
+  __ULL(0x0001D7A0B7FFD3C8), __ULL(0x0001D763A81A86F3), __ULL(0x0001D75CE033C914),
+  __ULL(0x0001D74F50FC1BFD), __ULL(0x0001D73AFB9EFCAF), __ULL(0x0001D70B9097AFC9),
+  __ULL(0x0001D65503E1F1A9), __ULL(0x0001D640C41781C4), __ULL(0x0001D5918ED5D1C1),
+  __ULL(0x0001D58AD4513095), __ULL(0x0001D555071C7ED0), __ULL(0x0001D540DD565866),
+  __ULL(0x0001D52CB54BA29E), __ULL(0x0001D5046A67A473), __ULL(0x0001D4AD3533152C),
+  __ULL(0x0001D49FCD6E4174), __ULL(0x0001D49919D574C1), __ULL(0x0001D48500316A07),
+  __ULL(0x0001D43B5B96584B), __ULL(0x0001D42749FC1984), __ULL(0x0001D42099D5368D),
+  __ULL(0x0001D3F87CEEDE9A), __ULL(0x0001D3D066E7C7A2), __ULL(0x0001D3BC5E776744),
+  __ULL(0x0001D39AFEE139F1), __ULL(0x0001D35EF86B50A6), __ULL(0x0001D3584DFC6443),
+  __ULL(0x0001D3305360AFE1), __ULL(0x0001D3085F9B6ED2), __ULL(0x0001D2E719AEF05C),
+  __ULL(0x0001D2AB415CA270), __ULL(0x0001D28364559041), __ULL(0x0001D26F785FB66F),
+  __ULL(0x0001D254EB12A66F), __ULL(0x0001D24103149FF6), __ULL(0x0001D21FD9891F2C),
+  __ULL(0x0001D20BF61296C6), __ULL(0x0001D1F174184226), __ULL(0x0001D1E4343C8A2B),
+  __ULL(0x0001D1DD9497038F), __ULL(0x0001D1D055DC96D3), __ULL(0x0001D18E2782EA86),
+  __ULL(0x0001D13ED57F6F84), __ULL(0x0001D12B05378A83), __ULL(0x0001D117369F9AF1),
+  __ULL(0x0001D0F63761B3AC), __ULL(0x0001D0C80D1B241E), __ULL(0x0001D0A7191775FF),
+  __ULL(0x0001D0A0827310A0), __ULL(0x0001D05815B59E43), __ULL(0x0001D044590FDC85),
+  __ULL(0x0001D0165212D287), __ULL(0x0001CFF5773D3AEC), __ULL(0x0001CFA020D33652),
+  __ULL(0x0001CF93029FD20C), __ULL(0x0001CF5803E715C8), __ULL(0x0001CF3DD0669400),
+  __ULL(0x0001CF1688B3B4E6), __ULL(0x0001CEEF47A99866), __ULL(0x0001CECE968B874C),
+  __ULL(0x0001CEA761B26A6A), __ULL(0x0001CE93C9C3740B), __ULL(0x0001CE79AC6EE7A5),
+  __ULL(0x0001CE457A9D4FC8), __ULL(0x0001CE31EAF82688), __ULL(0x0001CE17D8AF0898),
+  __ULL(0x0001CE044CE63F3C), __ULL(0x0001CDF0C2C4B31E), __ULL(0x0001CDA92BC0AF60),
+  __ULL(0x0001CDA2AAC2B5CE), __ULL(0x0001CD82288C558C), __ULL(0x0001CD4131D9FACE),
+  __ULL(0x0001CD20BD5C11C2), __ULL(0x0001CD0D4674DA57), __ULL(0x0001CC7EBB50A4ED),
+  __ULL(0x0001CC44848329F6), __ULL(0x0001CC31202E8377), __ULL(0x0001CC10D1ED6CCA),
+  __ULL(0x0001CC0A5C6BBCDD), __ULL(0x0001CBFD71F3A1F9), __ULL(0x0001CBEA139B88B9),
+  __ULL(0x0001CBBCE87A82BF), __ULL(0x0001CBB0025B5703), __ULL(0x0001CB5C3C321A33),
+  __ULL(0x0001CB4F5B7F03EA), __ULL(0x0001CB48EB6AC86B), __ULL(0x0001CB224EBB440C),
+  __ULL(0x0001CB022673941C), __ULL(0x0001CAE86FDEB985), __ULL(0x0001CADB95A8D474),
+  __ULL(0x0001CAC1E365CD5C), __ULL(0x0001CA9B5D664236), __ULL(0x0001CA8E87811A1E),
+  __ULL(0x0001CA680A20DC79), __ULL(0x0001CA4E64CCC9EF), __ULL(0x0001CA07ECEF1B8B),
+  __ULL(0x0001C9EE525AB61B), __ULL(0x0001C9DB204C3C1C), __ULL(0x0001C9BB25C75B39),
+  __ULL(0x0001C981A14BBC9E), __ULL(0x0001C96E7858BA55), __ULL(0x0001C95B51007B45),
+  __ULL(0x0001C941C9B41A26), __ULL(0x0001C92EA61984B4), __ULL(0x0001C90863B26C7F),
+  __ULL(0x0001C8FBA451A3D4), __ULL(0x0001C8E227B2162E), __ULL(0x0001C8A8D9AEBD04),
+  __ULL(0x0001C88909E28F99), __ULL(0x0001C862E32D2931), __ULL(0x0001C84FD2367D98),
+  __ULL(0x0001C829B5103603), __ULL(0x0001C8235B7D9F84), __ULL(0x0001C8104FD55AF9),
+  __ULL(0x0001C8039E475980), __ULL(0x0001C7FD45C42D2B), __ULL(0x0001C7CA8805BB13),
+  __ULL(0x0001C7A4811F7247), __ULL(0x0001C77E809102C5), __ULL(0x0001C7523297C023),
+  __ULL(0x0001C7329275577B), __ULL(0x0001C706533F823F), __ULL(0x0001C6F35F5CB968),
+  __ULL(0x0001C6D3CC64AFEB), __ULL(0x0001C6ADEE9D1D5E), __ULL(0x0001C6A79F98C530),
+  __ULL(0x0001C681C92B8BD9), __ULL(0x0001C66EE0516F1E), __ULL(0x0001C66245F51D59),
+  __ULL(0x0001C64F5FBA1F8A), __ULL(0x0001C64913553A1F), __ULL(0x0001C6234CA266E7),
+  __ULL(0x0001C616B676D465), __ULL(0x0001C5C4F75A1A05), __ULL(0x0001C5B21E328CF6),
+  __ULL(0x0001C5799C1FCD4B), __ULL(0x0001C566C93A3442), __ULL(0x0001C5476D34564A),
+  __ULL(0x0001C5349E78FA39), __ULL(0x0001C52E59E8A422), __ULL(0x0001C4F5F8A1D7C2),
+  __ULL(0x0001C4D6AC348AB8), __ULL(0x0001C4BDA560921F), __ULL(0x0001C4B123001E0F),
+  __ULL(0x0001C45FE463A5AF), __ULL(0x0001C440ACAFB1F0), __ULL(0x0001C4024A32F83A),
+  __ULL(0x0001C3EF966895AB), __ULL(0x0001C3BDBE87B231), __ULL(0x0001C37F80226436),
+  __ULL(0x0001C35A2FBA3F5F), __ULL(0x0001C33B1C19414A), __ULL(0x0001C32242AD1246),
+  __ULL(0x0001C30336BEDCDE), __ULL(0x0001C2FD01AC1628), __ULL(0x0001C2CB5F3BE0C5),
+  __ULL(0x0001C2B8C522C079), __ULL(0x0001C27ACE8E936A), __ULL(0x0001C25BD9A795F3),
+  __ULL(0x0001C21DFC9B6A22), __ULL(0x0001C2119F3CA219), __ULL(0x0001C1B4F8988E3C),
+  __ULL(0x0001C1AECCB59CFC), __ULL(0x0001C1A27571CD29), __ULL(0x0001C189C8F2463A),
+  __ULL(0x0001C15878120BD5), __ULL(0x0001C1524EB8C59E), __ULL(0x0001C11AE22EF815),
+  __ULL(0x0001C10E930817A0), __ULL(0x0001C1086BB56D15), __ULL(0x0001C0F5F6C06EEC),
+  __ULL(0x0001C0D73731B716), __ULL(0x0001C09FE8FFCD2D), __ULL(0x0001C07B11C5A07B),
+  __ULL(0x0001C0501E516B0C), __ULL(0x0001C018F1636FC8), __ULL(0x0001C00690189C5C),
+  __ULL(0x0001BFD59404BA8D), __ULL(0x0001BF9867F9EF67), __ULL(0x0001BF861138CEC5),
+  __ULL(0x0001BF79D8386D15), __ULL(0x0001BF6168384E0A), __ULL(0x0001BF4F15F88F71),
+  __ULL(0x0001BF42DFF8CB0C), __ULL(0x0001BF3090391983), __ULL(0x0001BF0BF538E232),
+  __ULL(0x0001BEF3913788E5), __ULL(0x0001BED517F3BA35), __ULL(0x0001BECF00329D73),
+  __ULL(0x0001BEAA7528E9F7), __ULL(0x0001BE9831E1CFD2), __ULL(0x0001BE8C05DC1E63),
+  __ULL(0x0001BE85F018F6DC), __ULL(0x0001BE73AFCE3037), __ULL(0x0001BE5547F7722D),
+  __ULL(0x0001BE4F33B21E85), __ULL(0x0001BE1E977D0754), __ULL(0x0001BDFA294791A6),
+  __ULL(0x0001BDCFB0384546), __ULL(0x0001BDB15EB340F4), __ULL(0x0001BD9F2FC47D4D),
+  __ULL(0x0001BD86F37F8390), __ULL(0x0001BD74C8069461), __ULL(0x0001BD2010BC54A1),
+  __ULL(0x0001BD1A04E05EF9), __ULL(0x0001BD07E248C13B), __ULL(0x0001BCD1835EB457),
+  __ULL(0x0001BC7702ADCBA1), __ULL(0x0001BC109D4F22B9), __ULL(0x0001BC0A98D0BD9B),
+  __ULL(0x0001BBDA7ABBF7F4), __ULL(0x0001BBB66B03C8E3), __ULL(0x0001BBB068F6EBD4),
+  __ULL(0x0001BB7A5DD491DE), __ULL(0x0001BB4A5EFB2D5D), __ULL(0x0001BB3862173275),
+  __ULL(0x0001BB206881C4A5), __ULL(0x0001BB02742C7ABB), __ULL(0x0001BAEA806C2240),
+  __ULL(0x0001BACC935FDE7C), __ULL(0x0001BAB4A5727AC4), __ULL(0x0001BA96BFAC9516),
+  __ULL(0x0001BA1362FDA553), __ULL(0x0001BA017F4D4C65), __ULL(0x0001B9EF9D0F8B26),
+  __ULL(0x0001B9E3B1B42BEF), __ULL(0x0001B9A8228EEFF4), __ULL(0x0001B99C3B0E4075),
+  __ULL(0x0001B996478B8313), __ULL(0x0001B98A610134BB), __ULL(0x0001B960BF29C6CB),
+  __ULL(0x0001B90D9303F352), __ULL(0x0001B8F5D54D0206), __ULL(0x0001B8E408B11EDB),
+  __ULL(0x0001B8B498C1B922), __ULL(0x0001B88B1F2F210A), __ULL(0x0001B83259824CEF),
+  __ULL(0x0001B8209CAA9BC4), __ULL(0x0001B7C801E102C2), __ULL(0x0001B7BC3433D3A2),
+  __ULL(0x0001B792E95288BC), __ULL(0x0001B7756F70C4A9), __ULL(0x0001B763C1CEFD5D),
+  __ULL(0x0001B7521599431B), __ULL(0x0001B73A8787A15D), __ULL(0x0001B72EC1714610),
+  __ULL(0x0001B6F9CDDB632E), __ULL(0x0001B6D687E43298), __ULL(0x0001B6C4E708B5D6),
+  __ULL(0x0001B6BF07101D3E), __ULL(0x0001B67E71C229AF), __ULL(0x0001B65B3F9A8B61),
+  __ULL(0x0001B643CBF8DB9D), __ULL(0x0001B63236E51664), __ULL(0x0001B60F10F8A76D),
+  __ULL(0x0001B6035AEA9447), __ULL(0x0001B5DA62A73A66), __ULL(0x0001B5CEAF6A09C4),
+  __ULL(0x0001B5BD23BA58FB), __ULL(0x0001B5B74ACFC8C0), __ULL(0x0001B5AB99729EB7),
+  __ULL(0x0001B57703098686), __ULL(0x0001B53CA39DED09), __ULL(0x0001B52B23A0C506),
+  __ULL(0x0001B4FC7FD62DD5), __ULL(0x0001B48DE2AD503C), __ULL(0x0001B45F60689E5D),
+  __ULL(0x0001B45990D265EF), __ULL(0x0001B44DF21CCCDD), __ULL(0x0001B43C85356AFD),
+  __ULL(0x0001B436B68CCD91), __ULL(0x0001B3C2B1CFF3FA), __ULL(0x0001B3492262A1F8),
+  __ULL(0x0001B320AC4F103B), __ULL(0x0001B3151E3D68C1), __ULL(0x0001B303CA497431),
+  __ULL(0x0001B2FE03F15165), __ULL(0x0001B2B8C3C343E7), __ULL(0x0001B29BEF86EEEF),
+  __ULL(0x0001B28AA538832D), __ULL(0x0001B284E2174C74), __ULL(0x0001B2510CCC095B),
+  __ULL(0x0001B234464F1EF2), __ULL(0x0001B211C38E1ABE), __ULL(0x0001B20C03A121B7),
+  __ULL(0x0001B1DE09B49183), __ULL(0x0001B1D84B264F44), __ULL(0x0001B1C710652319),
+  __ULL(0x0001B19925120AD6), __ULL(0x0001B187EF546DE4), __ULL(0x0001B170FF22332D),
+  __ULL(0x0001B16587F21605), __ULL(0x0001B15FCC944219), __ULL(0x0001B14326052B7B),
+  __ULL(0x0001B131F71A574A), __ULL(0x0001B11B0FFFE4EE), __ULL(0x0001B0FE72866CDE),
+  __ULL(0x0001B0F8B9E2488D), __ULL(0x0001B0C542E9F001), __ULL(0x0001B0978E18983D),
+  __ULL(0x0001B080B74E8DB0), __ULL(0x0001B05E79A4B46D), __ULL(0x0001B02B274F1CD6),
+  __ULL(0x0001B008F72FA12D), __ULL(0x0001AFF7E1271473), __ULL(0x0001AFD5B9238FF4),
+  __ULL(0x0001AFB94695FFCD), __ULL(0x0001AFA836DA5838), __ULL(0x0001AF972877DB62),
+  __ULL(0x0001AF640565CC61), __ULL(0x0001AF41F4BF556F), __ULL(0x0001AF1A3D73DF8E),
+  __ULL(0x0001AF0EE5DACFAC), __ULL(0x0001AF093A479266), __ULL(0x0001AEECE2A40E63),
+  __ULL(0x0001AEB43E8A1404), __ULL(0x0001AEA3436978A6), __ULL(0x0001AE81512C4813),
+  __ULL(0x0001AE705A0F61D7), __ULL(0x0001AE4322F5CA7E), __ULL(0x0001ADF9BDAB532F),
+  __ULL(0x0001ADEE753B3B7B), __ULL(0x0001ADBBB695E27A), __ULL(0x0001ADB613EB76C0),
+  __ULL(0x0001ADAACF081F85), __ULL(0x0001AD50BD30245E), __ULL(0x0001AD349F5AA59A),
+  __ULL(0x0001AD1E23BCEC95), __ULL(0x0001AD0D4892482F), __ULL(0x0001AD020C878151),
+  __ULL(0x0001ACF13391B38A), __ULL(0x0001ACE05BEE97B4), __ULL(0x0001ACB914964730),
+  __ULL(0x0001ACA8415B0736), __ULL(0x0001AC75CF94C7C4), __ULL(0x0001AC6A9B7737A6),
+  __ULL(0x0001AC6501A0AE3E), __ULL(0x0001AC329FAC2896), __ULL(0x0001AC16A742E1DE),
+  __ULL(0x0001AC0049900CA4), __ULL(0x0001ABE457B9A46C), __ULL(0x0001ABCDFF482D7C),
+  __ULL(0x0001ABB2140252C3), __ULL(0x0001ABAC7EFDE465), __ULL(0x0001ABA15564EC8C),
+  __ULL(0x0001AB9098171F19), __ULL(0x0001AB8B03F26788), __ULL(0x0001AB6F2169B0E9),
+  __ULL(0x0001AAFA2B3F62CD), __ULL(0x0001AAE3EB3BE1B2), __ULL(0x0001AAC28F8F5F06),
+  __ULL(0x0001AAB7722915E5), __ULL(0x0001AAA6C72584A8), __ULL(0x0001AA74CDE9FE1C),
+  __ULL(0x0001AA6F412A9666), __ULL(0x0001AA42E0620821), __ULL(0x0001AA2CB3744AA0),
+  __ULL(0x0001AA219DDAE5EE), __ULL(0x0001AA1C13458D0F), __ULL(0x0001AA00608415DD),
+  __ULL(0x0001A9D99F815E29), __ULL(0x0001A9B86D646BDB), __ULL(0x0001A99CC79570E7),
+  __ULL(0x0001A96586BC04F5), __ULL(0x0001A95A7B7C66AD), __ULL(0x0001A94466B5791E),
+  __ULL(0x0001A928CFF5EE78), __ULL(0x0001A8C01A21D19B), __ULL(0x0001A8B517774974),
+  __ULL(0x0001A8A4948971A5), __ULL(0x0001A89F13D88756), __ULL(0x0001A8839287722A),
+  __ULL(0x0001A84C9A948881), __ULL(0x0001A83123F151EC), __ULL(0x0001A81033DE7B58),
+  __ULL(0x0001A7FFBDC00A59), __ULL(0x0001A7DED5585E6D), __ULL(0x0001A79799FAE4D2),
+  __ULL(0x0001A776C1BAE675), __ULL(0x0001A76BD01CA27A), __ULL(0x0001A755EE92705B),
+  __ULL(0x0001A7096AFAACB2), __ULL(0x0001A6F3939A6B17), __ULL(0x0001A6E8A8C2C797),
+  __ULL(0x0001A6D2D4C44354), __ULL(0x0001A691664BA8CC), __ULL(0x0001A6810DD76C57),
+  __ULL(0x0001A665D28F8FE7), __ULL(0x0001A6500C102958), __ULL(0x0001A63FB8A9BC0D),
+  __ULL(0x0001A61435C3BB09), __ULL(0x0001A5F399794B59), __ULL(0x0001A5DDDEBEDCBB),
+  __ULL(0x0001A5C2B87B4E25), __ULL(0x0001A5A228C6B8B5), __ULL(0x0001A58C766E9255),
+  __ULL(0x0001A550D77E0938), __ULL(0x0001A54097CC86B3), __ULL(0x0001A53B2D8351DD),
+  __ULL(0x0001A5201C2BC5E2), __ULL(0x0001A51AB2B852B5), __ULL(0x0001A50A77339883),
+  __ULL(0x0001A4EF6C1E22F4), __ULL(0x0001A4DF33EF46F1), __ULL(0x0001A4CEFD005A68),
+  __ULL(0x0001A4B9605DE1DD), __ULL(0x0001A4A92C58E9B1), __ULL(0x0001A49E5FB1C009),
+  __ULL(0x0001A47897C62788), __ULL(0x0001A42D1C47D546), __ULL(0x0001A41790425B78),
+  __ULL(0x0001A3EC7ED7EBC0), __ULL(0x0001A3BC15CD28F1), __ULL(0x0001A3A6955D649D),
+  __ULL(0x0001A39BD5F8F845), __ULL(0x0001A38BB7EA8A92), __ULL(0x0001A35607552F1C),
+  __ULL(0x0001A34B4C109BE7), __ULL(0x0001A31B082757A1), __ULL(0x0001A30AF3FC4A9B),
+  __ULL(0x0001A30598341F3A), __ULL(0x0001A2C55580F48E), __ULL(0x0001A285268079CB),
+  __ULL(0x0001A2751DD336EB), __ULL(0x0001A26516606A07), __ULL(0x0001A2450B29A1B5),
+  __ULL(0x0001A22504DB000B), __ULL(0x0001A21A592D12A9), __ULL(0x0001A215038A638E),
+  __ULL(0x0001A1DA5E8790A6), __ULL(0x0001A1D50A86B0F2), __ULL(0x0001A1BA688BF93E),
+  __ULL(0x0001A1AA6F637A30), __ULL(0x0001A1952513D921), __ULL(0x0001A17539ADF163),
+  __ULL(0x0001A16A96F6E2B5), __ULL(0x0001A13571839175), __ULL(0x0001A105A82CA503),
+  __ULL(0x0001A0F5BCD3A93E), __ULL(0x0001A0EB209A8323), __ULL(0x0001A0CB4F2C3EB5),
+  __ULL(0x0001A08BBADF4FA8), __ULL(0x0001A07BD8D3D9FF), __ULL(0x0001A06BF7FE6C97),
+  __ULL(0x00019FDD46E63487), __ULL(0x00019FC82B7F28CC), __ULL(0x00019FB85859C586),
+  __ULL(0x00019FADCC417B8C), __ULL(0x00019F694AAD0879), __ULL(0x00019F0A951E1357),
+  __ULL(0x00019F0011D500C4), __ULL(0x00019EFAD0639751), __ULL(0x00019EF04DE6FDA0),
+  __ULL(0x00019EAC0AB4B916), __ULL(0x00019E8C90CDC1A4), __ULL(0x00019E6D1BADB77E),
+  __ULL(0x00019E62A05D46F3), __ULL(0x00019E52E8631463), __ULL(0x00019E43319A1DA5),
+  __ULL(0x00019E2E3FBE1223), __ULL(0x00019E0ED8EC4B49), __ULL(0x00019DF4B18B0E95),
+  __ULL(0x00019DEF76DD1A6E), __ULL(0x00019DD0198F6A94), __ULL(0x00019DA64F36870F),
+  __ULL(0x00019D7755A83DED), __ULL(0x00019D67AF8257EB), __ULL(0x00019D52D3D21C91),
+  __ULL(0x00019D43306F7CF0), __ULL(0x00019D23ED36C9CA), __ULL(0x00019CF5113F181D),
+  __ULL(0x00019CDB0D6979BA), __ULL(0x00019CD5D9D6A36B), __ULL(0x00019C499AD3F81F),
+  __ULL(0x00019C3F3B22CE02), __ULL(0x00019C3A0B7C5605), __ULL(0x00019C201F30EE5C),
+  __ULL(0x00019BD26DDAF001), __ULL(0x00019BB3625207F3), __ULL(0x00019B9EB290521A),
+  __ULL(0x00019B945B770423), __ULL(0x00019B7FAED35003), __ULL(0x00019B565BC66E8D),
+  __ULL(0x00019B3239E98CE4), __ULL(0x00019B1346826163), __ULL(0x00019B03CE8E06C2),
+  __ULL(0x00019AF97F3B579C), __ULL(0x00019AEA09378BE0), __ULL(0x00019ACB20AD1A58),
+  __ULL(0x00019ABBAE26315F), __ULL(0x00019AB6883B4F8B), __ULL(0x00019AAC3CC8A62F),
+  __ULL(0x00019A8838C7671A), __ULL(0x00019A695EF1AA57), __ULL(0x00019A5F175CD7E1),
+  __ULL(0x00019A3B20E1BF49), __ULL(0x00019A2BB92D2B4A), __ULL(0x000199EE25EB0545),
+  __ULL(0x000199DEC3FDDFA4), __ULL(0x000199CF633838FA), __ULL(0x000199B5C47F1BF0),
+  __ULL(0x000199970A418930), __ULL(0x00019978549F863D), __ULL(0x00019945302145EF),
+  __ULL(0x0001991733CDE32C), __ULL(0x00019907E1FDE3F3), __ULL(0x000198F8915393E4),
+  __ULL(0x000198CFBFD2E313), __ULL(0x000198BB5A2097E0), __ULL(0x000198B1280AD371),
+  __ULL(0x000198A1DDDE4AD5), __ULL(0x0001986EEEE151A2), __ULL(0x00019864C09B2446),
+  __ULL(0x0001981360AB8F25), __ULL(0x0001980936F545B9), __ULL(0x000197E5A8F36F07),
+  __ULL(0x000197CC474F54A8), __ULL(0x000197C734292425), __ULL(0x000197B7FB788CCC),
+  __ULL(0x000197998D7FD766), __ULL(0x0001977101EEFA49), __ULL(0x0001976BF10E0E5C),
+  __ULL(0x00019761CFACF3BF), __ULL(0x000197529E8D12E3), __ULL(0x000197343FB34066),
+  __ULL(0x0001972F3054FEE9), __ULL(0x00019715E5607F69), __ULL(0x00019701ABACC164),
+  __ULL(0x000196F281B788ED), __ULL(0x000196E8665F6801), __ULL(0x000196E358E38892),
+  __ULL(0x000196CA1759E5CB), __ULL(0x000196A6C0DD3234), __ULL(0x000196979DAD6606),
+  __ULL(0x000196887B9E1056), __ULL(0x0001966A3AE047A3), __ULL(0x0001963CE233EEC4),
+  __ULL(0x000195E7564B9FB3), __ULL(0x000195D33A9C6EB2), __ULL(0x000195BA1ACE7DC9),
+  __ULL(0x000195AB093787D0), __ULL(0x0001956ECE0B71E2), __ULL(0x0001955FC20BBD77),
+  __ULL(0x0001955ABE4B5F81), __ULL(0x00019541AD65D6FA), __ULL(0x000195239D3674E6),
+  __ULL(0x0001951E9AF2E6AF), __ULL(0x000194D387D786FA), __ULL(0x000194BA87A79D23),
+  __ULL(0x000194978C94242D), __ULL(0x00019479959C4CFF), __ULL(0x0001945BA314612A),
+  __ULL(0x00019433BBEF19C6), __ULL(0x00019424C748D2B4), __ULL(0x00019415D3BDD3FC),
+  __ULL(0x00019410D823C29D), __ULL(0x000193E4054032E1), __ULL(0x000193DA10A03833),
+  __ULL(0x000193CB229BCC12), __ULL(0x000193808D117151), __ULL(0x0001935DC82CDB55),
+  __ULL(0x00019353DA29D63C), __ULL(0x00019344F60FEFF3), __ULL(0x00019336130F7C62),
+  __ULL(0x000193311CF88669), __ULL(0x000193223B6F25FF), __ULL(0x00019318505A70C4),
+  __ULL(0x0001930970A59A70), __ULL(0x000192E6C044117B), __ULL(0x000192D7E4374C2A),
+  __ULL(0x000192CDFCCAA7FA), __ULL(0x000192BA2F674E48), __ULL(0x000192A17167DEEC),
+  __ULL(0x00019283C49EC7B2), __ULL(0x00019274EFDE1A06), __ULL(0x00019225E8F6E015),
+  __ULL(0x0001920D3D2B99A5), __ULL(0x000191F982B6D1C8), __ULL(0x000191C34BEFFCC3),
+  __ULL(0x000191BE5EF4A0ED), __ULL(0x000191A5BFDB85B2), __ULL(0x00019196FB7272CC),
+  __ULL(0x0001915BF4A86AC2), __ULL(0x000191484B9555FC), __ULL(0x0001913E77C4AF6B),
+  __ULL(0x000190F4D27CC5CF), __ULL(0x000190E61B132A50), __ULL(0x000190E13382BFE3),
+  __ULL(0x000190C3C8A53535), __ULL(0x0001909C963475E1), __ULL(0x00019088FFDC03B1),
+  __ULL(0x0001907A505B6AEB), __ULL(0x00019070869ED441), __ULL(0x00019061D8E99294),
+  __ULL(0x0001904E484F03F3), __ULL(0x000190272CD5D3AF), __ULL(0x00019004FB0FE042),
+  __ULL(0x00018FF6553BD09D), __ULL(0x00018FE7B07A5590), __ULL(0x00018FDDEDE72ABD),
+  __ULL(0x00018FD90CCB50F1), __ULL(0x00018FC0A909377A), __ULL(0x00018FA36873DCA7),
+  __ULL(0x00018F9E88C58453), __ULL(0x00018F778F99E3E0), __ULL(0x00018F557BCF91EE),
+  __ULL(0x00018F4BC05DF994), __ULL(0x00018F46E2D2B6EE), __ULL(0x00018F3D28173F27),
+  __ULL(0x00018F0C8989D637), __ULL(0x00018EE0D1C2FA4F), __ULL(0x00018EC88C3EF792),
+  __ULL(0x00018EC3B1E5B3BC), __ULL(0x00018EAB6FECD361), __ULL(0x00018E9CE35BB41D),
+  __ULL(0x00018E7FCD68C66C), __ULL(0x00018E3729180B3A), __ULL(0x00018E23CE8C6574),
+  __ULL(0x00018DF849B24265), __ULL(0x00018DDB4BBED91A), __ULL(0x00018DC326033146),
+  __ULL(0x00018DBE520480D5), __ULL(0x00018DAFD6BC7148), __ULL(0x00018DA15C824D74),
+  __ULL(0x00018D97B646C66B), __ULL(0x00018D7AC6635560), __ULL(0x00018D5DDAB5E34B),
+  __ULL(0x00018D59092C6337), __ULL(0x00018D4F66732057), __ULL(0x00018D328114F3B7),
+  __ULL(0x00018D0730E857C5), __ULL(0x00018CCD7F5C7950), __ULL(0x00018CC8B152907E),
+  __ULL(0x00018CB0ACDFBE56), __ULL(0x00018CA2453347A6), __ULL(0x00018C8F11EDDBEC),
+  __ULL(0x00018C68B0F61C3F), __ULL(0x00018C5583433E36), __ULL(0x00018C472234CFE2),
+  __ULL(0x00018C2A633905C5), __ULL(0x00018C1271EBE628), __ULL(0x00018BF0F1C28E9E),
+  __ULL(0x00018BE297FF2DAF), __ULL(0x00018BC5E7971D45), __ULL(0x00018BB790F233EA),
+  __ULL(0x00018BA93B573893), __ULL(0x00018B9FAD839532), __ULL(0x00018B9AE6C60E5A),
+  __ULL(0x00018B619EE14F57), __ULL(0x00018B581482A9D0), __ULL(0x00018B49C5D1AA44),
+  __ULL(0x00018B36B3D74E6A), __ULL(0x00018B2867909EE4), __ULL(0x00018B1EDFF49DFC),
+  __ULL(0x00018B1A1C52BD2B), __ULL(0x00018B1095673580), __ULL(0x00018B024BE26AEF),
+  __ULL(0x00018AE0F9B101E2), __ULL(0x00018AD775869FD0), __ULL(0x00018AC46E920CC8),
+  __ULL(0x00018AACA8745996), __ULL(0x00018A73A573CBF9), __ULL(0x00018A3AB2E96F9D),
+  __ULL(0x00018A1E3FCE59B0), __ULL(0x00018A19825AB202), __ULL(0x00018A0B4AAED5DE),
+  __ULL(0x000189EEDE6AB7DF), __ULL(0x000189BACD3D61D0), __ULL(0x00018973E3413489),
+  __ULL(0x0001896F29E5B183), __ULL(0x00018960FE8160A8), __ULL(0x000189368273737B),
+  __ULL(0x0001891EEC29AD8B), __ULL(0x00018910C68C494A), __ULL(0x00018902A1F383B8),
+  __ULL(0x000188EFC8125EF5), __ULL(0x000188E65BCF6420), __ULL(0x000188E1A5D948F3),
+  __ULL(0x000188D384A473EC), __ULL(0x000188BBFA391C25), __ULL(0x000188A9271E620E),
+  __ULL(0x00018891A1C67B99), __ULL(0x0001888386525A48), __ULL(0x00018870B8A087DC),
+  __ULL(0x0001884B22A3FA78), __ULL(0x0001883D0C406024), __ULL(0x0001881C3146EB01),
+  __ULL(0x0001880E1E4226F1), __ULL(0x00018804BCCEA81F), __ULL(0x000187CC7D859F66),
+  __ULL(0x000187B9C158AC31), __ULL(0x000187A258A55D34), __ULL(0x0001879DAA710BCD),
+  __ULL(0x0001878197906847), __ULL(0x000187738FA27011), __ULL(0x0001876A3592CF79),
+  __ULL(0x000187161F1D548D), __ULL(0x0001871174426D5A), __ULL(0x000186DE2433D72E),
+  __ULL(0x000186D027FA6B16), __ULL(0x000186BD83E6FB85), __ULL(0x000186AF8A031CA1),
+  __ULL(0x0001869841154E98), __ULL(0x00018685A2568F12), __ULL(0x00018677AC71B421),
+  __ULL(0x0001865BC3A65824), __ULL(0x0001864484B3944F), __ULL(0x00018623FE060952),
+  __ULL(0x0001860CC5B71168), __ULL(0x000185FED874DFF7), __ULL(0x000185D516A53BDB),
+  __ULL(0x000185B9451230E4), __ULL(0x000185B4A2872998), __ULL(0x00018598D5958157),
+  __ULL(0x0001858F922693F9), __ULL(0x000185536690ADA8), __ULL(0x0001853C470EAD08),
+  __ULL(0x0001851BEC5BFB2D), __ULL(0x000184F6F900A293), __ULL(0x000184CD6F9C6D23),
+  __ULL(0x000184BAFC819DC9), __ULL(0x000184917FEB8253), __ULL(0x00018475DC727E8C),
+  __ULL(0x0001845A3CE7BEE9), __ULL(0x0001844C6E9B7591), __ULL(0x00018427A29C16B8),
+  __ULL(0x0001840775D4B7F2), __ULL(0x000183D05A0AAFE7), __ULL(0x000183B9686A4147),
+  __ULL(0x0001839DE3A54546), __ULL(0x0001838B8D4D66C2), __ULL(0x0001835928CCC92B),
+  __ULL(0x0001834B6CC1570B), __ULL(0x00018346D8F4EE86), __ULL(0x0001832FF796452E),
+  __ULL(0x000182A6E81078EC), __ULL(0x0001829938A5F997), __ULL(0x00018294A90EEAFE),
+  __ULL(0x0001828B8A3371B6), __ULL(0x000182794DC6F384), __ULL(0x00018254DA16EE6D),
+  __ULL(0x00018234FA8074EB), __ULL(0x0001821E3971AB1F), __ULL(0x0001821093B23780),
+  __ULL(0x000181DA0658CC16), __ULL(0x000181CC656B0739), __ULL(0x000181B12672ADCA),
+  __ULL(0x000181884F349905), __ULL(0x00018151E8543DE0), __ULL(0x0001814D6072F375),
+  __ULL(0x0001810977069006), __ULL(0x000181006AC71D9D), __ULL(0x000180FBE4D0363B),
+  __ULL(0x000180E0C342070F), __ULL(0x000180D333E9FDEB), __ULL(0x000180BC9C76B431),
+  __ULL(0x000180B818178742), __ULL(0x000180AF0FAAA126), __ULL(0x0001808F758456DE),
+  __ULL(0x00018081EBE63549), __ULL(0x0001805DD6E8F7E0), __ULL(0x0001805954C3335E),
+  __ULL(0x00018042CB9C64AF), __ULL(0x00018030C631293D), __ULL(0x00017FFF40005FFF),
+  __ULL(0x00017FD24572B9D4), __ULL(0x00017FC4C922F71A), __ULL(0x00017FBBCC1F3873),
+  __ULL(0x00017F73F326B15E), __ULL(0x00017F667D76C3F2), __ULL(0x00017F3E2211C403),
+  __ULL(0x00017F352B5B8D0A), __ULL(0x00017F30B028B1FB), __ULL(0x00017F27BA137802),
+  __ULL(0x00017F233F311737), __ULL(0x00017F1A49BCC94D), __ULL(0x00017F086015E1DA),
+  __ULL(0x00017E941A212578), __ULL(0x00017E74D8468B1D), __ULL(0x00017E43C43F7047),
+  __ULL(0x00017E3F4EB0223F), __ULL(0x00017E0E4864B0D3), __ULL(0x00017DE1C1F11E21),
+  __ULL(0x00017DCB829B653E), __ULL(0x00017DB9B83483E4), __ULL(0x00017DA37D88A809),
+  __ULL(0x00017D9F0BB5D060), __ULL(0x00017D91B6DC47C0), __ULL(0x00017D88D4250CB5),
+  __ULL(0x00017D69BDE5C688), __ULL(0x00017D60DD0B041D), __ULL(0x00017D538C893FA6),
+  __ULL(0x00017D27318EBD90), __ULL(0x00017D1E53CCCD19), __ULL(0x00017D1107EFDBCF),
+  __ULL(0x00017D0C9985A78A), __ULL(0x00017CF20532552E), __ULL(0x00017CD77493FFCA),
+  __ULL(0x00017CCA2DA875ED), __ULL(0x00017CAFA29827EB), __ULL(0x00017C8C4443794E),
+  __ULL(0x00017C87D8EF2DC2), __ULL(0x00017C6D571D0DA5), __ULL(0x00017C5743154815),
+  __ULL(0x00017C459B4DB96E), __ULL(0x00017C3CC807498A), __ULL(0x00017C2F8BE23A76),
+  __ULL(0x00017C2B22B4F420), __ULL(0x00017BED6CF8782A), __ULL(0x00017BD300A4B07D),
+  __ULL(0x00017BC165221FDB), __ULL(0x00017BAB650A77EE), __ULL(0x00017B9101E4D639),
+  __ULL(0x00017B8C9C648440), __ULL(0x00017B83D1B216B6), __ULL(0x00017B650F76736C),
+  __ULL(0x00017B2799F1DF38), __ULL(0x00017B160E4F8326), __ULL(0x00017B08E6A6829B),
+  __ULL(0x00017B00220D030F), __ULL(0x00017AFBBFE73407), __ULL(0x00017AF2FBE972F2),
+  __ULL(0x00017AE5D6AF6C45), __ULL(0x00017AE175254B7F), __ULL(0x00017AC72E090723),
+  __ULL(0x00017A485EFC7C19), __ULL(0x00017A3B4595D190), __ULL(0x00017A1CB8827BD9),
+  __ULL(0x00017A06E90C5697), __ULL(0x00017A028CA866DA), __ULL(0x000179F578171D6B),
+  __ULL(0x000179B8796752C5), __ULL(0x00017972DC22DB1F), __ULL(0x0001796A2A4822C8),
+  __ULL(0x0001792901223C8D), __ULL(0x00017917A4A07D63), __ULL(0x0001790AA04BAA81),
+  __ULL(0x00017901F33D951A), __ULL(0x000178F4F0681622), __ULL(0x000178DAED6E9E9B),
+  __ULL(0x000178C0EE0BE668), __ULL(0x000178BC992A0CF5), __ULL(0x000178B3EFB2D6A4),
+  __ULL(0x000178A6F23F2F71), __ULL(0x00017899F5B0D914), __ULL(0x0001787BABDFFD9C),
+  __ULL(0x000178591455A826), __ULL(0x00017847CAF2A0BA), __ULL(0x0001780705E1941E),
+  __ULL(0x000177FE64C1C1CC), __ULL(0x000177FA1457DDFD), __ULL(0x000177E483C27D9F),
+  __ULL(0x000177D34512DF68), __ULL(0x000177C65718F2B4), __ULL(0x000177BDB8F0D8C4),
+  __ULL(0x000177B0CC726642), __ULL(0x00017778D5E83F1D), __ULL(0x000177703B4DCA5E),
+  __ULL(0x000177566DDBEE1B), __ULL(0x00017752214BE340), __ULL(0x0001773CA3F5C334),
+  __ULL(0x00017715FBC0D648), __ULL(0x000176FC3AB4B4E0), __ULL(0x000176E27D31B70B),
+  __ULL(0x000176BBE78CC568), __ULL(0x000176B79E862C1B), __ULL(0x000176AF0CC43CE6),
+  __ULL(0x0001769559D84C7F), __ULL(0x0001768439DAF51F), __ULL(0x0001766A8CCE55EF),
+  __ULL(0x0001765529F42178), __ULL(0x0001762A6B932E31), __ULL(0x00017621E0453C84),
+  __ULL(0x00017610CAD4FAFB), __ULL(0x000175EEA4A23FB0), __ULL(0x000175D50C136ACC),
+  __ULL(0x000175C3FDA67893), __ULL(0x000175B733DA3444), __ULL(0x000175951E0054A3),
+  __ULL(0x0001758415682DEA), __ULL(0x0001756ECCD90DA2), __ULL(0x0001755545C71D17),
+  __ULL(0x0001753781F06854), __ULL(0x0001752AC1BF24FB), __ULL(0x00017522421A33A9),
+  __ULL(0x0001751143F98E57), __ULL(0x000174F7C9AF4A28), __ULL(0x000174EF4C5C7B87),
+  __ULL(0x000174C4DF89DF1C), __ULL(0x000174B8272C7ADE), __ULL(0x00017463703D8CAF),
+  __ULL(0x0001745283795B19), __ULL(0x00017430AE8E14DD), __ULL(0x00017424004B9750),
+  __ULL(0x000173D7FCDE3646), __ULL(0x000173D3C4B2FDE5), __ULL(0x000173C71CC46522),
+  __ULL(0x000173BEAD4A849B), __ULL(0x000173B206CB6B1B), __ULL(0x000173ADCF7CB249),
+  __ULL(0x0001737F7569F3B2), __ULL(0x0001735991677924), __ULL(0x000173555C1A3903),
+  __ULL(0x0001734053062291), __ULL(0x00017333B51EE5CA), __ULL(0x000172E813B202CB),
+  __ULL(0x000172CAB2929264), __ULL(0x000172B187996AAF), __ULL(0x000172A924B36163),
+  __ULL(0x000172836C59D8C6), __ULL(0x00017272AB1A92A3), __ULL(0x0001726A4B0C6520),
+  __ULL(0x0001724CFDD5FED0), __ULL(0x0001723812AA23B0), __ULL(0x00017233E3E9F831),
+  __ULL(0x0001721EFB93F33C), __ULL(0x0001720E4368BD23), __ULL(0x00017205E7E4217E),
+  __ULL(0x00017201BA4610A7), __ULL(0x000171DC23F60B6F), __ULL(0x000171BAC133FCD1),
+  __ULL(0x000171A1BB16BF24), __ULL(0x000171848D919C8C), __ULL(0x0001716FB90458A3),
+  __ULL(0x0001715293637E45), __ULL(0x0001714616F4A569), __ULL(0x000171399B5DE691),
+  __ULL(0x000170E251DA5805), __ULL(0x000170CD8F92F639), __ULL(0x000170C11C20CAEC),
+  __ULL(0x000170B4A985D081), __ULL(0x0001708B319248EF), __ULL(0x000170767917CF77),
+  __ULL(0x00017065E73002F7), __ULL(0x0001704D0F1F7A05), __ULL(0x00017044C7D89322),
+  __ULL(0x0001702BF43F58D0), __ULL(0x00017006BD1F9684), __ULL(0x000170029B04B8F8),
+  __ULL(0x00016FEDF1E2D14E), __ULL(0x00016FD108FF29EB), __ULL(0x00016FABE43D99A8),
+  __ULL(0x00016F9744D6D30B), __ULL(0x00016F722BBE7D89), __ULL(0x00016F61B13752D9),
+  __ULL(0x00016F55564A38E4), __ULL(0x00016F4D1A225567), __ULL(0x00016F304A7EDC1D),
+  __ULL(0x00016F23F2E41B67), __ULL(0x00016F0F62BA1862), __ULL(0x00016ED1C00BD242),
+  __ULL(0x00016EB503BE4F0A), __ULL(0x00016EA8B46B9387), __ULL(0x00016E9C65EC6326),
+  __ULL(0x00016E94320D13E5), __ULL(0x00016E7B98A2CBF7), __ULL(0x00016E2DC8956E3E),
+  __ULL(0x00016E2599A87987), __ULL(0x00016E2182551BA6), __ULL(0x00016E1953F494ED),
+  __ULL(0x00016E0D0F1343AD), __ULL(0x00016DFCB48397F8), __ULL(0x00016DE42F694D54),
+  __ULL(0x00016DCFC3006B2B), __ULL(0x00016DC3830CD1DF), __ULL(0x00016D9EC81DAE0B),
+  __ULL(0x00016D928B7193DC), __ULL(0x00016D2CB1A95A7F), __ULL(0x00016D207C9EF688),
+  __ULL(0x00016D1859B6C3CB), __ULL(0x00016D0C26088006), __ULL(0x00016CF3C11E3025),
+  __ULL(0x00016CE37FA6EA75), __ULL(0x00016CCF2FDB09C2), __ULL(0x00016C8E3FB1524C),
+  __ULL(0x00016C82153C4C10), __ULL(0x00016C558080CC39), __ULL(0x00016C517385CFDE),
+  __ULL(0x00016C3D33F8AF95), __ULL(0x00016C24EAAE1AAE), __ULL(0x00016C0082D02F02),
+  __ULL(0x00016BFC77B8C690), __ULL(0x00016BF056FC81CA), __ULL(0x00016BE8419C9814),
+  __ULL(0x00016BABACBD7E3F), __ULL(0x00016B9B8872787E), __ULL(0x00016B8F6E2AE77F),
+  __ULL(0x00016B8354B1902A), __ULL(0x00016B5F0D1A165D), __ULL(0x00016B4AE8750849),
+  __ULL(0x00016B46E1656C5D), __ULL(0x00016B3ED38AC885), __ULL(0x00016B26AC1F4658),
+  __ULL(0x00016AFE718EB55A), __ULL(0x00016AEA579DDF73), __ULL(0x00016ADA44777B57),
+  __ULL(0x00016AAA138E77D9), __ULL(0x00016A9602F454EA), __ULL(0x00016A91FFE681BC),
+  __ULL(0x00016A85F7456239), __ULL(0x00016A59DE75FA86), __ULL(0x00016A4DD98E5948),
+  __ULL(0x00016A49D81929F1), __ULL(0x00016A25CEF67D67), __ULL(0x00016A11CCFC09EC),
+  __ULL(0x000169F9CD872935), __ULL(0x000169F5CDED8511), __ULL(0x000169B9DE84C9C5),
+  __ULL(0x00016995F1FF376E), __ULL(0x0001697E02F20CDA), __ULL(0x0001694636CE6CD4),
+  __ULL(0x000169423B2B770C), __ULL(0x0001693648C9764E), __ULL(0x0001692E524DD435),
+  __ULL(0x00016922613CDFCA), __ULL(0x000169068727379C), __ULL(0x000168FA98B7B4C8),
+  __ULL(0x000168E2BE36325D), __ULL(0x000168CEDFDD4B19), __ULL(0x000168BEFC5C8ADE),
+  __ULL(0x000168B70B227E78), __ULL(0x0001689F398D6134), __ULL(0x0001686BA8E89C3B),
+  __ULL(0x00016857D7A9EAC3), __ULL(0x00016847FEA2FA41), __ULL(0x0001683C1CC7ED7C),
+  __ULL(0x0001681C70FF0CA4), __ULL(0x000168187BEA2CE4), __ULL(0x00016804B3CFB93E),
+  __ULL(0x000167E11DE67720), __ULL(0x000167C57546A2B9), __ULL(0x000167B99C06202D),
+  __ULL(0x000167B1B64A1B0E), __ULL(0x000167A5DE567FA2), __ULL(0x0001678A3ED0FD3D),
+  __ULL(0x0001676AB24581F0), __ULL(0x00016766C117BAB9), __ULL(0x0001675AEE1333DD),
+  __ULL(0x000167530C7ED454), __ULL(0x0001673B69D48DD6), __ULL(0x000167140C4B8BBB),
+  __ULL(0x0001670C2DD2C1E9), __ULL(0x000166E4DAA2A280), __ULL(0x000166DCFE3B372B),
+  __ULL(0x000166D134455BD8), __ULL(0x000166B9A2AC5863), __ULL(0x000166B5B55FE69A),
+  __ULL(0x0001666F14B0B37A), __ULL(0x000166673D7124DD), __ULL(0x0001665B7B367224),
+  __ULL(0x000166578FF97045), __ULL(0x00016643F9117752), __ULL(0x000166400E581093),
+  __ULL(0x00016614FE070C65), __ULL(0x0001660557C0693D), __ULL(0x000165F99BF1354B),
+  __ULL(0x000165E60F4D5013), __ULL(0x000165CE9C8D301A), __ULL(0x000165B72CDF6B5C),
+  __ULL(0x000165940B1BDD68), __ULL(0x00016578BCBA8663), __ULL(0x00016549F6EAD4A7),
+  __ULL(0x00016503E521E0F5), __ULL(0x000164FC1DBDD12A), __ULL(0x000164D53DDEA519),
+  __ULL(0x000164A6A2CB37AA), __ULL(0x000164933B1AC389), __ULL(0x0001648797812260),
+  __ULL(0x00016483B67925F9), __ULL(0x0001644D70E4DD7E), __ULL(0x00016441D1D91126),
+  __ULL(0x0001641EF941A5D9), __ULL(0x0001640F7EBC9FED), __ULL(0x00016407C1FB460D),
+  __ULL(0x000163FC277AA2D0), __ULL(0x000163ECAFFC4373), __ULL(0x000163E1173F3F1D),
+  __ULL(0x000163D95C820891), __ULL(0x000163D57F43A87F), __ULL(0x000163BE519078CF),
+  __ULL(0x0001638848002154), __ULL(0x0001636593A92B0A), __ULL(0x0001634A9A4D304F),
+  __ULL(0x0001632BCB7971F4), __ULL(0x00016310DAE1D3EE), __ULL(0x000162EE3DD675F2),
+  __ULL(0x000162DB05F36242), __ULL(0x000162CBA78A111E), __ULL(0x000162C0219AB32E),
+  __ULL(0x000162B87365914A), __ULL(0x000162ACEEB57BB8), __ULL(0x000162A16AC4DF18),
+  __ULL(0x0001629211587145), __ULL(0x00016267E24759BE), __ULL(0x00016250E41BB3DB),
+  __ULL(0x0001624D0F5EADC9), __ULL(0x00016239E8EB9E14), __ULL(0x0001621775B9E6BF),
+  __ULL(0x0001620BFB7BD0DE), __ULL(0x00016208283C1D52), __ULL(0x000161E5BEB6A3EF),
+  __ULL(0x000161D2A36CC857), __ULL(0x000161CED16A2FC7), __ULL(0x000161B7E7160401),
+  __ULL(0x000161A4D0BEE527), __ULL(0x000161827A85B2EA), __ULL(0x000161457FE93B05),
+  __ULL(0x0001613A134360C8), __ULL(0x0001613275E88E68), __ULL(0x000161270A7DE3EC),
+  __ULL(0x0001611B9FD03DA3), __ULL(0x0001610C680E9C1B), __ULL(0x00016100FF19B859),
+  __ULL(0x000160F596E19BBA), __ULL(0x000160E2957CBBF7), __ULL(0x000160BC98D63788),
+  __ULL(0x000160B1350945C8), __ULL(0x0001609A6FA425C5), __ULL(0x00016087780EC2AC),
+  __ULL(0x000160784D0F4D18), __ULL(0x000160655925C37C), __ULL(0x0001604AD3E4C1B6),
+  __ULL(0x0001603F776F64F2), __ULL(0x0001602C89A1E7D9), __ULL(0x000160120CECE9A5),
+  __ULL(0x0001600A7C4FF3E1), __ULL(0x00016006B420AE1F), __ULL(0x00015FDD1F7501C6),
+  __ULL(0x00015FBB217C1195), __ULL(0x00015FB75B011426), __ULL(0x00015FA47BD146A8),
+  __ULL(0x00015FA0B5D2BA04), __ULL(0x00015F992A13D174), __ULL(0x00015F737434678B),
+  __ULL(0x00015F6BEA669A03), __ULL(0x00015F68259EBE47), __ULL(0x00015F2820B4E4CB),
+  __ULL(0x00015F245D6117A5), __ULL(0x00015F0DCB1BBDFC), __ULL(0x00015F02830F9A1B),
+  __ULL(0x00015EEFB7427013), __ULL(0x00015EEBF5240AC6), __ULL(0x00015ED92BC11B59),
+  __ULL(0x00015EB75FECFDCF), __ULL(0x00015EAC1D6DF9C8), __ULL(0x00015E91DA6A8103),
+  __ULL(0x00015E7B5AF681E6), __ULL(0x00015E64DE658D97), __ULL(0x00015E3BAC2EC01F),
+  __ULL(0x00015E2CB398D52C), __ULL(0x00015E2179FF6415), __ULL(0x00015E038E9540F0),
+  __ULL(0x00015DF8579EE52F), __ULL(0x00015DE964C9E30C), __ULL(0x00015DE1EBD9F76D),
+  __ULL(0x00015DCB82F44B83), __ULL(0x00015DC04F95021B), __ULL(0x00015DB16188E46B),
+  __ULL(0x00015DA9EAFD302F), __ULL(0x00015D66CE66CD09), __ULL(0x00015D5BA1798123),
+  __ULL(0x00015D507543325D), __ULL(0x00015D2B3C618B08), __ULL(0x00015CFE9C306AC2),
+  __ULL(0x00015CF375EC5A32), __ULL(0x00015CDD2B87347B), __ULL(0x00015CBBC145EA78),
+  __ULL(0x00015CA933ACAFC1), __ULL(0x00015CA57DFDE1F6), __ULL(0x00015C92F2C2EF45),
+  __ULL(0x00015C62C5308FA8), __ULL(0x00015C57A8DF330A), __ULL(0x00015C3A0B7CE235),
+  __ULL(0x00015C2B3EAF0D26), __ULL(0x00015C2025E80020), __ULL(0x00015C18C0728F25),
+  __ULL(0x00015BEC664AACC3), __ULL(0x00015BCB2A16CF20), __ULL(0x00015BBC66B418E5),
+  __ULL(0x00015BA643F97C5E), __ULL(0x00015B90241024BD), __ULL(0x00015B7DB6499B3E),
+  __ULL(0x00015B5C8F36ED5B), __ULL(0x00015B4678ADEF33), __ULL(0x00015B42CA87AE3A),
+  __ULL(0x00015B16A6D17109), __ULL(0x00015B0F4C9FA7B5), __ULL(0x00015AF93FE89EB4),
+  __ULL(0x00015AD83216687B), __ULL(0x00015AC22C5F0CB1), __ULL(0x00015AA87E91B4F6),
+  __ULL(0x00015A9629530371), __ULL(0x00015A927EE870D4), __ULL(0x00015A8B2A4ED775),
+  __ULL(0x00015A5F353782B8), __ULL(0x00015A493EDA2157), __ULL(0x00015A2FA2F21203),
+  __ULL(0x00015A1D5A794A45), __ULL(0x00015A12631E1827), __ULL(0x00015A0EBB7C8F4F),
+  __ULL(0x00015A03C50E839A), __ULL(0x000159FC767D41E4), __ULL(0x000159F181377BF2),
+  __ULL(0x000159C20D0D6D52), __ULL(0x000159BAC1426EEB), __ULL(0x000159AFD025B99F),
+  __ULL(0x000159A4DFBA4C20), __ULL(0x000159A13A688A01), __ULL(0x0001597924F813B1),
+  __ULL(0x0001596A93D75FBB), __ULL(0x00015949D1CB2D1A), __ULL(0x000159428B123BC0),
+  __ULL(0x00015921D09D2575), __ULL(0x0001591346D8AC28), __ULL(0x0001590C026C0194),
+  __ULL(0x000158E06E4CC746), __ULL(0x000158DCCD1EB470), __ULL(0x000158C707A4E1A6),
+  __ULL(0x000158B144EA9946), __ULL(0x000158AA049E171B), __ULL(0x000158A664951F5E),
+  __ULL(0x000158483E68D890), __ULL(0x00015844A06E1AF2), __ULL(0x000158241608AF79),
+  __ULL(0x000158193E9A1FBE), __ULL(0x0001581204B18EEC), __ULL(0x000158072E665FF3),
+  __ULL(0x000157F183DC2A62), __ULL(0x000157EDE7B3B743), __ULL(0x000157E313AEC035),
+  __ULL(0x000157CD6DB05587), __ULL(0x000157BB657138EF), __ULL(0x000157ACF9CE8703),
+  __ULL(0x000157A5C471535E), __ULL(0x000157A229DFC0BE), __ULL(0x00015776F0F16A29),
+  __ULL(0x00015764F1C375A6), __ULL(0x00015761588DCDBB), __ULL(0x0001574F5BA311B0),
+  __ULL(0x0001574BC2E136F1), __ULL(0x000157362FEB22C4), __ULL(0x0001572B677460BF),
+  __ULL(0x0001570B122076C2), __ULL(0x000156C34DDC7764), __ULL(0x000156B88C9C6770),
+  __ULL(0x00015694B7FB867E), __ULL(0x000156781345B1D5), __ULL(0x000156747F052DAC),
+  __ULL(0x0001565F071428FA), __ULL(0x000156544C1E065C), __ULL(0x000156426B57B0BE),
+  __ULL(0x0001562CF9AD593E), __ULL(0x0001562966FE8067), __ULL(0x0001562241DA1BF8),
+  __ULL(0x000156178AB2BD78), __ULL(0x000155FE8C9D934C), __ULL(0x000155E92373532F),
+  __ULL(0x000155D3BCF73615), __ULL(0x000155AC88080CB8), __ULL(0x000155A1D83F18CC),
+  __ULL(0x000155939992A966), __ULL(0x0001558C7AAE7980), __ULL(0x00015588EB58E16C),
+  __ULL(0x0001556C7357CF47), __ULL(0x0001554C72025D45), __ULL(0x000155371F1E93F5),
+  __ULL(0x000155339190430E), __ULL(0x00015528E956F358), __ULL(0x0001550C815461FB),
+  __ULL(0x00015501DB8B9729), __ULL(0x000154FE4F192595), __ULL(0x000154F3AA333EA7),
+  __ULL(0x000154EC91F87A4F), __ULL(0x000154D74B0D944F), __ULL(0x000154A2255F0205),
+  __ULL(0x00015493FBFCF1BC), __ULL(0x00015477ACC0DD1A), __ULL(0x00015474232E1032),
+  __ULL(0x0001545450535665), __ULL(0x00015442A4DD9275), __ULL(0x00015418440B3ADD),
+  __ULL(0x00015414BC73AD9D), __ULL(0x0001540A261D8B39), __ULL(0x000153DFD35BB9DD),
+  __ULL(0x000153D8C696F44B), __ULL(0x000153D54050A4DB), __ULL(0x000153AE801DDAD6),
+  __ULL(0x000153AAFAB7F66C), __ULL(0x0001538ED2295B4F), __ULL(0x0001538B4D6B903C),
+  __ULL(0x00015380BFA22C2B), __ULL(0x0001536BA6072309), __ULL(0x000153649E135110),
+  __ULL(0x00015344FDE49D50), __ULL(0x00015336F17B36FC), __ULL(0x0001532FEBB63236),
+  __ULL(0x0001531759CEA633), __ULL(0x0001531055586C7B), __ULL(0x000152F0C4DC3756),
+  __ULL(0x000152C6B8046CC8), __ULL(0x000152BC366FC72F), __ULL(0x000152B8B60DF719),
+  __ULL(0x000152AE3557B422), __ULL(0x0001529CB59A63B5), __ULL(0x0001529935DF4655),
+  __ULL(0x00015287B84D516F), __ULL(0x0001524552009BEB), __ULL(0x0001523AD870EC15),
+  __ULL(0x00015229649D16D2), __ULL(0x00015210F8AE1BED), __ULL(0x00015206825C16A1),
+  __ULL(0x000151FC0CAFD209), __ULL(0x000151D23C771316), __ULL(0x000151CB456F175A),
+  __ULL(0x000151C7CA06AB5F), __ULL(0x000151B2E715FA1D), __ULL(0x0001519711D955C0),
+  __ULL(0x0001517EBB0778E9), __ULL(0x00015162EE6368F4), __ULL(0x0001514E17E98F45),
+  __ULL(0x0001514A9F154FF4), __ULL(0x0001514035065856), __ULL(0x0001512EDB05D991),
+  __ULL(0x00015101C62B6410), __ULL(0x000150FAD7B934CD), __ULL(0x000150F7609B7C25),
+  __ULL(0x000150E297683668), __ULL(0x000150D833C4BA34), __ULL(0x000150D147083287),
+  __ULL(0x000150BC8287D2A9), __ULL(0x000150AEAB9E691E), __ULL(0x00015099EB623297),
+  __ULL(0x00015088A2797730), __ULL(0x000150698A1C23F4), __ULL(0x0001505F2DEE8F30),
+  __ULL(0x0001504703FF4819), __ULL(0x00015016BA897D6C), __ULL(0x00015013481B330F),
+  __ULL(0x00015008F13CEB6F), __ULL(0x00014FF7B7344B85), __ULL(0x00014FF44568D3A7),
+  __ULL(0x00014FED6208212C), __ULL(0x00014FD5486EF962), __ULL(0x00014F9ACF828ED2),
+  __ULL(0x00014F975F9E8065), __ULL(0x00014F8D105E74A5), __ULL(0x00014F674889091A),
+  __ULL(0x00014F63D9B314EF), __ULL(0x00014F52B0931CF7), __ULL(0x00014F3AAD263492),
+  __ULL(0x00014F33D15FA6CC), __ULL(0x00014F3063975097), __ULL(0x00014F14F7DAE685),
+  __ULL(0x00014F0743AB529D), __ULL(0x00014EF624034AA3), __ULL(0x00014EEBDEA8BD01),
+  __ULL(0x00014EDE2DD574F1), __ULL(0x00014ECD1260376B), __ULL(0x00014EBF641158A2),
+  __ULL(0x00014EB88D553CED), __ULL(0x00014EAE4BC12FA1), __ULL(0x00014EAAE0B396F2),
+  __ULL(0x00014E8F8ACA1610), __ULL(0x00014E854BB93663), __ULL(0x00014E7B0D48FD30),
+  __ULL(0x00014E5C55BBA4EB), __ULL(0x00014E293057B36F), __ULL(0x00014E1157727416),
+  __ULL(0x00014E07201AE952), __ULL(0x00014E0050E41397), __ULL(0x00014DCD47A0EFC1),
+  __ULL(0x00014DC9E12A6BDD), __ULL(0x00014DB8E1E3CCA6), __ULL(0x00014DA11902D0B0),
+  __ULL(0x00014D9A4DF4388B), __ULL(0x00014D785AD11EFB), __ULL(0x00014D6763D6CAE4),
+  __ULL(0x00014D59D2B30923), __ULL(0x00014D530A8B2570), __ULL(0x00014D457B0F42D3),
+  __ULL(0x00014D26FC40E2C3), __ULL(0x00014D20362A5CCE), __ULL(0x00014D088306B14C),
+  __ULL(0x00014CFE5BDB121A), __ULL(0x00014CF7976B5C18), __ULL(0x00014CCF02931DFA),
+  __ULL(0x00014CC4DEE8B041), __ULL(0x00014CBABBDC6655), __ULL(0x00014C9C566BCEE4),
+  __ULL(0x00014C7DF68871D9), __ULL(0x00014C7A96E34A66), __ULL(0x00014C3DE8F94D94),
+  __ULL(0x00014C33CE24298B), __ULL(0x00014C22F81E8796), __ULL(0x00014C0B68F45F45),
+  __ULL(0x00014BF73A0B5B4B), __ULL(0x00014BF080494294), __ULL(0x00014BE66A28E900),
+  __ULL(0x00014BE30D96549F), __ULL(0x00014BB0A92A4946), __ULL(0x00014BA696EAB860),
+  __ULL(0x00014B9FE06CA701), __ULL(0x00014B9C8547B481), __ULL(0x00014B9274412F66),
+  __ULL(0x00014B638236568F), __ULL(0x00014B4202082DA7), __ULL(0x00014B3B4F9BCE3F),
+  __ULL(0x00014B19D78D55D4), __ULL(0x00014B05C5F6C6E0), __ULL(0x00014ADDAA152C83),
+  __ULL(0x00014AC2F23A07D7), __ULL(0x00014AA4E88B733C), __ULL(0x00014A90E51ECDCE),
+  __ULL(0x00014A798EDA65A1), __ULL(0x00014A6F8F762153), __ULL(0x00014A68E5894F35),
+  __ULL(0x00014A54E95F950F), __ULL(0x00014A1FAA15825C), __ULL(0x00014A0BB6C66EAE),
+  __ULL(0x00014A01BE065AD4), __ULL(0x000149F120C79BC0), __ULL(0x000149E3D7634F6F),
+  __ULL(0x000149D33D27196B), __ULL(0x000149C947D04B9A), __ULL(0x000149AB6B6737CA),
+  __ULL(0x000149A81A5BA8DB), __ULL(0x0001498D9465FFED), __ULL(0x0001497662AF13C3),
+  __ULL(0x0001496C72F2CB8C), __ULL(0x00014948090B427F), __ULL(0x0001493E1C1A7732),
+  __ULL(0x0001492A440451C9), __ULL(0x00014926F5917EE9), __ULL(0x00014909368509CB),
+  __ULL(0x000149029B044845), __ULL(0x000148F564CE8AF3), __ULL(0x000148C3E2F6D320),
+  __ULL(0x000148B0199936FE), __ULL(0x000148A981AC28D2), __ULL(0x00014895BB7B36DD),
+  __ULL(0x0001489270039C1B), __ULL(0x00014881F7AB443A), __ULL(0x00014843709AEA53),
+  __ULL(0x0001481F483B7AEB), __ULL(0x0001481BFF238D30), __ULL(0x000148156D2638D7),
+  __ULL(0x000147FE7041E72F), __ULL(0x000147F497259DD8), __ULL(0x000147E0E6B31E52),
+  __ULL(0x000147B98CE4EE69), __ULL(0x000147B2FED84D7C), __ULL(0x000147AFB7EB28DB),
+  __ULL(0x000147A92A4334C0), __ULL(0x000147923C87A7AB), __ULL(0x0001477E97E24BFC),
+  __ULL(0x0001476E3B251B52), __ULL(0x0001476AF597E4B3), __ULL(0x00014750CB888D8F),
+  __ULL(0x00014746FCD6C178), __ULL(0x000147265019A370), __ULL(0x0001471FC7EF6D9B),
+  __ULL(0x000146FF23059555), __ULL(0x000146DB41F05974), __ULL(0x000146C7B33622CB),
+  __ULL(0x000146C470FC0420), __ULL(0x000146BDECB9AFD7), __ULL(0x000146BAAAB17938),
+  __ULL(0x000146A71FDD638A), __ULL(0x000146835214E533), __ULL(0x0001465C4BFE25C1),
+  __ULL(0x000146528BED896C), __ULL(0x00014648CC720D5A), __ULL(0x000146458CBF5AA2),
+  __ULL(0x0001463BCE0A9F76), __ULL(0x000146354F3A408F), __ULL(0x0001462B917DD520),
+  __ULL(0x0001462852601F0E), __ULL(0x0001461817C3B17B), __ULL(0x00014604A05CCE91),
+  __ULL(0x000145F12B48C1CE), __ULL(0x000145E7719DAA74), __ULL(0x000145E433DAFBB0),
+  __ULL(0x000145DA7AF5F38A), __ULL(0x000145C090BE5050), __ULL(0x000145B39D2E250B),
+  __ULL(0x000145A9E72F0390), __ULL(0x000145A36E2C9C3D), __ULL(0x0001458650D09E64),
+  __ULL(0x00014572EACCE2AA), __ULL(0x0001455F8718E0EC), __ULL(0x00014548EB078791),
+  __ULL(0x0001454275DF73C3), __ULL(0x0001452F17F0F49A), __ULL(0x0001452569D716BC),
+  __ULL(0x00014518829A10B7), __ULL(0x0001450ED5D8547A), __ULL(0x000144F1D307503D),
+  __ULL(0x000144E82892DDD1), __ULL(0x000144D80DC286D5), __ULL(0x000144C4BC7D7EB5),
+  __ULL(0x000144AE35E9754F), __ULL(0x000144A48F7A4A79), __ULL(0x0001449E20D71746),
+  __ULL(0x0001449144546917), __ULL(0x0001446DEB2DBA12), __ULL(0x0001446448907ECB),
+  __ULL(0x00014461127CA444), __ULL(0x000144342412BD33), __ULL(0x00014417483C2C72),
+  __ULL(0x0001441413AE6821), __ULL(0x000143F73D8CA1F6), __ULL(0x000143E73A94F913),
+  __ULL(0x000143DD9FF6098E), __ULL(0x000143C73964B393), __ULL(0x000143B73B2B9EED),
+  __ULL(0x000143B40883F069), __ULL(0x000143A40C301985), __ULL(0x0001438DAD94C70A),
+  __ULL(0x00014384184484A2), __ULL(0x0001437420AC4EFC), __ULL(0x00014370EF57E21C),
+  __ULL(0x0001434DD4DFAC2C), __ULL(0x0001434443573457), __ULL(0x00014337822D6C3B),
+  __ULL(0x0001432DF1F72738), __ULL(0x00014314742A7EB4), __ULL(0x0001430158746F54),
+  __ULL(0x000142F49C91CE97), __ULL(0x000142D19D0F5586), __ULL(0x000142CE6EEF654B),
+  __ULL(0x000142C812DFA2DA), __ULL(0x000142B1D2A183C4), __ULL(0x000142953B65804E),
+  __ULL(0x000142822EB887F0), __ULL(0x00014278A93A020E), __ULL(0x0001425298DE8074),
+  __ULL(0x00014249162F05DD), __ULL(0x000142393D9F1C55), __ULL(0x00014236127EFE9B),
+  __ULL(0x00014223110D352E), __ULL(0x000142003EE40C48), __ULL(0x000141E3C7157580),
+  __ULL(0x000141DA4AEEEC96), __ULL(0x000141BAB1223B5A), __ULL(0x000141B137675C71),
+  __ULL(0x000141A16DC2B3F2), __ULL(0x0001418B5610103F), __ULL(0x0001418506B4DD56),
+  __ULL(0x00014181DF1F0A00), __ULL(0x0001417868BCA2DF), __ULL(0x000141657DA37F9C),
+  __ULL(0x00014142D467F173), __ULL(0x0001412CC9B1E459), __ULL(0x00014119E77DFBDA),
+  __ULL(0x000141139C95A978), __ULL(0x0001410A2CAF8C8C), __ULL(0x000140FD98599CCC),
+  __ULL(0x000140DB0582027F), __ULL(0x000140D7E1415032), __ULL(0x000140C82CEA0709),
+  __ULL(0x000140B55688ADC8), __ULL(0x000140A8C8D7B78B), __ULL(0x0001406A131DD41F),
+  __ULL(0x00014066F112F457), __ULL(0x0001405D8B506DBC), __ULL(0x0001404DE2F06EF6),
+  __ULL(0x000140415D574D11), __ULL(0x0001403B1AE8B773), __ULL(0x00013FF97022734B),
+  __ULL(0x00013FDA34774CE7), __ULL(0x00013FD3F6105E3F), __ULL(0x00013FA20B9E15C8),
+  __ULL(0x00013F8F57B7539E), __ULL(0x00013F7FC3784B77), __ULL(0x00013F766B404F8D),
+  __ULL(0x00013F63BC740C39), __ULL(0x00013F510FD7126C), __ULL(0x00013F4DF3489745),
+  __ULL(0x00013F3E65690012), __ULL(0x00013F31F500995D), __ULL(0x00013F28A15521CD),
+  __ULL(0x00013F2269DB0030), __ULL(0x00013F15FBA0B4E3), __ULL(0x00013F0FC4E083F4),
+  __ULL(0x00013EE766E4B741), __ULL(0x00013ECB7A941F26), __ULL(0x00013EC546BA6B72),
+  __ULL(0x00013EB8DFC05954), __ULL(0x00013E8D7EED9F20), __ULL(0x00013E8434DBF8B5),
+  __ULL(0x00013E6859E6E6A2), __ULL(0x00013E5F11FFADEB), __ULL(0x00013E4C83D0A7C6),
+  __ULL(0x00013E496C53FB47), __ULL(0x00013E39F7CB3552), __ULL(0x00013E30B297F53D),
+  __ULL(0x00013E276DEEF5CF), __ULL(0x00013E11CFD3595F), __ULL(0x00013E0260B08D11),
+  __ULL(0x00013DEFDD4DA2C9), __ULL(0x00013DDA46BE26A2), __ULL(0x00013DB54B74E7DC),
+  __ULL(0x00013DAC0DFAC64D), __ULL(0x00013DA5E54B1F5A), __ULL(0x00013D871D719065),
+  __ULL(0x00013D65487EF74C), __ULL(0x00013D62357E9B90), __ULL(0x00013D468D2931B2),
+  __ULL(0x00013D406868725C), __ULL(0x00013D3731B983E2), __ULL(0x00013D24C5F69041),
+  __ULL(0x00013D21B435FC00), __ULL(0x00013D092854B73A), __ULL(0x00013CED8F81A589),
+  __ULL(0x00013CD81BF6B2B7), __ULL(0x00013CCEEB558C9C), __ULL(0x00013CC5BB3CDC01),
+  __ULL(0x00013CBF9B782FE8), __ULL(0x00013CB66C42D36D), __ULL(0x00013CAA2E251485),
+  __ULL(0x00013C8EA5D7C386), __ULL(0x00013C8888341FDB), __ULL(0x00013C732253A938),
+  __ULL(0x00013C4551C17743), __ULL(0x00013C3F36F2CFD1), __ULL(0x00013C23C13B36A6),
+  __ULL(0x00013C178E71698B), __ULL(0x00013C085047FCA4), __ULL(0x00013C054406762B),
+  __ULL(0x00013BFF2BB08EA5), __ULL(0x00013BF2FBB94919), __ULL(0x00013BE0B5898454),
+  __ULL(0x00013BDA9E9C8292), __ULL(0x00013BC85B3E0C1D), __ULL(0x00013BACFA25C608),
+  __ULL(0x00013BA9EFA6FD04), __ULL(0x00013B97B1E92F12), __ULL(0x00013B888011DF3B),
+  __ULL(0x00013B857646F4A9), __ULL(0x00013B6D2A0AB1CD), __ULL(0x00013B610553C48A),
+  __ULL(0x00013B5AF3520ED9), __ULL(0x00013B2D73B6FEF4), __ULL(0x00013B2A6BACB025),
+  __ULL(0x00013B2153E7529F), __ULL(0x00013AF6EBE7FD45), __ULL(0x00013AF3E4EA1E84),
+  __ULL(0x00013AE4C2D4319B), __ULL(0x00013AE1BC2FAE96), __ULL(0x00013AC68304CC5C),
+  __ULL(0x00013AB7654AE8CC), __ULL(0x00013AA23E1D4B97), __ULL(0x00013A9C33716279),
+  __ULL(0x00013A74F3BB1DD9), __ULL(0x00013A6BE66B30A4), __ULL(0x00013A50C19B9E41),
+  __ULL(0x00013A4ABA106932), __ULL(0x00013A2C97D0544B), __ULL(0x00013A238EAA53F3),
+  __ULL(0x00013A1D88DAE825), __ULL(0x00013A117DED6572), __ULL(0x000139F668B70118),
+  __ULL(0x000139F064A29F42), __ULL(0x000139DE59C783FA), __ULL(0x000139B7495E8491),
+  __ULL(0x0001399342D91FA9), __ULL(0x0001398D4290CE26), __ULL(0x0001396F4498E90C),
+  __ULL(0x0001394E4D74D5B2), __ULL(0x0001394B4E9B0801), __ULL(0x000139305B8671BF),
+  __ULL(0x0001390F719C09C3), __ULL(0x0001390C73F5D0E4), __ULL(0x0001390678D54190),
+  __ULL(0x000138F488D288C1), __ULL(0x000138F18BAFE94E), __ULL(0x000138E8949FB857),
+  __ULL(0x000138DF9E1302A6), __ULL(0x000138D6A809BCEE), __ULL(0x000138D0AEF738DC),
+  __ULL(0x000138C7B9C8EA03), __ULL(0x000138B2D506240B), __ULL(0x000138ACDD51BB97),
+  __ULL(0x0001388913DF3F42), __ULL(0x0001387732384045), __ULL(0x0001386E42292936),
+  __ULL(0x00013853750CFF01), __ULL(0x000138507AFD316E), __ULL(0x0001383E9FCF5D3E),
+  __ULL(0x00013814FDA96FBD), __ULL(0x0001380030C0079E), __ULL(0x000137FA3FDB22AD),
+  __ULL(0x000137F156F06203), __ULL(0x000137E5768202C0), __ULL(0x000137C4D1FBC41D),
+  __ULL(0x000137BBEC1DF794), __ULL(0x000137AA21E85874), __ULL(0x0001378F766633C5),
+  __ULL(0x000137839D6A7D22), __ULL(0x0001377DB1432053), __ULL(0x0001376017DEBDD4),
+  __ULL(0x0001375737BFCF0C), __ULL(0x000137514D4879CC), __ULL(0x000137486E0160A0),
+  __ULL(0x00013745790671FB), __ULL(0x0001372ADEBB0199), __ULL(0x0001372201A483F6),
+  __ULL(0x0001371C1932AA9A), __ULL(0x0001370A6135AC75), __ULL(0x000136F8AB3D3E8B),
+  __ULL(0x000136ECDDB66F28), __ULL(0x000136C3956BE45D), __ULL(0x000136BABE36B4AC),
+  __ULL(0x000136AEF562BBCB), __ULL(0x000136A03B9B7F70), __ULL(0x0001369D49D1BB66),
+  __ULL(0x00013679F8B6B737), __ULL(0x00013668532C0409), __ULL(0x00013659A015F918),
+  __ULL(0x000136365E5B5D87), __ULL(0x0001362A9F8F7949), __ULL(0x0001361BF250BC4A),
+  __ULL(0x000135FE9BFD98DA), __ULL(0x000135ED0475A413), __ULL(0x000135E4397151F5),
+  __ULL(0x000135D2A4E7C7E9), __ULL(0x000135C1125CC303), __ULL(0x000135BB374A7A9F),
+  __ULL(0x000135A6BA48B75D), __ULL(0x000135952CB8838C), __ULL(0x00013572178FC5E7),
+  __ULL(0x0001354071DAF9EA), __ULL(0x000135262FA27C42), __ULL(0x0001351A85698861),
+  __ULL(0x0001350BF1DF3035), __ULL(0x00013503339B7DE1), __ULL(0x000134E8FBC80577),
+  __ULL(0x000134DD562CE524), __ULL(0x000134D783B3A346), __ULL(0x000134CBDF69AC40),
+  __ULL(0x000134B49977981B), __ULL(0x000134A03F2448EB), __ULL(0x0001349786F771B8),
+  __ULL(0x00013491B71F9DEA), __ULL(0x00013488FFC4F1C7), __ULL(0x0001346627464A5C),
+  __ULL(0x0001346340415A08), __ULL(0x0001345A8B86705E), __ULL(0x00013454BDFA66BE),
+  __ULL(0x0001344C0A112BA4), __ULL(0x00013449238A0A73), __ULL(0x00013431F147D55F),
+  __ULL(0x000134293F555E29), __ULL(0x000134208DE07D53), __ULL(0x00013403973AB753),
+  __ULL(0x000133E0DCD62A67), __ULL(0x000133DB13DDA20F), __ULL(0x000133D82F763C91),
+  __ULL(0x000133D266D12CFB), __ULL(0x000133BE2A457CFA), __ULL(0x000133B8629AAD58),
+  __ULL(0x0001339E62C99F0D), __ULL(0x0001339B7F8609D8), __ULL(0x00013392D60E8EED),
+  __ULL(0x0001338184962B0B), __ULL(0x0001337BBF324F78), __ULL(0x000133678E0963FF),
+  __ULL(0x00013361C99EF54A), __ULL(0x0001335EE77E83FD), __ULL(0x00013344F6C977A5),
+  __ULL(0x0001332DEB9C59B6), __ULL(0x00013325484F85FF), __ULL(0x0001331CA57F0BDE),
+  __ULL(0x00013319C4AA837A), __ULL(0x00013302BFF74E2C), __ULL(0x000132E5FEF110F4),
+  __ULL(0x000132DD5FAF3CFC), __ULL(0x000132D4C0E96B59), __ULL(0x000132A9AE4F088E),
+  __ULL(0x000132A3F102342B), __ULL(0x00013298770D83FA), __ULL(0x0001328FDC264D31),
+  __ULL(0x0001326D755D767C), __ULL(0x000132568A76A9B9), __ULL(0x0001324DF34255F3),
+  __ULL(0x000132455C8956F2), __ULL(0x00013239E9A7CA35), __ULL(0x00013228BEF03954),
+  __ULL(0x000131FDDC8FD366), __ULL(0x000131F825AF9864), __ULL(0x000131DE71627B7C),
+  __ULL(0x000131C4C1669F03), __ULL(0x000131B95820481A), __ULL(0x000131B3A3CEDF3D),
+  __ULL(0x0001318E94ED646A), __ULL(0x000131805684D880), __ULL(0x0001317D7D6587B9),
+  __ULL(0x0001315E2C8DF78C), __ULL(0x00013152CAEE4D0C), __ULL(0x00013144921814FA),
+  __ULL(0x00013130AB25DAFA), __ULL(0x000131282464D197), __ULL(0x00013122757D36A0),
+  __ULL(0x00013108E50965B9), __ULL(0x000130FD89C41651), __ULL(0x000130EC8271ED7D),
+  __ULL(0x000130C4CE1654CB), __ULL(0x000130C1F8751303), __ULL(0x000130B977E24769),
+  __ULL(0x000130B3CD1936B0), __ULL(0x000130A2CE01B84B), __ULL(0x0001309A4F2BFB98),
+  __ULL(0x0001307858918203), __ULL(0x0001306FDC19CF3B), __ULL(0x000130648C3690C6),
+  __ULL(0x000130566989171C), __ULL(0x0001303A281E0B3E), __ULL(0x000130239128C9B5),
+  __ULL(0x0001301846F029CC), __ULL(0x00012FEDF811D870), __ULL(0x00012FE5834EFE2D),
+  __ULL(0x00012FDD0F0495E9), __ULL(0x00012FD76C6B356E), __ULL(0x00012FD49B329596),
+  __ULL(0x00012FC685E00B6B), __ULL(0x00012FB2D09DDAE1), __ULL(0x00012FAA5F254BAB),
+  __ULL(0x00012F9C4DBCB937), __ULL(0x00012F6F51FBF8CB), __ULL(0x00012F506CA21DE8),
+  __ULL(0x00012F372A063A40), __ULL(0x00012F345BC59CF6), __ULL(0x00012F2EBF6C41F8),
+  __ULL(0x00012F2BF1538385), __ULL(0x00012F265549E2E2), __ULL(0x00012F1B1DD60850),
+  __ULL(0x00012EFC499EA513), __ULL(0x00012EF1154708C9), __ULL(0x00012ED7E2894F1D),
+  __ULL(0x00012EC7185EE073), __ULL(0x00012E9FF28DA498), __ULL(0x00012E9D2718B7B4),
+  __ULL(0x00012E86CD4CE6AE), __ULL(0x00012E760C1E96E8), __ULL(0x00012E5CEDD3A020),
+  __ULL(0x00012E49675F13FC), __ULL(0x00012E3B7696FF09), __ULL(0x00012E226205ABA9),
+  __ULL(0x00012E11ABF4A94E), __ULL(0x00012E09519D9AA2), __ULL(0x00012DDCCCEEC270),
+  __ULL(0x00012DCEE628FA31), __ULL(0x00012DBB7207699C), __ULL(0x00012DB31C74658E),
+  __ULL(0x00012DA539853EAC), __ULL(0x00012DA272AFE207), __ULL(0x00012D949149568D),
+  __ULL(0x00012D91CAC278E2), __ULL(0x00012D89777C55D1), __ULL(0x00012D6AF4BEDEA6),
+  __ULL(0x00012D682EFC0592), __ULL(0x00012D62A39D7E86), __ULL(0x00012D5A52F19A50),
+  __ULL(0x00012D4F3D6DC4A5), __ULL(0x00012D4163AE73F0), __ULL(0x00012D3914D81E30),
+  __ULL(0x00012D25B4016A51), __ULL(0x00012D1D66B1E9F9), __ULL(0x00012D17DE135792),
+  __ULL(0x00012D07456FF65F), __ULL(0x00012CDDCFD786E9), __ULL(0x00012CBCAD2F370B),
+  __ULL(0x00012CB465A90CCE), __ULL(0x00012CAC1E97932C), __ULL(0x00012CA115E064D8),
+  __ULL(0x00012C98CFDF0C7F), __ULL(0x00012C934C1EE996), __ULL(0x00012C908A5244A7),
+  __ULL(0x00012C8B06DFD211), __ULL(0x00012C82C2153B04), __ULL(0x00012C77BC66EFF5),
+  __ULL(0x00012C6F78AC09F5), __ULL(0x00012C6735658464), __ULL(0x00012C48ED45FFBB),
+  __ULL(0x00012C302B2AAD35), __ULL(0x00012C252B8A685F), __ULL(0x00012C1FAC07A37E),
+  __ULL(0x00012C1CEC599732), __ULL(0x00012C04317F011A), __ULL(0x00012BFBF41DF908),
+  __ULL(0x00012BF6761DA676), __ULL(0x00012BF3B730CB5C), __ULL(0x00012BDDC1991848),
+  __ULL(0x00012BC51125FCF4), __ULL(0x00012BA9A7316EE5), __ULL(0x00012B9BF41869A9),
+  __ULL(0x00012B93BC701A8C), __ULL(0x00012B8B853B2D41), __ULL(0x00012B6277F3F9F3),
+  __ULL(0x00012B5FBBBC0B90), __ULL(0x00012B4F53791672), __ULL(0x00012B2911DA606F),
+  __ULL(0x00012B20E07E0C7A), __ULL(0x00012B18AF9495D2), __ULL(0x00012B107F1DF307),
+  __ULL(0x00012B0DC4653F8D), __ULL(0x00012AFD651CCF78), __ULL(0x00012AEFC1BEF1F6),
+  __ULL(0x00012AE4D98C5927), __ULL(0x00012ACC52033CB2), __ULL(0x00012AB3CE807C43),
+  __ULL(0x00012AAE5C7D7A38), __ULL(0x00012AA3790FEAC8), __ULL(0x00012A8AFC403B2F),
+  __ULL(0x00012A7D63501A04), __ULL(0x00012A7AAB461FE3), __ULL(0x00012A549FED356B),
+  __ULL(0x00012A51E8A14958), __ULL(0x00012A4454E38A98), __ULL(0x00012A3154ED46C9),
+  __ULL(0x00012A2BE7AB02CC), __ULL(0x00012A29311CD6F9), __ULL(0x00012A0084B43B18),
+  __ULL(0x000129F042D8D7FF), __ULL(0x000129D279618E04), __ULL(0x000129AF4D245C76),
+  __ULL(0x000129A1C82F5733), __ULL(0x00012996F84DA169), __ULL(0x0001298EDCE84DC4),
+  __ULL(0x000129815AE5547C), __ULL(0x000129768D5E918B), __ULL(0x00012960F4AB654D),
+  __ULL(0x0001294E11A0FF0F), __ULL(0x00012945FA33F4A8), __ULL(0x0001293DE337A7DD),
+  __ULL(0x00012930688D97C8), __ULL(0x0001291D8BAD24BE), __ULL(0x0001291576E40203),
+  __ULL(0x0001291013F1C456), __ULL(0x0001290D628B65B9), __ULL(0x000128FFEC47014F),
+  __ULL(0x000128EFC65DF62F), __ULL(0x000128ED158D7D81), __ULL(0x000128E50366F7D4),
+  __ULL(0x000128D790CAFDE9), __ULL(0x000128CCCF951EBE), __ULL(0x000128C76F44FDD4),
+  __ULL(0x000128C4BF2F9FDA), __ULL(0x000128B74F7FB53D), __ULL(0x000128946600EA05),
+  __ULL(0x00012876E1EC084E), __ULL(0x0001286ED6312630), __ULL(0x0001286C27B65D62),
+  __ULL(0x0001285C11DA6BE3), __ULL(0x00012843F4563325), __ULL(0x0001283E98FA231A),
+  __ULL(0x0001281BCBDBFAFE), __ULL(0x0001281671F3935E), __ULL(0x0001280BBEB748F5),
+  __ULL(0x000127FE5FC24956), __ULL(0x000127F65A907C5A), __ULL(0x000127E3A5778CE3),
+  __ULL(0x000127D64A217C57), __ULL(0x000127D39E688421), __ULL(0x000127BB9713258A),
+  __ULL(0x000127B3957F65CB), __ULL(0x000127A63E7FB6AA), __ULL(0x0001278B941C5FF2),
+  __ULL(0x000127839521DE55), __ULL(0x0001277B96961CEB), __ULL(0x0001277642767417),
+  __ULL(0x000127564DC142BC), __ULL(0x00012753A4575E62), __ULL(0x0001274E51A86E20),
+  __ULL(0x00012743ACDDE618), __ULL(0x0001273BB1C6E309), __ULL(0x000127266BA55536),
+  __ULL(0x00012713D0CBA87D), __ULL(0x000126FE9068CA0D), __ULL(0x000126E6ABA1F417),
+  __ULL(0x000126E4043ACD3F), __ULL(0x000126DEB5912E48), __ULL(0x000126CECAB9AF73),
+  __ULL(0x000126CC23C089E5), __ULL(0x000126BEE19A0649), __ULL(0x000126BC3AEA2816),
+  __ULL(0x000126B44723CC9C), __ULL(0x000126A460E0940A), __ULL(0x00012697224D5317),
+  __ULL(0x0001268F30874521), __ULL(0x000126873F2EE57A), __ULL(0x0001266CC875588B),
+  __ULL(0x00012664D8F7DB17), __ULL(0x0001265F8EE10778), __ULL(0x00012657A01A037E),
+  __ULL(0x000126256C6EE5B3), __ULL(0x00012620249F408F), __ULL(0x000126183942C766),
+  __ULL(0x0001260863D14922), __ULL(0x000125F5ECF46317), __ULL(0x000125F0A6D929B5),
+  __ULL(0x000125E0D5AA1758), __ULL(0x000125D64B277134), __ULL(0x000125C91F144FC6),
+  __ULL(0x000125B95225F18A), __ULL(0x000125A986EA93A0), __ULL(0x0001259F005F328D),
+  __ULL(0x00012599BD61EFE1), __ULL(0x00012591D9408DE9), __ULL(0x0001257F7143856A),
+  __ULL(0x000125724CF8791C), __ULL(0x0001256A6AF5A4F1), __ULL(0x0001255AA8352D77),
+  __ULL(0x0001255807E9E7F6), __ULL(0x0001254AE7261240), __ULL(0x0001253348BB5DBD),
+  __ULL(0x00012530A9248294), __ULL(0x000125190EF3723A), __ULL(0x0001250BF3D1CCD1),
+  __ULL(0x00012501788EE3EF), __ULL(0x000124F45F892157), __ULL(0x000124F1C1125968),
+  __ULL(0x000124E20B455AE3), __ULL(0x000124DCCF0B8AEF), __ULL(0x000124CA7DBA6BC9),
+  __ULL(0x000124A5E1F721B1), __ULL(0x000124A344E76D6E), __ULL(0x0001248E5E17E1F7),
+  __ULL(0x0001248BC173AE8F), __ULL(0x0001247441C6F5DB), __ULL(0x0001246C6D641F9B),
+  __ULL(0x0001245F61ADD9BB), __ULL(0x000124578E691AE2), __ULL(0x0001244D20099005),
+  __ULL(0x000124384586034A), __ULL(0x0001242608C39C17), __ULL(0x000123FEFBF0E79D),
+  __ULL(0x000123F1F9FC71F3), __ULL(0x000123D7F98D4264), __ULL(0x000123D02D864A1A),
+  __ULL(0x000123C32FBCF8B8), __ULL(0x000123A406917DB5), __ULL(0x000123A16E1AC798),
+  __ULL(0x0001237D1C76144A), __ULL(0x0001237A84B0A42B), __ULL(0x0001236AF707F23B),
+  __ULL(0x000123563CBBD43D), __ULL(0x0001234E77A1DF7D), __ULL(0x000123441C2448A8),
+  __ULL(0x00012315898AF240), __ULL(0x000123105DBA952E), __ULL(0x0001230606A6F142),
+  __ULL(0x00012300DB63A566), __ULL(0x000122EEC56A3129), __ULL(0x000122DF46A77A1A),
+  __ULL(0x000122D25E47EEEC), __ULL(0x000122C80B9B6C36), __ULL(0x000122B890F8590A),
+  __ULL(0x000122B36875116F), __ULL(0x000122ABAC080051), __ULL(0x000122A15C1A84F1),
+  __ULL(0x0001229C346A0444), __ULL(0x0001229479390882), __ULL(0x0001228270B57F5E),
+  __ULL(0x000122661EB5306B), __ULL(0x0001225BD3B66671), __ULL(0x000122541BF1E080),
+  __ULL(0x0001224EF6FE8AE8), __ULL(0x0001224C6496604A), __ULL(0x0001223F893C8098),
+  __ULL(0x00012237D2F8E6BC), __ULL(0x0001221E210D02AF), __ULL(0x0001221149CBC7F7),
+  __ULL(0x0001220704CF7BCD), __ULL(0x000121FF518C68F1), __ULL(0x000121F79EB1FFE7),
+  __ULL(0x000121DB67BAC16E), __ULL(0x000121C4561CECE7), __ULL(0x000121C1C628F7D7),
+  __ULL(0x000121AD482AD275), __ULL(0x000121A599AACC3B), __ULL(0x0001218C019BB312),
+  __ULL(0x00012186E3BD3857), __ULL(0x00012165A5FF0509), __ULL(0x00012160897B7D51),
+  __ULL(0x0001214EA71B0C29), __ULL(0x0001213290FA6F79), __ULL(0x00012120B4480469),
+  __ULL(0x0001211B9A33A3E8), __ULL(0x0001210C4D0B0358), __ULL(0x00012104A7122C83),
+  __ULL(0x000120FA75123729), __ULL(0x000120F55C57489D), __ULL(0x000120EDB7952B1A),
+  __ULL(0x000120E6133A9043), __ULL(0x000120C4FA5D47E1), __ULL(0x000120B84196DBA6),
+  __ULL(0x000120B5B65E682B), __ULL(0x0001209ED3669513), __ULL(0x00012087F40F5FBE),
+  __ULL(0x00012082DF5D9251), __ULL(0x000120805515D917), __ULL(0x0001206C04742B01),
+  __ULL(0x000120697A93742D), __ULL(0x00012052A3AFAA79), __ULL(0x0001204D90DE59D2),
+  __ULL(0x00012045F4FA132F), __ULL(0x0001203BD0699FEB), __ULL(0x00012036BE65EA1B),
+  __ULL(0x0001202F23B5F763), __ULL(0x0001201FEF8A2CF0), __ULL(0x0001201D670022E3),
+  __ULL(0x00012015CDA67078), __ULL(0x0001200E34B35958), __ULL(0x00011FEAC590AEF5),
+  __ULL(0x00011FBABCAC5504), __ULL(0x00011FB5AF321F2D), __ULL(0x00011FAB94C5F767),
+  __ULL(0x00011F97620E747D), __ULL(0x00011F7695B031E6), __ULL(0x00011F718A9A6EB6),
+  __ULL(0x00011F6F052089F6), __ULL(0x00011F626A68E6BA), __ULL(0x00011F534BCECF11),
+  __ULL(0x00011F50C6DCB8A3), __ULL(0x00011F442ECBE76F), __ULL(0x00011F3A1C56B9BF),
+  __ULL(0x00011F328EF57CA5), __ULL(0x00011F25F98AA759), __ULL(0x00011F16E14BCE91),
+  __ULL(0x00011F145D68D454), __ULL(0x00011F07CAA3252B), __ULL(0x00011F054703D745),
+  __ULL(0x00011EE71EFB4B3B), __ULL(0x00011EE218ECE8E6), __ULL(0x00011EBC711BDDAE),
+  __ULL(0x00011E9BD697F46B), __ULL(0x00011E94518709C1), __ULL(0x00011E8CCCDB20A3),
+  __ULL(0x00011E7641351F1B), __ULL(0x00011E6EBE1CECBA), __ULL(0x00011E673B699430),
+  __ULL(0x00011E4BB4E0FAA6), __ULL(0x00011E49348C15CA), __ULL(0x00011E3CB38B6B4E),
+  __ULL(0x00011E26347DD625), __ULL(0x00011E05BC196F7A), __ULL(0x00011E00BDEC7E1F),
+  __ULL(0x00011DEA484A4E4B), __ULL(0x00011DE04E07994C), __ULL(0x00011DD8D2CA8C31),
+  __ULL(0x00011DD157F1BAE4), __ULL(0x00011DC2636CAC3B), __ULL(0x00011DAE752A52B1),
+  __ULL(0x00011DA6FC88EA6D), __ULL(0x00011D9D06F7F7CE), __ULL(0x00011D891DEB450D),
+  __ULL(0x00011D81A73DB36B), __ULL(0x00011D77B446F756), __ULL(0x00011D63D06DE0BD),
+  __ULL(0x00011D615424A16A), __ULL(0x00011D2D2C20C66D), __ULL(0x00011CE544F10F0D),
+  __ULL(0x00011CDB5CDD4F5D), __ULL(0x00011CD669159210), __ULL(0x00011CCEFBBC9AD5),
+  __ULL(0x00011CCC820A5110), __ULL(0x00011CC78EC6C8C4), __ULL(0x00011CBDA8C3DD15),
+  __ULL(0x00011CA9DECE591A), __ULL(0x00011CA273C7CC9C), __ULL(0x00011C89BC7C8998),
+  __ULL(0x00011C84CB8AF02C), __ULL(0x00011C75F9BDAF77), __ULL(0x00011C67297B900D),
+  __ULL(0x00011C5FC1EE998C), __ULL(0x00011C50F3FCB860), __ULL(0x00011C4E7C7AC534),
+  __ULL(0x00011C4227955E4F), __ULL(0x00011C3FB0552654), __ULL(0x00011C384AD63274),
+  __ULL(0x00011C1D2F4F781D), __ULL(0x00011C1AB8B3673F), __ULL(0x00011C0E684B122E),
+  __ULL(0x00011C07055C6DEC), __ULL(0x00011BFD2CB7321D), __ULL(0x00011BF5CAADF2B7),
+  __ULL(0x00011BE97D78E14E), __ULL(0x00011BD8465F46B2), __ULL(0x00011BD0E64109CC),
+  __ULL(0x00011BC98684E9A4), __ULL(0x00011BC49C3DFCD6), __ULL(0x00011BAE801A0A84),
+  __ULL(0x00011BA4AD96EC6C), __ULL(0x00011B986767D9F4), __ULL(0x00011B8E966C5E10),
+  __ULL(0x00011B7AF67F29BA), __ULL(0x00011B69CCC9EBEC), __ULL(0x00011B5D8BB2B51F),
+  __ULL(0x00011B5B186837B9), __ULL(0x00011B4ED8967908), __ULL(0x00011B4C658D0E96),
+  __ULL(0x00011B3DB43833C2), __ULL(0x00011B365C2010BB), __ULL(0x00011B3176F0CD69),
+  __ULL(0x00011B18FF8E18F1), __ULL(0x00011B0CC57284AB), __ULL(0x00011B02FE1F19EA),
+  __ULL(0x00011AC37EF54093), __ULL(0x00011AB9BCB13432), __ULL(0x00011AAD8ACE997A),
+  __ULL(0x00011AA63A2E4B65), __ULL(0x00011AA3CA0E655B), __ULL(0x00011A979A106085),
+  __ULL(0x00011A8DDAD3AA5F), __ULL(0x00011A81ACB9CA9F), __ULL(0x00011A7A5E5E7D62),
+  __ULL(0x00011A731063EB54), __ULL(0x00011A6953AC3ECB), __ULL(0x00011A5D28B84D3E),
+  __ULL(0x00011A5AB9DAEC0A), __ULL(0x00011A3FF91BF02B), __ULL(0x00011A3D8ABF4AEA),
+  __ULL(0x00011A38AE2629B6), __ULL(0x00011A316390DB04), __ULL(0x00011A2061AB75CF),
+  __ULL(0x00011A1B861372C1), __ULL(0x00011A1918578058), __ULL(0x000119FBF6CAC9BC),
+  __ULL(0x000119ED6845E593), __ULL(0x000119E88E6F17B6), __ULL(0x000119C90A8C1362),
+  __ULL(0x000119B33D36ABE0), __ULL(0x000119AE65601597), __ULL(0x000119A721EE2157),
+  __ULL(0x0001199630AE6916), __ULL(0x00011971E96FC823), __ULL(0x0001196AA91BFE3B),
+  __ULL(0x00011965D3C3F040), __ULL(0x0001195E940F8ABD), __ULL(0x0001195C29935254),
+  __ULL(0x0001194198F9A2B0), __ULL(0x00011937F145EA05), __ULL(0x000119331DABAFBA),
+  __ULL(0x0001192BE093DCB2), __ULL(0x0001192976F6744E), __ULL(0x0001190EEFEE3A5E),
+  __ULL(0x00011907B4B3176D), __ULL(0x000118FE10F8681A), __ULL(0x000118EACB7EC59D),
+  __ULL(0x000118E3921F9AEB), __ULL(0x000118D2B85E07CE), __ULL(0x000118CDE83CA336),
+  __ULL(0x000118C6B059BAFF), __ULL(0x000118B10AEADAD1), __ULL(0x000118A76D21221C),
+  __ULL(0x0001189901AEC2E3), __ULL(0x00011891CC83CEDE), __ULL(0x00011883634A397B),
+  __ULL(0x0001186695478CF5), __ULL(0x000118429C14C890), __ULL(0x0001182F70482AB7),
+  __ULL(0x00011825DB5D9CAE), __ULL(0x000117FD29C75BA2), __ULL(0x000117F3984CB859),
+  __ULL(0x000117D94B9A632D), __ULL(0x000117D2204545A4), __ULL(0x000117C167419D59),
+  __ULL(0x000117B5769CCC67), __ULL(0x0001179FFB38A414), __ULL(0x0001178F48329BD8),
+  __ULL(0x0001178A8320F35E), __ULL(0x0001177C34E5EE33), __ULL(0x00011772AC397650),
+  __ULL(0x0001176DE821AAA5), __ULL(0x000117430A9B2AD2), __ULL(0x0001173BE6F6B50E),
+  __ULL(0x00011734C3AFAF16), __ULL(0x0001173262ACC4B3), __ULL(0x000117267E39D5DF),
+  __ULL(0x000117241D752BAB), __ULL(0x0001171F5C0AF44F), __ULL(0x000117079765DF76),
+  __ULL(0x0001170076CB3294), __ULL(0x000116F9568DB9DF), __ULL(0x000116ED76F6513F),
+  __ULL(0x000116DF38C94A4F), __ULL(0x000116D81A3E66B8), __ULL(0x000116D5BACF7327),
+  __ULL(0x000116A64E9DE7CA), __ULL(0x0001169CD4837788), __ULL(0x00011695B95BECCD),
+  __ULL(0x0001167494C32049), __ULL(0x0001166D7BA90223), __ULL(0x0001166B1E0A38B2),
+  __ULL(0x0001165CED29941F), __ULL(0x00011647A68EC87F), __ULL(0x00011642ECA48E2B),
+  __ULL(0x000116269485E5BA), __ULL(0x000116160E73D974), __ULL(0x0001160EFA2A858E),
+  __ULL(0x00011607E63D74A2), __ULL(0x000115FC1B29F697), __ULL(0x000115E488031641),
+  __ULL(0x000115D8BFEF72D6), __ULL(0x000115C8431B18F6), __ULL(0x000115B56DB2353F),
+  __ULL(0x000115A4F50E9C9B), __ULL(0x00011592246ED09C), __ULL(0x0001158B16DB2D48),
+  __ULL(0x00011581AFFA606F), __ULL(0x0001155768E78911), __ULL(0x00011552B722C56B),
+  __ULL(0x00011544A2C887C1), __ULL(0x000115368FDC32A4), __ULL(0x0001152F86EF2DE0),
+  __ULL(0x0001152176274D24), __ULL(0x000114E6EA40C158), __ULL(0x000114D8E0D64259),
+  __ULL(0x000114D1DCA99DC6), __ULL(0x000114CD2F6918E3), __ULL(0x000114C62BD429AC),
+  __ULL(0x000114BF289A37A5), __ULL(0x000114B5CF851D82), __ULL(0x000114AECD1F5F5E),
+  __ULL(0x000114A31F3FC928), __ULL(0x000114A0C9648E9E), __ULL(0x000114951CB3CD5F),
+  __ULL(0x00011492C7151F39), __ULL(0x0001147DC646D5F1), __ULL(0x000114721C8A5FEE),
+  __ULL(0x00011461CA299B80), __ULL(0x0001144F253B9635), __ULL(0x00011445D3B6065D),
+  __ULL(0x0001143ED6FB6F5A), __ULL(0x0001143A2EB14DC0), __ULL(0x00011422E7997E6A),
+  __ULL(0x0001141E4040720F), __ULL(0x0001141BECA2FAAB), __ULL(0x000114104B262F74),
+  __ULL(0x00011409512080FC), __ULL(0x000113F90B1CE449), __ULL(0x000113E421A0AA69),
+  __ULL(0x000113D884D69CB8), __ULL(0x000113AC6D261907), __ULL(0x000113A0D50BF0AC),
+  __ULL(0x0001138BF8EB6B3E), __ULL(0x00011389A7C45D7D), __ULL(0x0001137E1296B3B5),
+  __ULL(0x0001137BC1AB7BCA), __ULL(0x0001136DDCF97D70), __ULL(0x000113693BB88AAE),
+  __ULL(0x00011366EB27028D), __ULL(0x000113624A21D388), __ULL(0x0001135217C951AA),
+  __ULL(0x0001134B275D4009), __ULL(0x0001133F977017B8), __ULL(0x000113365832285F),
+  __ULL(0x00011308254CC2CF), __ULL(0x00011301389A6357), __ULL(0x000112EA26219E1D),
+  __ULL(0x000112E5894D2F44), __ULL(0x000112D7B3BD9668), __ULL(0x000112CE7B79324E),
+  __ULL(0x000112C791ADD00A), __ULL(0x000112A06B68FE02), __ULL(0x0001129736D9AA99),
+  __ULL(0x0001127DE97DD0D4), __ULL(0x00011274B73E8548), __ULL(0x00011266ED074C4A),
+  __ULL(0x0001125B703D8E63), __ULL(0x000112592432C0F5), __ULL(0x00011246C53EB8F5),
+  __ULL(0x0001121697B0BCE7), __ULL(0x00011208D6ECFED1), __ULL(0x000111FFAC84196F),
+  __ULL(0x000111E67B0CAD13), __ULL(0x000111DD52EFFDA8), __ULL(0x000111C427C8F598),
+  __ULL(0x000111BB01F79F10), __ULL(0x000111B426014FB6), __ULL(0x0001118D4E0AE938),
+  __ULL(0x0001118B05726DAE), __ULL(0x000111842BE3895A), __ULL(0x0001117F9B0A6544),
+  __ULL(0x0001116FA145A3D1), __ULL(0x00011168C915D924), __ULL(0x000111568A432443),
+  __ULL(0x000111544294A267), __ULL(0x0001113B30977DC1), __ULL(0x000111345B077DC4),
+  __ULL(0x0001112B3ECF9E90), __ULL(0x0001110FEDCCE036), __ULL(0x000110F6E85688C6),
+  __ULL(0x000110F0163084CD), __ULL(0x000110EDD0373D21), __ULL(0x000110E02D2B1B7A),
+  __ULL(0x000110DBA1C9EA97), __ULL(0x000110D4D100C74B), __ULL(0x000110C4EB29048C),
+  __ULL(0x000110C060B03246), __ULL(0x000110B74C32A6CB), __ULL(0x0001109C125A41CC),
+  __ULL(0x00011097893D7AFD), __ULL(0x00011090BBDAC078), __ULL(0x00011089EECEEC99),
+  __ULL(0x00011087AA88F48D), __ULL(0x0001106EBE041D8C), __ULL(0x00011058197FBFA3),
+  __ULL(0x000110514F471BCB), __ULL(0x0001104CC8A6D48B), __ULL(0x0001103CF2A51294),
+  __ULL(0x000110386CB207A6), __ULL(0x00011031A40D9B3B), __ULL(0x0001102ADBBFBAA1),
+  __ULL(0x00011021D133CF40), __ULL(0x0001101B09AFC667), __ULL(0x0001100FBDE92D0D),
+  __ULL(0x00011008F74BA68E), __ULL(0x00010FFFEF00010F), __ULL(0x00010FF9292C06F4),
+  __ULL(0x00010FE71B4770A5), __ULL(0x00010FD75116AD4B), __ULL(0x00010FD08D48566F),
+  __ULL(0x00010FC9C9D02EE9), __ULL(0x00010FB0FFF89229), __ULL(0x00010FAA3E1247DA),
+  __ULL(0x00010F8F39D54B9C), __ULL(0x00010F6B3C8961F3), __ULL(0x00010F647E1AFDE8),
+  __ULL(0x00010F5044D26C75), __ULL(0x00010F4987BB04E5), __ULL(0x00010F355276CF95),
+  __ULL(0x00010F2A19BA5494), __ULL(0x00010F212035165C), __ULL(0x00010EFF7DCB3E8F),
+  __ULL(0x00010EEB538CDCD5), __ULL(0x00010EE49B781B69), __ULL(0x00010ED2B2371A12),
+  __ULL(0x00010EC544D42F1D), __ULL(0x00010EBE8EA287E8), __ULL(0x00010EB1233EB65B),
+  __ULL(0x00010EAEE6CF2F1B), __ULL(0x00010EA831B95662), __ULL(0x00010EA3B92F6117),
+  __ULL(0x00010E965074557F), __ULL(0x00010E8D60B4969D), __ULL(0x00010E86AD47EFDA),
+  __ULL(0x00010E6E1E3AF345), __ULL(0x00010E653122A966), __ULL(0x00010E5E7FB36E3C),
+  __ULL(0x00010E5A09986613), __ULL(0x00010E4A6D628AC8), __ULL(0x00010E3F480D6D34),
+  __ULL(0x00010E2B3A5EA8E1), __ULL(0x00010E14F5C46AB4), __ULL(0x00010E09D4D7A1C1),
+  __ULL(0x00010E079B2AD8E6), __ULL(0x00010E00EE5CD26D), __ULL(0x00010DFC7B57BC89),
+  __ULL(0x00010DFA41E34538), __ULL(0x00010DDB215D92FD), __ULL(0x00010DC722887E8E),
+  __ULL(0x00010DC4E9F4F9F6), __ULL(0x00010DB9CF9FCAA9), __ULL(0x00010DB326A9C5B3),
+  __ULL(0x00010DAC7E07F116), __ULL(0x00010DA5D5BA4694), __ULL(0x00010D964E4C3979),
+  __ULL(0x00010D69F9C6AB40), __ULL(0x00010D4F67A8852C), __ULL(0x00010D4D310D3C5C),
+  __ULL(0x00010D48C3F29AD5), __ULL(0x00010D3FEA2D11C4), __ULL(0x00010D32A49BF99B),
+  __ULL(0x00010D2E3860B432), __ULL(0x00010D181D663A76), __ULL(0x00010D13B20A0F26),
+  __ULL(0x00010CF05C61D0BB), __ULL(0x00010CDC8046E423), __ULL(0x00010CCADB88B6A9),
+  __ULL(0x00010CC43E5A3707), __ULL(0x00010C9C96180F2E), __ULL(0x00010C93C7A02B25),
+  __ULL(0x00010C8D2D2740A6), __ULL(0x00010C88C65A2743), __ULL(0x00010C822C6BC10D),
+  __ULL(0x00010C72C6828786), __ULL(0x00010C6E6092EDEA), __ULL(0x00010C67C7F0B2F5),
+  __ULL(0x00010C4B3645A2DD), __ULL(0x00010C449F5DB3FC), __ULL(0x00010C39A4934235),
+  __ULL(0x00010C2A46FA489D), __ULL(0x00010C168814C7DF), __ULL(0x00010C0B910FC67A),
+  __ULL(0x00010C04FD47C70A), __ULL(0x00010BFE69D2679D), __ULL(0x00010BEF1301B8A0),
+  __ULL(0x00010BE41F36B073), __ULL(0x00010BDD8D5E15EA), __ULL(0x00010BD6FBD7F6F1),
+  __ULL(0x00010BC7A98A50AA), __ULL(0x00010BC11916F716), __ULL(0x00010BA6DA812115),
+  __ULL(0x00010BA27B3D87C3), __ULL(0x00010B932EF0D507), __ULL(0x00010B7B2849B1C6),
+  __ULL(0x00010B726CC1A5CD), __ULL(0x00010B6554873739), __ULL(0x00010B5A6BFBE779),
+  __ULL(0x00010B51B296E186), __ULL(0x00010B449D909793), __ULL(0x00010B31006D9719),
+  __ULL(0x00010B261C26C213), __ULL(0x00010B12837D8B70), __ULL(0x00010B09CEC93745),
+  __ULL(0x00010AEFB413B298), __ULL(0x00010AE4D51EF25E), __ULL(0x00010ADC2364BA61),
+  __ULL(0x00010AD7CABDFE61), __ULL(0x00010ABDB9CE66B4), __ULL(0x00010AB7365E2EAE),
+  __ULL(0x00010AA3ADF5FBAD), __ULL(0x00010A9D2BCB532A), __ULL(0x00010A9B0079D8D7),
+  __ULL(0x00010A902869FB20), __ULL(0x00010A6FA584B5BA), __ULL(0x00010A6D7AF0CEC7),
+  __ULL(0x00010A62A6948C97), __ULL(0x00010A607C36BDEC), __ULL(0x00010A5C27962A32),
+  __ULL(0x00010A59FD5364B2), __ULL(0x00010A2EB77EF86A), __ULL(0x00010A2C8DF93BCA),
+  __ULL(0x00010A0E4C58B65C), __ULL(0x00010A05A892CFEF), __ULL(0x000109FF2E1CA59D),
+  __ULL(0x000109F8B3F74005), __ULL(0x000109E5476B709D), __ULL(0x000109DECE88E2F4),
+  __ULL(0x000109D405C2840F), __ULL(0x000109C4EE24F9F4), __ULL(0x000109C09E91AE9D),
+  __ULL(0x000109AD3A35C34B), __ULL(0x0001098CEE907822), __ULL(0x0001097991BEA0B6),
+  __ULL(0x000109776B2943B3), __ULL(0x0001096A846463BD), __ULL(0x0001094A48F4038B),
+  __ULL(0x00010943D79ACF36), __ULL(0x00010923A58DE30A), __ULL(0x0001091F5B34626F),
+  __ULL(0x0001090C0E596316), __ULL(0x000108FF3201A020), __ULL(0x000108FD0D6764D4),
+  __ULL(0x000108F8C44D8C2E), __ULL(0x000108E9C58A79BA), __ULL(0x000108E358E06FE1),
+  __ULL(0x000108D8A4764760), __ULL(0x000108D238A0E3F7), __ULL(0x000108C9A955AEF9),
+  __ULL(0x000108C33E3A3B61), __ULL(0x000108B88C682238), __ULL(0x000108ABB829842F),
+  __ULL(0x000108A994E8B1B9), __ULL(0x000108A32B5B438D), __ULL(0x00010896592EFD6B),
+  __ULL(0x0001088BAAFCFE21), __ULL(0x000108898840AE60), __ULL(0x00010876512F020F),
+  __ULL(0x000108720C6FAD09), __ULL(0x0001085CB6C3F8EA), __ULL(0x0001085872D82D24),
+  __ULL(0x000108520D388AA5), __ULL(0x00010843214D8DBB), __ULL(0x0001083CBCB60075),
+  __ULL(0x00010836586DA04C), __ULL(0x0001081EEB5E9DBB), __ULL(0x0001081888876ED4),
+  __ULL(0x0001081225FF4C83), __ULL(0x00010809A31A0BFB), __ULL(0x000107F67E97A0FA),
+  __ULL(0x000107E35CDB944B), __ULL(0x000107D8BD179CC4), __ULL(0x000107D69D3DE5C2),
+  __ULL(0x000107CBFE80AB92), __ULL(0x000107C9DEDB7D06), __ULL(0x000107C38020748E),
+  __ULL(0x000107BF4124DA1C), __ULL(0x000107B8E2ED0F03), __ULL(0x000107AC27699794),
+  __ULL(0x0001079910725BD7), __ULL(0x00010796F19F0317), __ULL(0x0001078C58014133),
+  __ULL(0x00010783DDB9C545), __ULL(0x0001077FA0CA6266), __ULL(0x0001076C9044E0F2),
+  __ULL(0x0001076A7228BFAD), __ULL(0x000107641808A621), __ULL(0x0001075DBE36F792),
+  __ULL(0x0001075764B3AE55), __ULL(0x0001074CD031B0AF), __ULL(0x0001074459FFF9D4),
+  __ULL(0x00010739C7059851), __ULL(0x000107336F3E222D), __ULL(0x0001072069BD267D),
+  __ULL(0x00010713BCEE1BC9), __ULL(0x0001070B4A67108E), __ULL(0x000106FE9FA0D81F),
+  __ULL(0x000106F84AB2D777), __ULL(0x000106F4123F8814), __ULL(0x000106EDBDD39663),
+  __ULL(0x000106DEFA070913), __ULL(0x000106CE1C49834F), __ULL(0x000106CC00B8C770),
+  __ULL(0x000106BF5C0A1650), __ULL(0x000106BB256A64CB), __ULL(0x000106B4D3BBB5B6),
+  __ULL(0x0001068CD577593E), __ULL(0x000106868602BF7C), __ULL(0x0001068036DBCB76),
+  __ULL(0x0001066F6544B23A), __ULL(0x0001065A624F7282), __ULL(0x0001063CFD6B4855),
+  __ULL(0x00010628028732C6), __ULL(0x0001061D86575FDB), __ULL(0x000106173C3B54FA),
+  __ULL(0x00010610F26C8D41), __ULL(0x00010602476112EE), __ULL(0x000105FE16CF9168),
+  __ULL(0x000105E2DE618F59), __ULL(0x000105DEAED12627), __ULL(0x000105D009656756),
+  __ULL(0x000105C5943DC08F), __ULL(0x000105B2C377938B), __ULL(0x000105A422F4F1FB),
+  __ULL(0x00010586E6D6E084), __ULL(0x00010584D08270AE), __ULL(0x00010580A3F326C9),
+  __ULL(0x00010572090A3364), __ULL(0x0001056159FF3E01), __ULL(0x0001055F444432D7),
+  __ULL(0x00010542178739BA), __ULL(0x0001053BD7EE7E35), __ULL(0x000105338399DB4E),
+  __ULL(0x0001052D44B39B5D), __ULL(0x00010509E5E914BF), __ULL(0x0001050194C373B3),
+  __ULL(0x000104FD6C638310), __ULL(0x000104EAB8574D29), __ULL(0x000104E8A4804DF7),
+  __ULL(0x000104D806F9266F), __ULL(0x000104CFB900B453), __ULL(0x000104C97EDF32DB),
+  __ULL(0x000104A002ED4C08), __ULL(0x00010497B885825B), __ULL(0x0001048513098D6D),
+  __ULL(0x00010480EEA01A95), __ULL(0x00010461E1BB9740), __ULL(0x0001045BACD7A81F),
+  __ULL(0x0001044F43F2FCD9), __ULL(0x0001044D3294FC47), __ULL(0x0001042E3203B951),
+  __ULL(0x00010427FF964FC0), __ULL(0x0001041DAC3288B3), __ULL(0x0001040F38D4178A),
+  __ULL(0x000103E5F80B73FA), __ULL(0x000103D78ADC9D0E), __ULL(0x000103CD3DDAB650),
+  __ULL(0x000103CB2E8D052C), __ULL(0x000103BED36A6BD8), __ULL(0x000103B4885E0F8A),
+  __ULL(0x000103AC4CEA8538), __ULL(0x000103A82F62D965), __ULL(0x0001039FF4B7AC7D),
+  __ULL(0x00010399C90EE9F4), __ULL(0x000103939DB13C2B), __ULL(0x00010376D7318645),
+  __ULL(0x00010374C942532D), __ULL(0x00010370AD7CE902), __ULL(0x000103645AF47C74),
+  __ULL(0x00010355FC254EDA), __ULL(0x0001034591BDD02F), __ULL(0x0001033D5D518BE2),
+  __ULL(0x0001031E9D5AF962), __ULL(0x0001030E39F500CB), __ULL(0x000102FBCC9C7162),
+  __ULL(0x000102F9C09F9566), __ULL(0x000102EF852B8144), __ULL(0x000102DD1C30D64E),
+  __ULL(0x000102D6F9C78765), __ULL(0x000102B64728F6EE), __ULL(0x000102B23169D55C),
+  __ULL(0x0001029FD1264C7C), __ULL(0x00010299B1A449EA), __ULL(0x00010297A7341CBD),
+  __ULL(0x0001028B69402EB5), __ULL(0x00010281368234F9), __ULL(0x0001026EDD332038),
+  __ULL(0x0001026CD36FF1EE), __ULL(0x00010266B657C6CF), __ULL(0x0001025C867EB273),
+  __ULL(0x0001024E44DB593E), __ULL(0x0001023BF2C6B61D), __ULL(0x0001021F78423362),
+  __ULL(0x000102195ED26C1B), __ULL(0x000102113D5AD343), __ULL(0x00010200FBF4F60D),
+  __ULL(0x000101FEF3ED168B), __ULL(0x000101FAE3F5E82B), __ULL(0x000101E6960D1AB9),
+  __ULL(0x000101DC704B7B77), __ULL(0x000101D452AA2710), __ULL(0x000101C211DD3138),
+  __ULL(0x000101B7EEFAF25F), __ULL(0x000101B5E8196323), __ULL(0x000101ABC62BFF0A),
+  __ULL(0x000101A3AB9A86B5), __ULL(0x0001019F9E82B8E4), __ULL(0x000101998B1C29C6),
+  __ULL(0x0001018D652B1980), __ULL(0x0001018752A08DF7), __ULL(0x0001017316E3FEA2),
+  __ULL(0x0001016F0B53258C), __ULL(0x0001016D0596ED02), __ULL(0x00010166F4931116),
+  __ULL(0x00010162E963D2A5), __ULL(0x0001014EB35F52FE), __ULL(0x00010144998DBDD6),
+  __ULL(0x0001012A5A22921B), __ULL(0x00010118315DCD3A), __ULL(0x0001010E1BD33CF7),
+  __ULL(0x0001010C179CA05B), __ULL(0x000100F9F31D77A9), __ULL(0x000100F3E784C305),
+  __ULL(0x000100E3C9FC1A8B), __ULL(0x000100D5B1CCEF83), __ULL(0x000100D1AB2CBF88),
+  __ULL(0x000100B7832EC66F), __ULL(0x000100B37D80C106), __ULL(0x000100A56A9DB7A7),
+  __ULL(0x0001009B5E11F4DF), __ULL(0x0001008F500DB7A9), __ULL(0x000100814121D20A),
+  __ULL(0x0001007B3B3572AE), __ULL(0x0001007535917B7D), __ULL(0x0001007131F70E0D),
+  __ULL(0x000100632657D3F6), __ULL(0x000100591EFBC587), __ULL(0x000100571D9B0FB2),
+  __ULL(0x000100390CB3D40A), __ULL(0x0001002705F1E7DA), __ULL(0x0001001101211332),
+  __ULL(0x0001000F00E10D2F), __ULL(0x0000FFFF0000FFFF), __ULL(0x0000000000000000)
+  };
@@ -0,0 +1,373 @@
+/* proth_prime_p(k,n) return true iff k*2^n+1 is prime , and base 3 probable
+prime tests of k*2^n+-1 and (2^n+1)/3
+
+This file is part of the MPIR Library.
+
+The MPIR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published
+by the Free Software Foundation; either version 2.1 of the License, or (at
+your option) any later version.
+
+The MPIR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the MPIR Library; see the file COPYING.LIB.  If not, write
+to the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+Boston, MA 02110-1301, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef USE_MPIR
+#include "mpir.h"
+#else
+#include "gmp.h"
+#endif
+
+#define BITS_TO_LIMBS(x)	(((x)+GMP_NUMB_BITS-1)/GMP_NUMB_BITS)
+#ifndef MPN_ZERO
+#define MPN_ZERO(xp,xn)	do{mp_size_t __i;for(__i=(xn)-1;__i>=0;__i--)(xp)[__i]=0;}while(0)
+#endif
+#ifndef __GMP_ALLOCATE_FUNC_LIMBS
+#define __GMP_ALLOCATE_FUNC_LIMBS(x)	malloc((x)*sizeof(mp_limb_t))
+#endif
+#ifndef __GMP_FREE_FUNC_LIMBS
+#define __GMP_FREE_FUNC_LIMBS(x,y)	free(x)
+#endif
+
+// from MPIR , or mersenne_prime_p.c and fermat_prime_p.c for GMP
+void mpn_mulmod_2expm1 (mp_ptr xp, mp_ptr yp, mp_ptr zp, mp_size_t k2, mp_ptr tp);
+int mpn_mulmod_2expp1 (mp_ptr xp, mp_ptr yp, mp_ptr zp, int c, mp_size_t k2, mp_ptr tp);
+
+/*
+Squaring modulo N=k*2^n+s for s=+-1 and a small odd k
+
+For k=1 this is the squaring mod 2^n+-1 of mpn_mulmod_2expm1 and
+mpn_mulmod_2expp1 , with x in BITS_TO_LIMBS(n) limbs and , mod 2^n+1 , the
+carry c for x=2^n . The Wagstaff numbers (2^n+1)/3 are done mod 2^n+1 , which
+they divide , and reduced mod N at the end
+
+For k>1 the square is folded at bit n as in those kernels , but as k*2^n=-s
+mod N the high part H is first divided by k . If x=H*2^n+L with L<2^n and
+H=q*k+r with r<k then x=L+r*2^n-s*q mod N , where L+r*2^n<k*2^n , and q is
+about x/(k*2^n) , so one fold takes x<N^2 to within N of [0,N) , and a
+subtraction or two of N finishes it . k fits in a limb , so the division of H
+is one pass of mpn_divrem_1
+
+All the limbs are allocated once , in k2n_init , and the squarings run on
+them without any mpz arithmetic
+*/
+typedef struct
+{
+  mpz_t x;
+  mpz_t m;			// the modulus k*2^n+s
+  unsigned long k, n;
+  int s;
+  int c;			// x=2^n mod 2^n+1 , for k=1 and s=1
+  mp_size_t xn;			// limbs of x , with one to spare for k>1
+  mp_size_t pn;
+  mp_ptr pp;			// the block holding all of these
+  mp_ptr xp, rp;		// x and the square , swapped after each step
+  mp_ptr mp;			// N
+  mp_ptr hp, qp;		// H and q , for k>1
+  mp_ptr tp;			// the product and the kernels' scratch
+} k2n_ctx;
+
+static void
+k2n_init (k2n_ctx * c, unsigned long k, unsigned long n, int s)
+{
+  mp_size_t lg;
+  size_t cnt;
+
+  mpz_init (c->x);
+  mpz_init (c->m);
+  mpz_set_ui (c->m, k);
+  mpz_mul_2exp (c->m, c->m, n);
+  if (s > 0)
+    mpz_add_ui (c->m, c->m, 1);
+  else
+    mpz_sub_ui (c->m, c->m, 1);
+  c->k = k;
+  c->n = n;
+  c->s = s;
+  c->c = 0;
+  if (k == 1)
+    c->xn = BITS_TO_LIMBS (n);
+  else
+    c->xn = BITS_TO_LIMBS (mpz_sizeinbase (c->m, 2)) + 1;
+  for (lg = 1; ((mp_size_t) 1 << lg) < c->xn; lg++)
+    ;
+  // the kernels take up to 5n+5lg(n) limbs of scratch , as in lucas_lehmer
+  c->pn = 10 * c->xn + 5 * lg + 2;
+  c->pp = __GMP_ALLOCATE_FUNC_LIMBS (c->pn);
+  MPN_ZERO (c->pp, c->pn);
+  c->xp = c->pp;
+  c->rp = c->xp + c->xn;
+  c->mp = c->rp + c->xn;
+  c->hp = c->mp + c->xn;
+  c->qp = c->hp + c->xn + 1;
+  c->tp = c->qp + c->xn + 1;
+  if (k != 1)
+    mpz_export (c->mp, &cnt, -1, sizeof (mp_limb_t), 0, GMP_NAIL_BITS, c->m);
+}
+
+static void
+k2n_clear (k2n_ctx * c)
+{
+  mpz_clear (c->x);
+  mpz_clear (c->m);
+  __GMP_FREE_FUNC_LIMBS (c->pp, c->pn);
+}
+
+// x (an mpz in [0,N)) to and from the limbs
+static void
+k2n_load (k2n_ctx * c)
+{
+  size_t cnt;
+
+  MPN_ZERO (c->xp, c->xn);
+  c->c = 0;
+  if (c->k == 1 && c->s > 0 && mpz_sizeinbase (c->x, 2) > c->n)
+    c->c = 1;			// x=2^n
+  else
+    mpz_export (c->xp, &cnt, -1, sizeof (mp_limb_t), 0, GMP_NAIL_BITS, c->x);
+}
+
+static void
+k2n_store (k2n_ctx * c)
+{
+  mpz_import (c->x, c->xn, -1, sizeof (mp_limb_t), 0, GMP_NAIL_BITS, c->xp);
+  if (c->c != 0)
+    mpz_setbit (c->x, c->n);
+  // 2^n-1 is the second form of 0 mod 2^n-1
+  mpz_mod (c->x, c->x, c->m);
+}
+
+// x=x^2 mod k*2^n+s
+static void
+k2n_sqr (k2n_ctx * c)
+{
+  mp_size_t xn = c->xn, q, hn, qn;
+  unsigned long b;
+  mp_limb_t r;
+  mp_ptr sp;
+
+  if (c->k == 1)
+    {
+      if (c->s < 0)
+	mpn_mulmod_2expm1 (c->rp, c->xp, c->xp, c->n, c->tp);
+      else
+	c->c = mpn_mulmod_2expp1 (c->rp, c->xp, c->xp, c->c != 0 ? 3 : 0,
+				  c->n, c->tp);
+    }
+  else
+    {
+      q = c->n / GMP_NUMB_BITS;
+      b = c->n % GMP_NUMB_BITS;
+      mpn_sqr (c->tp, c->xp, xn);
+      // H , of at most xn+1 limbs as x<2^((xn-1)*GMP_NUMB_BITS)
+      hn = 2 * xn - q;
+      if (hn > xn + 1)
+	hn = xn + 1;
+      if (b != 0)
+	mpn_rshift (c->hp, c->tp + q, hn, b);
+      else
+	for (qn = 0; qn < hn; qn++)
+	  c->hp[qn] = c->tp[q + qn];
+      r = mpn_divrem_1 (c->qp, 0, c->hp, hn, c->k);
+      // L+r*2^n
+      for (qn = 0; qn < q; qn++)
+	c->rp[qn] = c->tp[qn];
+      for (qn = q; qn < xn; qn++)
+	c->rp[qn] = 0;
+      if (b != 0)
+	{
+	  c->rp[q] = (c->tp[q] & (((mp_limb_t) 1 << b) - 1)) | r << b;
+	  c->rp[q + 1] = r >> (GMP_NUMB_BITS - b);
+	}
+      else
+	c->rp[q] = r;
+      for (qn = hn; qn > 0 && c->qp[qn - 1] == 0; qn--)
+	;
+      if (c->s > 0)
+	{
+	  if (qn != 0 && mpn_sub (c->rp, c->rp, xn, c->qp, qn) != 0)
+	    while (mpn_add_n (c->rp, c->rp, c->mp, xn) == 0)
+	      ;
+	}
+      else
+	{
+	  if (qn != 0)
+	    mpn_add (c->rp, c->rp, xn, c->qp, qn);
+	  while (mpn_cmp (c->rp, c->mp, xn) >= 0)
+	    mpn_sub_n (c->rp, c->rp, c->mp, xn);
+	}
+    }
+  sp = c->xp;
+  c->xp = c->rp;
+  c->rp = sp;
+}
+
+/*
+x=a^(k*2^i) mod N , where N is k*2^n+s , or (2^n+1)/3 for k=0 , with the
+squarings done by k2n_sqr , and the result in r if r is not 0
+*/
+static void
+k2n_pow (unsigned long k, unsigned long n, int s, unsigned long a,
+	 unsigned long i, mpz_ptr r)
+{
+  k2n_ctx c;
+
+  k2n_init (&c, k == 0 ? 1 : k, n, k == 0 ? 1 : s);
+  mpz_set_ui (c.x, a);
+  mpz_powm_ui (c.x, c.x, k == 0 ? 1 : k, c.m);
+  k2n_load (&c);
+  for (; i != 0; i--)
+    k2n_sqr (&c);
+  if (r != 0)
+    {
+      k2n_store (&c);
+      if (k == 0)
+	{
+	  mpz_divexact_ui (c.m, c.m, 3);
+	  mpz_mod (c.x, c.x, c.m);
+	}
+      mpz_swap (r, c.x);
+    }
+  k2n_clear (&c);
+}
+
+/*
+Proth's Test for odd k<2^n
+
+N=k*2^n+1 is prime if and only if
+
+a^((N-1)/2) == -1 mod N
+
+for any a with jacobi(a,N)=-1 . Returns -1 if N is not of this form or there is
+no such a below 1000 (only if N is a square)
+*/
+int
+proth_prime_p (unsigned long k, unsigned long n)
+{
+  mpz_t N, r;
+  unsigned long a;
+  int ret = -1;
+
+  if (k % 2 == 0 || n == 0 || (n < 8 * sizeof (unsigned long) && k >> n != 0))
+    return -1;
+  mpz_init (N);
+  mpz_init (r);
+  mpz_set_ui (N, k);
+  mpz_mul_2exp (N, N, n);
+  mpz_add_ui (N, N, 1);
+  for (a = 3; a < 1000; a += 2)
+    if (mpz_kronecker_ui (N, a) == -1)	// = jacobi(a,N) as N=1 mod 4 when n>=2
+      break;
+  if (n == 1)
+    ret = k == 1;		// N=3 , the only Proth number with n=1
+  else if (a < 1000)
+    {
+      k2n_pow (k, n, 1, a, n - 1, r);
+      mpz_add_ui (r, r, 1);
+      ret = mpz_cmp (r, N) == 0;
+    }
+  mpz_clear (N);
+  mpz_clear (r);
+  return ret;
+}
+
+/*
+The base 3 Fermat test of N=k*2^n+s , 3^(N-1)=1 mod N . As N-1 is k*2^n or
+k*2^n-2 this is 3^(k*2^n)=1 or 9 mod N , which takes n squarings after 3^k .
+For N a multiple of 3 returns N==3
+*/
+int
+k2n_prp (unsigned long k, unsigned long n, int s)
+{
+  mpz_t N, r;
+  int ret;
+
+  mpz_init (N);
+  mpz_init (r);
+  mpz_set_ui (N, k);
+  mpz_mul_2exp (N, N, n);
+  if (s > 0)
+    mpz_add_ui (N, N, 1);
+  else
+    mpz_sub_ui (N, N, 1);
+  if (mpz_divisible_ui_p (N, 3))
+    ret = mpz_cmp_ui (N, 3) == 0;
+  else
+    {
+      k2n_pow (k, n, s, 3, n, r);
+      mpz_sub_ui (r, r, s > 0 ? 1 : 9);	// N may be below 9
+      ret = mpz_divisible_p (r, N) != 0;
+    }
+  mpz_clear (N);
+  mpz_clear (r);
+  return ret;
+}
+
+/*
+The base 3 test of the Wagstaff number N=(2^n+1)/3 for odd n>=5 , as
+3(N-1)=2^n-2 this is 3^(2^n)=9 mod N , which is implied by 3^(N-1)=1
+*/
+int
+wagstaff_prp (unsigned long n)
+{
+  mpz_t r;
+  int ret;
+
+  mpz_init (r);
+  k2n_pow (0, n, 1, 3, n, r);
+  ret = mpz_cmp_ui (r, 9) == 0 || n == 3;	// N=3 for n=3
+  mpz_clear (r);
+  return ret;
+}
+
+// i squarings of the tests above , for timing
+void
+k2n_squarings (unsigned long k, unsigned long n, int s, unsigned long i)
+{
+  k2n_pow (k, n, s, 3, i, 0);
+}
+
+#ifdef STANDALONE
+int
+main (int argc, char *argv[])
+{
+  unsigned long k, n;
+  int s, p, proved = 0;
+
+  if (argc != 4)
+    {
+      printf ("Usage: %s k n s\nDisplays primality of k*2^n+s (s=+-1) , or "
+	      "of (2^n+1)/3 for k=0\n", argv[0]);
+      return 1;
+    }
+  k = strtoul (argv[1], 0, 10);
+  n = strtoul (argv[2], 0, 10);
+  s = atoi (argv[3]) > 0 ? 1 : -1;
+  if (k == 0)
+    {
+      p = wagstaff_prp (n);
+      printf ("The Wagstaff number (2^%lu+1)/3 is ", n);
+    }
+  else
+    {
+      p = s > 0 ? proth_prime_p (k, n) : -1;
+      proved = p >= 0;
+      if (p < 0)
+	p = k2n_prp (k, n, s);
+      printf ("The number %lu*2^%lu%+d is ", k, n, s);
+    }
+  if (p == 0)
+    printf ("not ");
+  printf (proved ? "prime\n" : "a probable prime\n");
+  return 0;
+}
+#endif
@@ -0,0 +1,336 @@
+/*  Minimal portable thread support for the MPIR benchmark
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of version 2.1 of the GNU General Public License
+    as published by the Free Software Foundation; it is not distributable
+    under version 3 (or any later version) of the GNU General Public License.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#if defined( _WIN32 )
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#  include <process.h>
+#else
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
+
+#include "threads.h"
+
+#define MAX_THREADS 256
+
+#if !defined( _WIN32 ) && !defined( __GNUC__ )
+static pthread_mutex_t min_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+typedef struct
+{   thread_fn       fn;
+    void           *arg;
+    unsigned int    index;
+} thread_arg;
+
+unsigned int num_cores(void)
+{
+#if defined( _WIN32 )
+    SYSTEM_INFO si;
+
+    GetSystemInfo(&si);
+    return si.dwNumberOfProcessors > 0 ? si.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return n > 0 ? (unsigned int)n : 1;
+#endif
+}
+
+#if defined( _WIN32 )
+
+static unsigned __stdcall thread_start(void *p)
+{   thread_arg *ta = (thread_arg*)p;
+
+    ta->fn(ta->arg, ta->index);
+    return 0;
+}
+
+#else
+
+static void *thread_start(void *p)
+{   thread_arg *ta = (thread_arg*)p;
+
+    ta->fn(ta->arg, ta->index);
+    return 0;
+}
+
+#endif
+
+void run_threads(thread_fn fn, void *arg, unsigned int n_threads)
+{   thread_arg ta[MAX_THREADS];
+#if defined( _WIN32 )
+    HANDLE th[MAX_THREADS];
+#else
+    pthread_t th[MAX_THREADS];
+#endif
+    unsigned int i;
+
+    if(n_threads > MAX_THREADS)
+    {
+        fprintf(stderr, "run_threads: at most %d threads\n", MAX_THREADS);
+        exit(EXIT_FAILURE);
+    }
+
+    for( i = 1 ; i < n_threads ; ++i )
+    {
+        ta[i].fn = fn;
+        ta[i].arg = arg;
+        ta[i].index = i;
+#if defined( _WIN32 )
+        th[i] = (HANDLE)_beginthreadex(0, 0, thread_start, ta + i, 0, 0);
+        if(th[i] == 0)
+#else
+        if(pthread_create(th + i, 0, thread_start, ta + i) != 0)
+#endif
+        {
+            fprintf(stderr, "run_threads: cannot create thread %u\n", i);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if(n_threads > 0)
+        fn(arg, 0);
+
+    for( i = 1 ; i < n_threads ; ++i )
+    {
+#if defined( _WIN32 )
+        WaitForSingleObject(th[i], INFINITE);
+        CloseHandle(th[i]);
+#else
+        pthread_join(th[i], 0);
+#endif
+    }
+}
+
+/* The workers of a pool wait for the job count gen to change, first
+   by spinning for a while if there is a core for each thread, since the
+   next pass usually follows within microseconds, and then on a
+   condition variable. The last worker to finish a pass wakes the
+   caller in the same way. */
+
+#define POOL_SPIN   20000
+
+#if defined( _WIN32 )
+#  define LOCK_T            CRITICAL_SECTION
+#  define COND_T            CONDITION_VARIABLE
+#  define lock_init(l)      InitializeCriticalSection(l)
+#  define lock_free(l)      DeleteCriticalSection(l)
+#  define lock(l)           EnterCriticalSection(l)
+#  define unlock(l)         LeaveCriticalSection(l)
+#  define cond_init(c)      InitializeConditionVariable(c)
+#  define cond_free(c)
+#  define cond_wait(c, l)   SleepConditionVariableCS(c, l, INFINITE)
+#  define cond_wake(c)      WakeConditionVariable(c)
+#  define cond_wake_all(c)  WakeAllConditionVariable(c)
+#  define load(p)           (*(p))
+#  define inc(p)            InterlockedIncrement((volatile LONG*)(p))
+#  define dec(p)            ((unsigned long)InterlockedDecrement((volatile LONG*)(p)))
+#else
+#  define LOCK_T            pthread_mutex_t
+#  define COND_T            pthread_cond_t
+#  define lock_init(l)      pthread_mutex_init(l, 0)
+#  define lock_free(l)      pthread_mutex_destroy(l)
+#  define lock(l)           pthread_mutex_lock(l)
+#  define unlock(l)         pthread_mutex_unlock(l)
+#  define cond_init(c)      pthread_cond_init(c, 0)
+#  define cond_free(c)      pthread_cond_destroy(c)
+#  define cond_wait(c, l)   pthread_cond_wait(c, l)
+#  define cond_wake(c)      pthread_cond_signal(c)
+#  define cond_wake_all(c)  pthread_cond_broadcast(c)
+#  if defined( __ATOMIC_ACQUIRE )
+#    define load(p)         __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#  else
+#    define load(p)         (*(p))
+#  endif
+#  define inc(p)            __sync_add_and_fetch(p, 1)
+#  define dec(p)            __sync_sub_and_fetch(p, 1)
+#endif
+
+struct thread_pool_s
+{   unsigned int    n_threads;
+    unsigned long   spin;
+    thread_fn       fn;
+    void           *arg;
+    int             stop;
+    volatile unsigned long  gen;    /* jobs started              */
+    volatile unsigned long  busy;   /* workers still on this one */
+    LOCK_T          lk;
+    COND_T          start, done;
+    thread_arg      ta[MAX_THREADS];
+#if defined( _WIN32 )
+    HANDLE          th[MAX_THREADS];
+#else
+    pthread_t       th[MAX_THREADS];
+#endif
+};
+
+static void pool_worker(void *arg, unsigned int index)
+{   thread_pool *p = (thread_pool*)arg;
+    unsigned long seen = 0, k;
+    thread_fn fn;
+    void *fa;
+    int stop;
+
+    for( ; ; )
+    {
+        for( k = 0 ; k < p->spin && load(&p->gen) == seen ; ++k )
+            ;
+        lock(&p->lk);
+        while(p->gen == seen)
+            cond_wait(&p->start, &p->lk);
+        seen = p->gen;
+        fn = p->fn;
+        fa = p->arg;
+        stop = p->stop;
+        unlock(&p->lk);
+        if(stop)
+            break;
+
+        fn(fa, index);
+        if(dec(&p->busy) == 0)
+        {
+            lock(&p->lk);
+            cond_wake(&p->done);
+            unlock(&p->lk);
+        }
+    }
+}
+
+thread_pool *pool_create(unsigned int n_threads)
+{   thread_pool *p;
+    unsigned int i;
+
+    if(n_threads < 1 || n_threads > MAX_THREADS
+            || !(p = (thread_pool*)malloc(sizeof(thread_pool))))
+        return 0;
+    p->n_threads = n_threads;
+    p->spin = num_cores() >= n_threads ? POOL_SPIN : 0;
+    p->stop = 0;
+    p->gen = 0;
+    p->busy = 0;
+    lock_init(&p->lk);
+    cond_init(&p->start);
+    cond_init(&p->done);
+
+    for( i = 1 ; i < n_threads ; ++i )
+    {
+        p->ta[i].fn = pool_worker;
+        p->ta[i].arg = p;
+        p->ta[i].index = i;
+#if defined( _WIN32 )
+        p->th[i] = (HANDLE)_beginthreadex(0, 0, thread_start, p->ta + i, 0, 0);
+        if(p->th[i] == 0)
+#else
+        if(pthread_create(p->th + i, 0, thread_start, p->ta + i) != 0)
+#endif
+        {
+            fprintf(stderr, "pool_create: cannot create thread %u\n", i);
+            exit(EXIT_FAILURE);
+        }
+    }
+    return p;
+}
+
+void pool_run(thread_pool *p, thread_fn fn, void *arg)
+{   unsigned long k;
+
+    if(p->n_threads > 1)
+    {
+        lock(&p->lk);
+        p->fn = fn;
+        p->arg = arg;
+        p->busy = p->n_threads - 1;
+        inc(&p->gen);
+        cond_wake_all(&p->start);
+        unlock(&p->lk);
+    }
+
+    fn(arg, 0);
+
+    if(p->n_threads > 1)
+    {
+        for( k = 0 ; k < p->spin && load(&p->busy) != 0 ; ++k )
+            ;
+        lock(&p->lk);
+        while(load(&p->busy) != 0)
+            cond_wait(&p->done, &p->lk);
+        unlock(&p->lk);
+    }
+}
+
+void pool_destroy(thread_pool *p)
+{   unsigned int i;
+
+    if(!p)
+        return;
+    lock(&p->lk);
+    p->stop = 1;
+    inc(&p->gen);
+    cond_wake_all(&p->start);
+    unlock(&p->lk);
+
+    for( i = 1 ; i < p->n_threads ; ++i )
+    {
+#if defined( _WIN32 )
+        WaitForSingleObject(p->th[i], INFINITE);
+        CloseHandle(p->th[i]);
+#else
+        pthread_join(p->th[i], 0);
+#endif
+    }
+    cond_free(&p->start);
+    cond_free(&p->done);
+    lock_free(&p->lk);
+    free(p);
+}
+
+unsigned long atomic_min_ul(volatile unsigned long *p, unsigned long v)
+{
+#if defined( _WIN32 )
+    /* unsigned long and LONG are both 32 bits on Windows */
+    unsigned long old = *p, seen;
+
+    while(v < old)
+    {
+        seen = (unsigned long)InterlockedCompareExchange(
+                    (volatile LONG*)p, (LONG)v, (LONG)old);
+        if(seen == old)
+            return v;
+        old = seen;
+    }
+    return old;
+#elif defined( __GNUC__ )
+    unsigned long old = __sync_fetch_and_or(p, 0), seen;
+
+    while(v < old)
+    {
+        seen = __sync_val_compare_and_swap(p, old, v);
+        if(seen == old)
+            return v;
+        old = seen;
+    }
+    return old;
+#else
+    pthread_mutex_lock(&min_lock);
+    if(v < *p)
+        *p = v;
+    v = *p;
+    pthread_mutex_unlock(&min_lock);
+    return v;
+#endif
+}
@@ -0,0 +1,56 @@
+/*  Minimal portable thread support for the MPIR benchmark
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of version 2.1 of the GNU General Public License
+    as published by the Free Software Foundation; it is not distributable
+    under version 3 (or any later version) of the GNU General Public License.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+*/
+
+#ifndef _THREADS_H
+#define _THREADS_H
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+/* a work function: 'arg' is shared by all threads and 'index' is
+   0, 1, .., n_threads - 1
+*/
+typedef void (*thread_fn)(void *arg, unsigned int index);
+
+/* the number of processors available to this process (at least 1) */
+unsigned int num_cores(void);
+
+/* run fn(arg, 0), .., fn(arg, n_threads - 1) concurrently, index 0
+   on the calling thread, and return when all of them have finished
+*/
+void run_threads(thread_fn fn, void *arg, unsigned int n_threads);
+
+/* a set of n_threads - 1 threads kept waiting for work, for jobs that
+   are split into many short passes, where creating and joining threads
+   for each pass would cost more than the pass itself; the pool is
+   created with pool_create (0 if that fails) and each pool_run works
+   as run_threads would on its n_threads
+*/
+typedef struct thread_pool_s thread_pool;
+
+thread_pool *pool_create(unsigned int n_threads);
+void pool_run(thread_pool *p, thread_fn fn, void *arg);
+void pool_destroy(thread_pool *p);
+
+/* set *p to the smaller of *p and v, atomically with respect to the
+   other threads, and return the result
+*/
+unsigned long atomic_min_ul(volatile unsigned long *p, unsigned long v);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -63,6 +63,7 @@
  */
 
 #include "trn.h"
+#include "threads.h"
 
 /* M_EPSILON1 is the convergence tolerance in several calculations. */
 
@@ -73,9 +74,15 @@
    e.g., the global declaration "extern unsigned long ulPrime16[]". */
 
 unsigned long ulDmax=0;  /* tracks global max of Lucas-Selfridge |D| */
-unsigned long ulPrime16[6545];  /* array of 16-bit primes < 65538 */
 long double ldZ[66];  /* Zeta function values zeta(2..65) */
 
+/* The array ulPrime16 of 16-bit primes < 65538, and the inverses and
+   bounds ullPrime16Inv and ullPrime16Lim used for divisibility tests by
+   these primes, are compiled in. They are read-only in practice, need
+   no initialization call, and may be shared freely between threads. */
+
+#include "prm16.h"
+
 /**********************************************************************/
 /**********************************************************************/
 /**********************************************************************/
@@ -1625,22 +1632,575 @@ return;
 /**********************************************************************/
 void vGenPrimes16(void)
 {
-/* Generate from scratch all the primes < 2^16 + 2. There are 6543 such
-   primes, having a sum of 202353624. The array of primes ulPrime16 is
-   global (static) to this code, and must be accessed from the calling
-   code by means of the global declaration "extern unsigned long
-   ulPrime16[]". Do not allocate it or otherwise declare ulPrime16
-   in the calling code. */
+/* The primes < 2^16 + 2 (there are 6543 such primes, having a sum of
+   202353624) are now compiled into the global array ulPrime16 from
+   prm16.h, so there is nothing left to generate. This routine is
+   retained so that existing calling code still links; it no longer
+   writes to ulPrime16, and so is safe to call from any thread. The
+   array must be accessed from the calling code by means of the global
+   declaration "extern unsigned long ulPrime16[]" (or via trn.h). Do
+   not allocate it or otherwise declare ulPrime16 in the calling code. */
+
+return;
+}
+/**********************************************************************/
+/**********************************************************************/
+/*   Segmented, bit-packed, mod-30 wheel Sieve of Eratosthenes        */
+/**********************************************************************/
+/**********************************************************************/
+/* Each byte of a sieve segment represents the thirty integers 30*b + r,
+   0 <= r < 30, with one bit for each of the eight residues r coprime
+   to 30 (bit i for r=uchWheel30[i]). A 32 KiB segment thus spans
+   983040 integers while staying resident in the L1 data cache. The
+   multiples of a sieving prime p are visited in the order p*k, k >= p
+   running through the integers coprime to 30; for a given residue of p
+   mod 30, the bit cleared and the byte advance at each step depend
+   only on k mod 30, and are tabulated below. Multiples of 7, 11, 13
+   and 17 are removed by copying a precomputed pattern, and the position
+   of every other sieving prime is carried from one segment to the
+   next, so the cost per segment is independent of where it lies. */
+
+#define SEG_L1_BYTES   32768UL  /* default segment size (L1 cache) */
+#define SEG_L2_BYTES  262144UL  /* largest segment size (L2 cache) */
+#define SEG_PRESIEVE   17017UL  /* 7*11*13*17, period of the pattern */
+#define PRIME_ITER_MIN 16777216UL  /* narrowest PRIMEITER window */
+
+static const unsigned char uchWheel30[8]={1, 7, 11, 13, 17, 19, 23, 29};
+static const unsigned char uchWheelGap30[8]={6, 4, 2, 4, 2, 4, 6, 2};
+
+/* Index in uchWheel30 of each residue mod 30 (0xFF if not coprime to
+   30), and the distance from each residue to the next coprime one. */
+
+static const unsigned char uchWheelIdx30[30]=
+  {
+  0xFF, 0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 1, 0xFF, 0xFF,
+  0xFF, 2, 0xFF, 3, 0xFF, 0xFF, 0xFF, 4, 0xFF, 5,
+  0xFF, 0xFF, 0xFF, 6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 7
+  };
+static const unsigned char uchWheelNext30[30]=
+  {
+  1, 0, 5, 4, 3, 2, 1, 0, 3, 2, 1, 0, 1, 0, 3, 2, 1, 0, 1, 0,
+  3, 2, 1, 0, 5, 4, 3, 2, 1, 0
+  };
+
+/* With p == uchWheel30[i] and k == uchWheel30[j] (mod 30), the multiple
+   p*k is cleared by uchSeg[b] &= uchMask30[8*i + j], and the next
+   multiple p*(k + uchWheelGap30[j]) lies (p/30)*uchWheelGap30[j]
+   + uchCarry30[8*i + j] bytes further on. */
+
+static const unsigned char uchMask30[64]=
+  {
+  0xFE, 0xFD, 0xFB, 0xF7, 0xEF, 0xDF, 0xBF, 0x7F,
+  0xFD, 0xDF, 0xEF, 0xFE, 0x7F, 0xF7, 0xFB, 0xBF,
+  0xFB, 0xEF, 0xFE, 0xBF, 0xFD, 0x7F, 0xF7, 0xDF,
+  0xF7, 0xFE, 0xBF, 0xDF, 0xFB, 0xFD, 0x7F, 0xEF,
+  0xEF, 0x7F, 0xFD, 0xFB, 0xDF, 0xBF, 0xFE, 0xF7,
+  0xDF, 0xF7, 0x7F, 0xFD, 0xBF, 0xFE, 0xEF, 0xFB,
+  0xBF, 0xFB, 0xF7, 0x7F, 0xFE, 0xEF, 0xDF, 0xFD,
+  0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE
+  };
+static const unsigned char uchCarry30[64]=
+  {
+  0, 0, 0, 0, 0, 0, 0, 1,
+  1, 1, 1, 0, 1, 1, 1, 1,
+  2, 2, 0, 2, 0, 2, 2, 1,
+  3, 1, 1, 2, 1, 1, 3, 1,
+  3, 3, 1, 2, 1, 3, 3, 1,
+  4, 2, 2, 2, 2, 2, 4, 1,
+  5, 3, 1, 4, 1, 3, 5, 1,
+  6, 4, 2, 4, 2, 4, 6, 1
+  };
+
+/**********************************************************************/
+static unsigned long ulPopCount(const unsigned char *uch,
+  unsigned long ulBytes)
+{
+/* Number of bits set in the ulBytes bytes at uch. */
+
+uint64_t ull;
+unsigned long ul, ulCount=0;
+unsigned char uchB;
+
+for(ul=0; ul + 8 <= ulBytes; ul += 8)
+  {
+  memcpy(&ull, uch + ul, 8);
+  ull=ull - ((ull >> 1) & __ULL(0x5555555555555555));
+  ull=(ull & __ULL(0x3333333333333333))
+    + ((ull >> 2) & __ULL(0x3333333333333333));
+  ull=(ull + (ull >> 4)) & __ULL(0x0F0F0F0F0F0F0F0F);
+  ulCount += (unsigned long)((ull*__ULL(0x0101010101010101)) >> 56);
+  }
+for(; ul < ulBytes; ul++)
+  for(uchB=uch[ul]; uchB; uchB &= uchB - 1)ulCount++;
+return(ulCount);
+}
+/**********************************************************************/
+static void vSegSieveAddPrime(SEGSIEVE *pss, uint64_t ullP)
+{
+/* Adds the prime ullP >= 19 to the sieving primes of pss, positioned
+   at its first multiple p*k >= max(p^2, start of the current segment)
+   with k coprime to 30. Primes having no such multiple <= ullUB are
+   not retained. */
+
+uint64_t ullK;
+SIEVEPRIME *psp;
+
+ullK=30*pss->ullByte/ullP;
+if(ullK*ullP < 30*pss->ullByte)ullK++;
+if(ullK < ullP)ullK=ullP;
+ullK += uchWheelNext30[ullK%30];
+if(ullK > pss->ullUB/ullP)return;
+
+if(pss->nSP==pss->nSPAlloc)
+  {
+  pss->nSPAlloc=2*pss->nSPAlloc + 1024;
+  pss->pSP=(SIEVEPRIME *)realloc(pss->pSP,
+    pss->nSPAlloc*sizeof(SIEVEPRIME));
+  if(!pss->pSP)
+    {
+    fprintf(stderr, "\n ERROR: realloc failed in vSegSieveAddPrime.\n");
+    exit(EXIT_FAILURE);
+    }
+  }
+psp=pss->pSP + pss->nSP++;
+psp->ullOff=(ullP*ullK)/30 - pss->ullByte;
+psp->ulQ=(uint32_t)(ullP/30);
+psp->uchP=uchWheelIdx30[ullP%30];
+psp->uchK=uchWheelIdx30[ullK%30];
+return;
+}
+/**********************************************************************/
+void vSegSieveInit(SEGSIEVE *pss, uint64_t ullLB, uint64_t ullUB,
+  unsigned long ulSegBytes)
+{
+/* Prepares pss to sieve the integers ullLB..ullUB (7 <= ullLB <= ullUB)
+   one segment at a time with iSegSieveNext. The primes 2, 3, and 5 are
+   not represented by the wheel and are left to the caller. If
+   ulSegBytes is zero, segments of 32 KiB (L1-sized) are used, growing
+   towards 256 KiB (L2-sized) when sqrt(ullUB)/30 is larger, so that
+   the largest sieving primes still hit most segments.
+
+   Memory use is one segment plus 16 bytes per prime <= sqrt(ullUB),
+   independent of ullUB - ullLB. Sieving primes < 2^16 are taken from
+   ulPrime16; larger ones are produced by a second, nested segmented
+   sieve, so that no array of primes is ever materialized. */
+
+SEGSIEVE ss2;
+uint64_t ullSqrt, ullM;
+unsigned long ul, ulP;
+
+memset(pss, 0, sizeof(SEGSIEVE));
+if(ullLB < 7)ullLB=7;
+pss->ullLB=ullLB;
+pss->ullUB=ullUB;
+pss->ullByte=ullLB/30;
+pss->ullLastByte=ullUB/30;
+ullSqrt=ulSqrt(ullUB);
+
+if(ulSegBytes==0)
+  {
+  ulSegBytes=SEG_L1_BYTES;
+  while((ulSegBytes < SEG_L2_BYTES) && (ulSegBytes < ullSqrt/30))
+    ulSegBytes *= 2;
+  }
+if(ulSegBytes > pss->ullLastByte - pss->ullByte + 1)
+  ulSegBytes=pss->ullLastByte - pss->ullByte + 1;
+pss->ulSegBytes=ulSegBytes;
+pss->uchSeg=(unsigned char *)malloc(ulSegBytes);
+pss->uchPre=(unsigned char *)malloc(SEG_PRESIEVE);
+if(!pss->uchSeg || !pss->uchPre)
+  {
+  fprintf(stderr, "\n ERROR: malloc failed in vSegSieveInit.\n");
+  exit(EXIT_FAILURE);
+  }
+
+/* The presieve pattern has period 7*11*13*17 bytes. */
+
+memset(pss->uchPre, 0xFF, SEG_PRESIEVE);
+for(ul=4; ul <= 7; ul++)
+  {
+  ulP=ulPrime16[ul];
+  for(ullM=ulP; ullM < 30*SEG_PRESIEVE; ullM += 2*ulP)
+    if(uchWheelIdx30[ullM%30] != 0xFF)
+      pss->uchPre[ullM/30] &= ~(1 << uchWheelIdx30[ullM%30]);
+  }
+
+/* Sieving primes from 19 up to sqrt(ullUB). */
+
+for(ul=8; ul <= NUM_16BIT_PRIMES + 1; ul++)
+  {
+  if(ulPrime16[ul] > ullSqrt)return;
+  vSegSieveAddPrime(pss, ulPrime16[ul]);
+  }
+if(ullSqrt < 65539UL)return;
+vSegSieveInit(&ss2, 65539UL, ullSqrt, 0);
+while(iSegSieveNext(&ss2))
+  for(ul=0; ul < ss2.ulBytes; ul++)
+    for(ulP=0; ulP < 8; ulP++)
+      if(ss2.uchSeg[ul] & (1 << ulP))
+        vSegSieveAddPrime(pss, 30*(ss2.ullByte + ul) + uchWheel30[ulP]);
+vSegSieveClear(&ss2);
+return;
+}
+/**********************************************************************/
+int iSegSieveNext(SEGSIEVE *pss)
+{
+/* Sieves the next segment of pss. Returns zero when the range is
+   exhausted; otherwise pss->uchSeg[0..pss->ulBytes-1] then holds the
+   primality bits of the integers 30*(pss->ullByte + b) + uchWheel30[i]
+   (bit i of byte b), restricted to pss->ullLB..pss->ullUB. */
+
+unsigned char *uchSeg;
+uint64_t ullOff;
+unsigned long ulBytes, ulPhase, ul, ulQ, ulI;
+unsigned int k;
+SIEVEPRIME *psp, *pspEnd;
+
+if(pss->iStarted)pss->ullByte += pss->ulBytes;
+pss->iStarted=1;
+pss->ulBytes=0;
+if(pss->ullByte > pss->ullLastByte)return(0);
+ulBytes=pss->ulSegBytes;
+if(ulBytes > pss->ullLastByte - pss->ullByte + 1)
+  ulBytes=pss->ullLastByte - pss->ullByte + 1;
+uchSeg=pss->uchSeg;
+
+/* Copy in the presieve pattern for 7, 11, 13, and 17, restoring those
+   primes themselves (and removing 1) in the very first byte. */
+
+ulPhase=pss->ullByte%SEG_PRESIEVE;
+for(ul=0; ul < ulBytes; ul += ulI)
+  {
+  ulI=SEG_PRESIEVE - ulPhase;
+  if(ulI > ulBytes - ul)ulI=ulBytes - ul;
+  memcpy(uchSeg + ul, pss->uchPre + ulPhase, ulI);
+  ulPhase=0;
+  }
+if(pss->ullByte==0)uchSeg[0]=(uchSeg[0] | 0x1E) & 0xFE;
+
+/* Cross off the multiples of the remaining sieving primes. */
+
+pspEnd=pss->pSP + pss->nSP;
+for(psp=pss->pSP; psp < pspEnd; psp++)
+  {
+  ullOff=psp->ullOff;
+  if(ullOff >= ulBytes)
+    {
+    psp->ullOff=ullOff - ulBytes;
+    continue;
+    }
+  ulQ=psp->ulQ;
+  ulI=8*psp->uchP;
+  k=psp->uchK;
+  do
+    {
+    uchSeg[ullOff] &= uchMask30[ulI + k];
+    ullOff += ulQ*uchWheelGap30[k] + uchCarry30[ulI + k];
+    k=(k + 1) & 7;
+    }
+  while(ullOff < ulBytes);
+  psp->ullOff=ullOff - ulBytes;
+  psp->uchK=k;
+  }
+
+/* Trim the first and last bytes to the requested bounds. */
+
+if(pss->ullByte==pss->ullLB/30)
+  for(ul=0; ul < 8; ul++)
+    if(uchWheel30[ul] < pss->ullLB - 30*pss->ullByte)
+      uchSeg[0] &= ~(1 << ul);
+if(pss->ullByte + ulBytes - 1==pss->ullLastByte)
+  for(ul=0; ul < 8; ul++)
+    if(uchWheel30[ul] > pss->ullUB - 30*pss->ullLastByte)
+      uchSeg[ulBytes - 1] &= ~(1 << ul);
+
+pss->ulBytes=ulBytes;
+return(1);
+}
+/**********************************************************************/
+void vSegSieveClear(SEGSIEVE *pss)
+{
+free(pss->uchSeg);
+free(pss->uchPre);
+free(pss->pSP);
+memset(pss, 0, sizeof(SEGSIEVE));
+return;
+}
+/**********************************************************************/
+uint64_t ullPrimeCount(uint64_t ullLB, uint64_t ullUB)
+{
+/* Returns the number of primes p with ullLB <= p <= ullUB, counted by
+   the segmented sieve. Any 64-bit bounds are accepted; the time is
+   roughly proportional to ullUB - ullLB plus pi(sqrt(ullUB)), and the
+   memory to pi(sqrt(ullUB)). */
+
+SEGSIEVE ss;
+uint64_t ullCount=0;
+
+if(ullUB < ullLB)return(0);
+if((ullLB <= 2) && (ullUB >= 2))ullCount++;
+if((ullLB <= 3) && (ullUB >= 3))ullCount++;
+if((ullLB <= 5) && (ullUB >= 5))ullCount++;
+if(ullUB < 7)return(ullCount);
+
+vSegSieveInit(&ss, ullLB, ullUB, 0);
+while(iSegSieveNext(&ss))ullCount += ulPopCount(ss.uchSeg, ss.ulBytes);
+vSegSieveClear(&ss);
+return(ullCount);
+}
+/**********************************************************************/
+void vPrimeIterInit(PRIMEITER *ppi, uint64_t ullLB, uint64_t ullUB)
+{
+/* Prepares ppi to return, by successive calls to ullPrimeIterNext, the
+   primes p with ullLB <= p <= ullUB in increasing order. Use
+   ullUB=UINT64_MAX for no upper bound.
+
+   The primes are sieved in windows [x, 2x] (at least PRIME_ITER_MIN
+   wide), each by a SEGSIEVE, and are never stored; memory use is one
+   sieve segment plus the sieving primes <= sqrt(2x), however many
+   primes are returned. */
+
+memset(ppi, 0, sizeof(PRIMEITER));
+ppi->ullNext=ullLB;
+ppi->ullUB=ullUB;
+ppi->iDone=(ullLB > ullUB);
+return;
+}
+/**********************************************************************/
+uint64_t ullPrimeIterNext(PRIMEITER *ppi)
+{
+/* Returns the next prime of ppi, or zero when there are no more. */
+
+static const unsigned char uchSmall[3]={2, 3, 5};
+uint64_t ullW, ullHi;
+unsigned long ul;
+unsigned char uch;
+
+if(ppi->ullNext < 7)
+  {
+  for(ul=0; ul < 3; ul++)
+    {
+    if(uchSmall[ul] < ppi->ullNext)continue;
+    if(uchSmall[ul] > ppi->ullUB)break;
+    ppi->ullNext=uchSmall[ul] + 1;
+    return(uchSmall[ul]);
+    }
+  ppi->ullNext=7;
+  if(ppi->ullUB < 7)ppi->iDone=1;
+  }
+
+while(ppi->uchBits==0)
+  {
+  if(++ppi->ulByte < ppi->ss.ulBytes)
+    {
+    ppi->uchBits=ppi->ss.uchSeg[ppi->ulByte];
+    continue;
+    }
+  ppi->ulByte=(unsigned long)-1;
+  if(ppi->iActive && iSegSieveNext(&ppi->ss))continue;
+
+  /* The current window is exhausted; open the next. */
+
+  if(ppi->iActive)vSegSieveClear(&ppi->ss);
+  ppi->iActive=0;
+  if(ppi->iDone)return(0);
+  ullW=ppi->ullNext;
+  if(ullW < PRIME_ITER_MIN)ullW=PRIME_ITER_MIN;
+  if(ppi->ullUB - ppi->ullNext < ullW)
+    {
+    ullHi=ppi->ullUB;
+    ppi->iDone=1;
+    }
+  else
+    ullHi=ppi->ullNext + ullW - 1;
+  vSegSieveInit(&ppi->ss, ppi->ullNext, ullHi, 0);
+  ppi->iActive=1;
+  if(!ppi->iDone)ppi->ullNext=ullHi + 1;
+  }
+
+for(ul=0, uch=ppi->uchBits; !(uch & 1); ul++)uch >>= 1;
+ppi->uchBits &= ppi->uchBits - 1;
+return(30*(ppi->ss.ullByte + ppi->ulByte) + uchWheel30[ul]);
+}
+/**********************************************************************/
+void vPrimeIterClear(PRIMEITER *ppi)
+{
+if(ppi->iActive)vSegSieveClear(&ppi->ss);
+memset(ppi, 0, sizeof(PRIMEITER));
+return;
+}
+/**********************************************************************/
+/* Multi-threaded segmented sieving. The interval is cut into nThreads
+   contiguous slices of equal width, and each slice is sieved on its
+   own thread (see threads.c) by its own SEGSIEVE. The sieve shares
+   only read-only tables between threads, so no locking is needed.
+   Each slice repeats the setup of the sieving primes <= sqrt(ullUB),
+   which is negligible unless the slices are very narrow. */
 
-unsigned long nPrimes, ulUB;
+typedef struct
+  {
+  uint64_t        ullLB, ullUB;  /* whole interval, inclusive */
+  unsigned int    nThreads;
+  uint64_t       *pullCount;     /* primes found in each slice */
+  unsigned long **pulPrime;      /* primes of each slice, or NULL */
+  } SIEVEJOB;
 
-nPrimes=6543;
-ulUB=65537UL;
-vGenPrimesDiv(ulPrime16, &nPrimes, &ulUB);
+#define SEG_MT_MIN 1000000UL  /* narrower intervals use one thread */
 
+/**********************************************************************/
+static int iSieveSlice(SIEVEJOB *psj, unsigned int i, uint64_t *pullLB,
+  uint64_t *pullUB)
+{
+/* Sets *pullLB and *pullUB to the bounds of the ith slice of psj,
+   returning zero if that slice is empty. Slice widths are multiples of
+   30 and the arithmetic avoids overflow near 2^64. */
+
+uint64_t ullW, ullOff;
+
+ullW=30*((psj->ullUB - psj->ullLB)/(30*(uint64_t)psj->nThreads) + 1);
+ullOff=ullW*i;
+if(ullOff > psj->ullUB - psj->ullLB)return(0);
+*pullLB=psj->ullLB + ullOff;
+if(ullW - 1 >= psj->ullUB - *pullLB)
+  *pullUB=psj->ullUB;
+else
+  *pullUB=*pullLB + ullW - 1;
+return(1);
+}
+/**********************************************************************/
+static void vSieveSlice(void *pv, unsigned int i)
+{
+/* Thread body: counts, or counts and lists, the primes >= 7 in the ith
+   slice. */
+
+SIEVEJOB *psj=(SIEVEJOB *)pv;
+SEGSIEVE ss;
+uint64_t ullLB, ullUB, ullCount=0;
+unsigned long *ulP=NULL, nAlloc=0, ul, ulBit;
+unsigned char uch;
+
+psj->pullCount[i]=0;
+if(psj->pulPrime)psj->pulPrime[i]=NULL;
+if(!iSieveSlice(psj, i, &ullLB, &ullUB))return;
+if(ullUB < 7)return;
+if(ullLB < 7)ullLB=7;
+
+vSegSieveInit(&ss, ullLB, ullUB, 0);
+while(iSegSieveNext(&ss))
+  {
+  if(!psj->pulPrime)
+    {
+    ullCount += ulPopCount(ss.uchSeg, ss.ulBytes);
+    continue;
+    }
+  if(ullCount + 8*ss.ulBytes > nAlloc)
+    {
+    nAlloc=2*nAlloc + 8*ss.ulBytes;
+    ulP=(unsigned long *)realloc(ulP, nAlloc*sizeof(unsigned long));
+    if(!ulP)
+      {
+      fprintf(stderr, "\n ERROR: realloc failed in vSieveSlice.\n");
+      exit(EXIT_FAILURE);
+      }
+    }
+  for(ul=0; ul < ss.ulBytes; ul++)
+    {
+    uch=ss.uchSeg[ul];
+    for(ulBit=0; uch; ulBit++, uch >>= 1)
+      if(uch & 1)
+        ulP[ullCount++]=30*(ss.ullByte + ul) + uchWheel30[ulBit];
+    }
+  }
+vSegSieveClear(&ss);
+psj->pullCount[i]=ullCount;
+if(psj->pulPrime)psj->pulPrime[i]=ulP;
 return;
 }
 /**********************************************************************/
+static void vSieveJob(SIEVEJOB *psj, uint64_t ullLB, uint64_t ullUB,
+  unsigned int nThreads, int iList)
+{
+/* Runs the slices of ullLB..ullUB on nThreads threads, keeping the
+   prime lists if iList is nonzero. */
+
+psj->ullLB=ullLB;
+psj->ullUB=ullUB;
+psj->nThreads=nThreads;
+psj->pullCount=(uint64_t *)malloc(nThreads*sizeof(uint64_t));
+psj->pulPrime=NULL;
+if(iList)
+  psj->pulPrime=(unsigned long **)malloc(nThreads*sizeof(unsigned long *));
+if(!psj->pullCount || (iList && !psj->pulPrime))
+  {
+  fprintf(stderr, "\n ERROR: malloc failed in vSieveJob.\n");
+  exit(EXIT_FAILURE);
+  }
+run_threads(vSieveSlice, psj, nThreads);
+return;
+}
+/**********************************************************************/
+uint64_t ullPrimeCountMT(uint64_t ullLB, uint64_t ullUB,
+  unsigned int nThreads)
+{
+/* As ullPrimeCount, but spreading the sieving over nThreads threads
+   (all available cores if nThreads is zero). */
+
+SIEVEJOB sj;
+uint64_t ullCount=0;
+unsigned int i;
+
+if(nThreads==0)nThreads=num_cores();
+if(ullUB < ullLB)return(0);
+if((nThreads < 2) || (ullUB - ullLB < SEG_MT_MIN))
+  return(ullPrimeCount(ullLB, ullUB));
+
+if((ullLB <= 2) && (ullUB >= 2))ullCount++;
+if((ullLB <= 3) && (ullUB >= 3))ullCount++;
+if((ullLB <= 5) && (ullUB >= 5))ullCount++;
+
+vSieveJob(&sj, ullLB, ullUB, nThreads, 0);
+for(i=0; i < nThreads; i++)ullCount += sj.pullCount[i];
+free(sj.pullCount);
+return(ullCount);
+}
+/**********************************************************************/
+static uint64_t ullGenPrimesBound(unsigned long *nPrimes,
+  unsigned long *ulUB)
+{
+/* Enforces the limits on *nPrimes and *ulUB documented in
+   vGenPrimesSieve, and returns a bound which is at least *ulUB and at
+   least the (*nPrimes)th prime, but not above the largest 32-bit prime. */
+
+uint64_t ullUB0;
+unsigned long nP;
+long double ldUB, lognP;
+
+/* Adjust the bounds. */
+
+if(*ulUB > UINT32_MAX - 4)*ulUB=UINT32_MAX - 4;  /* Largest 32-bit prime */
+if(*nPrimes > NUM_32BIT_PRIMES)*nPrimes=NUM_32BIT_PRIMES;
+if(*ulUB < 65537UL)*ulUB=65537UL;
+if(*nPrimes < 6543)*nPrimes=6543;
+
+/* The following formulas, due to J. B. Rosser (1983) and G. Robin (1983),
+   provide upper bounds for the (*nPrimes)th prime. See "The new book
+   of prime number records," Paulo Ribenboim (Springer, 1995). */
+
+ullUB0=*ulUB;
+nP=*nPrimes;
+if(nP > 6543)
+  {
+  lognP=logl(nP);
+  if(nP < 7022)
+    ldUB=nP*(lognP + logl(lognP) + 8);
+  else
+    ldUB=nP*(lognP + logl(lognP) - 0.9385);
+  if(ldUB > ullUB0)ullUB0=ceill(ldUB);
+  }
+if(ullUB0 > UINT32_MAX - 4)ullUB0=UINT32_MAX - 4;
+return(ullUB0);
+}
+/**********************************************************************/
 void vGenPrimesSieve(unsigned long *ulPrime, unsigned long *nPrimes,
   unsigned long *ulUB)
 {
@@ -1662,142 +2222,96 @@ void vGenPrimesSieve(unsigned long *ulPrime, unsigned long *nPrimes,
    and *nPrimes may not exceed the number of 32-bit primes. Minimum
    values are also enforced, *ulUB=65537 and *nPrimes=6543.
 
-   This algorithm bootstraps some base primes by first calling
-   vGenPrimesDiv, which does not use sieving, to establish a base set.
-   An array allocated for use as a sieve is then used to generate
-   succeeding blocks of primes by assigning successive odd integers to
-   the elements of the sieving array. The base primes, bootstrapped by
-   use of trial divisors, are required for sieving the first block. Each
-   sieving then generates more than enough new primes to sieve the
-   succeeding block.
+   The sieving is done by the segmented mod-30 wheel sieve (see
+   vSegSieveInit), one cache-sized segment at a time, so that apart
+   from ulPrime itself the memory required is small and independent
+   of *ulUB. The 64-bit routine ullPrimeCount uses the same sieve
+   without the 32-bit restrictions.
 */
 
-unsigned char *uchSieve;
-unsigned long nPrimes0, ulLB0, ulUB0, ulPMA, ulSpan, ulOffset,
-  ulOffsetMax, ulN, ulSieveBytes, ulLB0In, ulUB0In, nP;
-long double ldSB, ldSB1, ldSB2, lognP;
-
-/* Adjust the bounds. */
+SEGSIEVE ss;
+uint64_t ullUB0;
+unsigned long nP, ulN, ul, ulBit;
+unsigned char uch;
 
-if(*ulUB > UINT32_MAX - 4)*ulUB=UINT32_MAX - 4;  /* Largest 32-bit prime */
-if(*nPrimes > NUM_32BIT_PRIMES)*nPrimes=NUM_32BIT_PRIMES;
-if(*ulUB < 65537UL)*ulUB=65537UL;
-if(*nPrimes < 6543)*nPrimes=6543;
+ullUB0=ullGenPrimesBound(nPrimes, ulUB);
 
-/* Allocate memory for the sieving array. The size in bytes needs to
-   be half the size of the interval to be sieved; a smaller size
-   will cause iterations of the sieving process. */
+ulPrime[0]=0;  /* 0th prime---just a marker */
+ulPrime[1]=2;
+ulPrime[2]=3;
+ulPrime[3]=5;
+nP=3;
 
-ulPMA=__ulPhysicalMemoryAvailable() & 0xFFFFFFFE;  /* ulPMA is even */
-ulSieveBytes=ulPMA/2;  /* Use no more than half the available memory */
-/* Use even less if this exceeds half the projected upper bound */
-ldSB1=(*ulUB + 1)/2 + 1;
-/* The following formulas, due to J. B. Rosser (1983) and G. Robin (1983),
-   provide upper bounds for the (*nPrimes)th prime. See "The new book
-   of prime number records," Paulo Ribenboim (Springer, 1995). */
-nP=*nPrimes;
-if(nP > 6543)
-  {
-  lognP=logl(nP);
-  if(nP < 7022)
-    ldSB2=nP*(lognP + logl(lognP) + 8)/2 + 2;
-  else
-    ldSB2=nP*(lognP + logl(lognP) - 0.9385)/2 + 2;
-  }
-if(ldSB2 > ldSB1)ldSB=ldSB2; else ldSB=ldSB1;
-if(ldSB < ulSieveBytes)ulSieveBytes=ceill(ldSB);
-uchSieve=(unsigned char *)malloc(ulSieveBytes);
-while(!uchSieve)
+vSegSieveInit(&ss, 7, ullUB0, 0);
+while(iSegSieveNext(&ss))
   {
-  ulSieveBytes=ulSieveBytes/2;
-  if(ulSieveBytes < 32000)
+  for(ul=0; ul < ss.ulBytes; ul++)
     {
-    fprintf(stderr,
-      "\n ERROR: uchSieve malloc failed in vGenPrimesSieve.\n");
-    exit(EXIT_FAILURE);
+    uch=ss.uchSeg[ul];
+    for(ulBit=0; uch; ulBit++, uch >>= 1)
+      {
+      if(!(uch & 1))continue;
+      ulN=30*(ss.ullByte + ul) + uchWheel30[ulBit];
+      if((ulN > *ulUB) && (nP >= *nPrimes))goto DONE_vGP;
+      ulPrime[++nP]=ulN;
+      }
     }
-  uchSieve=(unsigned char *)malloc(ulSieveBytes);
-  }
-if(!uchSieve)
-  {
-  fprintf(stderr, "\n ERROR: uchSieve malloc failed in vGenPrimesSieve.\n");
-  exit(EXIT_FAILURE);
   }
-ulSpan=2*ulSieveBytes-2;  /* ulSpan is even */
 
-/* Bootstrap the primes necessary for the initial sieve (to at least
-   the next prime beyond the square root of the first sieve upper bound). */
-
-nPrimes0=0;
-ulUB0=1442 + ceil(sqrt(3 + 2*ulSieveBytes));  /* No gap > 1442 below 1e18 */
-ulUB0=ulUB0 + (ulUB0 & 1);
-vGenPrimesDiv(ulPrime, &nPrimes0, &ulUB0);
+DONE_vGP:
 
-if((nPrimes0 >= *nPrimes) && (ulUB0 >= *ulUB))
+vSegSieveClear(&ss);
+ulPrime[nP+1]=0;  /* end marker */
+*nPrimes=nP;
+*ulUB=ulPrime[nP];
+return;
+}
+/**********************************************************************/
+void vGenPrimesSieveMT(unsigned long *ulPrime, unsigned long *nPrimes,
+  unsigned long *ulUB, unsigned int nThreads)
+{
+/* As vGenPrimesSieve, with the same arguments, limits, and return
+   values, but sieving on nThreads threads (all available cores if
+   nThreads is zero). Each thread lists the primes of its own slice,
+   and the lists are then merged in order into ulPrime; this needs
+   temporary storage of about the same size as ulPrime itself. */
+
+SIEVEJOB sj;
+uint64_t ullUB0, ull;
+unsigned long nP, *ulP;
+unsigned int i;
+
+if(nThreads==0)nThreads=num_cores();
+if(nThreads < 2)
   {
-  *nPrimes=nPrimes0;
-  *ulUB=ulUB0;
-  goto DONE_vGP;
+  vGenPrimesSieve(ulPrime, nPrimes, ulUB);
+  return;
   }
 
-ulLB0=3;  /* Bootstrap primes will be regenerated---avoids complications */
-nPrimes0=1;  /* Even prime 2 is an exception */
-while(1)
+ullUB0=ullGenPrimesBound(nPrimes, ulUB);
+vSieveJob(&sj, 7, ullUB0, nThreads, 1);
+
+ulPrime[0]=0;  /* 0th prime---just a marker */
+ulPrime[1]=2;
+ulPrime[2]=3;
+ulPrime[3]=5;
+nP=3;
+for(i=0; i < nThreads; i++)
   {
-  if(ulLB0 + (uint64_t)ulSpan > (uint64_t)UINT32_MAX - 4)
-    {                      /* overflow trap */
-    ulUB0=UINT32_MAX - 4;
-    if(ulUB0==ulLB0)
-      {
-      nPrimes0++;
-      *nPrimes=nPrimes0;
-      *ulUB=ulUB0;
-      break;
-      }
-    if(ulUB0 < ulLB0)
-      {
-      *nPrimes=nPrimes0;
-      *ulUB=ulUB0;
-      break;
-      }
-    ulSpan=ulUB0 - ulLB0;
-    }
-  else  /* normal case */
-    {
-    ulUB0=ulLB0 + ulSpan;
-    ulOffsetMax=ulSpan/2;
-    }
-  ulLB0In=ulLB0;
-  ulUB0In=ulUB0;
-  vSieve(uchSieve, &ulLB0, &ulUB0, ulPrime);
-  if((ulLB0In != ulLB0) || (ulUB0In != ulUB0))
-    {
-    fprintf(stderr, "\n ERROR, Bounds anomaly in call to vSieve:");
-    fprintf(stderr, "\n LB==> %lu to %lu    UB==> %lu to %lu\n",
-      ulLB0In, ulLB0, ulUB0In, ulUB0);
-    exit(EXIT_FAILURE);
-    }
-  ulOffset=0;
-  ulN=ulLB0;
-  while(1)
+  ulP=sj.pulPrime[i];
+  for(ull=0; ull < sj.pullCount[i]; ull++)
     {
-    if(uchSieve[ulOffset])ulPrime[++nPrimes0]=ulN;
-    ulN += 2;  /* ulN is odd */
-    if((ulN > *ulUB) && (nPrimes0 >= *nPrimes))
-      {
-      *nPrimes=nPrimes0;
-      *ulUB=ulPrime[nPrimes0];
-      goto DONE_vGP;
-      }
-    ulOffset++;
-    if(ulOffset > ulOffsetMax)break;
+    if((ulP[ull] > *ulUB) && (nP >= *nPrimes))break;
+    ulPrime[++nP]=ulP[ull];
     }
-  ulLB0=ulN;
+  free(ulP);
   }
+free(sj.pulPrime);
+free(sj.pullCount);
 
-DONE_vGP:
-
-free(uchSieve);
+ulPrime[nP+1]=0;  /* end marker */
+*nPrimes=nP;
+*ulUB=ulPrime[nP];
 return;
 }
 /**********************************************************************/
@@ -1866,64 +2380,283 @@ int iIsPrime32(unsigned long ulN)
 /* Returns 1 if ulN is prime, zero otherwise. No sieving is used. The
    routine simply checks for prime divisors up to the sqrt of ulN. */
 
-unsigned long ulSqrtN, ul=2, ulDiv;
+unsigned long ulSqrtN, ul, ulDiv;
 
 if((ulN < 3) || ((ulN & 1)==0))return(ulN==2 ? 1 : 0);
-if(ulPrime16[6543] != 65537UL)vGenPrimes16();
 ulSqrtN=ulSqrt(ulN);
 
-while(1)
+for(ul=2; ; ul++)
   {
-  ulDiv=ulPrime16[ul++];
+  ulDiv=ulPrime16[ul];
   if(ulDiv > ulSqrtN)return(1);
-  if(ulN%ulDiv==0)return(0);
+  if(__DIVISIBLE16(ulN, ul))return(0);
   }
 }
 /**********************************************************************/
-#ifdef __MPIR__
+#ifdef __SIZEOF_INT128__
 /**********************************************************************/
-int iIsPrime64(uint64_t ullN, unsigned long ulMaxDivisor)
-{
-/* Returns 1 if ullN is prime, zero otherwise.  No sieving is used.
-   The routine checks for prime divisors up to the smaller of the
-   sqrt of ullN or ulMaxDivisor. If no prime divisor is found, and
-   N > ulMaxDivisor^2 exceeds 2^32, the strong BPSW primality test
-   is invoked. If 0 or 1 is specified for ulMaxDivisor, a default
-   value of 1000 is used. */
-
-int                iPrime;
-unsigned long	   ulSqrtN, ul=2, ulDiv;
-mpz_t              mpzN;
+/* Single-word Montgomery arithmetic modulo an odd N < 2^64, using the
+   compiler's unsigned __int128 for the double-word products. A residue
+   a is held as a*2^64 mod N, fully reduced; ullNinv is 1/N mod 2^64. */
 
-if((ullN < 3) || ((ullN & 1)==0))return(ullN==2 ? 1 : 0);
-if(ulPrime16[6543] != 65537UL)vGenPrimes16();
+typedef unsigned __int128 uint128_t;
 
-if(ulMaxDivisor < 2)ulMaxDivisor=1000UL;
-if(ulMaxDivisor > 65536UL)ulMaxDivisor=65536UL;
+static uint64_t ullInv64(uint64_t ullN)
+{
+/* 1/N mod 2^64 by Newton's iteration; N*N=1 mod 8 gives three bits,
+   and each step doubles them. */
 
-ulSqrtN=ulSqrt(ullN);
-while(1)
-  {
-  ulDiv=ulPrime16[ul++];
-  if(ulDiv > ulSqrtN)return(1);
-  if(ulDiv > ulMaxDivisor)break;
-  if(ullN%ulDiv==0)return(0);
-  }
+uint64_t ullX=ullN;
+int i;
 
-/* If there are no small prime divisors, we use the strong BPSW test
-   for primality. */
+for(i=0; i < 5; i++)ullX *= 2 - ullN*ullX;
+return(ullX);
+}
+/**********************************************************************/
+static uint64_t ullMontMul64(uint64_t ullA, uint64_t ullB, uint64_t ullN,
+  uint64_t ullNinv)
+{
+/* A*B/2^64 mod N. Since the low words of A*B and M*N agree, the high
+   words can be subtracted, which avoids the carry out of A*B + M*N
+   when N > 2^63. */
+
+uint128_t ulllT;
+uint64_t ullM, ullHi, ullMN;
+
+ulllT=(uint128_t)ullA*ullB;
+ullM=(uint64_t)ulllT*ullNinv;
+ullMN=(uint64_t)(((uint128_t)ullM*ullN) >> 64);
+ullHi=(uint64_t)(ulllT >> 64);
+return(ullHi < ullMN ? ullHi - ullMN + ullN : ullHi - ullMN);
+}
+/**********************************************************************/
+static uint64_t ullToMont64(uint64_t ullA, uint64_t ullN)
+{
+return((uint64_t)(((uint128_t)(ullA % ullN) << 64) % ullN));
+}
+/**********************************************************************/
+static uint64_t ullAddMod64(uint64_t ullA, uint64_t ullB, uint64_t ullN)
+{
+uint64_t ullS=ullA + ullB;
 
-mpz_init2(mpzN, 2*mp_bits_per_limb);
-__mpz_set_ull(mpzN, ullN);
-iPrime=iPrP(mpzN, 1, 2);
-mpz_clear(mpzN);
-return(iPrime);
+if((ullS < ullA) || (ullS >= ullN))ullS -= ullN;
+return(ullS);
 }
 /**********************************************************************/
-int iPrP(mpz_t mpzN, unsigned long ulNMR, unsigned long ulMaxDivisor)
+static uint64_t ullSubMod64(uint64_t ullA, uint64_t ullB, uint64_t ullN)
 {
-/* Returns 1 if mpzN is a probable prime according to the strong
- * modified Baillie-PSW test.
+return(ullA >= ullB ? ullA - ullB : ullA - ullB + ullN);
+}
+/**********************************************************************/
+static uint64_t ullHalfMod64(uint64_t ullA, uint64_t ullN)
+{
+return((ullA & 1) ? (ullA >> 1) + (ullN >> 1) + 1 : ullA >> 1);
+}
+/**********************************************************************/
+static int iJacobi64(int64_t sllA, uint64_t ullN)
+{
+/* Jacobi(A,N) for odd N > 0. */
+
+uint64_t ullA, ullT;
+int iJ=1;
+
+ullA=(uint64_t)(sllA < 0 ? -sllA : sllA) % ullN;
+if((sllA < 0) && ((ullN & 3)==3))iJ=-iJ;
+while(ullA)
+  {
+  while((ullA & 1)==0)
+    {
+    ullA >>= 1;
+    if(((ullN & 7)==3) || ((ullN & 7)==5))iJ=-iJ;
+    }
+  ullT=ullA;
+  ullA=ullN;
+  ullN=ullT;
+  if(((ullA & 3)==3) && ((ullN & 3)==3))iJ=-iJ;
+  ullA %= ullN;
+  }
+return(ullN==1 ? iJ : 0);
+}
+/**********************************************************************/
+int iMillerRabin64(uint64_t ullN, uint64_t ullB)
+{
+/* The Miller-Rabin strong probable prime test of N < 2^64 with base B,
+   in single-word Montgomery arithmetic. Returns 1 if N is a prime or a
+   base-B strong probable prime (or if N divides B), and 0 if N is
+   definitely composite. */
+
+uint64_t ullNinv, ullOne, ullMinusOne, ullB1, ullX, ullD;
+int i, iS;
+
+if((ullN < 3) || ((ullN & 1)==0))return(ullN==2 ? 1 : 0);
+if(ullB % ullN==0)return(1);
+
+ullNinv=ullInv64(ullN);
+ullOne=ullToMont64(1, ullN);
+ullMinusOne=ullN - ullOne;
+
+/* N - 1 = d*2^s with d odd; B^d by left-to-right binary powering. */
+
+ullD=ullN - 1;
+for(iS=0; (ullD & 1)==0; iS++)ullD >>= 1;
+ullB1=ullToMont64(ullB, ullN);
+ullX=ullB1;
+for(i=63; ((ullD >> i) & 1)==0; i--);
+while(i-- > 0)
+  {
+  ullX=ullMontMul64(ullX, ullX, ullN, ullNinv);
+  if((ullD >> i) & 1)ullX=ullMontMul64(ullX, ullB1, ullN, ullNinv);
+  }
+
+if((ullX==ullOne) || (ullX==ullMinusOne))return(1);
+for(i=1; i < iS; i++)
+  {
+  ullX=ullMontMul64(ullX, ullX, ullN, ullNinv);
+  if(ullX==ullMinusOne)return(1);
+  }
+return(0);
+}
+/**********************************************************************/
+int iStrongLucas64(uint64_t ullN)
+{
+/* The strong Lucas-Selfridge test of N < 2^64, with the same results as
+   iStrongLucasSelfridge, computed as in iLucasMont in single-word
+   Montgomery arithmetic. Returns 1 if N is a prime or a strong
+   Lucas-Selfridge pseudoprime, and 0 if N is definitely composite. */
+
+uint64_t ullNinv, ullSqrt, ullK, ullG, ullH, ullT, ullU, ullV, ullQk,
+  ullD, ullQ;
+long lDabs, lD, lQ;
+int i, iS, iSign;
+
+if((ullN < 3) || ((ullN & 1)==0))return(ullN==2 ? 1 : 0);
+ullSqrt=ulSqrt(ullN);
+if(ullSqrt*ullSqrt==ullN)return(0);
+
+/* Selfridge's D, with 1 < GCD(|D|,N) < N exposing a factor of N. As
+   N=2^64 - 1 is divisible by 5, N + 1 cannot overflow below. */
+
+lDabs=5;
+iSign=1;
+while(1)
+  {
+  lD=iSign*lDabs;
+  iSign = -iSign;
+  ullG=ullN % lDabs;
+  ullH=lDabs;
+  while(ullG)
+    {
+    ullT=ullH % ullG;
+    ullH=ullG;
+    ullG=ullT;
+    }
+  if((ullH > 1) && (ullH < ullN))return(0);
+  if(iJacobi64(lD, ullN)==-1)break;
+  lDabs += 2;
+  if(lDabs > ulDmax)ulDmax=lDabs;  /* tracks global max of |D| */
+  }
+lQ=(1-lD)/4;
+
+ullNinv=ullInv64(ullN);
+ullD=ullToMont64(labs(lD), ullN);
+if(lD < 0)ullD=ullSubMod64(0, ullD, ullN);
+ullQ=ullToMont64(labs(lQ), ullN);
+if(lQ < 0)ullQ=ullSubMod64(0, ullQ, ullN);
+
+/* N + 1 = d*2^s with d odd; U_d, V_d and Q^d as in iLucasMont. */
+
+ullK=ullN + 1;
+for(iS=0; (ullK & 1)==0; iS++)ullK >>= 1;
+ullU=ullV=ullToMont64(1, ullN);
+ullQk=ullQ;
+for(i=63; ((ullK >> i) & 1)==0; i--);
+while(i-- > 0)
+  {
+  ullU=ullMontMul64(ullU, ullV, ullN, ullNinv);
+  ullV=ullMontMul64(ullV, ullV, ullN, ullNinv);
+  ullV=ullSubMod64(ullV, ullAddMod64(ullQk, ullQk, ullN), ullN);
+  ullQk=ullMontMul64(ullQk, ullQk, ullN, ullNinv);
+  if((ullK >> i) & 1)
+    {
+    ullT=ullMontMul64(ullU, ullD, ullN, ullNinv);
+    ullU=ullHalfMod64(ullAddMod64(ullU, ullV, ullN), ullN);
+    ullV=ullHalfMod64(ullAddMod64(ullV, ullT, ullN), ullN);
+    ullQk=ullMontMul64(ullQk, ullQ, ullN, ullNinv);
+    }
+  }
+
+if(ullU==0)return(1);
+for(i=0; i < iS; i++)
+  {
+  if(ullV==0)return(1);
+  ullV=ullMontMul64(ullV, ullV, ullN, ullNinv);
+  ullV=ullSubMod64(ullV, ullAddMod64(ullQk, ullQk, ullN), ullN);
+  ullQk=ullMontMul64(ullQk, ullQk, ullN, ullNinv);
+  }
+return(0);
+}
+/**********************************************************************/
+#endif  /* __SIZEOF_INT128__ */
+/**********************************************************************/
+#ifdef __MPIR__
+/**********************************************************************/
+int iIsPrime64(uint64_t ullN, unsigned long ulMaxDivisor)
+{
+/* Returns 1 if ullN is prime, zero otherwise.  No sieving is used.
+   The routine checks for prime divisors up to the smaller of the
+   sqrt of ullN or ulMaxDivisor. If no prime divisor is found, and
+   N > ulMaxDivisor^2 exceeds 2^32, the strong BPSW primality test
+   is invoked. If 0 or 1 is specified for ulMaxDivisor, a default
+   value of 1000 is used.
+
+   Where the compiler has unsigned __int128, the tests are carried out
+   in single-word Montgomery arithmetic: Miller-Rabin with the bases 2,
+   7 and 61, which is deterministic for N < 4759123141 (Jaeschke), and
+   beyond that the strong BPSW test (iMillerRabin64 and iStrongLucas64),
+   which has no pseudoprimes below 2^64 (Feitsma and Galway). Otherwise
+   N is converted to an mpz_t for iPrP. */
+
+unsigned long	   ulSqrtN, ul, ulDiv;
+#ifndef __SIZEOF_INT128__
+int                iPrime;
+mpz_t              mpzN;
+#endif
+
+if((ullN < 3) || ((ullN & 1)==0))return(ullN==2 ? 1 : 0);
+
+if(ulMaxDivisor < 2)ulMaxDivisor=1000UL;
+if(ulMaxDivisor > 65536UL)ulMaxDivisor=65536UL;
+
+ulSqrtN=ulSqrt(ullN);
+for(ul=2; ; ul++)
+  {
+  ulDiv=ulPrime16[ul];
+  if(ulDiv > ulSqrtN)return(1);
+  if(ulDiv > ulMaxDivisor)break;
+  if(__DIVISIBLE16(ullN, ul))return(0);
+  }
+
+/* If there are no small prime divisors, we use the strong BPSW test
+   for primality. */
+
+#ifdef __SIZEOF_INT128__
+if(ullN < __ULL(4759123141))
+  return(iMillerRabin64(ullN, 2) && iMillerRabin64(ullN, 7)
+    && iMillerRabin64(ullN, 61));
+return(iMillerRabin64(ullN, 2) && iStrongLucas64(ullN));
+#else
+mpz_init2(mpzN, 2*mp_bits_per_limb);
+__mpz_set_ull(mpzN, ullN);
+iPrime=iPrP(mpzN, 1, 2);
+mpz_clear(mpzN);
+return(iPrime);
+#endif
+}
+/**********************************************************************/
+int iPrP(mpz_t mpzN, unsigned long ulNMR, unsigned long ulMaxDivisor)
+{
+/* Returns 1 if mpzN is a probable prime according to the strong
+ * modified Baillie-PSW test.
  *
  * Returns 0 if mpzN is definitely composite.
  *
@@ -1984,7 +2717,6 @@ if(iStrongLucasSelfridge(mpzN)==0)return(0);
 
 if(ulNMR < 2)return(1);
 if(ulNMR > 6543)ulNMR=6543;
-if(ulPrime16[6543] != 65537UL)vGenPrimes16();
 for(ul=2; ul <= ulNMR; ul++)
   {
   if(iMillerRabin(mpzN, ulPrime16[ul])==0)return(0);
@@ -1995,6 +2727,351 @@ for(ul=2; ul <= ulNMR; ul++)
 return(1);
 }
 /**********************************************************************/
+/* Batch primality testing. Beyond the few smallest primes, trial
+   division of a whole batch is shared: the product P of the remaining
+   odd primes <= ulMaxDivisor is reduced modulo every candidate by one
+   descent of a product tree of the candidates,
+   after which gcd(P mod N, N) > 1 exposes each N with a small factor.
+   Each tree covers about as many bits of candidates as P has.
+   The survivors are then given the strong BPSW test on worker threads
+   (see threads.c). */
+
+typedef struct
+  {
+  mpz_t         *mpzN;
+  int           *iPrime;
+  unsigned long *ulIdx;   /* indices of the survivors */
+  unsigned long  nIdx;
+  unsigned int   nThreads;
+  } PRPJOB;
+
+/**********************************************************************/
+static void vPrPBatchThread(void *pv, unsigned int i)
+{
+PRPJOB *ppj=(PRPJOB *)pv;
+unsigned long ul, ulN;
+
+for(ul=i; ul < ppj->nIdx; ul += ppj->nThreads)
+  {
+  ulN=ppj->ulIdx[ul];
+  ppj->iPrime[ulN]=iMillerRabin(ppj->mpzN[ulN], 2)
+    && iStrongLucasSelfridge(ppj->mpzN[ulN]);
+  }
+return;
+}
+/**********************************************************************/
+static void vRemainderTree(mpz_t *mpzR, mpz_t mpzP, mpz_t *mpzN,
+  unsigned long *ulIdx, unsigned long nIdx)
+{
+/* Sets mpzR[k]=P mod N[ulIdx[k]] for 0 <= k < nIdx, where the mpzR[k]
+   are already initialized. A product tree of the moduli is built, P
+   is reduced modulo its root, and the remainder is then reduced down
+   the tree, each level in place of the products it replaces. */
+
+mpz_t *mpzT;
+unsigned long ulLevels, ulL, ul, ulTotal, nLev[8*sizeof(unsigned long)],
+  ulOff[8*sizeof(unsigned long)];
+
+ulLevels=1;
+nLev[0]=nIdx;
+ulOff[0]=0;
+ulTotal=nIdx;
+while(nLev[ulLevels-1] > 1)
+  {
+  nLev[ulLevels]=(nLev[ulLevels-1] + 1)/2;
+  ulOff[ulLevels]=ulTotal;
+  ulTotal += nLev[ulLevels];
+  ulLevels++;
+  }
+mpzT=(mpz_t *)malloc(ulTotal*sizeof(mpz_t));
+if(!mpzT)
+  {
+  fprintf(stderr, "\n ERROR: malloc failed in vRemainderTree.\n");
+  exit(EXIT_FAILURE);
+  }
+
+for(ul=0; ul < nIdx; ul++)mpz_init_set(mpzT[ul], mpzN[ulIdx[ul]]);
+for(ulL=1; ulL < ulLevels; ulL++)
+  for(ul=0; ul < nLev[ulL]; ul++)
+    {
+    mpz_init(mpzT[ulOff[ulL] + ul]);
+    if(2*ul + 1 < nLev[ulL-1])
+      mpz_mul(mpzT[ulOff[ulL] + ul], mpzT[ulOff[ulL-1] + 2*ul],
+        mpzT[ulOff[ulL-1] + 2*ul + 1]);
+    else
+      mpz_set(mpzT[ulOff[ulL] + ul], mpzT[ulOff[ulL-1] + 2*ul]);
+    }
+
+mpz_mod(mpzT[ulTotal-1], mpzP, mpzT[ulTotal-1]);
+for(ulL=ulLevels-1; ulL > 0; ulL--)
+  for(ul=0; ul < nLev[ulL-1]; ul++)
+    mpz_mod(mpzT[ulOff[ulL-1] + ul], mpzT[ulOff[ulL] + ul/2],
+      mpzT[ulOff[ulL-1] + ul]);
+
+for(ul=0; ul < nIdx; ul++)mpz_set(mpzR[ul], mpzT[ul]);
+for(ul=0; ul < ulTotal; ul++)mpz_clear(mpzT[ul]);
+free(mpzT);
+return;
+}
+/**********************************************************************/
+void vPrPBatch(mpz_t *mpzN, int *iPrime, unsigned long nN,
+  unsigned long ulMaxDivisor, unsigned int nThreads)
+{
+/* Sets iPrime[i]=1 if mpzN[i] is a probable prime according to the
+   strong Baillie-PSW test, and iPrime[i]=0 if mpzN[i] is definitely
+   composite, for 0 <= i < nN. The results agree with
+   iPrP(mpzN[i], 1, ulMaxDivisor).
+
+   Trial division is by the primes <= ulMaxDivisor, which may not
+   exceed 65537; because it is shared by the whole batch, the bound
+   can be much higher than for single candidates, and if 0 or 1 is
+   specified the default is 65536. The Miller-Rabin and strong
+   Lucas-Selfridge tests of the survivors are spread over nThreads
+   threads (all available cores if nThreads is zero).
+
+   The global ulDmax is not updated reliably when nThreads > 1. */
+
+PRPJOB pj;
+mpz_t mpzP, *mpzR;
+unsigned long ul, ulEnd, ulProd, ulBits, ulBitsP, ulSmall, nIdx;
+uint64_t ullRem;
+
+if(nN==0)return;
+if(nThreads==0)nThreads=num_cores();
+if(ulMaxDivisor < 2)ulMaxDivisor=65536UL;
+if(ulMaxDivisor > 65537UL)ulMaxDivisor=65537UL;
+
+pj.ulIdx=(unsigned long *)malloc(nN*sizeof(unsigned long));
+if(!pj.ulIdx)
+  {
+  fprintf(stderr, "\n ERROR: malloc failed in vPrPBatch.\n");
+  exit(EXIT_FAILURE);
+  }
+
+/* Settle N < 3, even N, and N <= ulMaxDivisor directly. The smallest
+   primes, which remove most composites, are tried first, one candidate
+   at a time, against a single-word residue as in ulPrmDiv. */
+
+ulProd=1;
+for(ulSmall=2; ulPrime16[ulSmall] <= ulMaxDivisor; ulSmall++)
+  {
+  if(ulProd > ULONG_MAX/ulPrime16[ulSmall])break;
+  ulProd *= ulPrime16[ulSmall];
+  }
+nIdx=0;
+for(ul=0; ul < nN; ul++)
+  {
+  iPrime[ul]=0;
+  if(mpz_cmp_ui(mpzN[ul], 2) < 0)continue;
+  if(mpz_even_p(mpzN[ul]))
+    iPrime[ul]=(mpz_cmp_ui(mpzN[ul], 2)==0);
+  else if(mpz_cmp_ui(mpzN[ul], ulMaxDivisor) <= 0)
+    iPrime[ul]=iIsPrime32(mpz_get_ui(mpzN[ul]));
+  else
+    {
+    ullRem=mpz_fdiv_ui(mpzN[ul], ulProd);
+    for(ulEnd=2; ulEnd < ulSmall; ulEnd++)
+      if(__DIVISIBLE16(ullRem, ulEnd))break;
+    if(ulEnd==ulSmall)pj.ulIdx[nIdx++]=ul;
+    }
+  }
+
+/* Shared trial division of the rest by the remaining primes. */
+
+if(nIdx && (ulSmall <= NUM_16BIT_PRIMES + 1)
+  && (ulPrime16[ulSmall] <= ulMaxDivisor))
+  {
+  mpz_init_set_ui(mpzP, 1);
+  for(ul=ulSmall; (ul <= NUM_16BIT_PRIMES + 1)
+    && (ulPrime16[ul] <= ulMaxDivisor); )
+    {
+    for(ulProd=1; ul <= NUM_16BIT_PRIMES + 1; ul++)
+      {
+      if(ulPrime16[ul] > ulMaxDivisor)break;
+      if(ulProd > ULONG_MAX/ulPrime16[ul])break;
+      ulProd *= ulPrime16[ul];
+      }
+    mpz_mul_ui(mpzP, mpzP, ulProd);
+    }
+  mpzR=(mpz_t *)malloc(nIdx*sizeof(mpz_t));
+  if(!mpzR)
+    {
+    fprintf(stderr, "\n ERROR: malloc failed in vPrPBatch.\n");
+    exit(EXIT_FAILURE);
+    }
+  for(ul=0; ul < nIdx; ul++)mpz_init(mpzR[ul]);
+  ulBitsP=mpz_sizeinbase(mpzP, 2);
+  for(ul=0; ul < nIdx; ul=ulEnd)
+    {
+    /* Tree levels wider than P would only be reduced trivially, so
+       each tree holds about as many bits of candidates as P has. */
+    ulBits=0;
+    for(ulEnd=ul; (ulEnd < nIdx) && ((ulEnd==ul) || (ulBits < ulBitsP));
+      ulEnd++)
+      ulBits += mpz_sizeinbase(mpzN[pj.ulIdx[ulEnd]], 2);
+    vRemainderTree(mpzR + ul, mpzP, mpzN, pj.ulIdx + ul, ulEnd - ul);
+    }
+  for(ul=0, pj.nIdx=0; ul < nIdx; ul++)
+    {
+    mpz_gcd(mpzR[ul], mpzR[ul], mpzN[pj.ulIdx[ul]]);
+    if(mpz_cmp_ui(mpzR[ul], 1)==0)pj.ulIdx[pj.nIdx++]=pj.ulIdx[ul];
+    mpz_clear(mpzR[ul]);
+    }
+  free(mpzR);
+  mpz_clear(mpzP);
+  nIdx=pj.nIdx;
+  }
+
+/* The strong BPSW test of the survivors. */
+
+pj.mpzN=mpzN;
+pj.iPrime=iPrime;
+pj.nIdx=nIdx;
+if(nThreads > nIdx)nThreads=nIdx;
+pj.nThreads=nThreads;
+if(nThreads > 1)
+  run_threads(vPrPBatchThread, &pj, nThreads);
+else if(nIdx)
+  vPrPBatchThread(&pj, 0);
+free(pj.ulIdx);
+return;
+}
+/**********************************************************************/
+/* Sieved next prime search. A window of odd candidates above N is
+   sieved by the table primes below 65536, and the survivors are given
+   the strong BPSW test in order, interleaved over the threads: thread i
+   takes survivors i, i + nThreads, ..., and stops at its first probable
+   prime, or once it has passed one found by another thread. Each thread
+   lowers the shared index found by atomic_min_ul, so it ends as the
+   smallest found, the next probable prime, whatever the timing of the
+   threads. */
+
+#define NEXTPRIME_MIN_WINDOW  256  /* odd candidates per window */
+#define NEXTPRIME_MAX_THREADS 256
+
+typedef struct
+  {
+  mpz_t                   mpzS;     /* first candidate (odd) */
+  unsigned long          *ulIdx;    /* survivors, as offsets/2 from S */
+  unsigned long           nIdx;
+  volatile unsigned long  ulFound;  /* smallest found; ULONG_MAX if none */
+  unsigned int            nThreads;
+  } NEXTPRIMEJOB;
+
+/**********************************************************************/
+static void vNextPrimeThread(void *pv, unsigned int i)
+{
+NEXTPRIMEJOB *pnj=(NEXTPRIMEJOB *)pv;
+unsigned long ul;
+mpz_t mpzC;
+
+mpz_init(mpzC);
+for(ul=i; ul < pnj->nIdx; ul += pnj->nThreads)
+  {
+  if(ul > atomic_min_ul(&pnj->ulFound, ULONG_MAX))break;
+  mpz_add_ui(mpzC, pnj->mpzS, 2*pnj->ulIdx[ul]);
+  if(iMillerRabin(mpzC, 2) && iStrongLucasSelfridge(mpzC))
+    {
+    atomic_min_ul(&pnj->ulFound, ul);
+    break;
+    }
+  }
+mpz_clear(mpzC);
+return;
+}
+/**********************************************************************/
+void vNextPrime(mpz_t mpzP, mpz_t mpzN, unsigned int nThreads)
+{
+/* Sets P to the smallest probable prime > N, according to the strong
+   Baillie-PSW test (as iPrP(P, 1, 2)); P and N may be the same. Only
+   the candidates that survive sieving by the primes below 65536 are
+   tested, on nThreads threads (all available cores if nThreads is
+   zero). Below 2^32 the candidates are simply tested in turn. As in
+   vPrPBatch, the global ulDmax is not updated reliably when
+   nThreads > 1. */
+
+NEXTPRIMEJOB nj;
+unsigned char *uchComp;
+unsigned long ulW, ul, ulEnd, ulProd, ulP, ulI;
+uint64_t ullRem;
+
+if(mpz_cmp_ui(mpzN, 2) < 0)
+  {
+  mpz_set_ui(mpzP, 2);
+  return;
+  }
+if(mpz_sizeinbase(mpzN, 2) <= 32)
+  {
+  mpz_add_ui(mpzP, mpzN, 1);
+  while(!iPrP(mpzP, 1, 1000))mpz_add_ui(mpzP, mpzP, 1);
+  return;
+  }
+
+if(nThreads==0)nThreads=num_cores();
+if(nThreads > NEXTPRIME_MAX_THREADS)nThreads=NEXTPRIME_MAX_THREADS;
+
+/* The window spans about three times the average prime gap. */
+
+ulW=mpz_sizeinbase(mpzN, 2) + NEXTPRIME_MIN_WINDOW;
+uchComp=(unsigned char *)malloc(ulW);
+nj.ulIdx=(unsigned long *)malloc(ulW*sizeof(unsigned long));
+if(!uchComp || !nj.ulIdx)
+  {
+  fprintf(stderr, "\n ERROR: malloc failed in vNextPrime.\n");
+  exit(EXIT_FAILURE);
+  }
+mpz_init(nj.mpzS);
+mpz_add_ui(nj.mpzS, mpzN, 1);
+if(mpz_even_p(nj.mpzS))mpz_add_ui(nj.mpzS, nj.mpzS, 1);
+while(1)
+  {
+  /* Strike S + 2i for each prime p dividing it, where i=-S/2 mod p;
+     the residues of S come from one mpz division for each product of
+     primes that fits in an unsigned long, as in ulPrmDiv. Since
+     S > 2^32, no candidate is itself a table prime. */
+
+  memset(uchComp, 0, ulW);
+  ul=2;
+  while(ul < NUM_16BIT_PRIMES + 1)
+    {
+    ulProd=ulPrime16[ul];
+    for(ulEnd=ul+1; ulEnd < NUM_16BIT_PRIMES + 1; ulEnd++)
+      {
+      if(ulProd > ULONG_MAX/ulPrime16[ulEnd])break;
+      ulProd *= ulPrime16[ulEnd];
+      }
+    ullRem=mpz_fdiv_ui(nj.mpzS, ulProd);
+    for(; ul < ulEnd; ul++)
+      {
+      ulP=ulPrime16[ul];
+      ulI=(ulP - (unsigned long)(ullRem % ulP)) % ulP;
+      ulI=(unsigned long)((uint64_t)ulI*((ulP + 1)/2) % ulP);
+      for(; ulI < ulW; ulI += ulP)uchComp[ulI]=1;
+      }
+    }
+
+  nj.nIdx=0;
+  for(ulI=0; ulI < ulW; ulI++)
+    if(!uchComp[ulI])nj.ulIdx[nj.nIdx++]=ulI;
+  nj.ulFound=ULONG_MAX;
+  nj.nThreads=nThreads;
+  if(nThreads > 1)
+    run_threads(vNextPrimeThread, &nj, nThreads);
+  else
+    vNextPrimeThread(&nj, 0);
+
+  ulI=nj.ulFound;
+  if(ulI < ULONG_MAX)break;
+  mpz_add_ui(nj.mpzS, nj.mpzS, 2*ulW);
+  }
+
+mpz_add_ui(mpzP, nj.mpzS, 2*nj.ulIdx[ulI]);
+mpz_clear(nj.mpzS);
+free(nj.ulIdx);
+free(uchComp);
+return;
+}
+/**********************************************************************/
 unsigned long ulPrmDiv(mpz_t mpzN, unsigned long ulMaxDivisor)
 {
 /* Returns the smallest proper prime divisor (p <= ulMaxDivisor) of N.
@@ -2023,11 +3100,13 @@ unsigned long ulPrmDiv(mpz_t mpzN, unsigned long ulMaxDivisor)
 */
 
 int iComp2;
-unsigned long ul, ulDiv;
+unsigned long ul, ulEnd, ulDiv, ulProd;
+uint64_t ullRem, ullUB;
 mpz_t mpzSqrt;
+PRIMEITER pi;
 
 #undef RETURN
-#define RETURN(n) {mpz_clear(mpzSqrt); return(n);}
+#define RETURN(n) {vPrimeIterClear(&pi); mpz_clear(mpzSqrt); return(n);}
 
 /* First eliminate all N < 3 and all even N. */
 
@@ -2036,39 +3115,49 @@ if(iComp2 < 0)return(0);
 if(iComp2==0)return(1);
 if(mpz_even_p(mpzN))return(2);
 
-if(ulPrime16[6543] != 65537UL)vGenPrimes16();
 if(ulMaxDivisor < 2)ulMaxDivisor=1000UL;
 
+memset(&pi, 0, sizeof(PRIMEITER));
 mpz_init2(mpzSqrt, mpz_sizeinbase(mpzN, 2)/2 + mp_bits_per_limb);
 mpz_sqrt(mpzSqrt, mpzN);
 
+/* Rather than passing over all of N once for every trial divisor, N is
+   reduced once modulo the product of as many consecutive table primes
+   as fit in an unsigned long, and each of those primes is then tested
+   against the single-word residue with a multiply and a compare. */
+
 ul=2;  /* first trial divisor will be 3 */
-while(1)
+while(ul < NUM_16BIT_PRIMES + 1)  /* 65537 is left to the loop below */
   {
-  ulDiv=ulPrime16[ul++];
-  if(ulDiv > ulMaxDivisor)RETURN(0);
-  if(ulDiv > 65536UL)break;
-  if(mpz_cmp_ui(mpzSqrt, ulDiv) < 0)RETURN(1);
-  if(mpz_divisible_ui_p(mpzN, ulDiv))RETURN(ulDiv);
+  ulProd=ulPrime16[ul];
+  for(ulEnd=ul+1; ulEnd < NUM_16BIT_PRIMES + 1; ulEnd++)
+    {
+    if(ulPrime16[ulEnd] > ulMaxDivisor)break;
+    if(ulProd > ULONG_MAX/ulPrime16[ulEnd])break;
+    ulProd *= ulPrime16[ulEnd];
+    }
+  ullRem=mpz_fdiv_ui(mpzN, ulProd);
+  for(; ul < ulEnd; ul++)
+    {
+    ulDiv=ulPrime16[ul];
+    if(ulDiv > ulMaxDivisor)RETURN(0);
+    if(mpz_cmp_ui(mpzSqrt, ulDiv) < 0)RETURN(1);
+    if(__DIVISIBLE16(ullRem, ul))RETURN(ulDiv);
+    }
   }
+if(ulPrime16[ul] > ulMaxDivisor)RETURN(0);
 
-/* If ulMaxDivisor exceeds 2^16, use trial divisors of the
-   form 6n +/- 1. */
+/* If ulMaxDivisor exceeds 2^16, continue with the primes from 65537,
+   streamed by a PRIMEITER, up to ulMaxDivisor or sqrt(N). */
 
-if(ulMaxDivisor > UINT32_MAX - 7)ulMaxDivisor=UINT32_MAX-7;
+if(ulMaxDivisor > UINT32_MAX - 4)ulMaxDivisor=UINT32_MAX - 4;
 
-ulDiv=65537UL;
-while(1)
-  {
-  if(ulDiv > ulMaxDivisor)break;
-  if(mpz_cmp_ui(mpzSqrt, ulDiv) < 0)RETURN(1);
-  if(mpz_divisible_ui_p(mpzN, ulDiv))RETURN(ulDiv);
-  ulDiv += 2;
-  if(ulDiv > ulMaxDivisor)break;
-  if(mpz_cmp_ui(mpzSqrt, ulDiv) < 0)RETURN(1);
+ullUB=ulMaxDivisor;
+if(mpz_cmp_ui(mpzSqrt, ulMaxDivisor) < 0)ullUB=mpz_get_ui(mpzSqrt);
+vPrimeIterInit(&pi, 65537UL, ullUB);
+while((ulDiv=(unsigned long)ullPrimeIterNext(&pi)))
   if(mpz_divisible_ui_p(mpzN, ulDiv))RETURN(ulDiv);
-  ulDiv += 4;
-  }
+if(ullUB < ulMaxDivisor)RETURN(1);
 
 RETURN(0);
 }
@@ -2592,36 +3681,627 @@ for(r=1; r < s; r++)
 RETURN(0);
 }
 /**********************************************************************/
-int iExtraStrongLucas(mpz_t mpzN, long lB)
+/* Montgomery arithmetic modulo an odd N of n limbs, at the mpn level.
+   A residue a is held as the n-limb array a*R mod N, R=2^(n*GMP_NUMB_BITS),
+   always fully reduced. The scratch space is allocated once by
+   vMontInit, so that the arithmetic itself never allocates. */
+
+#define MONT_REDC_MUL_THRESHOLD 48  /* limbs; use products for REDC above */
+
+/**********************************************************************/
+static void vMontRedc(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pT)
 {
-/* Test N for primality using the extra strong Lucas test with base B,
-   as formulated by Zhaiyu Mo and James P. Jones ("A new primality test
-   using Lucas sequences," preprint, circa 1997), and described by Jon
-   Grantham in "Frobenius pseudoprimes," (preprint, 16 July 1998),
-   available at <http://www.pseudoprime.com/pseudo1.ps>.
+/* Sets pR=pT/R mod N, fully reduced, for the 2n-limb pT < N*R, which
+   is destroyed. pR may be pT + n but must not otherwise overlap pT.
+   Small moduli are reduced a limb at a time; larger ones with the
+   two products m=(pT mod R)*(-1/N) mod R and m*N. */
 
-   Returns 1 if N is prime or an extra strong Lucas pseudoprime (base B).
-   Returns 0 if N is definitely composite.
+mp_size_t n=pmc->n, i;
+mp_limb_t *pS, lCarry;
 
-   Even N and N < 3 are eliminated before applying the Lucas test.
+if(n < MONT_REDC_MUL_THRESHOLD)
+  {
+  for(i=0; i < n; i++)
+    pT[i]=mpn_addmul_1(pT + i, pmc->pN, n, pT[i]*pmc->lInv);
+  lCarry=mpn_add_n(pR, pT + n, pT, n);
+  }
+else
+  {
+  pS=pmc->pT + 2*n;
+  mpn_mul_n(pS, pT, pmc->pNinv, n);
+  mpn_mul_n(pS + 2*n, pS, pmc->pN, n);
+  /* The low halves of pT and m*N sum to 0 or R. */
+  for(i=0; (i < n) && (pT[i]==0); i++);
+  lCarry=mpn_add_n(pR, pT + n, pS + 3*n, n);
+  if(i < n)lCarry += mpn_add_1(pR, pR, n, 1);
+  }
+if(lCarry || (mpn_cmp(pR, pmc->pN, n) >= 0))
+  mpn_sub_n(pR, pR, pmc->pN, n);
+return;
+}
+/**********************************************************************/
+void vMontInit(MONTCTX *pmc, mpz_t mpzN)
+{
+/* Prepares pmc for arithmetic modulo the odd integer mpzN > 1. */
 
-   In this implementation of the algorithm, Q=1, and B is an integer
-   in 2 < B < INT32_MAX (2147483647 on 32-bit machines); the default value
-   is B=3. B is incremented as necessary if the values of B and N are
-   inconsistent with the hypotheses of Jones and Mo: P=B, Q=1,
-   D=P*P - 4*Q, GCD(N,2D)=1, Jacobi(D,N) <> 0.
+mp_size_t n;
+mp_limb_t lInv;
+mpz_t mpzR;
+int i;
 
-   Since the base B is used solely to calculate the discriminant
-   D=B*B - 4, negative values of B are redundant. The bases B=0 and
-   B=1 are excluded because they produce huge numbers of pseudoprimes,
-   and B=2 is excluded because the resulting D=0 fails the Jones-Mo
-   hypotheses.
+mpz_init(pmc->mpzT);
+n=mpz_size(mpzN);
+pmc->n=n;
+pmc->pN=(mp_limb_t *)calloc(8*n, sizeof(mp_limb_t));
+if(!pmc->pN)
+  {
+  fprintf(stderr, "\n ERROR: calloc failed in vMontInit.\n");
+  exit(EXIT_FAILURE);
+  }
+pmc->pNinv=pmc->pN + n;
+pmc->pT=pmc->pN + 2*n;  /* 2n for products, 4n more for vMontRedc */
+mpz_export(pmc->pN, NULL, -1, sizeof(mp_limb_t), 0, GMP_NAIL_BITS, mpzN);
 
-   Note that the choice Q=1 eliminates the computation of powers of Q
-   which appears in the weak and strong Lucas tests.
+/* Newton iteration for 1/N mod 2^GMP_NUMB_BITS; each step doubles the
+   number of correct low bits, starting from 3. */
 
-   The running time of the extra strong Lucas-Selfridge test is, on
-   average, roughly 80 % that of the standard Lucas-Selfridge test
+lInv=pmc->pN[0];
+for(i=0; i < 6; i++)lInv *= 2 - pmc->pN[0]*lInv;
+pmc->lInv=-lInv;
+
+if(n >= MONT_REDC_MUL_THRESHOLD)
+  {
+  mpz_init(mpzR);
+  mpz_setbit(mpzR, n*GMP_NUMB_BITS);
+  mpz_invert(pmc->mpzT, mpzN, mpzR);  /* uses mpzT as a temporary */
+  mpz_sub(pmc->mpzT, mpzR, pmc->mpzT);
+  mpz_export(pmc->pNinv, NULL, -1, sizeof(mp_limb_t), 0, GMP_NAIL_BITS,
+    pmc->mpzT);
+  mpz_clear(mpzR);
+  }
+mpz_init_set(pmc->mpzN, mpzN);
+return;
+}
+/**********************************************************************/
+void vMontClear(MONTCTX *pmc)
+{
+free(pmc->pN);
+mpz_clear(pmc->mpzN);
+mpz_clear(pmc->mpzT);
+return;
+}
+/**********************************************************************/
+void vMontSet(MONTCTX *pmc, mp_limb_t *pR, mpz_t mpzA)
+{
+/* Sets pR to the Montgomery form of mpzA (any sign), which must not
+   be pmc->mpzT. */
+
+mp_size_t i;
+size_t nLimbs;
+
+mpz_mul_2exp(pmc->mpzT, mpzA, pmc->n*GMP_NUMB_BITS);
+mpz_mod(pmc->mpzT, pmc->mpzT, pmc->mpzN);
+mpz_export(pR, &nLimbs, -1, sizeof(mp_limb_t), 0, GMP_NAIL_BITS,
+  pmc->mpzT);
+for(i=nLimbs; i < pmc->n; i++)pR[i]=0;
+return;
+}
+/**********************************************************************/
+void vMontGet(MONTCTX *pmc, mpz_t mpzR, mp_limb_t *pA)
+{
+/* Sets mpzR to the integer (0 <= mpzR < N) held in Montgomery form
+   by pA. */
+
+mp_size_t n=pmc->n, i;
+
+for(i=0; i < n; i++)
+  {
+  pmc->pT[i]=pA[i];
+  pmc->pT[n + i]=0;
+  }
+vMontRedc(pmc, pmc->pT + n, pmc->pT);
+mpz_import(mpzR, n, -1, sizeof(mp_limb_t), 0, GMP_NAIL_BITS, pmc->pT + n);
+return;
+}
+/**********************************************************************/
+void vMontMul(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA, mp_limb_t *pB)
+{
+if(pA==pB)
+  mpn_sqr(pmc->pT, pA, pmc->n);
+else
+  mpn_mul_n(pmc->pT, pA, pB, pmc->n);
+vMontRedc(pmc, pR, pmc->pT);
+return;
+}
+/**********************************************************************/
+void vMontAdd(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA, mp_limb_t *pB)
+{
+if(mpn_add_n(pR, pA, pB, pmc->n) || (mpn_cmp(pR, pmc->pN, pmc->n) >= 0))
+  mpn_sub_n(pR, pR, pmc->pN, pmc->n);
+return;
+}
+/**********************************************************************/
+void vMontSub(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA, mp_limb_t *pB)
+{
+if(mpn_sub_n(pR, pA, pB, pmc->n))mpn_add_n(pR, pR, pmc->pN, pmc->n);
+return;
+}
+/**********************************************************************/
+void vMontHalf(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA)
+{
+/* pR=pA/2 mod N. */
+
+mp_size_t n=pmc->n, i;
+mp_limb_t lCarry=0;
+
+if(pA[0] & 1)
+  lCarry=mpn_add_n(pR, pA, pmc->pN, n);
+else if(pR != pA)
+  for(i=0; i < n; i++)pR[i]=pA[i];
+mpn_rshift(pR, pR, n, 1);
+pR[n-1] |= lCarry << (GMP_NUMB_BITS - 1);
+return;
+}
+/**********************************************************************/
+int iMontIsZero(MONTCTX *pmc, mp_limb_t *pA)
+{
+mp_size_t i;
+
+for(i=0; i < pmc->n; i++)
+  if(pA[i])return(0);
+return(1);
+}
+/**********************************************************************/
+void vMontMulSmall(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA, long l)
+{
+/* pR=l*pA mod N for a small signed l, by modular doublings and
+   additions, so that no product or reduction is needed. */
+
+mp_size_t n=pmc->n, i;
+unsigned long ulAbs, ulBit;
+mp_limb_t *pA0=pmc->pT;
+
+ulAbs=(l < 0) ? -(unsigned long)l : (unsigned long)l;
+for(i=0; i < n; i++)
+  {
+  pA0[i]=pA[i];
+  pR[i]=0;
+  }
+if(ulAbs==0)return;
+for(ulBit=1; ulBit <= ulAbs/2; ulBit <<= 1);
+for(; ulBit; ulBit >>= 1)
+  {
+  vMontAdd(pmc, pR, pR, pR);
+  if(ulAbs & ulBit)vMontAdd(pmc, pR, pR, pA0);
+  }
+if((l < 0) && !iMontIsZero(pmc, pR))mpn_sub_n(pR, pmc->pN, pR, n);
+return;
+}
+/**********************************************************************/
+static int iSelfridgeD(mpz_t mpzN, long *plD)
+{
+/* Common start of iLucasMont and iLucasV. As in iStrongLucasSelfridge,
+   N < 3, even N, and perfect squares are eliminated, and D is chosen
+   by Selfridge's method as the first element of {5, -7, 9, -11, ...}
+   with Jacobi(D,N)=-1. Returns 0 or 1 if this settles N, and -1 (with
+   *plD set) if the Lucas test must be run. */
+
+int iComp2, iJ, iSign;
+long lDabs, lD;
+unsigned long ulGCD;
+
+iComp2=mpz_cmp_si(mpzN, 2);
+if(iComp2 < 0)return(0);
+if(iComp2==0)return(1);
+if(mpz_even_p(mpzN))return(0);
+if(mpz_perfect_square_p(mpzN))return(0);
+
+lDabs=5;
+iSign=1;
+while(1)
+  {
+  lD=iSign*lDabs;
+  iSign = -iSign;
+  ulGCD=mpz_gcd_ui(NULL, mpzN, lDabs);
+  if((ulGCD > 1) && mpz_cmp_ui(mpzN, ulGCD) > 0)return(0);
+  iJ=mpz_si_kronecker(lD, mpzN);
+  if(iJ==-1)break;
+  lDabs += 2;
+  if(lDabs > ulDmax)ulDmax=lDabs;  /* tracks global max of |D| */
+  if(lDabs > INT32_MAX-2)
+    {
+    fprintf(stderr,
+      "\n ERROR: D overflows signed long in Lucas-Selfridge test.");
+    fprintf(stderr, "\n N=");
+    mpz_out_str(stderr, 10, mpzN);
+    fprintf(stderr, "\n |D|=%ld\n\n", lDabs);
+    exit(EXIT_FAILURE);
+    }
+  }
+*plD=lD;
+return(-1);
+}
+/**********************************************************************/
+int iLucasMont(mpz_t mpzN, int iStrong)
+{
+/* The Lucas-Selfridge test (iStrong=0) or the strong Lucas-Selfridge
+   test (iStrong=1) of mpzN, with the same results as iLucasSelfridge
+   and iStrongLucasSelfridge respectively, computed in Montgomery form
+   (see vMontInit).
+
+   With P=1, U and V are advanced by the doubling formulas
+   U_2k=U_k*V_k, V_2k=V_k^2 - 2*Q^k and, for each set bit of the index,
+   U_(2k+1)=(U_2k + V_2k)/2, V_(2k+1)=(D*U_2k + V_2k)/2. Since D and Q
+   are small, each bit costs two multiplications and a squaring (for
+   Q^k); the set bits add only linear-time work. */
+
+int iResult;
+long lD, lQ;
+unsigned long ulBit, r, s;
+mp_size_t n;
+mp_limb_t *pU, *pV, *pQk, *pT;
+mpz_t mpzK, mpzT;
+MONTCTX mc;
+
+iResult=iSelfridgeD(mpzN, &lD);
+if(iResult >= 0)return(iResult);
+iResult=0;
+lQ=(1-lD)/4;
+
+/* The index is N + 1, or its odd part d for the strong test. */
+
+mpz_init(mpzK);
+mpz_init(mpzT);
+mpz_add_ui(mpzK, mpzN, 1);
+s=0;
+if(iStrong)
+  {
+  s=mpz_scan1(mpzK, 0);
+  mpz_tdiv_q_2exp(mpzK, mpzK, s);
+  }
+
+vMontInit(&mc, mpzN);
+n=mc.n;
+pU=(mp_limb_t *)malloc(4*n*sizeof(mp_limb_t));
+if(!pU)
+  {
+  fprintf(stderr, "\n ERROR: malloc failed in iLucasMont.\n");
+  exit(EXIT_FAILURE);
+  }
+pV=pU + n;
+pQk=pV + n;
+pT=pQk + n;
+
+mpz_set_ui(mpzT, 1);
+vMontSet(&mc, pU, mpzT);                 /* U_1=1 */
+vMontSet(&mc, pV, mpzT);                 /* V_1=P=1 */
+mpz_set_si(mpzT, lQ);
+vMontSet(&mc, pQk, mpzT);                /* Q^1 */
+
+for(ulBit=mpz_sizeinbase(mpzK, 2) - 1; ulBit-- > 0; )
+  {
+  vMontMul(&mc, pU, pU, pV);
+  vMontMul(&mc, pV, pV, pV);
+  vMontAdd(&mc, pT, pQk, pQk);
+  vMontSub(&mc, pV, pV, pT);
+  vMontMul(&mc, pQk, pQk, pQk);
+  if(mpz_tstbit(mpzK, ulBit))
+    {
+    vMontMulSmall(&mc, pT, pU, lD);
+    vMontAdd(&mc, pU, pU, pV);
+    vMontHalf(&mc, pU, pU);
+    vMontAdd(&mc, pV, pV, pT);
+    vMontHalf(&mc, pV, pV);
+    vMontMulSmall(&mc, pQk, pQk, lQ);
+    }
+  }
+
+/* The standard test requires U_(N+1)=0; the strong test U_d=0, or
+   V_(d*2^r)=0 for some 0 <= r < s. */
+
+if(iMontIsZero(&mc, pU))
+  iResult=1;
+else if(iStrong)
+  for(r=0; r < s; r++)
+    {
+    if(iMontIsZero(&mc, pV))
+      {
+      iResult=1;
+      break;
+      }
+    if(r + 1 < s)
+      {
+      vMontMul(&mc, pV, pV, pV);
+      vMontAdd(&mc, pT, pQk, pQk);
+      vMontSub(&mc, pV, pV, pT);
+      vMontMul(&mc, pQk, pQk, pQk);
+      }
+    }
+
+free(pU);
+vMontClear(&mc);
+mpz_clear(mpzK);
+mpz_clear(mpzT);
+return(iResult);
+}
+/**********************************************************************/
+static int iLucasVMont(MONTCTX *pmc, mpz_t mpzN, long lD, int iStrong)
+{
+/* The ladder of iLucasV, for Selfridge's D (P=1) and the Montgomery
+   context of N, which are set up by the caller. */
+
+int iResult, iUnit;
+long lQ;
+unsigned long ulBit, r, s;
+mp_size_t n, i;
+mp_limb_t *pV, *pV1, *pQk, *pQk1, *pT, *pOne, *pMinusOne, *pQ1;
+mpz_t mpzK, mpzT;
+
+iResult=0;
+lQ=(1-lD)/4;  /* P=1 */
+iUnit=(lQ==1) || (lQ==-1);
+
+mpz_init(mpzK);
+mpz_init(mpzT);
+mpz_add_ui(mpzK, mpzN, 1);
+s=0;
+if(iStrong)
+  {
+  s=mpz_scan1(mpzK, 0);
+  mpz_tdiv_q_2exp(mpzK, mpzK, s);
+  }
+
+n=pmc->n;
+pV=(mp_limb_t *)malloc(7*n*sizeof(mp_limb_t));
+if(!pV)
+  {
+  fprintf(stderr, "\n ERROR: malloc failed in iLucasV.\n");
+  exit(EXIT_FAILURE);
+  }
+pV1=pV + n;
+pQk=pV1 + n;
+pQk1=pQk + n;
+pT=pQk1 + n;
+pOne=pT + n;
+pMinusOne=pOne + n;
+
+mpz_set_ui(mpzT, 1);
+vMontSet(pmc, pOne, mpzT);
+vMontSub(pmc, pMinusOne, pOne, pOne);
+vMontSub(pmc, pMinusOne, pMinusOne, pOne);
+vMontSet(pmc, pV, mpzT);                 /* V_1=P=1 */
+mpz_set_si(mpzT, 1 - 2*lQ);
+vMontSet(pmc, pV1, mpzT);                /* V_2=P^2 - 2Q */
+mpz_set_si(mpzT, lQ);
+vMontSet(pmc, pQk, mpzT);                /* Q^1 */
+
+for(ulBit=mpz_sizeinbase(mpzK, 2) - 1; ulBit-- > 0; )
+  {
+  vMontMul(pmc, pT, pV, pV1);
+  vMontSub(pmc, pT, pT, pQk);            /* V_(2k+1) */
+  if(mpz_tstbit(mpzK, ulBit))
+    {
+    vMontMulSmall(pmc, pQk1, pQk, lQ);   /* Q^(k+1) */
+    vMontMul(pmc, pV1, pV1, pV1);
+    vMontSub(pmc, pV1, pV1, pQk1);
+    vMontSub(pmc, pV1, pV1, pQk1);       /* V_(2k+2) */
+    for(i=0; i < n; i++)pV[i]=pT[i];
+    }
+  else
+    {
+    vMontMul(pmc, pV, pV, pV);
+    vMontSub(pmc, pV, pV, pQk);
+    vMontSub(pmc, pV, pV, pQk);          /* V_2k */
+    for(i=0; i < n; i++)pV1[i]=pT[i];
+    }
+  if(iUnit)
+    {
+    /* Q^k is 1, or -1 if Q=-1 and k is odd. */
+    pQ1=((lQ==-1) && mpz_tstbit(mpzK, ulBit)) ? pMinusOne : pOne;
+    for(i=0; i < n; i++)pQk[i]=pQ1[i];
+    }
+  else
+    {
+    vMontMul(pmc, pQk, pQk, pQk);
+    if(mpz_tstbit(mpzK, ulBit))vMontMulSmall(pmc, pQk, pQk, lQ);
+    }
+  }
+
+/* Now pV=V_K and pV1=V_(K+1) for K=N+1 or K=d; U_K=0 iff
+   2*V_(K+1)=V_K. */
+
+vMontAdd(pmc, pT, pV1, pV1);
+vMontSub(pmc, pT, pT, pV);
+if(iMontIsZero(pmc, pT))
+  iResult=1;
+else if(iStrong)
+  for(r=0; r < s; r++)
+    {
+    if(iMontIsZero(pmc, pV))
+      {
+      iResult=1;
+      break;
+      }
+    if(r + 1 < s)
+      {
+      vMontMul(pmc, pV, pV, pV);
+      vMontSub(pmc, pV, pV, pQk);
+      vMontSub(pmc, pV, pV, pQk);
+      vMontMul(pmc, pQk, pQk, pQk);
+      }
+    }
+
+free(pV);
+mpz_clear(mpzK);
+mpz_clear(mpzT);
+return(iResult);
+}
+/**********************************************************************/
+int iLucasV(mpz_t mpzN, int iStrong)
+{
+/* As iLucasMont, with the same results, but computing V only, by the
+   ladder which holds (V_k, V_(k+1)) and steps to (V_2k, V_(2k+1)) or
+   (V_(2k+1), V_(2k+2)) with
+
+     V_2k=V_k^2 - 2*Q^k,  V_(2k+1)=V_k*V_(k+1) - P*Q^k.
+
+   U is recovered at the end from D*U_k=2*V_(k+1) - P*V_k, and since
+   Jacobi(D,N)=-1 makes D invertible mod N, U_k=0 exactly when
+   2*V_(k+1)=P*V_k.
+
+   Each bit costs one multiplication and one squaring when Q=+/-1 (D=5,
+   which Selfridge's search picks for about half of all N), since Q^k
+   is then known from the parity of k. For any other Q, Q^k has to be
+   squared as well, so a bit costs three full products, the same as in
+   iLucasMont, plus small multiplications by Q; there the ladder saves
+   nothing but the set-bit additions. */
+
+int iResult;
+long lD;
+MONTCTX mc;
+
+iResult=iSelfridgeD(mpzN, &lD);
+if(iResult >= 0)return(iResult);
+vMontInit(&mc, mpzN);
+iResult=iLucasVMont(&mc, mpzN, lD, iStrong);
+vMontClear(&mc);
+return(iResult);
+}
+/**********************************************************************/
+/**********************************************************************/
+int iPrPCandInit(PRPCAND *ppc, mpz_t mpzN, unsigned long ulMaxDivisor)
+{
+/* Prepares N for a series of tests by iMillerRabinCand and iLucasCand:
+   finds N - 1 = d*2^s, Selfridge's parameters D, P=1 and Q=(1 - D)/4,
+   and the Montgomery context of N, and carries out trial division by
+   ulPrmDiv(N, ulMaxDivisor). Each of these is then computed once, no
+   matter how many tests are run. Returns (and sets ppc->iStatus to) 1
+   if N is prime and 0 if N is composite, as decided by trial division
+   (with N < 3 and even N), and -1 if no conclusion was reached. The
+   tests may be run in any case. */
+
+int iComp2;
+
+mpz_init_set(ppc->mpzN, mpzN);
+mpz_init(ppc->mpzNm1);
+mpz_init(ppc->mpzd);
+mpz_init(ppc->mpzT);
+ppc->ulS=0;
+ppc->ulDiv=0;
+ppc->lD=0;
+ppc->lP=1;
+ppc->lQ=0;
+ppc->iLucas=0;
+ppc->iMont=0;
+
+iComp2=mpz_cmp_si(mpzN, 2);
+if(iComp2 < 0)return(ppc->iStatus=0);
+if(iComp2==0)return(ppc->iStatus=1);
+if(mpz_even_p(mpzN))return(ppc->iStatus=0);
+
+mpz_sub_ui(ppc->mpzNm1, mpzN, 1);
+ppc->ulS=mpz_scan1(ppc->mpzNm1, 0);
+mpz_tdiv_q_2exp(ppc->mpzd, ppc->mpzNm1, ppc->ulS);
+
+/* A perfect square, or a factor found while searching for D, settles
+   the Lucas tests (in ppc->iLucas) but not the Miller-Rabin tests. */
+
+ppc->iLucas=iSelfridgeD(mpzN, &ppc->lD);
+if(ppc->iLucas < 0)
+  ppc->lQ=(1 - ppc->lD)/4;
+else
+  ppc->lD=0;
+vMontInit(&ppc->mc, mpzN);
+ppc->iMont=1;
+
+ppc->iStatus=-1;
+ppc->ulDiv=ulPrmDiv(mpzN, ulMaxDivisor);
+if(ppc->ulDiv==1)ppc->iStatus=1;
+if(ppc->ulDiv > 1)ppc->iStatus=0;
+return(ppc->iStatus);
+}
+/**********************************************************************/
+void vPrPCandClear(PRPCAND *ppc)
+{
+if(ppc->iMont)vMontClear(&ppc->mc);
+mpz_clear(ppc->mpzN);
+mpz_clear(ppc->mpzNm1);
+mpz_clear(ppc->mpzd);
+mpz_clear(ppc->mpzT);
+return;
+}
+/**********************************************************************/
+int iMillerRabinCand(PRPCAND *ppc, unsigned long ulB)
+{
+/* iMillerRabin(N, B) for the prepared N, with the same results. */
+
+unsigned long ulGCD, r;
+
+if(!ppc->iMont)return(mpz_cmp_ui(ppc->mpzN, 2)==0);
+
+if(ulB < 2)ulB=2;
+while(1)
+  {
+  ulGCD=mpz_gcd_ui(NULL, ppc->mpzN, ulB);
+  if(ulGCD==1)break;
+  if(mpz_cmp_ui(ppc->mpzN, ulGCD) > 0)return(0);
+  ulB++;
+  }
+
+mpz_set_ui(ppc->mpzT, ulB);
+mpz_powm(ppc->mpzT, ppc->mpzT, ppc->mpzd, ppc->mpzN);
+if(mpz_cmp_ui(ppc->mpzT, 1)==0)return(1);
+if(mpz_cmp(ppc->mpzT, ppc->mpzNm1)==0)return(1);
+for(r=1; r < ppc->ulS; r++)
+  {
+  mpz_mul(ppc->mpzT, ppc->mpzT, ppc->mpzT);
+  mpz_mod(ppc->mpzT, ppc->mpzT, ppc->mpzN);
+  if(mpz_cmp(ppc->mpzT, ppc->mpzNm1)==0)return(1);
+  }
+return(0);
+}
+/**********************************************************************/
+int iLucasCand(PRPCAND *ppc, int iStrong)
+{
+/* iLucasSelfridge(N) (iStrong=0) or iStrongLucasSelfridge(N)
+   (iStrong=1) for the prepared N, with the same results, computed by
+   the ladder of iLucasV. */
+
+if(!ppc->iMont)return(mpz_cmp_ui(ppc->mpzN, 2)==0);
+if(ppc->lD==0)return(ppc->iLucas);
+return(iLucasVMont(&ppc->mc, ppc->mpzN, ppc->lD, iStrong));
+}
+/**********************************************************************/
+int iExtraStrongLucas(mpz_t mpzN, long lB)
+{
+/* Test N for primality using the extra strong Lucas test with base B,
+   as formulated by Zhaiyu Mo and James P. Jones ("A new primality test
+   using Lucas sequences," preprint, circa 1997), and described by Jon
+   Grantham in "Frobenius pseudoprimes," (preprint, 16 July 1998),
+   available at <http://www.pseudoprime.com/pseudo1.ps>.
+
+   Returns 1 if N is prime or an extra strong Lucas pseudoprime (base B).
+   Returns 0 if N is definitely composite.
+
+   Even N and N < 3 are eliminated before applying the Lucas test.
+
+   In this implementation of the algorithm, Q=1, and B is an integer
+   in 2 < B < INT32_MAX (2147483647 on 32-bit machines); the default value
+   is B=3. B is incremented as necessary if the values of B and N are
+   inconsistent with the hypotheses of Jones and Mo: P=B, Q=1,
+   D=P*P - 4*Q, GCD(N,2D)=1, Jacobi(D,N) <> 0.
+
+   Since the base B is used solely to calculate the discriminant
+   D=B*B - 4, negative values of B are redundant. The bases B=0 and
+   B=1 are excluded because they produce huge numbers of pseudoprimes,
+   and B=2 is excluded because the resulting D=0 fails the Jones-Mo
+   hypotheses.
+
+   Note that the choice Q=1 eliminates the computation of powers of Q
+   which appears in the weak and strong Lucas tests.
+
+   The running time of the extra strong Lucas-Selfridge test is, on
+   average, roughly 80 % that of the standard Lucas-Selfridge test
    or 2 to 6 times that of a single Miller-Rabin test. This is superior
    in speed to both the standard and strong Lucas-Selfridge tests. The
    frequency of extra strong Lucas pseudoprimes also appears to be
@@ -3912,9 +5592,10 @@ GPL for additional details. */
    <http://www.trnicely.net> from a standalone to a callable procedure.
    The error jumptables were eliminated in favor of an error return
    value, and the timing and printing options were removed (except
-   after fatal errors). The procedure free_expr has been disabled
-   (it simply returns) to alleviate an untraced fatal SIGSEGV violation,
-   at the cost of a memory leak. This is one of many problems encountered
+   after fatal errors). The procedure free_expr was disabled (it
+   simply returned) to alleviate an untraced fatal SIGSEGV violation,
+   at the cost of a memory leak; it has since been traced and fixed
+   (see free_expr). This is one of many problems encountered
    with GMP's allocation, re-allocation, and memory clearing algorithms;
    either the GMP source code must be cleaned up, or workarounds must be
    introduced into each application code (as TRN has done in the
@@ -3931,6 +5612,29 @@ GPL for additional details. */
    Success returns zero.  Any non-zero return is failure, and mpzResult
    will contain zero.
 
+   int iEvalExprMPZCtx(EXPRCTX *pec, mpz_t mpzResult, char *szExpression)
+
+   is the same with the random state and errors kept in a context set
+   up by vExprCtxInit, rather than in globals, for use from threads.
+
+   int iExprProgCompile(EXPRCTX *pec, EXPRPROG *pep, char *szExpression,
+     char *szVars)
+   int iExprProgEvalMPZ(EXPRCTX *pec, EXPRPROG *pep, mpz_t mpzResult)
+
+   compile an expression with variables, such as k*2^n-1 with szVars
+   "k,n", once to a program in reverse Polish notation, and evaluate it
+   for the values set in pep->mpzVar[0], pep->mpzVar[1], .. without
+   parsing it again or allocating any nodes or temporaries; this is
+   for evaluating the same form over many values of its parameters.
+   A name followed by ( is always taken as a function, so that sqrt(n)
+   is the square root even if sqrt is also named as a variable.
+
+   The compiler first evaluates the subtrees without variables (or
+   random(n)), such as the 1009# of k*1009#/30030-2908, and finds the
+   equal subtrees by their hashes, to evaluate each once per call.
+   Both evaluators keep the last EXPR_CACHE_SIZE large results of #, !,
+   fib and ^ in the context, where the next expressions may find them.
+
    The expression may be in C or BASIC format, with some exceptions.
    Note that the exponentiation operator is "^" and the modulus
    operator is "%".  The primorial operator is "#" (unary postfix,
@@ -3958,7 +5662,10 @@ GPL for additional details. */
 enum op_t {NOP, LIT, NEG, NOT, PLUS, MINUS, MULT, DIV, MOD, REM, INVMOD, POW,
 	   AND, IOR, XOR, SLL, SRA, POPCNT, HAMDIST, GCD, LCM, SQRT, ROOT, FAC,
 	   LOG, LOG2, FERMAT, MERSENNE, FIBONACCI, RANDOM, NEXTPRIME,
-           PRIMORIAL};
+           PRIMORIAL, VAR,
+           /* the following are used only by compiled programs */
+           MODABS, MODEND, MODRED, ADDMOD, SUBMOD, MULMOD, POWMOD, REMPOW,
+           SAVE, LOAD};
 
 /* Type for the expression tree.  */
 struct expr
@@ -3968,10 +5675,25 @@ struct expr
   {
     struct {struct expr *lhs, *rhs;} ops;
     mpz_t val;
+    int var;  /* the index of a VAR in the names given to the compiler */
   } operands;
+  unsigned long hash;  /* set by vExprMark for the compiler */
+  int flags;
 };
+#define EXPR_HAS_VAR    1  /* the flags: a VAR or RANDOM in the subtree */
+#define EXPR_HAS_RANDOM 2
 typedef struct expr *expr_t;
 
+/* An entry of the table of subtrees used by iExprProgCompile to find
+   the common subexpressions: the first of the equal subtrees, their
+   number, and the saved register of their value once computed. */
+typedef struct
+  {
+  expr_t  e;
+  int     nUses;
+  int     iSav;
+  } EXPRCSE;
+
 struct functions
 {
   char *spelling;
@@ -4020,28 +5742,39 @@ int iEvalExprMPZ(mpz_t mpzResult, char *szExpression);
 static char *skipspace _PROTO ((char *));
 static void makeexp _PROTO ((expr_t *, enum op_t, expr_t, expr_t));
 static void free_expr _PROTO ((expr_t));
-static char *expr _PROTO ((char *, expr_t *));
-static char *term _PROTO ((char *, expr_t *));
-static char *power _PROTO ((char *, expr_t *));
-static char *factor _PROTO ((char *, expr_t *));
+static char *expr _PROTO ((EXPRCTX *, char *, expr_t *));
+static char *term _PROTO ((EXPRCTX *, char *, expr_t *));
+static char *power _PROTO ((EXPRCTX *, char *, expr_t *));
+static char *factor _PROTO ((EXPRCTX *, char *, expr_t *));
 static int match _PROTO ((char *, char *));
 static int matchp _PROTO ((char *, char *));
-static void mpz_eval_expr _PROTO ((mpz_ptr, expr_t));
-static void mpz_eval_mod_expr _PROTO ((mpz_ptr, expr_t, mpz_ptr));
+static void mpz_eval_expr _PROTO ((EXPRCTX *, mpz_ptr, expr_t));
+static void mpz_eval_mod_expr _PROTO ((EXPRCTX *, mpz_ptr, expr_t, mpz_ptr));
+static void mpz_rem_pow _PROTO ((EXPRCTX *, mpz_ptr, mpz_ptr, mpz_ptr, mpz_ptr));
+static void mpz_powm_inv _PROTO ((EXPRCTX *, mpz_ptr, mpz_ptr, mpz_ptr, mpz_ptr));
+static void mpz_apply_op _PROTO ((EXPRCTX *, enum op_t, mpz_ptr, mpz_ptr, mpz_ptr));
+static void mpz_compute_op _PROTO ((EXPRCTX *, enum op_t, mpz_ptr, mpz_ptr, mpz_ptr));
+static unsigned long ulExprOpBits _PROTO ((enum op_t, mpz_ptr, mpz_ptr));
+static char *szExprCopy _PROTO ((char *));
+static int iExprNodes _PROTO ((expr_t));
+static void vExprEmit _PROTO ((EXPRPROG *, int, int, int));
+static void vExprMark _PROTO ((expr_t));
+static int iExprEqual _PROTO ((expr_t, expr_t));
+static expr_t eExprFold _PROTO ((EXPRCTX *, expr_t, int));
+static EXPRCSE *pExprCse _PROTO ((EXPRCSE *, int, expr_t));
+static void vExprCount _PROTO ((EXPRCSE *, int, expr_t, int));
+static void vExprCompile _PROTO ((EXPRPROG *, EXPRCSE *, int, expr_t, int));
+static void vExprCompileMod _PROTO ((EXPRPROG *, EXPRCSE *, int, expr_t, int,
+  int));
 
-char *error;
-int iGlobalError;
-char *newline = "";
-gmp_randstate_t rstate;
 
 /**********************************************************************/
 int iEvalExprMPZ(mpz_t mpzResult, char *szExpression)
 {
-char *str, *pchAstAst, *szCopy;
-struct expr *e;
+/* The original interface, with a context of its own for each call. */
 
-iGlobalError=0;
-gmp_randinit_lc_2exp_size (rstate, 128);
+EXPRCTX ec;
+int iRet;
 
 /* The following statements have been replaced to avoid problems
    caused by the absence of gettimeofday on some platforms:
@@ -4050,57 +5783,639 @@ gmp_randinit_lc_2exp_size (rstate, 128);
    gettimeofday(&tv, NULL);
    gmp_randseed_ui(rstate, tv.tv_sec + tv.tv_usec); */
 
-gmp_randseed_ui(rstate, 1 + time(NULL)*(314159311UL + clock()));
-szCopy=(char *)malloc(strlen(szExpression) + 1);
-strcpy(szCopy, szExpression);  // Don't modify input
-szTrimMWS(szCopy);
-pchAstAst=strstr(szCopy, "**");  // Replace Fortran/Cobol ** by ^
-while(pchAstAst)
-  {
-  *pchAstAst=' ';
-  *(pchAstAst+1)='^';
-  pchAstAst=strstr(pchAstAst+2, "**");
-  }
-str=expr(szCopy, &e);
-if (str[0] != 0)
+vExprCtxInit(&ec, 1 + time(NULL)*(314159311UL + clock()));
+iRet=iEvalExprMPZCtx(&ec, mpzResult, szExpression);
+vExprCtxClear(&ec);
+return(iRet);
+}
+/**********************************************************************/
+void vExprCtxInit(EXPRCTX *pec, unsigned long ulSeed)
+{
+/* Initialize a context for iEvalExprMPZCtx, with the random state used
+   by random(n) seeded once from ulSeed. A context may be used for any
+   number of expressions, but by only one thread at a time. */
+
+int i;
+
+gmp_randinit_lc_2exp_size(pec->rstate, 128);
+gmp_randseed_ui(pec->rstate, ulSeed);
+pec->szError=NULL;
+pec->iError=0;
+pec->pszVar=NULL;
+pec->nVar=0;
+for(i=0; i < EXPR_CACHE_SIZE; i++)
   {
-  mpz_set_ui(mpzResult, 0);
-  iGlobalError=1;
-  free_expr(e);
-  free(szCopy);
-  return(EXIT_FAILURE);
+  pec->aec[i].iOp=NOP;
+  mpz_init(pec->aec[i].mpzLhs);
+  mpz_init(pec->aec[i].mpzRhs);
+  mpz_init(pec->aec[i].mpzVal);
+  pec->aec[i].ulUsed=0;
   }
-else
+pec->ulTime=0;
+return;
+}
+/**********************************************************************/
+void vExprCtxClear(EXPRCTX *pec)
+{
+int i;
+
+gmp_randclear(pec->rstate);
+for(i=0; i < EXPR_CACHE_SIZE; i++)
   {
-  mpz_eval_expr(mpzResult, e);
-  free_expr(e);
-  free(szCopy);
-  return(EXIT_SUCCESS);
+  mpz_clear(pec->aec[i].mpzLhs);
+  mpz_clear(pec->aec[i].mpzRhs);
+  mpz_clear(pec->aec[i].mpzVal);
   }
+return;
 }
 /**********************************************************************/
-static char *expr (char *str, expr_t *e)
+int iEvalExprMPZCtx(EXPRCTX *pec, mpz_t mpzResult, char *szExpression)
 {
-  expr_t e2;
+/* iEvalExprMPZ with the state kept in *pec rather than in globals, so
+   that threads with contexts of their own can evaluate expressions
+   at the same time. Returns zero on success; on a syntax error, or an
+   error in the evaluation (with its message in pec->szError), returns
+   EXIT_FAILURE and sets mpzResult to zero. */
+
+char *str, *szCopy;
+struct expr *e;
+
+pec->iError=0;
+pec->szError=NULL;
+szCopy=szExprCopy(szExpression);
+str=expr(pec, szCopy, &e);
+if (str[0] != 0)
+  {
+  pec->iError=1;
+  if(pec->szError==NULL)pec->szError="syntax error";
+  }
+else
+  mpz_eval_expr(pec, mpzResult, e);
+free_expr(e);
+free(szCopy);
+if(pec->iError)
+  {
+  mpz_set_ui(mpzResult, 0);
+  return(EXIT_FAILURE);
+  }
+return(EXIT_SUCCESS);
+}
+/**********************************************************************/
+int iExprProgCompile(EXPRCTX *pec, EXPRPROG *pep, char *szExpression,
+  char *szVars)
+{
+/* Compile the expression, in which the names in the comma-separated
+   list szVars (such as "k,n", or NULL for none) may be used as
+   variables, to a program for iExprProgEvalMPZ. Returns zero on
+   success; on a syntax error returns EXIT_FAILURE with the program
+   left empty (vExprProgClear may still be called). */
+
+char *str, *szCopy, *szNames, *pch;
+struct expr *e;
+EXPRCSE *pcse;
+int i, nNodes, nCse;
+
+pep->pei=NULL;
+pep->nIns=0;
+pep->mpzReg=NULL;
+pep->nReg=0;
+pep->mpzLit=NULL;
+pep->nLit=0;
+pep->mpzVar=NULL;
+pep->nVar=0;
+pep->mpzSav=NULL;
+pep->nSav=0;
+pec->iError=0;
+pec->szError=NULL;
+
+/* Split the names in place; strtok is not reentrant. */
+
+if(szVars==NULL)szVars="";
+szNames=(char *)malloc(strlen(szVars) + 1);
+strcpy(szNames, szVars);
+pec->pszVar=(char **)malloc((strlen(szVars) + 1)*sizeof(char *));
+pec->nVar=0;
+pch=szNames;
+while(1)
+  {
+  while(*pch==',' || *pch==' ')*pch++=0;
+  if(*pch==0)break;
+  pec->pszVar[pec->nVar++]=pch;
+  while(*pch && *pch != ',' && *pch != ' ')pch++;
+  }
+
+szCopy=szExprCopy(szExpression);
+str=expr(pec, szCopy, &e);
+pep->nVar=pec->nVar;
+free(pec->pszVar);
+pec->pszVar=NULL;
+pec->nVar=0;
+free(szNames);
+if (str[0] != 0)
+  {
+  free_expr(e);
+  free(szCopy);
+  pep->nVar=0;
+  pec->iError=1;
+  if(pec->szError==NULL)pec->szError="syntax error";
+  return(EXIT_FAILURE);
+  }
+free(szCopy);
+
+/* Evaluate the constant subtrees, and count the equal subtrees in a
+   hash table of at least twice as many entries as nodes, to evaluate
+   them once and save them. Each node then gives at most four
+   instructions (a MOD reduced modulo another, and saved) and at most
+   one constant. */
+
+vExprMark(e);
+e=eExprFold(pec, e, 0);
+vExprMark(e);
+nNodes=iExprNodes(e);
+for(nCse=2; nCse < 2*nNodes; nCse*=2);
+pcse=(EXPRCSE *)calloc(nCse, sizeof(EXPRCSE));
+vExprCount(pcse, nCse, e, 0);
+pep->pei=(EXPRINS *)malloc(4*nNodes*sizeof(EXPRINS));
+pep->mpzLit=(mpz_t *)malloc(nNodes*sizeof(mpz_t));
+vExprCompile(pep, pcse, nCse, e, 0);
+free(pcse);
+free_expr(e);
+pep->mpzSav=(mpz_t *)malloc((pep->nSav + 1)*sizeof(mpz_t));
+for(i=0; i < pep->nSav; i++)mpz_init(pep->mpzSav[i]);
+
+pep->mpzReg=(mpz_t *)malloc(pep->nReg*sizeof(mpz_t));
+for(i=0; i < pep->nReg; i++)mpz_init(pep->mpzReg[i]);
+pep->mpzVar=(mpz_t *)malloc((pep->nVar + 1)*sizeof(mpz_t));
+for(i=0; i < pep->nVar; i++)mpz_init(pep->mpzVar[i]);
+return(EXIT_SUCCESS);
+}
+/**********************************************************************/
+int iExprProgEvalMPZ(EXPRCTX *pec, EXPRPROG *pep, mpz_t mpzResult)
+{
+/* Run the program with the current values of pep->mpzVar[], with the
+   same results and errors as iEvalExprMPZCtx on the expression with
+   those values in place of the variables. The context is used only
+   for random(n) and the errors. */
+
+EXPRINS *pei, *peiEnd;
+mpz_ptr r, r1, m;
+
+pec->iError=0;
+pec->szError=NULL;
+if(pep->nIns==0)
+  {
+  pec->iError=1;
+  pec->szError="no program";
+  mpz_set_ui(mpzResult, 0);
+  return(EXIT_FAILURE);
+  }
+peiEnd=pep->pei + pep->nIns;
+for(pei=pep->pei; pei < peiEnd; pei++)
+  {
+  r=pep->mpzReg[pei->iDst];
+  r1=pep->mpzReg[pei->iDst + 1];
+  switch(pei->iOp)
+    {
+    case LIT:
+      mpz_set(r, pep->mpzLit[pei->iArg]);
+      break;
+    case VAR:
+      mpz_set(r, pep->mpzVar[pei->iArg]);
+      break;
+    case MODABS:  /* r is the modulus of a MOD */
+      mpz_abs(r, r);
+      if(mpz_sgn(r)==0)
+        {
+        pec->szError="division by zero";
+        pec->iError=1;
+        }
+      break;
+    case MODEND:  /* the result of the MOD replaces its modulus */
+      mpz_swap(r, r1);
+      break;
+    case MODRED:
+      mpz_mod(r, r, pep->mpzReg[pei->iArg]);
+      break;
+    case ADDMOD:
+    case SUBMOD:
+      m=pep->mpzReg[pei->iArg];
+      if(pei->iOp==ADDMOD)
+        mpz_add(r, r, r1);
+      else
+        mpz_sub(r, r, r1);
+      if(mpz_sgn(r) < 0)
+        mpz_add(r, r, m);
+      else if(mpz_cmp(r, m) >= 0)
+        mpz_sub(r, r, m);
+      break;
+    case MULMOD:
+      mpz_mul(r, r, r1);
+      mpz_mod(r, r, pep->mpzReg[pei->iArg]);
+      break;
+    case POWMOD:
+      mpz_powm_inv(pec, r, r, r1, pep->mpzReg[pei->iArg]);
+      break;
+    case REMPOW:
+      mpz_rem_pow(pec, r, r, r1, pep->mpzReg[pei->iDst + 2]);
+      break;
+    case SAVE:
+      mpz_set(pep->mpzSav[pei->iArg], r);
+      break;
+    case LOAD:
+      mpz_set(r, pep->mpzSav[pei->iArg]);
+      break;
+    default:
+      mpz_apply_op(pec, (enum op_t)pei->iOp, r, r, r1);
+      break;
+    }
+  if(pec->iError)
+    {
+    mpz_set_ui(mpzResult, 0);
+    return(EXIT_FAILURE);
+    }
+  }
+mpz_set(mpzResult, pep->mpzReg[0]);
+return(EXIT_SUCCESS);
+}
+/**********************************************************************/
+void vExprProgClear(EXPRPROG *pep)
+{
+int i;
+
+for(i=0; i < pep->nReg; i++)mpz_clear(pep->mpzReg[i]);
+for(i=0; i < pep->nLit; i++)mpz_clear(pep->mpzLit[i]);
+for(i=0; i < pep->nVar; i++)mpz_clear(pep->mpzVar[i]);
+for(i=0; i < pep->nSav; i++)mpz_clear(pep->mpzSav[i]);
+free(pep->pei);
+free(pep->mpzReg);
+free(pep->mpzLit);
+free(pep->mpzVar);
+free(pep->mpzSav);
+pep->pei=NULL;
+pep->mpzReg=pep->mpzLit=pep->mpzVar=pep->mpzSav=NULL;
+pep->nIns=pep->nReg=pep->nLit=pep->nVar=pep->nSav=0;
+return;
+}
+/**********************************************************************/
+static int iExprNodes(expr_t e)
+{
+if(e==NULL)return(0);
+if(e->op==LIT || e->op==VAR)return(1);
+return(1 + iExprNodes(e->operands.ops.lhs) + iExprNodes(e->operands.ops.rhs));
+}
+/**********************************************************************/
+static void vExprEmit(EXPRPROG *pep, int iOp, int iDst, int iArg)
+{
+/* Append an instruction, which may use the register above iDst. */
+
+pep->pei[pep->nIns].iOp=iOp;
+pep->pei[pep->nIns].iDst=iDst;
+pep->pei[pep->nIns].iArg=iArg;
+pep->nIns++;
+if(iDst + 2 > pep->nReg)pep->nReg=iDst + 2;
+return;
+}
+/**********************************************************************/
+static void vExprMark(expr_t e)
+{
+/* Set the hash of E and its subtrees, equal for equal subtrees, and
+   their flags. */
+
+unsigned long h;
+
+switch(e->op)
+  {
+  case LIT:
+    h=mpz_get_ui(e->operands.val) + 31*mpz_size(e->operands.val)
+      + mpz_sgn(e->operands.val);
+    e->flags=0;
+    break;
+  case VAR:
+    h=e->operands.var;
+    e->flags=EXPR_HAS_VAR;
+    break;
+  default:
+    vExprMark(e->operands.ops.lhs);
+    h=e->operands.ops.lhs->hash;
+    e->flags=e->operands.ops.lhs->flags;
+    if(e->operands.ops.rhs != NULL)
+      {
+      vExprMark(e->operands.ops.rhs);
+      h=h*2654435761UL + e->operands.ops.rhs->hash;
+      e->flags|=e->operands.ops.rhs->flags;
+      }
+    if(e->op==RANDOM)e->flags|=EXPR_HAS_RANDOM;
+    break;
+  }
+e->hash=(h ^ h >> 15)*2654435761UL + e->op;
+return;
+}
+/**********************************************************************/
+static int iExprEqual(expr_t e1, expr_t e2)
+{
+if(e1==e2)return(1);
+if(e1==NULL || e2==NULL)return(0);
+if(e1->hash != e2->hash || e1->op != e2->op)return(0);
+if(e1->op==LIT)return(mpz_cmp(e1->operands.val, e2->operands.val)==0);
+if(e1->op==VAR)return(e1->operands.var==e2->operands.var);
+return(iExprEqual(e1->operands.ops.lhs, e2->operands.ops.lhs)
+  && iExprEqual(e1->operands.ops.rhs, e2->operands.ops.rhs));
+}
+/**********************************************************************/
+static expr_t eExprFold(EXPRCTX *pec, expr_t e, int iMod)
+{
+/* Replace each largest subtree of E without a variable or random(n)
+   by its value, and return the new E. iMod is 1 if E is evaluated
+   modulo something, as in mpz_eval_mod_expr, where the ^, +, - and *
+   of constants are not evaluated, as their values may be far larger
+   than their residues; nor is the ^ of a REM. A subtree whose
+   evaluation fails is left for iExprProgEvalMPZ to report. */
+
+mpz_t mpz;
+
+if(e->op==LIT || e->op==VAR)return(e);
+if((e->flags & (EXPR_HAS_VAR | EXPR_HAS_RANDOM))==0
+  && !(iMod && (e->op==POW || e->op==PLUS || e->op==MINUS || e->op==MULT)))
+  {
+  mpz_init(mpz);
+  mpz_eval_expr(pec, mpz, e);
+  if(pec->iError)
+    {
+    pec->iError=0;
+    pec->szError=NULL;
+    mpz_clear(mpz);
+    return(e);
+    }
+  free_expr(e);
+  e=(expr_t)malloc(sizeof(struct expr));
+  e->op=LIT;
+  mpz_init(e->operands.val);
+  mpz_swap(e->operands.val, mpz);
+  mpz_clear(mpz);
+  return(e);
+  }
+
+switch(e->op)
+  {
+  case MOD:
+    e->operands.ops.rhs=eExprFold(pec, e->operands.ops.rhs, 0);
+    e->operands.ops.lhs=eExprFold(pec, e->operands.ops.lhs, 1);
+    return(e);
+  case REM:
+    if(e->operands.ops.lhs->op==POW)
+      {
+      expr_t ePow=e->operands.ops.lhs;
+      ePow->operands.ops.lhs=eExprFold(pec, ePow->operands.ops.lhs, 0);
+      ePow->operands.ops.rhs=eExprFold(pec, ePow->operands.ops.rhs, 0);
+      e->operands.ops.rhs=eExprFold(pec, e->operands.ops.rhs, 0);
+      return(e);
+      }
+    break;
+  case POW:
+    if(iMod)
+      {
+      e->operands.ops.lhs=eExprFold(pec, e->operands.ops.lhs, 1);
+      e->operands.ops.rhs=eExprFold(pec, e->operands.ops.rhs, 0);
+      return(e);
+      }
+    break;
+  case PLUS:
+  case MINUS:
+  case MULT:
+    if(iMod)
+      {
+      e->operands.ops.lhs=eExprFold(pec, e->operands.ops.lhs, 1);
+      e->operands.ops.rhs=eExprFold(pec, e->operands.ops.rhs, 1);
+      return(e);
+      }
+    break;
+  default:
+    break;
+  }
+e->operands.ops.lhs=eExprFold(pec, e->operands.ops.lhs, 0);
+if(e->operands.ops.rhs != NULL)
+  e->operands.ops.rhs=eExprFold(pec, e->operands.ops.rhs, 0);
+return(e);
+}
+/**********************************************************************/
+static EXPRCSE *pExprCse(EXPRCSE *pcse, int nCse, expr_t e)
+{
+/* The entry of the subtrees equal to E in the table of nCse (a power
+   of 2) entries, or the free entry for them. */
+
+int i;
+
+i=e->hash & (nCse - 1);
+while(pcse[i].e != NULL && !iExprEqual(pcse[i].e, e))i=(i + 1) & (nCse - 1);
+return(&pcse[i]);
+}
+/**********************************************************************/
+static void vExprCount(EXPRCSE *pcse, int nCse, expr_t e, int iMod)
+{
+/* Count the subtrees of E that vExprCompile would evaluate, in the same
+   order, with iMod 1 for vExprCompileMod; a subtree equal to one seen
+   before is counted, but not its own subtrees. */
+
+EXPRCSE *p;
+
+if(iMod)
+  {
+  switch(e->op)
+    {
+    case POW:
+      vExprCount(pcse, nCse, e->operands.ops.lhs, 1);
+      vExprCount(pcse, nCse, e->operands.ops.rhs, 0);
+      return;
+    case PLUS:
+    case MINUS:
+    case MULT:
+      vExprCount(pcse, nCse, e->operands.ops.lhs, 1);
+      vExprCount(pcse, nCse, e->operands.ops.rhs, 1);
+      return;
+    default:
+      vExprCount(pcse, nCse, e, 0);
+      return;
+    }
+  }
+
+if(e->op==LIT || e->op==VAR)return;
+if((e->flags & EXPR_HAS_RANDOM)==0)
+  {
+  p=pExprCse(pcse, nCse, e);
+  if(p->e != NULL)
+    {
+    p->nUses++;
+    return;
+    }
+  p->e=e;
+  p->nUses=1;
+  p->iSav=-1;
+  }
+switch(e->op)
+  {
+  case MOD:
+    vExprCount(pcse, nCse, e->operands.ops.rhs, 0);
+    vExprCount(pcse, nCse, e->operands.ops.lhs, 1);
+    return;
+  case REM:
+    if(e->operands.ops.lhs->op==POW)
+      {
+      vExprCount(pcse, nCse, e->operands.ops.lhs->operands.ops.lhs, 0);
+      vExprCount(pcse, nCse, e->operands.ops.lhs->operands.ops.rhs, 0);
+      vExprCount(pcse, nCse, e->operands.ops.rhs, 0);
+      return;
+      }
+    break;
+  default:
+    break;
+  }
+vExprCount(pcse, nCse, e->operands.ops.lhs, 0);
+if(e->operands.ops.rhs != NULL)
+  vExprCount(pcse, nCse, e->operands.ops.rhs, 0);
+return;
+}
+/**********************************************************************/
+static void vExprCompile(EXPRPROG *pep, EXPRCSE *pcse, int nCse, expr_t e,
+  int iDst)
+{
+/* Instructions to put the value of E in register iDst, with the
+   registers above it free, as mpz_eval_expr. The first of the subtrees
+   that vExprCount found more than once is saved, and the rest loaded. */
+
+EXPRCSE *p=NULL;
+int i;
+
+switch(e->op)
+  {
+  case LIT:  /* equal constants share one copy */
+    for(i=0; i < pep->nLit; i++)
+      if(mpz_cmp(pep->mpzLit[i], e->operands.val)==0)break;
+    if(i==pep->nLit)mpz_init_set(pep->mpzLit[pep->nLit++], e->operands.val);
+    vExprEmit(pep, LIT, iDst, i);
+    return;
+  case VAR:
+    vExprEmit(pep, VAR, iDst, e->operands.var);
+    return;
+  default:
+    break;
+  }
+if((e->flags & EXPR_HAS_RANDOM)==0)
+  {
+  p=pExprCse(pcse, nCse, e);
+  if(p->nUses < 2)
+    p=NULL;
+  else if(p->iSav >= 0)
+    {
+    vExprEmit(pep, LOAD, iDst, p->iSav);
+    return;
+    }
+  }
+
+switch(e->op)
+  {
+  case MOD:
+    vExprCompile(pep, pcse, nCse, e->operands.ops.rhs, iDst);
+    vExprEmit(pep, MODABS, iDst, 0);
+    vExprCompileMod(pep, pcse, nCse, e->operands.ops.lhs, iDst + 1, iDst);
+    vExprEmit(pep, MODEND, iDst, 0);
+    break;
+  case REM:
+    if(e->operands.ops.lhs->op==POW)
+      {
+      vExprCompile(pep, pcse, nCse, e->operands.ops.lhs->operands.ops.lhs,
+        iDst);
+      vExprCompile(pep, pcse, nCse, e->operands.ops.lhs->operands.ops.rhs,
+        iDst + 1);
+      vExprCompile(pep, pcse, nCse, e->operands.ops.rhs, iDst + 2);
+      vExprEmit(pep, REMPOW, iDst, 0);
+      break;
+      }
+    /* fall through */
+  default:
+    vExprCompile(pep, pcse, nCse, e->operands.ops.lhs, iDst);
+    if(e->operands.ops.rhs != NULL)
+      vExprCompile(pep, pcse, nCse, e->operands.ops.rhs, iDst + 1);
+    vExprEmit(pep, e->op, iDst, 0);
+    break;
+  }
+if(p != NULL)
+  {
+  p->iSav=pep->nSav++;
+  vExprEmit(pep, SAVE, iDst, p->iSav);
+  }
+return;
+}
+/**********************************************************************/
+static void vExprCompileMod(EXPRPROG *pep, EXPRCSE *pcse, int nCse,
+  expr_t e, int iDst, int iMod)
+{
+/* The same for the value of E modulo register iMod, as
+   mpz_eval_mod_expr. */
+
+switch(e->op)
+  {
+  case POW:
+    vExprCompileMod(pep, pcse, nCse, e->operands.ops.lhs, iDst, iMod);
+    vExprCompile(pep, pcse, nCse, e->operands.ops.rhs, iDst + 1);
+    vExprEmit(pep, POWMOD, iDst, iMod);
+    return;
+  case PLUS:
+  case MINUS:
+  case MULT:
+    vExprCompileMod(pep, pcse, nCse, e->operands.ops.lhs, iDst, iMod);
+    vExprCompileMod(pep, pcse, nCse, e->operands.ops.rhs, iDst + 1, iMod);
+    vExprEmit(pep, e->op==PLUS ? ADDMOD : e->op==MINUS ? SUBMOD : MULMOD,
+      iDst, iMod);
+    return;
+  default:
+    vExprCompile(pep, pcse, nCse, e, iDst);
+    vExprEmit(pep, MODRED, iDst, iMod);
+    return;
+  }
+}
+/**********************************************************************/
+static char *szExprCopy(char *szExpression)
+{
+/* A trimmed copy of the expression, to be freed by the caller, with
+   the Fortran/Cobol ** replaced by ^. */
+
+char *pchAstAst, *szCopy;
+
+szCopy=(char *)malloc(strlen(szExpression) + 1);
+strcpy(szCopy, szExpression);  // Don't modify input
+szTrimMWS(szCopy);
+pchAstAst=strstr(szCopy, "**");
+while(pchAstAst)
+  {
+  *pchAstAst=' ';
+  *(pchAstAst+1)='^';
+  pchAstAst=strstr(pchAstAst+2, "**");
+  }
+return(szCopy);
+}
+/**********************************************************************/
+static char *expr (EXPRCTX *pec, char *str, expr_t *e)
+{
+  expr_t e2;
 
   str = skipspace (str);
   if (str[0] == '+')
     {
-      str = term (str + 1, e);
+      str = term (pec, str + 1, e);
     }
   else if (str[0] == '-')
     {
-      str = term (str + 1, e);
+      str = term (pec, str + 1, e);
       makeexp (e, NEG, *e, NULL);
     }
   else if (str[0] == '~')
     {
-      str = term (str + 1, e);
+      str = term (pec, str + 1, e);
       makeexp (e, NOT, *e, NULL);
     }
   else
     {
-      str = term (str, e);
+      str = term (pec, str, e);
     }
 
   for (;;)
@@ -4111,7 +6426,7 @@ static char *expr (char *str, expr_t *e)
 	case 'p':
 	  if (match ("plus", str))
 	    {
-	      str = term (str + 4, &e2);
+	      str = term (pec, str + 4, &e2);
 	      makeexp (e, PLUS, *e, e2);
 	    }
 	  else
@@ -4120,18 +6435,18 @@ static char *expr (char *str, expr_t *e)
 	case 'm':
 	  if (match ("minus", str))
 	    {
-	      str = term (str + 5, &e2);
+	      str = term (pec, str + 5, &e2);
 	      makeexp (e, MINUS, *e, e2);
 	    }
 	  else
 	    return str;
 	  break;
 	case '+':
-	  str = term (str + 1, &e2);
+	  str = term (pec, str + 1, &e2);
 	  makeexp (e, PLUS, *e, e2);
 	  break;
 	case '-':
-	  str = term (str + 1, &e2);
+	  str = term (pec, str + 1, &e2);
 	  makeexp (e, MINUS, *e, e2);
 	  break;
 	default:
@@ -4140,11 +6455,11 @@ static char *expr (char *str, expr_t *e)
     }
 }
 /**********************************************************************/
-static char *term (char *str, expr_t *e)
+static char *term (EXPRCTX *pec, char *str, expr_t *e)
 {
   expr_t e2;
 
-  str = power (str, e);
+  str = power (pec, str, e);
   for (;;)
     {
       str = skipspace (str);
@@ -4153,13 +6468,13 @@ static char *term (char *str, expr_t *e)
 	case 'm':
 	  if (match ("mul", str))
 	    {
-	      str = power (str + 3, &e2);
+	      str = power (pec, str + 3, &e2);
 	      makeexp (e, MULT, *e, e2);
 	      break;
 	    }
 	  if (match ("mod", str))
 	    {
-	      str = power (str + 3, &e2);
+	      str = power (pec, str + 3, &e2);
 	      makeexp (e, MOD, *e, e2);
 	      break;
 	    }
@@ -4167,7 +6482,7 @@ static char *term (char *str, expr_t *e)
 	case 'd':
 	  if (match ("div", str))
 	    {
-	      str = power (str + 3, &e2);
+	      str = power (pec, str + 3, &e2);
 	      makeexp (e, DIV, *e, e2);
 	      break;
 	    }
@@ -4175,7 +6490,7 @@ static char *term (char *str, expr_t *e)
 	case 'r':
 	  if (match ("rem", str))
 	    {
-	      str = power (str + 3, &e2);
+	      str = power (pec, str + 3, &e2);
 	      makeexp (e, REM, *e, e2);
 	      break;
 	    }
@@ -4183,7 +6498,7 @@ static char *term (char *str, expr_t *e)
 	case 'i':
 	  if (match ("invmod", str))
 	    {
-	      str = power (str + 6, &e2);
+	      str = power (pec, str + 6, &e2);
 	      makeexp (e, REM, *e, e2);
 	      break;
 	    }
@@ -4191,33 +6506,33 @@ static char *term (char *str, expr_t *e)
 	case 't':
 	  if (match ("times", str))
 	    {
-	      str = power (str + 5, &e2);
+	      str = power (pec, str + 5, &e2);
 	      makeexp (e, MULT, *e, e2);
 	      break;
 	    }
 	  if (match ("thru", str))
 	    {
-	      str = power (str + 4, &e2);
+	      str = power (pec, str + 4, &e2);
 	      makeexp (e, DIV, *e, e2);
 	      break;
 	    }
 	  if (match ("through", str))
 	    {
-	      str = power (str + 7, &e2);
+	      str = power (pec, str + 7, &e2);
 	      makeexp (e, DIV, *e, e2);
 	      break;
 	    }
 	  return str;
 	case '*':
-	  str = power (str + 1, &e2);
+	  str = power (pec, str + 1, &e2);
 	  makeexp (e, MULT, *e, e2);
 	  break;
 	case '/':
-	  str = power (str + 1, &e2);
+	  str = power (pec, str + 1, &e2);
 	  makeexp (e, DIV, *e, e2);
 	  break;
 	case '%':
-	  str = power (str + 1, &e2);
+	  str = power (pec, str + 1, &e2);
 	  makeexp (e, MOD, *e, e2);
 	  break;
 	default:
@@ -4226,11 +6541,11 @@ static char *term (char *str, expr_t *e)
     }
 }
 /**********************************************************************/
-static char *power (char *str, expr_t *e)
+static char *power (EXPRCTX *pec, char *str, expr_t *e)
 {
   expr_t e2;
 
-  str = factor (str, e);
+  str = factor (pec, str, e);
   while (str[0] == '!')
     {
       str++;
@@ -4244,7 +6559,7 @@ static char *power (char *str, expr_t *e)
   str = skipspace (str);
   if (str[0] == '^')
     {
-      str = power (str + 1, &e2);
+      str = power (pec, str + 1, &e2);
       makeexp (e, POW, *e, e2);
     }
 
@@ -4281,7 +6596,7 @@ static int matchp (char *s, char *str)
   return 0;
 }
 /**********************************************************************/
-static char *factor (char *str, expr_t *e)
+static char *factor (EXPRCTX *pec, char *str, expr_t *e)
 {
   expr_t e1, e2;
 
@@ -4299,11 +6614,13 @@ static char *factor (char *str, expr_t *e)
 	      cnt = matchp (fns[i].spelling, str);
 	      if (cnt != 0)
 		{
-		  str = expr (str + cnt, &e1);
+		  str = expr (pec, str + cnt, &e1);
 		  str = skipspace (str);
 		  if (str[0] != ')')
 		    {
-                      iGlobalError=1;
+                      free_expr (e1);
+                      pec->iError=1;
+                      *e=NULL;
                       return("1");
 		    }
 		  makeexp (e, fns[i].op, e1, NULL);
@@ -4319,17 +6636,19 @@ static char *factor (char *str, expr_t *e)
 	      cnt = matchp (fns[i].spelling, str);
 	      if (cnt != 0)
 		{
-		  str = expr (str + cnt, &e1);
+		  str = expr (pec, str + cnt, &e1);
 		  str = skipspace (str);
 
 		  if (str[0] != ',')
 		    {
-                      iGlobalError=1;
+                      free_expr (e1);
+                      pec->iError=1;
+                      *e=NULL;
                       return("1");
 		    }
 
 		  str = skipspace (str + 1);
-		  str = expr (str, &e2);
+		  str = expr (pec, str, &e2);
 		  str = skipspace (str);
 
 		  if (fns[i].arity == 0)
@@ -4338,14 +6657,17 @@ static char *factor (char *str, expr_t *e)
 			{
 			  makeexp (&e1, fns[i].op, e1, e2);
 			  str = skipspace (str + 1);
-			  str = expr (str, &e2);
+			  str = expr (pec, str, &e2);
 			  str = skipspace (str);
 			}
 		    }
 
 		  if (str[0] != ')')
 		    {
-                      iGlobalError=1;
+                      free_expr (e1);
+                      free_expr (e2);
+                      pec->iError=1;
+                      *e=NULL;
                       return("1");
 		    }
 
@@ -4354,15 +6676,29 @@ static char *factor (char *str, expr_t *e)
 		}
 	    }
 	}
+
+      for (i = 0; i < pec->nVar; i++)
+	{
+	  cnt = strlen (pec->pszVar[i]);
+	  if (strncmp (str, pec->pszVar[i], cnt) == 0
+	      && !isalnum (str[cnt]) && str[cnt] != '_')
+	    {
+	      makeexp (e, VAR, NULL, NULL);
+	      (*e)->operands.var = i;
+	      return str + cnt;
+	    }
+	}
     }
 
   if (str[0] == '(')
     {
-      str = expr (str + 1, e);
+      str = expr (pec, str + 1, e);
       str = skipspace (str);
       if (str[0] != ')')
 	{
-          iGlobalError=1;
+          free_expr (*e);
+          pec->iError=1;
+          *e=NULL;
           return("1");
 	}
       str++;
@@ -4389,7 +6725,8 @@ static char *factor (char *str, expr_t *e)
     }
   else
     {
-      iGlobalError=1;
+      pec->iError=1;
+      *e=NULL;
       return("1");
     }
   return str;
@@ -4420,29 +6757,30 @@ static void free_expr(expr_t e)
 {
 /* Free the memory used by expression E.  */
 
-  return;
-
-/* Bug-fixing hack (T. R. Nicely 2003.10.10).  This routine was
-   generating unpredictable crashes (non-trappable SIGSEGV violations).
-   Signal trapping and other measures failed to solve the problem,
-   and the ultimate fault has not been fixed or even pinned down.
-   Disabling the routine leaves a potential memory leak in the
-   program, which has thus far not been a problem. */
+/* This routine was disabled (T. R. Nicely 2003.10.10) after it caused
+   unpredictable crashes. Those came from freeing the uninitialized
+   subtrees that a syntax error left behind; factor now sets them to
+   NULL, which is skipped here, and the routine is enabled again so
+   that repeated calls do not leak memory. */
 
-  if (e->op != LIT)
+  if (e == NULL)
+    return;
+  if (e->op == VAR)
+    ;
+  else if (e->op != LIT)
     {
       free_expr (e->operands.ops.lhs);
-      if (e->operands.ops.rhs != NULL)
-	free_expr (e->operands.ops.rhs);
+      free_expr (e->operands.ops.rhs);
     }
   else
     {
       mpz_clear (e->operands.val);
     }
+  free (e);
   return;
 }
 /**********************************************************************/
-static void mpz_eval_expr(mpz_ptr r, expr_t e)
+static void mpz_eval_expr(EXPRCTX *pec, mpz_ptr r, expr_t e)
 {
 /* Evaluate the expression E and put the result in R.  */
 
@@ -4453,39 +6791,18 @@ static void mpz_eval_expr(mpz_ptr r, expr_t e)
     case LIT:
       mpz_set (r, e->operands.val);
       return;
-    case PLUS:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
-      mpz_add (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
-      return;
-    case MINUS:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
-      mpz_sub (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
-      return;
-    case MULT:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
-      mpz_mul (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
-      return;
-    case DIV:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
-      mpz_fdiv_q (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
-      return;
     case MOD:
       mpz_init (rhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
+      mpz_eval_expr (pec, rhs, e->operands.ops.rhs);
       mpz_abs (rhs, rhs);
-      mpz_eval_mod_expr (r, e->operands.ops.lhs, rhs);
+      if (mpz_sgn (rhs) == 0)
+	{
+	  pec->szError = "division by zero";
+	  pec->iError=1;
+	  mpz_set_ui (r, 0);
+	}
+      else
+	mpz_eval_mod_expr (pec, r, e->operands.ops.lhs, rhs);
       mpz_clear (rhs);
       return;
     case REM:
@@ -4496,36 +6813,211 @@ static void mpz_eval_expr(mpz_ptr r, expr_t e)
 	  mpz_init (powlhs);
 	  mpz_init (powrhs);
 	  mpz_init (rhs);
-	  mpz_eval_expr (powlhs, e->operands.ops.lhs->operands.ops.lhs);
-	  mpz_eval_expr (powrhs, e->operands.ops.lhs->operands.ops.rhs);
-	  mpz_eval_expr (rhs, e->operands.ops.rhs);
-	  mpz_powm (r, powlhs, powrhs, rhs);
-	  if (mpz_cmp_si (rhs, 0L) < 0)
-	    mpz_neg (r, r);
+	  mpz_eval_expr (pec, powlhs, e->operands.ops.lhs->operands.ops.lhs);
+	  mpz_eval_expr (pec, powrhs, e->operands.ops.lhs->operands.ops.rhs);
+	  mpz_eval_expr (pec, rhs, e->operands.ops.rhs);
+	  mpz_rem_pow (pec, r, powlhs, powrhs, rhs);
 	  mpz_clear (powlhs);
 	  mpz_clear (powrhs);
 	  mpz_clear (rhs);
 	  return;
 	}
+      /* fall through */
+    default:
       mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
-      mpz_fdiv_r (r, lhs, rhs);
+      mpz_eval_expr (pec, lhs, e->operands.ops.lhs);
+      if (e->operands.ops.rhs != NULL)
+	mpz_eval_expr (pec, rhs, e->operands.ops.rhs);
+      mpz_apply_op (pec, e->op, r, lhs, rhs);
       mpz_clear (lhs); mpz_clear (rhs);
       return;
+    }
+}
+/**********************************************************************/
+static void mpz_rem_pow (EXPRCTX *pec, mpz_ptr r, mpz_ptr b, mpz_ptr x,
+  mpz_ptr m)
+{
+/* Put B^X rem M in R, for the REM of a POW.  */
+
+  if (mpz_sgn (m) == 0)
+    {
+      pec->szError = "division by zero";
+      pec->iError=1;
+      mpz_set_ui (r, 0);
+      return;
+    }
+  mpz_powm_inv (pec, r, b, x, m);
+  if (mpz_cmp_si (m, 0L) < 0)
+    mpz_neg (r, r);
+  return;
+}
+/**********************************************************************/
+static void mpz_powm_inv (EXPRCTX *pec, mpz_ptr r, mpz_ptr b, mpz_ptr x,
+  mpz_ptr m)
+{
+/* Put B^X mod M in R as mpz_powm does, for a nonzero M, but with an
+   error rather than mpz_powm's division by zero when X is negative and
+   B has no inverse mod M. R may be B.  */
+  mpz_t t;
+  int inv = 1;
+
+  if (mpz_sgn (x) < 0)
+    {
+      mpz_init (t);
+      inv = mpz_invert (t, b, m);
+      mpz_clear (t);
+    }
+  if (inv == 0)
+    {
+      pec->szError = "no inverse for negative exponent";
+      pec->iError=1;
+      mpz_set_ui (r, 0);
+      return;
+    }
+  mpz_powm (r, b, x, m);
+  return;
+}
+/**********************************************************************/
+static void mpz_apply_op (EXPRCTX *pec, enum op_t op, mpz_ptr r,
+  mpz_ptr lhs, mpz_ptr rhs)
+{
+/* Apply the operation OP to the values LHS and RHS, or to LHS alone for
+   the operations of one operand, which may use RHS as scratch, and put
+   the result in R. R may be LHS, and both LHS and RHS may be changed.
+   This is the arithmetic of mpz_eval_expr (other than LIT, MOD and the
+   REM of a POW), shared with the compiled programs of iExprProgEvalMPZ.
+   The large results of #, !, fib and ^ are looked up in, and kept in,
+   the cache of the context.  */
+
+  EXPRCACHE *pc, *pcOld;
+  unsigned long bits;
+  int i;
+
+  if (op != POW && op != FAC && op != PRIMORIAL && op != FIBONACCI)
+    {
+      mpz_compute_op (pec, op, r, lhs, rhs);
+      return;
+    }
+  bits = ulExprOpBits (op, lhs, rhs);
+  if (bits < EXPR_CACHE_MIN_BITS || bits > EXPR_CACHE_MAX_BITS)
+    {
+      mpz_compute_op (pec, op, r, lhs, rhs);
+      return;
+    }
+
+  pcOld = pec->aec;
+  for (i = 0; i < EXPR_CACHE_SIZE; i++)
+    {
+      pc = pec->aec + i;
+      if (pc->iOp == op && mpz_cmp (pc->mpzLhs, lhs) == 0
+	  && (op != POW || mpz_cmp (pc->mpzRhs, rhs) == 0))
+	{
+	  pc->ulUsed = ++pec->ulTime;
+	  mpz_set (r, pc->mpzVal);
+	  return;
+	}
+      if (pc->ulUsed < pcOld->ulUsed)
+	pcOld = pc;
+    }
+
+  /* Replace the least recently used entry; the operands are copied
+     first, as R may be LHS.  */
+  pc = pcOld;
+  pc->iOp = NOP;
+  mpz_set (pc->mpzLhs, lhs);
+  if (op == POW)
+    mpz_set (pc->mpzRhs, rhs);
+  mpz_compute_op (pec, op, r, lhs, rhs);
+  if (pec->iError)
+    return;
+  pc->iOp = op;
+  pc->ulUsed = ++pec->ulTime;
+  mpz_set (pc->mpzVal, r);
+  return;
+}
+/**********************************************************************/
+static unsigned long ulExprOpBits (enum op_t op, mpz_ptr lhs, mpz_ptr rhs)
+{
+/* A rough size in bits of the result of #, !, fib or ^ on LHS and RHS,
+   or 0 where the operation would fail or is trivial. The size of n# is
+   taken as 32n bits, not n / log(2), as its nextprime loop costs far
+   more than a product of that size.  */
+
+  unsigned long n, b;
+
+  if (op == POW)
+    {
+      if (mpz_sgn (rhs) <= 0 || mpz_size (rhs) > 1 || mpz_cmpabs_ui (lhs, 1) <= 0)
+	return 0;
+      n = mpz_get_ui (rhs);
+      b = mpz_sizeinbase (lhs, 2);
+      return n > ~0UL / b ? ~0UL : n * b;
+    }
+  if (mpz_sgn (lhs) <= 0 || mpz_size (lhs) > 1)
+    return 0;
+  n = mpz_get_ui (lhs);
+  switch (op)
+    {
+    case FAC:        /* n log2(n) */
+      b = mpz_sizeinbase (lhs, 2);
+      return n > ~0UL / b ? ~0UL : n * b;
+    case PRIMORIAL:
+      return n > ~0UL / 32 ? ~0UL : 32 * n;
+    default:         /* FIBONACCI, n log2(golden ratio) */
+      return n / 10 * 7;
+    }
+}
+/**********************************************************************/
+static void mpz_compute_op (EXPRCTX *pec, enum op_t op, mpz_ptr r,
+  mpz_ptr lhs, mpz_ptr rhs)
+{
+/* mpz_apply_op without the cache.  */
+
+  switch (op)
+    {
+    case PLUS:
+      mpz_add (r, lhs, rhs);
+      return;
+    case MINUS:
+      mpz_sub (r, lhs, rhs);
+      return;
+    case MULT:
+      mpz_mul (r, lhs, rhs);
+      return;
+    case DIV:
+      if (mpz_sgn (rhs) == 0)
+	{
+	  pec->szError = "division by zero";
+	  pec->iError=1;
+	  mpz_set_ui (r, 0);
+	}
+      else
+	mpz_fdiv_q (r, lhs, rhs);
+      return;
+    case REM:
+      if (mpz_sgn (rhs) == 0)
+	{
+	  pec->szError = "division by zero";
+	  pec->iError=1;
+	  mpz_set_ui (r, 0);
+	}
+      else
+	mpz_fdiv_r (r, lhs, rhs);
+      return;
 #if __GNU_MP_VERSION >= 2
     case INVMOD:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
-      mpz_invert (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
+      if (mpz_sgn (rhs) == 0)
+	{
+	  pec->szError = "division by zero";
+	  pec->iError=1;
+	  mpz_set_ui (r, 0);
+	}
+      else if (mpz_invert (r, lhs, rhs) == 0)
+	/* no inverse; r would be undefined */
+	mpz_set_ui (r, 0);
       return;
 #endif
     case POW:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
       if (mpz_cmp_si (rhs, 0L) == 0)
 	/* x^0 is 1 */
 	mpz_set_ui (r, 1L);
@@ -4567,69 +7059,42 @@ static void mpz_eval_expr(mpz_ptr r, expr_t e)
 	  else
 	    mpz_pow_ui (r, lhs, y);
 	}
-      mpz_clear (lhs); mpz_clear (rhs);
       return;
     pow_err:
-      error = "result of `pow' operator too large";
-      mpz_clear (lhs); mpz_clear (rhs);
-      iGlobalError=1;
+      pec->szError = "result of `pow' operator too large";
+      pec->iError=1;
       mpz_set_ui(r,1);
       return;
     case GCD:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
       mpz_gcd (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
       return;
 #if __GNU_MP_VERSION > 2 || __GNU_MP_VERSION_MINOR >= 1
     case LCM:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
       mpz_lcm (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
       return;
 #endif
     case AND:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
       mpz_and (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
       return;
     case IOR:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
       mpz_ior (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
       return;
 #if __GNU_MP_VERSION > 2 || __GNU_MP_VERSION_MINOR >= 1
     case XOR:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
       mpz_xor (r, lhs, rhs);
-      mpz_clear (lhs); mpz_clear (rhs);
       return;
 #endif
     case NEG:
-      mpz_eval_expr (r, e->operands.ops.lhs);
-      mpz_neg (r, r);
+      mpz_neg (r, lhs);
       return;
     case NOT:
-      mpz_eval_expr (r, e->operands.ops.lhs);
-      mpz_com (r, r);
+      mpz_com (r, lhs);
       return;
     case SQRT:
-      mpz_init (lhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
       if (mpz_sgn (lhs) < 0)
 	{
-	  error = "cannot take square root of negative numbers";
-	  mpz_clear (lhs);
-	  iGlobalError=1;
+	  pec->szError = "cannot take square root of negative numbers";
+	  pec->iError=1;
           mpz_set_ui(r,1);
           return;
 	}
@@ -4637,22 +7102,17 @@ static void mpz_eval_expr(mpz_ptr r, expr_t e)
       return;
 #if __GNU_MP_VERSION > 2 || __GNU_MP_VERSION_MINOR >= 1
     case ROOT:
-      mpz_init (lhs); mpz_init (rhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
-      mpz_eval_expr (rhs, e->operands.ops.rhs);
       if (mpz_sgn (rhs) <= 0)
 	{
-	  error = "cannot take non-positive root orders";
-	  mpz_clear (lhs); mpz_clear (rhs);
-	  iGlobalError=1;
+	  pec->szError = "cannot take non-positive root orders";
+	  pec->iError=1;
           mpz_set_ui(r,1);
           return;
 	}
       if (mpz_sgn (lhs) < 0 && (mpz_get_ui (rhs) & 1) == 0)
 	{
-	  error = "cannot take even root orders of negative numbers";
-	  mpz_clear (lhs); mpz_clear (rhs);
-	  iGlobalError=1;
+	  pec->szError = "cannot take even root orders of negative numbers";
+	  pec->iError=1;
           mpz_set_ui(r,1);
           return;
 	}
@@ -4668,156 +7128,129 @@ static void mpz_eval_expr(mpz_ptr r, expr_t e)
 	  }
 	mpz_root (r, lhs, nth);
       }
-      mpz_clear (lhs); mpz_clear (rhs);
       return;
 #endif
     case FAC:
-      mpz_eval_expr (r, e->operands.ops.lhs);
-      if (mpz_size (r) > 1)
+      if (mpz_size (lhs) > 1)
 	{
-	  error = "result of `!' operator too large";
-	  iGlobalError=1;
+	  pec->szError = "result of `!' operator too large";
+	  pec->iError=1;
           mpz_set_ui(r,1);
           return;
 	}
-      mpz_fac_ui (r, mpz_get_ui (r));
+      mpz_fac_ui (r, mpz_get_ui (lhs));
       return;
     case PRIMORIAL:
-      mpz_eval_expr (r, e->operands.ops.lhs);
-      if (mpz_size (r) > 1)
+      if (mpz_size (lhs) > 1)
 	{
-	  error = "result of `#' operator too large";
-	  iGlobalError=1;
+	  pec->szError = "result of `#' operator too large";
+	  pec->iError=1;
           mpz_set_ui(r,1);
           return;
 	}
       { unsigned long ulArg;
-        ulArg=mpz_get_ui(r);
+        ulArg=mpz_get_ui(lhs);
         if(ulArg < 2){mpz_set_ui(r,1);return;}
         mpz_set_ui(r,2);
         if(ulArg < 3)return;
-        mpz_init(lhs); mpz_init(rhs);
         mpz_set_ui(rhs, 2);
         while(1)
           {
-          mpz_nextprime(lhs,rhs); /* rhs=prev_prime, lhs=next_prime */
-          if(mpz_cmp_ui(lhs,ulArg) > 0)break;
-          mpz_mul(r,lhs,r);
-          mpz_set(rhs,lhs);
+          mpz_nextprime(rhs,rhs); /* rhs=next_prime */
+          if(mpz_cmp_ui(rhs,ulArg) > 0)break;
+          mpz_mul(r,rhs,r);
           }
-        mpz_clear(lhs);mpz_clear(rhs);
       }
       return;
 #if __GNU_MP_VERSION >= 2
     case POPCNT:
-      mpz_eval_expr (r, e->operands.ops.lhs);
       { long int cnt;
-	cnt = mpz_popcount (r);
+	cnt = mpz_popcount (lhs);
 	mpz_set_si (r, cnt);
       }
       return;
     case HAMDIST:
       { long int cnt;
-        mpz_init (lhs); mpz_init (rhs);
-	mpz_eval_expr (lhs, e->operands.ops.lhs);
-	mpz_eval_expr (rhs, e->operands.ops.rhs);
 	cnt = mpz_hamdist (lhs, rhs);
-	mpz_clear (lhs); mpz_clear (rhs);
 	mpz_set_si (r, cnt);
       }
       return;
 #endif
     case LOG2:
-      mpz_eval_expr (r, e->operands.ops.lhs);
       { unsigned long int cnt;
-	if (mpz_sgn (r) <= 0)
+	if (mpz_sgn (lhs) <= 0)
 	  {
-	    error = "logarithm of non-positive number";
-            iGlobalError=1;
+	    pec->szError = "logarithm of non-positive number";
+            pec->iError=1;
             mpz_set_ui(r,1);
             return;
 	  }
-	cnt = mpz_sizeinbase (r, 2);
+	cnt = mpz_sizeinbase (lhs, 2);
 	mpz_set_ui (r, cnt - 1);
       }
       return;
     case LOG:
       { unsigned long int cnt;
-	mpz_init (lhs); mpz_init (rhs);
-	mpz_eval_expr (lhs, e->operands.ops.lhs);
-	mpz_eval_expr (rhs, e->operands.ops.rhs);
 	if (mpz_sgn (lhs) <= 0)
 	  {
-	    error = "logarithm of non-positive number";
-	    mpz_clear (lhs); mpz_clear (rhs);
-            iGlobalError=1;
+	    pec->szError = "logarithm of non-positive number";
+            pec->iError=1;
             mpz_set_ui(r,1);
             return;
 	  }
 	if (mpz_cmp_ui (rhs, 256) >= 0)
 	  {
-	    error = "logarithm base too large";
-	    mpz_clear (lhs); mpz_clear (rhs);
-            iGlobalError=1;
+	    pec->szError = "logarithm base too large";
+            pec->iError=1;
             mpz_set_ui(r,1);
             return;
 	  }
 	cnt = mpz_sizeinbase (lhs, mpz_get_ui (rhs));
 	mpz_set_ui (r, cnt - 1);
-	mpz_clear (lhs); mpz_clear (rhs);
       }
       return;
     case FERMAT:
       {
 	unsigned long int t;
-	mpz_init (lhs);
-	mpz_eval_expr (lhs, e->operands.ops.lhs);
 	t = (unsigned long int) 1 << mpz_get_ui (lhs);
 	if (mpz_cmp_ui (lhs, ~(unsigned long int) 0) > 0 || t == 0)
 	  {
-	    error = "too large Mersenne number index";
-	    mpz_clear (lhs);
-            iGlobalError=1;
+	    pec->szError = "too large Mersenne number index";
+            pec->iError=1;
             mpz_set_ui(r,1);
             return;
 	  }
 	mpz_set_ui (r, 1);
 	mpz_mul_2exp (r, r, t);
 	mpz_add_ui (r, r, 1);
-	mpz_clear (lhs);
       }
       return;
     case MERSENNE:
-      mpz_init (lhs);
-      mpz_eval_expr (lhs, e->operands.ops.lhs);
       if (mpz_cmp_ui (lhs, ~(unsigned long int) 0) > 0)
 	{
-	  error = "too large Mersenne number index";
-	  mpz_clear (lhs);
-          iGlobalError=1;
+	  pec->szError = "too large Mersenne number index";
+          pec->iError=1;
           mpz_set_ui(r,1);
           return;
 	}
-      mpz_set_ui (r, 1);
-      mpz_mul_2exp (r, r, mpz_get_ui (lhs));
-      mpz_sub_ui (r, r, 1);
-      mpz_clear (lhs);
+      { unsigned long int n;
+	n = mpz_get_ui (lhs);
+	mpz_set_ui (r, 1);
+	mpz_mul_2exp (r, r, n);
+	mpz_sub_ui (r, r, 1);
+      }
       return;
     case FIBONACCI:
       { mpz_t t;
 	unsigned long int n, i;
-	mpz_init (lhs);
-	mpz_eval_expr (lhs, e->operands.ops.lhs);
 	if (mpz_sgn (lhs) <= 0 || mpz_cmp_si (lhs, 1000000000) > 0)
 	  {
-	    error = "Fibonacci index out of range";
-	    mpz_clear (lhs);
-            iGlobalError=1;
+	    pec->szError = "Fibonacci index out of range";
+            pec->iError=1;
             mpz_set_ui(r,1);
             return;
 	  }
 	n = mpz_get_ui (lhs);
-	mpz_clear (lhs);
 
 #if __GNU_MP_VERSION > 2 || __GNU_MP_VERSION_MINOR >= 1
 	mpz_fib_ui (r, n);
@@ -4842,33 +7275,26 @@ static void mpz_eval_expr(mpz_ptr r, expr_t e)
     case RANDOM:
       {
 	unsigned long int n;
-	mpz_init (lhs);
-	mpz_eval_expr (lhs, e->operands.ops.lhs);
 	if (mpz_sgn (lhs) <= 0 || mpz_cmp_si (lhs, 1000000000) > 0)
 	  {
-	    error = "random number size out of range";
-	    mpz_clear (lhs);
-            iGlobalError=1;
+	    pec->szError = "random number size out of range";
+            pec->iError=1;
             mpz_set_ui(r,1);
             return;
 	  }
 	n = mpz_get_ui (lhs);
-	mpz_clear (lhs);
-	mpz_urandomb (r, rstate, n);
+	mpz_urandomb (r, pec->rstate, n);
       }
       return;
     case NEXTPRIME:
-      {
-	mpz_eval_expr (r, e->operands.ops.lhs);
-	mpz_nextprime (r, r);
-      }
+      mpz_nextprime (r, lhs);
       return;
     default:
       abort ();
     }
 }
 /**********************************************************************/
-static void mpz_eval_mod_expr (mpz_ptr r, expr_t e, mpz_ptr mod)
+static void mpz_eval_mod_expr (EXPRCTX *pec, mpz_ptr r, expr_t e, mpz_ptr mod)
 {
 /* Evaluate the expression E modulo MOD and put the result in R.  */
   mpz_t lhs, rhs;
@@ -4877,15 +7303,15 @@ static void mpz_eval_mod_expr (mpz_ptr r, expr_t e, mpz_ptr mod)
     {
       case POW:
 	mpz_init (lhs); mpz_init (rhs);
-	mpz_eval_mod_expr (lhs, e->operands.ops.lhs, mod);
-	mpz_eval_expr (rhs, e->operands.ops.rhs);
-	mpz_powm (r, lhs, rhs, mod);
+	mpz_eval_mod_expr (pec, lhs, e->operands.ops.lhs, mod);
+	mpz_eval_expr (pec, rhs, e->operands.ops.rhs);
+	mpz_powm_inv (pec, r, lhs, rhs, mod);
 	mpz_clear (lhs); mpz_clear (rhs);
 	return;
       case PLUS:
 	mpz_init (lhs); mpz_init (rhs);
-	mpz_eval_mod_expr (lhs, e->operands.ops.lhs, mod);
-	mpz_eval_mod_expr (rhs, e->operands.ops.rhs, mod);
+	mpz_eval_mod_expr (pec, lhs, e->operands.ops.lhs, mod);
+	mpz_eval_mod_expr (pec, rhs, e->operands.ops.rhs, mod);
 	mpz_add (r, lhs, rhs);
 	if (mpz_cmp_si (r, 0L) < 0)
 	  mpz_add (r, r, mod);
@@ -4895,8 +7321,8 @@ static void mpz_eval_mod_expr (mpz_ptr r, expr_t e, mpz_ptr mod)
 	return;
       case MINUS:
 	mpz_init (lhs); mpz_init (rhs);
-	mpz_eval_mod_expr (lhs, e->operands.ops.lhs, mod);
-	mpz_eval_mod_expr (rhs, e->operands.ops.rhs, mod);
+	mpz_eval_mod_expr (pec, lhs, e->operands.ops.lhs, mod);
+	mpz_eval_mod_expr (pec, rhs, e->operands.ops.rhs, mod);
 	mpz_sub (r, lhs, rhs);
 	if (mpz_cmp_si (r, 0L) < 0)
 	  mpz_add (r, r, mod);
@@ -4906,15 +7332,15 @@ static void mpz_eval_mod_expr (mpz_ptr r, expr_t e, mpz_ptr mod)
 	return;
       case MULT:
 	mpz_init (lhs); mpz_init (rhs);
-	mpz_eval_mod_expr (lhs, e->operands.ops.lhs, mod);
-	mpz_eval_mod_expr (rhs, e->operands.ops.rhs, mod);
+	mpz_eval_mod_expr (pec, lhs, e->operands.ops.lhs, mod);
+	mpz_eval_mod_expr (pec, rhs, e->operands.ops.rhs, mod);
 	mpz_mul (r, lhs, rhs);
 	mpz_mod (r, r, mod);
 	mpz_clear (lhs); mpz_clear (rhs);
 	return;
       default:
 	mpz_init (lhs);
-	mpz_eval_expr (lhs, e);
+	mpz_eval_expr (pec, lhs, e);
 	mpz_mod (r, lhs, mod);
 	mpz_clear (lhs);
 	return;
@@ -577,12 +577,67 @@ void                __mpf_set_ld2(mpf_t mpf, long double ld);
 /* Prime number generation and testing using GMP */
 
 int     iPrP(mpz_t mpzN, unsigned long ulNMR, unsigned long ulMaxDivisor);
+void    vPrPBatch(mpz_t *mpzN, int *iPrime, unsigned long nN,
+	  unsigned long ulMaxDivisor, unsigned int nThreads);
+void    vNextPrime(mpz_t mpzP, mpz_t mpzN, unsigned int nThreads);
 int     iIsPrime64(uint64_t ullN, unsigned long ulMaxDivisor);
 unsigned long ulPrmDiv(mpz_t mpzN, unsigned long ulMaxDivisor);
 int     iMillerRabin(mpz_t mpzN, unsigned long ulB);
 int     iLucasSelfridge(mpz_t mpzN);
 int     iStrongLucasSelfridge(mpz_t mpzN);
 int     iExtraStrongLucas(mpz_t mpzN, long lB);
+
+/* Montgomery arithmetic modulo an odd N at the mpn level, and the
+   Lucas-Selfridge tests built on it (see vMontInit, iLucasMont, and
+   the V-only ladder iLucasV). */
+
+typedef struct
+  {
+  mp_size_t  n;       /* limbs of N */
+  mp_limb_t *pN;      /* N */
+  mp_limb_t *pNinv;   /* -1/N mod R, for large n */
+  mp_limb_t  lInv;    /* -1/N mod 2^GMP_NUMB_BITS */
+  mp_limb_t *pT;      /* scratch */
+  mpz_t      mpzN;
+  mpz_t      mpzT;    /* scratch for conversions */
+  } MONTCTX;
+
+void    vMontInit(MONTCTX *pmc, mpz_t mpzN);
+void    vMontClear(MONTCTX *pmc);
+void    vMontSet(MONTCTX *pmc, mp_limb_t *pR, mpz_t mpzA);
+void    vMontGet(MONTCTX *pmc, mpz_t mpzR, mp_limb_t *pA);
+void    vMontMul(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA, mp_limb_t *pB);
+void    vMontAdd(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA, mp_limb_t *pB);
+void    vMontSub(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA, mp_limb_t *pB);
+void    vMontHalf(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA);
+void    vMontMulSmall(MONTCTX *pmc, mp_limb_t *pR, mp_limb_t *pA, long l);
+int     iMontIsZero(MONTCTX *pmc, mp_limb_t *pA);
+int     iLucasMont(mpz_t mpzN, int iStrong);
+int     iLucasV(mpz_t mpzN, int iStrong);
+
+/* A candidate prepared for a series of probable prime tests, so that
+   N - 1 = d*2^s, Selfridge's parameters, trial division, and the
+   Montgomery context are computed once (see iPrPCandInit). */
+
+typedef struct
+  {
+  mpz_t   mpzN;
+  mpz_t   mpzNm1;         /* N - 1 */
+  mpz_t   mpzd;           /* odd d with N - 1 = d*2^s */
+  mpz_t   mpzT;           /* scratch */
+  unsigned long ulS;
+  unsigned long ulDiv;    /* ulPrmDiv(N, ulMaxDivisor) */
+  long    lD, lP, lQ;     /* Selfridge's D, P=1, Q; D=0 if not needed */
+  int     iLucas;         /* result of the Lucas tests when D=0 */
+  int     iStatus;        /* 0 or 1 if settled by trial division, else -1 */
+  int     iMont;          /* mc is set up (N odd and > 2) */
+  MONTCTX mc;
+  } PRPCAND;
+
+int     iPrPCandInit(PRPCAND *ppc, mpz_t mpzN, unsigned long ulMaxDivisor);
+void    vPrPCandClear(PRPCAND *ppc);
+int     iMillerRabinCand(PRPCAND *ppc, unsigned long ulB);
+int     iLucasCand(PRPCAND *ppc, int iStrong);
 int64_t sllLML(uint64_t ullx);  /* pi(x) using LML algorithm; see lml.c */
 
 /* Expression parser for mpz bigints. iEvalExpr and iParseMPZ are
@@ -592,6 +647,73 @@ int     iEvalExprMPZ(mpz_t mpzResult, char *szExpression);
 #define iEvalExpr iEvalExprMPZ
 #define iParseMPZ iEvalExprMPZ
 
+/* Context for iEvalExprMPZCtx, which is reentrant: each thread parses
+   and evaluates with a context of its own. The context also keeps the
+   last few large results of #, !, fib and ^, which are often repeated
+   from one expression to the next (p#/d - k for a range of k). */
+
+#define EXPR_CACHE_SIZE     16
+#define EXPR_CACHE_MIN_BITS 4096      /* smaller results are not kept */
+#define EXPR_CACHE_MAX_BITS 4194304   /* nor are larger ones */
+
+typedef struct
+  {
+  int     iOp;              /* the operation, or 0 if the entry is free */
+  mpz_t   mpzLhs, mpzRhs;   /* its operands (mpzRhs for ^ only) */
+  mpz_t   mpzVal;           /* and result */
+  unsigned long ulUsed;     /* the time of the last use */
+  } EXPRCACHE;
+
+typedef struct
+  {
+  gmp_randstate_t rstate;   /* for random(n), seeded once */
+  const char *szError;      /* message for the last failure, or NULL */
+  int     iError;
+  char  **pszVar;           /* the variable names while compiling */
+  int     nVar;
+  EXPRCACHE aec[EXPR_CACHE_SIZE];  /* least recently used replaced */
+  unsigned long ulTime;
+  } EXPRCTX;
+
+void    vExprCtxInit(EXPRCTX *pec, unsigned long ulSeed);
+void    vExprCtxClear(EXPRCTX *pec);
+int     iEvalExprMPZCtx(EXPRCTX *pec, mpz_t mpzResult, char *szExpression);
+
+/* An expression compiled once by iExprProgCompile to a program for a
+   stack of registers (reverse Polish notation), to be evaluated by
+   iExprProgEvalMPZ for any number of values of its variables, which
+   are set in mpzVar[] in the order they were named to the compiler.
+   The evaluation allocates no memory (beyond the growth of the
+   registers on the first few calls). The compiler evaluates the
+   constant parts of the expression once, and the parts that occur
+   more than once are evaluated once per call and kept in mpzSav[]. */
+
+typedef struct
+  {
+  int     iOp;      /* the operation */
+  int     iDst;     /* the register of its result and first operand */
+  int     iArg;     /* the constant, variable or modulus register */
+  } EXPRINS;
+
+typedef struct
+  {
+  EXPRINS *pei;
+  int     nIns;
+  mpz_t  *mpzReg;   /* the registers */
+  int     nReg;
+  mpz_t  *mpzLit;   /* the constants */
+  int     nLit;
+  mpz_t  *mpzVar;   /* the variables, set by the caller */
+  int     nVar;
+  mpz_t  *mpzSav;   /* the common subexpressions */
+  int     nSav;
+  } EXPRPROG;
+
+int     iExprProgCompile(EXPRCTX *pec, EXPRPROG *pep, char *szExpression,
+          char *szVars);
+int     iExprProgEvalMPZ(EXPRCTX *pec, EXPRPROG *pep, mpz_t mpzResult);
+void    vExprProgClear(EXPRPROG *pep);
+
 #endif /* __MPIR__ */
 
 /**********************************************************************/
@@ -609,6 +731,18 @@ void        vGapCont(char *szContRec, char *szGapRec);
 
 /* Prime number generation and testing without GMP */
 
+/* Compiled-in table of the primes < 65538 (see prm16.h), with the
+   inverse of each odd prime mod 2^64 and the bound (2^64 - 1)/p.
+   __DIVISIBLE16(x, i) is nonzero iff the unsigned 64-bit value x is
+   divisible by ulPrime16[i], for 2 <= i <= 6543. */
+
+extern unsigned long ulPrime16[];
+extern uint64_t      ullPrime16Inv[];
+extern uint64_t      ullPrime16Lim[];
+
+#define __DIVISIBLE16(x, i) \
+  ((uint64_t)(x)*ullPrime16Inv[i] <= ullPrime16Lim[i])
+
 void    vGenPrimesDiv(unsigned long *ulPrime, unsigned long *nPrimes,
 	  unsigned long *ulUB);
 #define vGenPrimes vGenPrimesDiv
@@ -618,6 +752,74 @@ void    vGenPrimesSieve(unsigned long *ulPrime, unsigned long *nPrimes,
 void    vSieve(unsigned char *uchSieve, unsigned long *ulLB,
 	  unsigned long *ulUB, unsigned long *ulPrime);
 int     iIsPrime32(unsigned long ulN);
+#ifdef __SIZEOF_INT128__
+int     iMillerRabin64(uint64_t ullN, uint64_t ullB);
+int     iStrongLucas64(uint64_t ullN);
+#endif
+
+/* Segmented, bit-packed, mod-30 wheel sieve with 64-bit bounds. A
+   SEGSIEVE walks ullLB..ullUB one cache-sized segment at a time; after
+   each successful iSegSieveNext, bit i of uchSeg[b] (b < ulBytes) is
+   set iff 30*(ullByte + b) + {1,7,11,13,17,19,23,29}[i] is prime.
+   The primes 2, 3, and 5 are not represented. */
+
+typedef struct
+  {
+  uint64_t       ullOff;  /* byte of next multiple, relative to segment */
+  uint32_t       ulQ;     /* p/30 */
+  unsigned char  uchP;    /* wheel index of p mod 30 */
+  unsigned char  uchK;    /* wheel index of the next multiplier mod 30 */
+  } SIEVEPRIME;
+
+typedef struct
+  {
+  uint64_t       ullLB, ullUB;  /* integers sieved, inclusive */
+  uint64_t       ullByte;       /* wheel byte of uchSeg[0] */
+  uint64_t       ullLastByte;   /* wheel byte containing ullUB */
+  unsigned long  ulSegBytes;    /* allocated size of uchSeg */
+  unsigned long  ulBytes;       /* valid bytes in the current segment */
+  unsigned char *uchSeg;
+  unsigned char *uchPre;        /* presieve pattern for 7, 11, 13, 17 */
+  unsigned long  nSP, nSPAlloc;
+  SIEVEPRIME    *pSP;           /* sieving primes 19..sqrt(ullUB) */
+  int            iStarted;
+  } SEGSIEVE;
+
+void     vSegSieveInit(SEGSIEVE *pss, uint64_t ullLB, uint64_t ullUB,
+	   unsigned long ulSegBytes);
+int      iSegSieveNext(SEGSIEVE *pss);
+void     vSegSieveClear(SEGSIEVE *pss);
+uint64_t ullPrimeCount(uint64_t ullLB, uint64_t ullUB);
+
+/* Streaming access to the primes of an interval, in increasing order
+   and in constant memory, without a preallocated ulPrime array:
+
+     vPrimeIterInit(&pi, ullLB, ullUB);
+     while((ullP=ullPrimeIterNext(&pi)))...;
+     vPrimeIterClear(&pi);
+*/
+
+typedef struct
+  {
+  SEGSIEVE       ss;          /* current window */
+  uint64_t       ullNext;     /* start of the next window */
+  uint64_t       ullUB;
+  unsigned long  ulByte;      /* current byte of ss.uchSeg */
+  unsigned char  uchBits;     /* its bits not yet returned */
+  int            iActive;     /* ss is initialized */
+  int            iDone;       /* the current window is the last */
+  } PRIMEITER;
+
+void     vPrimeIterInit(PRIMEITER *ppi, uint64_t ullLB, uint64_t ullUB);
+uint64_t ullPrimeIterNext(PRIMEITER *ppi);
+void     vPrimeIterClear(PRIMEITER *ppi);
+
+/* Multi-threaded versions; nThreads=0 uses all available cores. */
+
+uint64_t ullPrimeCountMT(uint64_t ullLB, uint64_t ullUB,
+	   unsigned int nThreads);
+void     vGenPrimesSieveMT(unsigned long *ulPrime, unsigned long *nPrimes,
+	   unsigned long *ulUB, unsigned int nThreads);
 
 /* Functions returning (for x >= 2) Li(x); the Hardy-Littlewood integral
    approximations for the counts of twin primes, triplets, and
@@ -22,6 +22,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #ifdef USE_MPIR
 #include "mpir.h"
 #else
@@ -82,6 +83,95 @@ void wagstaff(int q)
 	  return;
 }
 
+/* The same test at the mpn level, with the buffers allocated once and
+ * each squaring reduced mod n = 2^q + 1 directly: if T = H * 2^q + L
+ * with L < 2^q, then T = L - H mod n. Residues lie in [0, 2^q] and so
+ * take BITS_TO_LIMBS(q + 1) limbs. Returns 1 if S(q) == S(2) mod n.
+ */
+
+#define BITS_TO_LIMBS(x)	(((x)+GMP_NUMB_BITS-1)/GMP_NUMB_BITS)
+
+/* rp += 2^q + 1, where this wraps a negative rp back into [0, 2^q] */
+static void add_2expp1(mp_ptr rp, unsigned long q, mp_size_t n)
+{
+	mp_size_t k = q / GMP_NUMB_BITS;
+
+	mpn_add_1(rp, rp, n, 1);
+	mpn_add_1(rp + k, rp + k, n - k, (mp_limb_t)1 << (q % GMP_NUMB_BITS));
+}
+
+/* rp = xp^2 mod 2^q + 1, where tp has room for 4 * n limbs */
+static void sqrmod_2expp1(mp_ptr rp, mp_srcptr xp, unsigned long q,
+		mp_size_t n, mp_ptr tp)
+{
+	mp_size_t i, k = q / GMP_NUMB_BITS;
+	unsigned long b = q % GMP_NUMB_BITS;
+	mp_ptr hp = tp + 2 * n;
+
+	mpn_sqr(tp, xp, n);
+	if(b)
+		mpn_rshift(hp, tp + k, 2 * n - k, b);
+	else
+		for(i = 0; i < 2 * n - k; i++)
+			hp[i] = tp[k + i];
+	if(b)
+		tp[k++] &= ((mp_limb_t)1 << b) - 1;
+	for(i = k; i < n; i++)
+		tp[i] = 0;
+	if(mpn_sub_n(rp, tp, hp, n))
+		add_2expp1(rp, q, n);
+}
+
+int wagstaff_mpn(int q)
+{
+	  mp_size_t n;
+	  mp_ptr xp, tp;
+	  int i, r;
+	  mpz_t res, N;
+
+	  n = BITS_TO_LIMBS(q + 1);
+	  xp = malloc(5 * n * sizeof(mp_limb_t));
+	  if(xp == 0)
+	  {
+		fprintf(stderr, "wagstaff_mpn: out of memory\n");
+		exit(EXIT_FAILURE);
+	  }
+	  tp = xp + n;
+
+	  for(i = 0; i < n; i++)
+		xp[i] = 0;
+	  xp[0] = 6;
+	  for(i = 1; i <= q; i++)
+	  {
+	      sqrmod_2expp1(xp, xp, q, n, tp);
+	      if(mpn_sub_1(xp, xp, n, 2))
+			add_2expp1(xp, q, n);
+	  }
+
+	  mpz_init(res);
+	  mpz_init(N);
+	  mpz_import(res, n, -1, sizeof(mp_limb_t), 0, 0, xp);
+	  mpz_set_ui(N, 1);
+	  mpz_mul_2exp(N, N, q);
+	  mpz_add_ui(N, N, 1);
+	  mpz_sub_ui(res, res, 1154);
+	  mpz_mul_ui(res, res, 3);
+	  mpz_mod(res, res, N);
+	  r = mpz_sgn(res) == 0;
+
+	  #ifdef DEBUG
+	  if(r)
+		printf("S(q)==S(2) mod n\n");
+	  else
+		printf("S(q)!==S(2) mod n\n");
+	  #endif
+
+	  mpz_clear(res);
+	  mpz_clear(N);
+	  free(xp);
+	  return r;
+}
+
 #if 0
 
 int main(int argc, char *argv[])